@@ -34,6 +34,15 @@ namespace Accessibility
 class Accessible;
 class ProxyAccessible;
 
+/**
+ * @brief Signals the bridge dropped because they repeated the last emitted value.
+ */
+struct SuppressedSignalStats
+{
+  uint64_t stateChanged{0};    ///< StateChanged with the state's last emitted value
+  uint64_t propertyChanged{0}; ///< PropertyChange of a name or description that did not change
+};
+
 /**
  * @brief Base class for different accessibility bridges.
  *
@@ -146,6 +155,23 @@ struct ACCESSIBILITY_API Bridge
    */
   virtual void UnregisterDefaultLabel(Accessible* accessible) = 0;
 
+  /**
+   * @brief Notifies that the relation set of the accessible object has changed.
+   *
+   * Calling this opts the toolkit in to relation caching: from the first
+   * call on, the bridge keeps the relation sets of objects registered with
+   * AddAccessible() for navigation and reading material, so the toolkit
+   * must then call this whenever relations of such an object are added,
+   * removed or retargeted. Until then relation sets are read on every
+   * lookup. Replacing or removing an object drops its cached set and the
+   * sets that target it. Pass nullptr to opt in without naming an object.
+   *
+   * @param[in] accessible The accessible object whose relations changed, or nullptr
+   */
+  virtual void RelationsChanged(Accessible* accessible)
+  {
+  }
+
   /**
    * @brief Gets the top-most object from the stack of "default label" sourcing objects.
    *
@@ -376,6 +402,15 @@ struct ACCESSIBILITY_API Bridge
    **/
   virtual void Emit(std::shared_ptr<Accessible> obj, ObjectPropertyChangeEvent event) = 0;
 
+  /**
+   * @brief Gets the number of state and property signals dropped as no-ops.
+   *
+   * The bridge remembers the last emitted value of each state and the last
+   * emitted name and description of an object; EmitStateChanged() and
+   * Emit() calls that repeat them are not sent.
+   */
+  virtual SuppressedSignalStats GetSuppressedSignalStats() const = 0;
+
   /**
    * @brief Emits bounds-changed event on at-spi bus.
    *
@@ -21,12 +21,175 @@
 // EXTERNAL INCLUDES
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 // INTERNAL INCLUDES
 #include <accessibility/api/accessibility.h>
 
 namespace Accessibility
 {
+/**
+ * @brief Interned event detail string.
+ *
+ * AT-SPI event details come from a small vocabulary (state names, property
+ * names, text change kinds, window events). Well-known details are mapped to
+ * an Id once, when the event is constructed, so handlers compare integers
+ * instead of strings. Any other text (e.g. a window title) is kept verbatim
+ * with Id::CUSTOM.
+ *
+ * Usage:
+ * @code
+ *   event.detail = "highlighted";                    // interned to Id::HIGHLIGHTED
+ *   if(event.detail == EventDetail::HIGHLIGHTED) {}  // integer comparison
+ * @endcode
+ */
+class EventDetail
+{
+public:
+  /**
+   * @brief Well-known detail atoms.
+   *
+   * The order must match the string table in accessibility-event.cpp.
+   */
+  enum Id : uint16_t
+  {
+    NONE = 0,
+
+    // StateChanged (State names as emitted by BridgeObject::EmitStateChanged)
+    ACTIVE,
+    ARMED,
+    BUSY,
+    CHECKED,
+    COLLAPSED,
+    DEFUNCT,
+    EDITABLE,
+    ENABLED,
+    EXPANDABLE,
+    EXPANDED,
+    FOCUSABLE,
+    FOCUSED,
+    MODAL,
+    PRESSED,
+    SELECTABLE,
+    SELECTED,
+    SENSITIVE,
+    SHOWING,
+    VISIBLE,
+    CHECKABLE,
+    READ_ONLY,
+    HIGHLIGHTED,
+    HIGHLIGHTABLE,
+
+    // PropertyChange
+    ACCESSIBLE_NAME,
+    ACCESSIBLE_DESCRIPTION,
+    ACCESSIBLE_VALUE,
+    ACCESSIBLE_PARENT,
+    ACCESSIBLE_ROLE,
+
+    // TextChanged
+    TEXT_INSERT,
+    TEXT_DELETE,
+
+    // Window events
+    WINDOW_ACTIVATE,
+    WINDOW_DEACTIVATE,
+    WINDOW_CREATE,
+    WINDOW_DESTROY,
+
+    CUSTOM ///< Not a well-known detail; the text is stored verbatim
+  };
+
+  EventDetail() = default;
+
+  EventDetail(Id id)
+  : mId(id)
+  {
+  }
+
+  EventDetail(const char* text)
+  : EventDetail(std::string_view(text ? text : ""))
+  {
+  }
+
+  EventDetail(const std::string& text)
+  : EventDetail(std::string_view(text))
+  {
+  }
+
+  explicit EventDetail(std::string_view text);
+
+  /**
+   * @brief Returns the interned id (CUSTOM for unknown text).
+   */
+  Id id() const
+  {
+    return mId;
+  }
+
+  /**
+   * @brief Returns the detail text.
+   */
+  std::string_view view() const;
+
+  /**
+   * @brief Returns the detail text as a string.
+   */
+  std::string str() const
+  {
+    return std::string(view());
+  }
+
+  /**
+   * @brief Returns true if there is no detail.
+   */
+  bool empty() const
+  {
+    return mId == NONE;
+  }
+
+  /**
+   * @brief Looks up the atom for the given text.
+   *
+   * @return The atom, NONE for empty text, or CUSTOM if the text is not well-known
+   */
+  static Id intern(std::string_view text);
+
+  bool operator==(const EventDetail& rhs) const
+  {
+    return mId == rhs.mId && (mId != CUSTOM || mCustom == rhs.mCustom);
+  }
+
+  bool operator!=(const EventDetail& rhs) const
+  {
+    return !(*this == rhs);
+  }
+
+  bool operator==(Id id) const
+  {
+    return mId == id;
+  }
+
+  bool operator!=(Id id) const
+  {
+    return mId != id;
+  }
+
+  bool operator==(const char* text) const
+  {
+    return view() == std::string_view(text ? text : "");
+  }
+
+  bool operator!=(const char* text) const
+  {
+    return !(*this == text);
+  }
+
+private:
+  Id          mId{NONE};
+  std::string mCustom; ///< Only used when mId == CUSTOM
+};
+
 /**
  * @brief Structure describing an accessibility event received from an application.
  */
@@ -46,14 +209,47 @@ struct AccessibilityEvent
     MOVED_OUT,
     SCROLL_STARTED,
     SCROLL_FINISHED,
-    WINDOW_CHANGED
+    WINDOW_CHANGED,
+    CHILDREN_CHANGED
   };
 
   Type        type{};
   Address     source;
-  std::string detail;
+  EventDetail detail;
   int         detail1{0};
   int         detail2{0};
+  std::string text; ///< TEXT_CHANGED: the inserted or removed text, if the router provides it
+};
+
+/**
+ * @brief Bitmask of AccessibilityEvent::Type values.
+ */
+using EventTypeMask = uint32_t;
+
+constexpr EventTypeMask ALL_EVENT_TYPES = 0xFFFFFFFFu;
+
+/**
+ * @brief Returns the mask bit for the given event type.
+ */
+constexpr EventTypeMask EventTypeBit(AccessibilityEvent::Type type)
+{
+  return 1u << static_cast<uint32_t>(type);
+}
+
+/**
+ * @brief Objects a service can subscribe to for event routing.
+ *
+ * @see AccessibilityService::subscribeEvents
+ */
+enum class EventTarget
+{
+  ANY_SOURCE,     ///< Events from any object
+  CURRENT_NODE,   ///< The currently highlighted node
+  CURRENT_PARENT, ///< The parent of the currently highlighted node
+  ACTIVE_WINDOW,  ///< The active window
+  NEXT_NODE,      ///< A node the service expects to navigate to next (bound by the service)
+  PREV_NODE,      ///< A node the service expects to navigate to previously (bound by the service)
+  MAX_COUNT
 };
 
 } // namespace Accessibility
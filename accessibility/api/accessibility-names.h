@@ -0,0 +1,573 @@
+#ifndef ACCESSIBILITY_NAMES_H
+#define ACCESSIBILITY_NAMES_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/accessibility.h>
+
+namespace Accessibility
+{
+/**
+ * @brief Compile-time table of enumerator names.
+ *
+ * The table is built from {enumerator, name} pairs, so entries may be
+ * listed in any order. Construction requires exactly one pair per
+ * enumerator below MAX_COUNT; combined with the IsComplete() checks below,
+ * a table that misses or repeats an enumerator does not compile. Lookups
+ * are an index into a static array and return views of string literals.
+ */
+template<typename Enum, std::size_t N = static_cast<std::size_t>(Enum::MAX_COUNT)>
+class EnumNames
+{
+public:
+  using Entry = std::pair<Enum, std::string_view>;
+
+  template<std::size_t M>
+  constexpr EnumNames(const Entry (&entries)[M])
+  : mNames{}
+  {
+    static_assert(M == N, "An EnumNames table needs one entry per enumerator");
+    for(std::size_t i = 0; i < M; ++i)
+    {
+      mNames[static_cast<std::size_t>(entries[i].first)] = entries[i].second;
+    }
+  }
+
+  /**
+   * @brief Returns the name of value, or an empty view if it is out of range.
+   */
+  constexpr std::string_view operator[](Enum value) const
+  {
+    auto index = static_cast<std::size_t>(value);
+    return index < N ? mNames[index] : std::string_view{};
+  }
+
+  /**
+   * @brief Finds the enumerator with the given name.
+   *
+   * @return true if name was found
+   */
+  constexpr bool Find(std::string_view name, Enum& value) const
+  {
+    for(std::size_t i = 0; i < N; ++i)
+    {
+      if(mNames[i] == name)
+      {
+        value = static_cast<Enum>(i);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Checks that every enumerator has a name.
+   */
+  constexpr bool IsComplete() const
+  {
+    for(std::size_t i = 0; i < N; ++i)
+    {
+      if(mNames[i].empty())
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static constexpr std::size_t Size()
+  {
+    return N;
+  }
+
+private:
+  std::array<std::string_view, N> mNames;
+};
+
+/**
+ * @brief Human-readable role names, as returned by Accessible::GetRoleName().
+ */
+inline constexpr EnumNames<Role> ROLE_NAMES{{
+  {Role::INVALID, "invalid"},
+  {Role::ACCELERATOR_LABEL, "accelerator label"},
+  {Role::ALERT, "alert"},
+  {Role::ANIMATION, "animation"},
+  {Role::ARROW, "arrow"},
+  {Role::CALENDAR, "calendar"},
+  {Role::CANVAS, "canvas"},
+  {Role::CHECK_BOX, "check box"},
+  {Role::CHECK_MENU_ITEM, "check menu item"},
+  {Role::COLOR_CHOOSER, "color chooser"},
+  {Role::COLUMN_HEADER, "column header"},
+  {Role::COMBO_BOX, "combo box"},
+  {Role::DATE_EDITOR, "date editor"},
+  {Role::DESKTOP_ICON, "desktop icon"},
+  {Role::DESKTOP_FRAME, "desktop frame"},
+  {Role::DIAL, "dial"},
+  {Role::DIALOG, "dialog"},
+  {Role::DIRECTORY_PANE, "directory pane"},
+  {Role::DRAWING_AREA, "drawing area"},
+  {Role::FILE_CHOOSER, "file chooser"},
+  {Role::FILLER, "filler"},
+  {Role::FOCUS_TRAVERSABLE, "focus traversable"},
+  {Role::FONT_CHOOSER, "font chooser"},
+  {Role::FRAME, "frame"},
+  {Role::GLASS_PANE, "glass pane"},
+  {Role::HTML_CONTAINER, "html container"},
+  {Role::ICON, "icon"},
+  {Role::IMAGE, "image"},
+  {Role::INTERNAL_FRAME, "internal frame"},
+  {Role::LABEL, "label"},
+  {Role::LAYERED_PANE, "layered pane"},
+  {Role::LIST, "list"},
+  {Role::LIST_ITEM, "list item"},
+  {Role::MENU, "menu"},
+  {Role::MENU_BAR, "menu bar"},
+  {Role::MENU_ITEM, "menu item"},
+  {Role::OPTION_PANE, "option pane"},
+  {Role::PAGE_TAB, "page tab"},
+  {Role::PAGE_TAB_LIST, "page tab list"},
+  {Role::PANEL, "panel"},
+  {Role::PASSWORD_TEXT, "password text"},
+  {Role::POPUP_MENU, "popup menu"},
+  {Role::PROGRESS_BAR, "progress bar"},
+  {Role::PUSH_BUTTON, "push button"},
+  {Role::RADIO_BUTTON, "radio button"},
+  {Role::RADIO_MENU_ITEM, "radio menu item"},
+  {Role::ROOT_PANE, "root pane"},
+  {Role::ROW_HEADER, "row header"},
+  {Role::SCROLL_BAR, "scroll bar"},
+  {Role::SCROLL_PANE, "scroll pane"},
+  {Role::SEPARATOR, "separator"},
+  {Role::SLIDER, "slider"},
+  {Role::SPIN_BUTTON, "spin button"},
+  {Role::SPLIT_PANE, "split pane"},
+  {Role::STATUS_BAR, "status bar"},
+  {Role::TABLE, "table"},
+  {Role::TABLE_CELL, "table cell"},
+  {Role::TABLE_COLUMN_HEADER, "table column header"},
+  {Role::TABLE_ROW_HEADER, "table row header"},
+  {Role::TEAROFF_MENU_ITEM, "tearoff menu item"},
+  {Role::TERMINAL, "terminal"},
+  {Role::TEXT, "text"},
+  {Role::TOGGLE_BUTTON, "toggle button"},
+  {Role::TOOL_BAR, "tool bar"},
+  {Role::TOOL_TIP, "tool tip"},
+  {Role::TREE, "tree"},
+  {Role::TREE_TABLE, "tree table"},
+  {Role::UNKNOWN, "unknown"},
+  {Role::VIEWPORT, "viewport"},
+  {Role::WINDOW, "window"},
+  {Role::EXTENDED, "extended"},
+  {Role::HEADER, "header"},
+  {Role::FOOTER, "footer"},
+  {Role::PARAGRAPH, "paragraph"},
+  {Role::RULER, "ruler"},
+  {Role::APPLICATION, "application"},
+  {Role::AUTOCOMPLETE, "autocomplete"},
+  {Role::EDITBAR, "edit bar"},
+  {Role::EMBEDDED, "embedded"},
+  {Role::ENTRY, "entry"},
+  {Role::CHART, "chart"},
+  {Role::CAPTION, "caution"},
+  {Role::DOCUMENT_FRAME, "document frame"},
+  {Role::HEADING, "heading"},
+  {Role::PAGE, "page"},
+  {Role::SECTION, "section"},
+  {Role::REDUNDANT_OBJECT, "redundant object"},
+  {Role::FORM, "form"},
+  {Role::LINK, "link"},
+  {Role::INPUT_METHOD_WINDOW, "input method window"},
+  {Role::TABLE_ROW, "table row"},
+  {Role::TREE_ITEM, "tree item"},
+  {Role::DOCUMENT_SPREADSHEET, "document spreadsheet"},
+  {Role::DOCUMENT_PRESENTATION, "document presentation"},
+  {Role::DOCUMENT_TEXT, "document text"},
+  {Role::DOCUMENT_WEB, "document web"},
+  {Role::DOCUMENT_EMAIL, "document email"},
+  {Role::COMMENT, "comment"},
+  {Role::LIST_BOX, "list box"},
+  {Role::GROUPING, "grouping"},
+  {Role::IMAGE_MAP, "image map"},
+  {Role::NOTIFICATION, "notification"},
+  {Role::INFO_BAR, "info bar"},
+  {Role::LEVEL_BAR, "level bar"},
+  {Role::TITLE_BAR, "title bar"},
+  {Role::BLOCK_QUOTE, "block quote"},
+  {Role::AUDIO, "audio"},
+  {Role::VIDEO, "video"},
+  {Role::DEFINITION, "definition"},
+  {Role::ARTICLE, "article"},
+  {Role::LANDMARK, "landmark"},
+  {Role::LOG, "log"},
+  {Role::MARQUEE, "marquee"},
+  {Role::MATH, "math"},
+  {Role::RATING, "rating"},
+  {Role::TIMER, "timer"},
+  {Role::STATIC, "static"},
+  {Role::MATH_FRACTION, "math fraction"},
+  {Role::MATH_ROOT, "math root"},
+  {Role::SUBSCRIPT, "subscript"},
+  {Role::SUPERSCRIPT, "superscript"},
+}};
+
+/**
+ * @brief AT-SPI state names, as sent in StateChanged signals.
+ */
+inline constexpr EnumNames<State> STATE_NAMES{{
+  {State::INVALID, "invalid"},
+  {State::ACTIVE, "active"},
+  {State::ARMED, "armed"},
+  {State::BUSY, "busy"},
+  {State::CHECKED, "checked"},
+  {State::COLLAPSED, "collapsed"},
+  {State::DEFUNCT, "defunct"},
+  {State::EDITABLE, "editable"},
+  {State::ENABLED, "enabled"},
+  {State::EXPANDABLE, "expandable"},
+  {State::EXPANDED, "expanded"},
+  {State::FOCUSABLE, "focusable"},
+  {State::FOCUSED, "focused"},
+  {State::HAS_TOOLTIP, "has-tooltip"},
+  {State::HORIZONTAL, "horizontal"},
+  {State::ICONIFIED, "iconified"},
+  {State::MODAL, "modal"},
+  {State::MULTI_LINE, "multi-line"},
+  {State::MULTI_SELECTABLE, "multiselectable"},
+  {State::OPAQUE, "opaque"},
+  {State::PRESSED, "pressed"},
+  {State::RESIZEABLE, "resizable"},
+  {State::SELECTABLE, "selectable"},
+  {State::SELECTED, "selected"},
+  {State::SENSITIVE, "sensitive"},
+  {State::SHOWING, "showing"},
+  {State::SINGLE_LINE, "single-line"},
+  {State::STALE, "stale"},
+  {State::TRANSIENT, "transient"},
+  {State::VERTICAL, "vertical"},
+  {State::VISIBLE, "visible"},
+  {State::MANAGES_DESCENDANTS, "manages-descendants"},
+  {State::INDETERMINATE, "indeterminate"},
+  {State::REQUIRED, "required"},
+  {State::TRUNCATED, "truncated"},
+  {State::ANIMATED, "animated"},
+  {State::INVALID_ENTRY, "invalid-entry"},
+  {State::SUPPORTS_AUTOCOMPLETION, "supports-autocompletion"},
+  {State::SELECTABLE_TEXT, "selectable-text"},
+  {State::IS_DEFAULT, "is-default"},
+  {State::VISITED, "visited"},
+  {State::CHECKABLE, "checkable"},
+  {State::HAS_POPUP, "has-popup"},
+  {State::READ_ONLY, "read-only"},
+  {State::HIGHLIGHTED, "highlighted"},
+  {State::HIGHLIGHTABLE, "highlightable"},
+}};
+
+/**
+ * @brief D-Bus interface names, as returned by Accessible::GetInterfaceName().
+ */
+inline constexpr EnumNames<AtspiInterface> INTERFACE_NAMES{{
+  {AtspiInterface::ACCESSIBLE, "org.a11y.atspi.Accessible"},
+  {AtspiInterface::ACTION, "org.a11y.atspi.Action"},
+  {AtspiInterface::APPLICATION, "org.a11y.atspi.Application"},
+  {AtspiInterface::CACHE, "org.a11y.atspi.Cache"},
+  {AtspiInterface::COLLECTION, "org.a11y.atspi.Collection"},
+  {AtspiInterface::COMPONENT, "org.a11y.atspi.Component"},
+  {AtspiInterface::DEVICE_EVENT_CONTROLLER, "org.a11y.atspi.DeviceEventController"},
+  {AtspiInterface::DEVICE_EVENT_LISTENER, "org.a11y.atspi.DeviceEventListener"},
+  {AtspiInterface::DOCUMENT, "org.a11y.atspi.Document"},
+  {AtspiInterface::EDITABLE_TEXT, "org.a11y.atspi.EditableText"},
+  {AtspiInterface::EVENT_DOCUMENT, "org.a11y.atspi.Event.Document"},
+  {AtspiInterface::EVENT_FOCUS, "org.a11y.atspi.Event.Focus"},
+  {AtspiInterface::EVENT_KEYBOARD, "org.a11y.atspi.Event.Keyboard"},
+  {AtspiInterface::EVENT_MOUSE, "org.a11y.atspi.Event.Mouse"},
+  {AtspiInterface::EVENT_OBJECT, "org.a11y.atspi.Event.Object"},
+  {AtspiInterface::EVENT_TERMINAL, "org.a11y.atspi.Event.Terminal"},
+  {AtspiInterface::EVENT_WINDOW, "org.a11y.atspi.Event.Window"},
+  {AtspiInterface::HYPERLINK, "org.a11y.atspi.Hyperlink"},
+  {AtspiInterface::HYPERTEXT, "org.a11y.atspi.Hypertext"},
+  {AtspiInterface::IMAGE, "org.a11y.atspi.Image"},
+  {AtspiInterface::REGISTRY, "org.a11y.atspi.Registry"},
+  {AtspiInterface::SELECTION, "org.a11y.atspi.Selection"},
+  {AtspiInterface::SOCKET, "org.a11y.atspi.Socket"},
+  {AtspiInterface::TABLE, "org.a11y.atspi.Table"},
+  {AtspiInterface::TABLE_CELL, "org.a11y.atspi.TableCell"},
+  {AtspiInterface::TEXT, "org.a11y.atspi.Text"},
+  {AtspiInterface::VALUE, "org.a11y.atspi.Value"},
+}};
+
+/**
+ * @brief Detail strings of PropertyChange signals.
+ */
+inline constexpr EnumNames<ObjectPropertyChangeEvent> PROPERTY_CHANGE_EVENT_NAMES{{
+  {ObjectPropertyChangeEvent::NAME, "accessible-name"},
+  {ObjectPropertyChangeEvent::DESCRIPTION, "accessible-description"},
+  {ObjectPropertyChangeEvent::VALUE, "accessible-value"},
+  {ObjectPropertyChangeEvent::PARENT, "accessible-parent"},
+  {ObjectPropertyChangeEvent::ROLE, "accessible-role"},
+}};
+
+/**
+ * @brief Member names of window event signals.
+ */
+inline constexpr EnumNames<WindowEvent> WINDOW_EVENT_NAMES{{
+  {WindowEvent::PROPERTY_CHANGE, "PropertyChange"},
+  {WindowEvent::MINIMIZE, "Minimize"},
+  {WindowEvent::MAXIMIZE, "Maximize"},
+  {WindowEvent::RESTORE, "Restore"},
+  {WindowEvent::CLOSE, "Close"},
+  {WindowEvent::CREATE, "Create"},
+  {WindowEvent::REPARENT, "Reparent"},
+  {WindowEvent::DESKTOP_CREATE, "DesktopCreate"},
+  {WindowEvent::DESKTOP_DESTROY, "DesktopDestroy"},
+  {WindowEvent::DESTROY, "Destroy"},
+  {WindowEvent::ACTIVATE, "Activate"},
+  {WindowEvent::DEACTIVATE, "Deactivate"},
+  {WindowEvent::RAISE, "Raise"},
+  {WindowEvent::LOWER, "Lower"},
+  {WindowEvent::MOVE, "Move"},
+  {WindowEvent::RESIZE, "Resize"},
+  {WindowEvent::SHADE, "Shade"},
+  {WindowEvent::UU_SHADE, "uUshade"},
+  {WindowEvent::RESTYLE, "Restyle"},
+  {WindowEvent::POST_RENDER, "PostRender"},
+}};
+
+/**
+ * @brief Detail strings of TextChanged signals.
+ */
+inline constexpr EnumNames<TextChangedState> TEXT_CHANGED_STATE_NAMES{{
+  {TextChangedState::INSERTED, "insert"},
+  {TextChangedState::DELETED, "delete"},
+}};
+
+/**
+ * @brief Names of the well-known attribute keys, as sent over D-Bus.
+ */
+inline constexpr EnumNames<WellKnownAttribute> ATTRIBUTE_NAMES{{
+  {WellKnownAttribute::CLASS, "class"},
+  {WellKnownAttribute::AUTOMATION_ID, "automationId"},
+  {WellKnownAttribute::ITEM_COUNT, "item_count"},
+  {WellKnownAttribute::SUPPRESS_SCREEN_READER, "suppress-screen-reader"},
+  {WellKnownAttribute::VALUE_FORMAT, "value_format"},
+  {WellKnownAttribute::FORCE_CHILD_SEARCH, "forceChildSearch"},
+  {WellKnownAttribute::COLLECTION_INDEX, "collection_index"},
+  {WellKnownAttribute::COLLECTION_CONTAINER, "collection_container"},
+}};
+
+#define A11Y_ENUM_IDENTIFIER(ENUM, VALUE) {ENUM::VALUE, #VALUE}
+
+/**
+ * @brief Role enumerator names, e.g. "PUSH_BUTTON".
+ */
+inline constexpr EnumNames<Role> ROLE_IDENTIFIERS{{
+  A11Y_ENUM_IDENTIFIER(Role, INVALID),
+  A11Y_ENUM_IDENTIFIER(Role, ACCELERATOR_LABEL),
+  A11Y_ENUM_IDENTIFIER(Role, ALERT),
+  A11Y_ENUM_IDENTIFIER(Role, ANIMATION),
+  A11Y_ENUM_IDENTIFIER(Role, ARROW),
+  A11Y_ENUM_IDENTIFIER(Role, CALENDAR),
+  A11Y_ENUM_IDENTIFIER(Role, CANVAS),
+  A11Y_ENUM_IDENTIFIER(Role, CHECK_BOX),
+  A11Y_ENUM_IDENTIFIER(Role, CHECK_MENU_ITEM),
+  A11Y_ENUM_IDENTIFIER(Role, COLOR_CHOOSER),
+  A11Y_ENUM_IDENTIFIER(Role, COLUMN_HEADER),
+  A11Y_ENUM_IDENTIFIER(Role, COMBO_BOX),
+  A11Y_ENUM_IDENTIFIER(Role, DATE_EDITOR),
+  A11Y_ENUM_IDENTIFIER(Role, DESKTOP_ICON),
+  A11Y_ENUM_IDENTIFIER(Role, DESKTOP_FRAME),
+  A11Y_ENUM_IDENTIFIER(Role, DIAL),
+  A11Y_ENUM_IDENTIFIER(Role, DIALOG),
+  A11Y_ENUM_IDENTIFIER(Role, DIRECTORY_PANE),
+  A11Y_ENUM_IDENTIFIER(Role, DRAWING_AREA),
+  A11Y_ENUM_IDENTIFIER(Role, FILE_CHOOSER),
+  A11Y_ENUM_IDENTIFIER(Role, FILLER),
+  A11Y_ENUM_IDENTIFIER(Role, FOCUS_TRAVERSABLE),
+  A11Y_ENUM_IDENTIFIER(Role, FONT_CHOOSER),
+  A11Y_ENUM_IDENTIFIER(Role, FRAME),
+  A11Y_ENUM_IDENTIFIER(Role, GLASS_PANE),
+  A11Y_ENUM_IDENTIFIER(Role, HTML_CONTAINER),
+  A11Y_ENUM_IDENTIFIER(Role, ICON),
+  A11Y_ENUM_IDENTIFIER(Role, IMAGE),
+  A11Y_ENUM_IDENTIFIER(Role, INTERNAL_FRAME),
+  A11Y_ENUM_IDENTIFIER(Role, LABEL),
+  A11Y_ENUM_IDENTIFIER(Role, LAYERED_PANE),
+  A11Y_ENUM_IDENTIFIER(Role, LIST),
+  A11Y_ENUM_IDENTIFIER(Role, LIST_ITEM),
+  A11Y_ENUM_IDENTIFIER(Role, MENU),
+  A11Y_ENUM_IDENTIFIER(Role, MENU_BAR),
+  A11Y_ENUM_IDENTIFIER(Role, MENU_ITEM),
+  A11Y_ENUM_IDENTIFIER(Role, OPTION_PANE),
+  A11Y_ENUM_IDENTIFIER(Role, PAGE_TAB),
+  A11Y_ENUM_IDENTIFIER(Role, PAGE_TAB_LIST),
+  A11Y_ENUM_IDENTIFIER(Role, PANEL),
+  A11Y_ENUM_IDENTIFIER(Role, PASSWORD_TEXT),
+  A11Y_ENUM_IDENTIFIER(Role, POPUP_MENU),
+  A11Y_ENUM_IDENTIFIER(Role, PROGRESS_BAR),
+  A11Y_ENUM_IDENTIFIER(Role, PUSH_BUTTON),
+  A11Y_ENUM_IDENTIFIER(Role, RADIO_BUTTON),
+  A11Y_ENUM_IDENTIFIER(Role, RADIO_MENU_ITEM),
+  A11Y_ENUM_IDENTIFIER(Role, ROOT_PANE),
+  A11Y_ENUM_IDENTIFIER(Role, ROW_HEADER),
+  A11Y_ENUM_IDENTIFIER(Role, SCROLL_BAR),
+  A11Y_ENUM_IDENTIFIER(Role, SCROLL_PANE),
+  A11Y_ENUM_IDENTIFIER(Role, SEPARATOR),
+  A11Y_ENUM_IDENTIFIER(Role, SLIDER),
+  A11Y_ENUM_IDENTIFIER(Role, SPIN_BUTTON),
+  A11Y_ENUM_IDENTIFIER(Role, SPLIT_PANE),
+  A11Y_ENUM_IDENTIFIER(Role, STATUS_BAR),
+  A11Y_ENUM_IDENTIFIER(Role, TABLE),
+  A11Y_ENUM_IDENTIFIER(Role, TABLE_CELL),
+  A11Y_ENUM_IDENTIFIER(Role, TABLE_COLUMN_HEADER),
+  A11Y_ENUM_IDENTIFIER(Role, TABLE_ROW_HEADER),
+  A11Y_ENUM_IDENTIFIER(Role, TEAROFF_MENU_ITEM),
+  A11Y_ENUM_IDENTIFIER(Role, TERMINAL),
+  A11Y_ENUM_IDENTIFIER(Role, TEXT),
+  A11Y_ENUM_IDENTIFIER(Role, TOGGLE_BUTTON),
+  A11Y_ENUM_IDENTIFIER(Role, TOOL_BAR),
+  A11Y_ENUM_IDENTIFIER(Role, TOOL_TIP),
+  A11Y_ENUM_IDENTIFIER(Role, TREE),
+  A11Y_ENUM_IDENTIFIER(Role, TREE_TABLE),
+  A11Y_ENUM_IDENTIFIER(Role, UNKNOWN),
+  A11Y_ENUM_IDENTIFIER(Role, VIEWPORT),
+  A11Y_ENUM_IDENTIFIER(Role, WINDOW),
+  A11Y_ENUM_IDENTIFIER(Role, EXTENDED),
+  A11Y_ENUM_IDENTIFIER(Role, HEADER),
+  A11Y_ENUM_IDENTIFIER(Role, FOOTER),
+  A11Y_ENUM_IDENTIFIER(Role, PARAGRAPH),
+  A11Y_ENUM_IDENTIFIER(Role, RULER),
+  A11Y_ENUM_IDENTIFIER(Role, APPLICATION),
+  A11Y_ENUM_IDENTIFIER(Role, AUTOCOMPLETE),
+  A11Y_ENUM_IDENTIFIER(Role, EDITBAR),
+  A11Y_ENUM_IDENTIFIER(Role, EMBEDDED),
+  A11Y_ENUM_IDENTIFIER(Role, ENTRY),
+  A11Y_ENUM_IDENTIFIER(Role, CHART),
+  A11Y_ENUM_IDENTIFIER(Role, CAPTION),
+  A11Y_ENUM_IDENTIFIER(Role, DOCUMENT_FRAME),
+  A11Y_ENUM_IDENTIFIER(Role, HEADING),
+  A11Y_ENUM_IDENTIFIER(Role, PAGE),
+  A11Y_ENUM_IDENTIFIER(Role, SECTION),
+  A11Y_ENUM_IDENTIFIER(Role, REDUNDANT_OBJECT),
+  A11Y_ENUM_IDENTIFIER(Role, FORM),
+  A11Y_ENUM_IDENTIFIER(Role, LINK),
+  A11Y_ENUM_IDENTIFIER(Role, INPUT_METHOD_WINDOW),
+  A11Y_ENUM_IDENTIFIER(Role, TABLE_ROW),
+  A11Y_ENUM_IDENTIFIER(Role, TREE_ITEM),
+  A11Y_ENUM_IDENTIFIER(Role, DOCUMENT_SPREADSHEET),
+  A11Y_ENUM_IDENTIFIER(Role, DOCUMENT_PRESENTATION),
+  A11Y_ENUM_IDENTIFIER(Role, DOCUMENT_TEXT),
+  A11Y_ENUM_IDENTIFIER(Role, DOCUMENT_WEB),
+  A11Y_ENUM_IDENTIFIER(Role, DOCUMENT_EMAIL),
+  A11Y_ENUM_IDENTIFIER(Role, COMMENT),
+  A11Y_ENUM_IDENTIFIER(Role, LIST_BOX),
+  A11Y_ENUM_IDENTIFIER(Role, GROUPING),
+  A11Y_ENUM_IDENTIFIER(Role, IMAGE_MAP),
+  A11Y_ENUM_IDENTIFIER(Role, NOTIFICATION),
+  A11Y_ENUM_IDENTIFIER(Role, INFO_BAR),
+  A11Y_ENUM_IDENTIFIER(Role, LEVEL_BAR),
+  A11Y_ENUM_IDENTIFIER(Role, TITLE_BAR),
+  A11Y_ENUM_IDENTIFIER(Role, BLOCK_QUOTE),
+  A11Y_ENUM_IDENTIFIER(Role, AUDIO),
+  A11Y_ENUM_IDENTIFIER(Role, VIDEO),
+  A11Y_ENUM_IDENTIFIER(Role, DEFINITION),
+  A11Y_ENUM_IDENTIFIER(Role, ARTICLE),
+  A11Y_ENUM_IDENTIFIER(Role, LANDMARK),
+  A11Y_ENUM_IDENTIFIER(Role, LOG),
+  A11Y_ENUM_IDENTIFIER(Role, MARQUEE),
+  A11Y_ENUM_IDENTIFIER(Role, MATH),
+  A11Y_ENUM_IDENTIFIER(Role, RATING),
+  A11Y_ENUM_IDENTIFIER(Role, TIMER),
+  A11Y_ENUM_IDENTIFIER(Role, STATIC),
+  A11Y_ENUM_IDENTIFIER(Role, MATH_FRACTION),
+  A11Y_ENUM_IDENTIFIER(Role, MATH_ROOT),
+  A11Y_ENUM_IDENTIFIER(Role, SUBSCRIPT),
+  A11Y_ENUM_IDENTIFIER(Role, SUPERSCRIPT),
+}};
+
+/**
+ * @brief State enumerator names, e.g. "HAS_TOOLTIP".
+ */
+inline constexpr EnumNames<State> STATE_IDENTIFIERS{{
+  A11Y_ENUM_IDENTIFIER(State, INVALID),
+  A11Y_ENUM_IDENTIFIER(State, ACTIVE),
+  A11Y_ENUM_IDENTIFIER(State, ARMED),
+  A11Y_ENUM_IDENTIFIER(State, BUSY),
+  A11Y_ENUM_IDENTIFIER(State, CHECKED),
+  A11Y_ENUM_IDENTIFIER(State, COLLAPSED),
+  A11Y_ENUM_IDENTIFIER(State, DEFUNCT),
+  A11Y_ENUM_IDENTIFIER(State, EDITABLE),
+  A11Y_ENUM_IDENTIFIER(State, ENABLED),
+  A11Y_ENUM_IDENTIFIER(State, EXPANDABLE),
+  A11Y_ENUM_IDENTIFIER(State, EXPANDED),
+  A11Y_ENUM_IDENTIFIER(State, FOCUSABLE),
+  A11Y_ENUM_IDENTIFIER(State, FOCUSED),
+  A11Y_ENUM_IDENTIFIER(State, HAS_TOOLTIP),
+  A11Y_ENUM_IDENTIFIER(State, HORIZONTAL),
+  A11Y_ENUM_IDENTIFIER(State, ICONIFIED),
+  A11Y_ENUM_IDENTIFIER(State, MODAL),
+  A11Y_ENUM_IDENTIFIER(State, MULTI_LINE),
+  A11Y_ENUM_IDENTIFIER(State, MULTI_SELECTABLE),
+  A11Y_ENUM_IDENTIFIER(State, OPAQUE),
+  A11Y_ENUM_IDENTIFIER(State, PRESSED),
+  A11Y_ENUM_IDENTIFIER(State, RESIZEABLE),
+  A11Y_ENUM_IDENTIFIER(State, SELECTABLE),
+  A11Y_ENUM_IDENTIFIER(State, SELECTED),
+  A11Y_ENUM_IDENTIFIER(State, SENSITIVE),
+  A11Y_ENUM_IDENTIFIER(State, SHOWING),
+  A11Y_ENUM_IDENTIFIER(State, SINGLE_LINE),
+  A11Y_ENUM_IDENTIFIER(State, STALE),
+  A11Y_ENUM_IDENTIFIER(State, TRANSIENT),
+  A11Y_ENUM_IDENTIFIER(State, VERTICAL),
+  A11Y_ENUM_IDENTIFIER(State, VISIBLE),
+  A11Y_ENUM_IDENTIFIER(State, MANAGES_DESCENDANTS),
+  A11Y_ENUM_IDENTIFIER(State, INDETERMINATE),
+  A11Y_ENUM_IDENTIFIER(State, REQUIRED),
+  A11Y_ENUM_IDENTIFIER(State, TRUNCATED),
+  A11Y_ENUM_IDENTIFIER(State, ANIMATED),
+  A11Y_ENUM_IDENTIFIER(State, INVALID_ENTRY),
+  A11Y_ENUM_IDENTIFIER(State, SUPPORTS_AUTOCOMPLETION),
+  A11Y_ENUM_IDENTIFIER(State, SELECTABLE_TEXT),
+  A11Y_ENUM_IDENTIFIER(State, IS_DEFAULT),
+  A11Y_ENUM_IDENTIFIER(State, VISITED),
+  A11Y_ENUM_IDENTIFIER(State, CHECKABLE),
+  A11Y_ENUM_IDENTIFIER(State, HAS_POPUP),
+  A11Y_ENUM_IDENTIFIER(State, READ_ONLY),
+  A11Y_ENUM_IDENTIFIER(State, HIGHLIGHTED),
+  A11Y_ENUM_IDENTIFIER(State, HIGHLIGHTABLE),
+}};
+
+#undef A11Y_ENUM_IDENTIFIER
+
+static_assert(ROLE_NAMES.IsComplete() && ROLE_IDENTIFIERS.IsComplete(), "Every Role needs a name");
+static_assert(STATE_NAMES.IsComplete() && STATE_IDENTIFIERS.IsComplete(), "Every State needs a name");
+static_assert(INTERFACE_NAMES.IsComplete(), "Every AtspiInterface needs a name");
+static_assert(PROPERTY_CHANGE_EVENT_NAMES.IsComplete(), "Every ObjectPropertyChangeEvent needs a name");
+static_assert(WINDOW_EVENT_NAMES.IsComplete(), "Every WindowEvent needs a name");
+static_assert(TEXT_CHANGED_STATE_NAMES.IsComplete(), "Every TextChangedState needs a name");
+static_assert(ATTRIBUTE_NAMES.IsComplete(), "Every WellKnownAttribute needs a name");
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_NAMES_H
@@ -19,6 +19,9 @@
  */
 
 // EXTERNAL INCLUDES
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 
 // INTERNAL INCLUDES
@@ -27,10 +30,23 @@
 #include <accessibility/api/app-registry.h>
 #include <accessibility/api/gesture-provider.h>
 #include <accessibility/api/node-proxy.h>
+#include <accessibility/api/task-executor.h>
 #include <accessibility/api/types.h>
 
 namespace Accessibility
 {
+/**
+ * @brief Cost of neighbor lookups, including hops across embedded processes.
+ */
+struct NeighborHopStats
+{
+  uint64_t                  lookups{0};      ///< Neighbor lookups (navigation and prediction)
+  uint64_t                  hops{0};         ///< GetNeighbor steps, mirrored ones included
+  uint64_t                  crossBusHops{0}; ///< Steps that returned the recurse flag
+  std::chrono::microseconds totalLatency{0};
+  std::chrono::microseconds maxHopLatency{0};
+};
+
 /**
  * @brief Base class for assistive technology services.
  *
@@ -38,6 +54,9 @@ namespace Accessibility
  * Concrete services (ScreenReaderService, InspectorService, AurumService)
  * extend this class and implement the virtual callbacks.
  *
+ * Navigation may run on a service worker thread while events are dispatched
+ * from the platform thread; the current node/window state is synchronized.
+ *
  * Usage pattern (Android-inspired):
  *   class ScreenReaderService : public AccessibilityService
  *   {
@@ -96,6 +115,34 @@ public:
    */
   std::shared_ptr<NodeProxy> navigatePrev();
 
+  /**
+   * @brief Computes the node navigateNext() or navigatePrev() would move to, without moving.
+   *
+   * Content embedded from other processes is entered and left as needed:
+   * the bridge flags such neighbors and the search continues on their bus.
+   *
+   * @param[in] start The node to start from, or nullptr to start from the window
+   * @param[in] forward true for next, false for previous
+   * @return The neighbor, or nullptr at the end of the window
+   */
+  std::shared_ptr<NodeProxy> findNeighbor(std::shared_ptr<NodeProxy> start, bool forward);
+
+  /**
+   * @brief Gets the accumulated cost of neighbor lookups.
+   */
+  NeighborHopStats getNeighborHopStats() const;
+
+  /**
+   * @brief Moves the navigation position to the given node and highlights it.
+   *
+   * Meant for a node resolved earlier, e.g. a predicted neighbor, so the
+   * position only moves if the node still accepts the highlight.
+   *
+   * @param[in] node The node to navigate to
+   * @return The node, or nullptr if it was null or could not be highlighted
+   */
+  std::shared_ptr<NodeProxy> navigateTo(std::shared_ptr<NodeProxy> node);
+
   /**
    * @brief Highlights the given node.
    *
@@ -113,10 +160,44 @@ public:
    * @brief Dispatches an accessibility event to the service.
    *
    * This is called by event routers (AtSpiEventRouter, TidlEventRouter)
-   * when they receive events from applications.
+   * when they receive events from applications. Events whose source is not
+   * subscribed (see subscribeEvents) are dropped before onAccessibilityEvent.
    */
   void dispatchEvent(const AccessibilityEvent& event);
 
+  /**
+   * @brief Enables computing navigation neighbors from a local window mirror.
+   *
+   * The active window's subtree is fetched once and kept current from
+   * events; navigateNext() and navigatePrev() then walk it without a
+   * GetNeighbor round trip per gesture. Structural events refetch only the
+   * subtree under their source, role and bounds changes only their source.
+   * Loads and refetches run on loader, never on
+   * the gesture path; until one finishes, and whenever the mirror cannot
+   * answer, the service falls back to GetNeighbor. Disabled by default.
+   *
+   * @param[in] enabled true to enable mirrored navigation
+   * @param[in] loader Runs mirror loads; by default a worker thread owned by
+   *            the service. In-process proxies need an executor on the
+   *            toolkit's thread.
+   */
+  void setMirroredNavigation(bool enabled, std::shared_ptr<TaskExecutor> loader = nullptr);
+
+  /**
+   * @brief Checks whether mirrored navigation is enabled.
+   */
+  bool isMirroredNavigationEnabled() const;
+
+  /**
+   * @brief Checks the mirror against GetNeighbor for every node of the active window.
+   *
+   * Each mismatch is logged as an error. Costs two round trips per node,
+   * plus a load on the calling thread if the mirror is not current.
+   *
+   * @return The number of mismatching neighbors
+   */
+  std::size_t verifyMirroredNavigation();
+
 protected:
   /**
    * @brief Called when an accessibility event is received from an application.
@@ -145,6 +226,34 @@ protected:
    */
   AppRegistry& getRegistry();
 
+  /**
+   * @brief Subscribes to events of the given types from the given target.
+   *
+   * By default a service receives every event (ANY_SOURCE = all types).
+   * Services that only care about particular objects narrow ANY_SOURCE and
+   * subscribe to CURRENT_NODE, CURRENT_PARENT or ACTIVE_WINDOW instead;
+   * the target addresses are tracked as navigation and window changes happen.
+   *
+   * @param[in] target The object to subscribe to
+   * @param[in] types Mask of event types (see EventTypeBit), 0 to unsubscribe
+   */
+  void subscribeEvents(EventTarget target, EventTypeMask types);
+
+  /**
+   * @brief Binds the address of a target the base service does not track.
+   *
+   * Used for NEXT_NODE and PREV_NODE. Bindings are cleared by stop().
+   *
+   * @param[in] target The target to bind
+   * @param[in] address The address of the object, or an empty Address to unbind
+   */
+  void setEventTargetAddress(EventTarget target, const Address& address);
+
+  /**
+   * @brief Gets the number of events dropped by the routing table.
+   */
+  std::size_t getRejectedEventCount() const;
+
 private:
   struct Impl;
   std::unique_ptr<Impl> mImpl;
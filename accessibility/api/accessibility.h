@@ -25,6 +25,7 @@
 
 // INTERNAL INCLUDES
 #include <accessibility/api/accessibility-bitset.h>
+#include <accessibility/api/attributes.h>
 #include <accessibility/public-api/accessibility-common.h>
 
 namespace Accessibility
@@ -313,6 +314,7 @@ enum class ObjectPropertyChangeEvent
   VALUE,
   ROLE,
   PARENT,
+  MAX_COUNT
 };
 
 /**
@@ -341,6 +343,7 @@ enum class WindowEvent
   UU_SHADE,
   RESTYLE,
   POST_RENDER,
+  MAX_COUNT
 };
 
 /**
@@ -525,7 +528,6 @@ using AtspiInterfaces  = EnumBitSet<AtspiInterface, AtspiInterface::MAX_COUNT>;
 using AtspiEvents      = EnumBitSet<AtspiEvent, AtspiEvent::MAX_COUNT>;
 using ReadingInfoTypes = EnumBitSet<ReadingInfoType, ReadingInfoType::MAX_COUNT>;
 using States           = EnumBitSet<State, State::MAX_COUNT>;
-using Attributes       = std::unordered_map<std::string, std::string>;
 
 namespace Internal
 {
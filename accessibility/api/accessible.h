@@ -151,6 +151,18 @@ public:
    */
   virtual Attributes GetAttributes() const = 0;
 
+  /**
+   * @brief Gets the value of a single accessibility attribute.
+   *
+   * The default implementation looks the key up in GetAttributes(). Toolkits
+   * that can answer one key without building every attribute should override it.
+   *
+   * @param[in] key The attribute name
+   * @param[out] value The attribute value; unchanged if the attribute is not set
+   * @return True if the attribute is set
+   */
+  virtual bool GetAttribute(AttributeKey key, std::string& value) const;
+
   /**
    * @brief Checks if this is hidden.
    *
@@ -332,9 +344,9 @@ public:
    * @brief Obtains the DBus interface name for the specified AT-SPI interface.
    *
    * @param interface AT-SPI interface identifier (e.g. AtspiInterface::ACCESSIBLE)
-   * @return AT-SPI interface name (e.g. "org.a11y.atspi.Accessible")
+   * @return AT-SPI interface name (e.g. "org.a11y.atspi.Accessible"), or an empty string for unknown values
    */
-  static std::string GetInterfaceName(AtspiInterface interface);
+  static const std::string& GetInterfaceName(AtspiInterface interface);
 
   /**
    * @brief Adds an existing feature instance.
@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <accessibility/api/attributes.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/accessibility-names.h>
+
+namespace Accessibility
+{
+namespace
+{
+constexpr auto WELL_KNOWN_COUNT = static_cast<uint32_t>(WellKnownAttribute::MAX_COUNT);
+
+/**
+ * @brief Process-wide interned attribute names.
+ *
+ * Names are never removed, so references returned by GetName() stay valid.
+ * The well-known names are registered up front at their fixed ids.
+ */
+class KeyRegistry
+{
+public:
+  static KeyRegistry& Get()
+  {
+    static KeyRegistry registry;
+    return registry;
+  }
+
+  uint32_t Intern(std::string_view name)
+  {
+    {
+      std::shared_lock<std::shared_mutex> lock(mMutex);
+      if(auto it = mIds.find(name); it != mIds.end())
+      {
+        return it->second;
+      }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mMutex);
+    if(auto it = mIds.find(name); it != mIds.end())
+    {
+      return it->second;
+    }
+    auto id = WELL_KNOWN_COUNT + static_cast<uint32_t>(mNames.size());
+    mNames.emplace_back(name);
+    mIds.emplace(mNames.back(), id);
+    return id;
+  }
+
+  uint32_t Find(std::string_view name) const
+  {
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    auto                                it = mIds.find(name);
+    return it != mIds.end() ? it->second : AttributeKey::INVALID_ID;
+  }
+
+  const std::string& GetName(uint32_t id) const
+  {
+    if(id < WELL_KNOWN_COUNT)
+    {
+      return mWellKnownNames[id];
+    }
+
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    id -= WELL_KNOWN_COUNT;
+    return id < mNames.size() ? mNames[id] : mEmpty;
+  }
+
+private:
+  KeyRegistry()
+  {
+    for(uint32_t id = 0; id < WELL_KNOWN_COUNT; ++id)
+    {
+      mWellKnownNames[id] = ATTRIBUTE_NAMES[static_cast<WellKnownAttribute>(id)];
+      mIds.emplace(mWellKnownNames[id], id);
+    }
+  }
+
+  std::array<std::string, WELL_KNOWN_COUNT>      mWellKnownNames; ///< Written once; read without locking
+  mutable std::shared_mutex                      mMutex;
+  std::deque<std::string>                        mNames; ///< Interned names by id - WELL_KNOWN_COUNT; stable addresses as it grows
+  std::unordered_map<std::string_view, uint32_t> mIds;   ///< Views into mWellKnownNames and mNames
+  const std::string                              mEmpty;
+};
+
+const std::vector<Attributes::value_type>& NoEntries()
+{
+  static const std::vector<Attributes::value_type> empty;
+  return empty;
+}
+
+const Attributes::Uninterned& NoUninterned()
+{
+  static const Attributes::Uninterned empty;
+  return empty;
+}
+
+bool KeyLess(const Attributes::value_type& entry, AttributeKey key)
+{
+  return entry.first < key;
+}
+
+} // namespace
+
+AttributeKey::AttributeKey(std::string_view name)
+: mId(KeyRegistry::Get().Intern(name))
+{
+}
+
+AttributeKey AttributeKey::Find(std::string_view name)
+{
+  AttributeKey key;
+  key.mId = KeyRegistry::Get().Find(name);
+  return key;
+}
+
+const std::string& AttributeKey::GetName() const
+{
+  return KeyRegistry::Get().GetName(mId);
+}
+
+std::ostream& operator<<(std::ostream& stream, AttributeKey key)
+{
+  return stream << key.GetName();
+}
+
+Attributes::Attributes(std::initializer_list<std::pair<std::string_view, std::string>> entries)
+{
+  for(auto& entry : entries)
+  {
+    emplace(AttributeKey{entry.first}, entry.second);
+  }
+}
+
+Attributes::const_iterator Attributes::begin() const
+{
+  return mEntries ? mEntries->cbegin() : NoEntries().cbegin();
+}
+
+Attributes::const_iterator Attributes::end() const
+{
+  return mEntries ? mEntries->cend() : NoEntries().cend();
+}
+
+std::size_t Attributes::size() const
+{
+  return (mEntries ? mEntries->size() : 0u) + GetUninterned().size();
+}
+
+bool Attributes::empty() const
+{
+  return size() == 0u;
+}
+
+Attributes::const_iterator Attributes::find(AttributeKey key) const
+{
+  auto it = std::lower_bound(begin(), end(), key, KeyLess);
+  return it != end() && it->first == key ? it : end();
+}
+
+Attributes::const_iterator Attributes::find(std::string_view name) const
+{
+  auto key = AttributeKey::Find(name);
+  return key.IsValid() ? find(key) : end();
+}
+
+std::size_t Attributes::count(AttributeKey key) const
+{
+  return find(key) != end() || (key.IsValid() && FindUninterned(key.GetName())) ? 1u : 0u;
+}
+
+std::size_t Attributes::count(std::string_view name) const
+{
+  return GetValue(name) ? 1u : 0u;
+}
+
+const std::string* Attributes::GetValue(std::string_view name) const
+{
+  if(auto it = find(name); it != end())
+  {
+    return &it->second;
+  }
+  auto entry = FindUninterned(name);
+  return entry ? &entry->second : nullptr;
+}
+
+std::pair<Attributes::const_iterator, bool> Attributes::insert(value_type entry)
+{
+  if(!entry.first.IsValid())
+  {
+    return {end(), false};
+  }
+  AdoptInterned();
+  if(auto it = find(entry.first); it != end())
+  {
+    return {it, false};
+  }
+
+  auto& entries = Mutable();
+  auto  it      = std::lower_bound(entries.begin(), entries.end(), entry.first, KeyLess);
+  it            = entries.insert(it, std::move(entry));
+  return {it, true};
+}
+
+std::pair<Attributes::const_iterator, bool> Attributes::emplace(AttributeKey key, std::string value)
+{
+  return insert({key, std::move(value)});
+}
+
+void Attributes::Set(AttributeKey key, std::string value)
+{
+  if(!key.IsValid())
+  {
+    return;
+  }
+
+  AdoptInterned();
+  auto& entries = Mutable();
+  auto  it      = std::lower_bound(entries.begin(), entries.end(), key, KeyLess);
+  if(it == entries.end() || it->first != key)
+  {
+    entries.insert(it, {key, std::move(value)});
+  }
+  else
+  {
+    it->second = std::move(value);
+  }
+}
+
+bool Attributes::InsertByName(std::string_view name, std::string value)
+{
+  if(auto key = AttributeKey::Find(name); key.IsValid())
+  {
+    return insert({key, std::move(value)}).second;
+  }
+
+  if(FindUninterned(name))
+  {
+    return false;
+  }
+
+  if(!mUninterned)
+  {
+    mUninterned = std::make_shared<Uninterned>();
+  }
+  else if(mUninterned.use_count() > 1)
+  {
+    mUninterned = std::make_shared<Uninterned>(*mUninterned);
+  }
+  mUninterned->emplace_back(name, std::move(value));
+  return true;
+}
+
+const Attributes::Uninterned& Attributes::GetUninterned() const
+{
+  return mUninterned ? *mUninterned : NoUninterned();
+}
+
+std::size_t Attributes::erase(AttributeKey key)
+{
+  AdoptInterned();
+  if(find(key) == end())
+  {
+    return 0u;
+  }
+
+  auto& entries = Mutable();
+  entries.erase(std::lower_bound(entries.begin(), entries.end(), key, KeyLess));
+  return 1u;
+}
+
+void Attributes::clear()
+{
+  mEntries.reset();
+  mUninterned.reset();
+}
+
+bool Attributes::operator==(const Attributes& other) const
+{
+  return (mEntries == other.mEntries || std::equal(begin(), end(), other.begin(), other.end())) &&
+         (mUninterned == other.mUninterned || GetUninterned() == other.GetUninterned());
+}
+
+bool Attributes::operator!=(const Attributes& other) const
+{
+  return !(*this == other);
+}
+
+Attributes::Entries& Attributes::Mutable()
+{
+  if(!mEntries)
+  {
+    mEntries = std::make_shared<Entries>();
+  }
+  else if(mEntries.use_count() > 1)
+  {
+    mEntries = std::make_shared<Entries>(*mEntries);
+  }
+  return *mEntries;
+}
+
+void Attributes::AdoptInterned()
+{
+  auto& uninterned = GetUninterned();
+  if(std::none_of(uninterned.begin(), uninterned.end(), [](auto& entry) { return AttributeKey::Find(entry.first).IsValid(); }))
+  {
+    return;
+  }
+
+  // Rebuilt rather than edited in place, as copies may share the side list
+  Uninterned kept;
+  for(auto& entry : uninterned)
+  {
+    auto key = AttributeKey::Find(entry.first);
+    if(!key.IsValid())
+    {
+      kept.push_back(entry);
+      continue;
+    }
+
+    auto& entries = Mutable();
+    auto  it      = std::lower_bound(entries.begin(), entries.end(), key, KeyLess);
+    if(it == entries.end() || it->first != key)
+    {
+      entries.insert(it, {key, entry.second});
+    }
+  }
+  mUninterned = kept.empty() ? nullptr : std::make_shared<Uninterned>(std::move(kept));
+}
+
+const std::pair<std::string, std::string>* Attributes::FindUninterned(std::string_view name) const
+{
+  auto& uninterned = GetUninterned();
+  auto  it         = std::find_if(uninterned.begin(), uninterned.end(), [name](auto& entry) { return entry.first == name; });
+  return it != uninterned.end() ? &*it : nullptr;
+}
+
+} // namespace Accessibility
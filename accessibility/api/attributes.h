@@ -0,0 +1,251 @@
+#ifndef ACCESSIBILITY_ATTRIBUTES_H
+#define ACCESSIBILITY_ATTRIBUTES_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <accessibility/public-api/accessibility-common.h>
+
+namespace Accessibility
+{
+/**
+ * @brief Attribute keys with a fixed atom id.
+ *
+ * The names are listed in ATTRIBUTE_NAMES (accessibility-names.h).
+ */
+enum class WellKnownAttribute : uint32_t
+{
+  CLASS,
+  AUTOMATION_ID,
+  ITEM_COUNT,
+  SUPPRESS_SCREEN_READER,
+  VALUE_FORMAT,
+  FORCE_CHILD_SEARCH,
+  COLLECTION_INDEX,
+  COLLECTION_CONTAINER,
+  MAX_COUNT
+};
+
+/**
+ * @brief An interned attribute name.
+ *
+ * Keys are small integer atoms; comparing two keys never compares strings.
+ * Well-known keys have the ids of their WellKnownAttribute and cost nothing
+ * to create. Other names are interned process-wide on first use and keep
+ * their id for the lifetime of the process, so they should come from a
+ * bounded vocabulary; names received from other processes are only looked
+ * up with Find().
+ */
+class ACCESSIBILITY_API AttributeKey
+{
+public:
+  static constexpr uint32_t INVALID_ID = UINT32_MAX;
+
+  /**
+   * @brief Creates an invalid key, which names no attribute.
+   */
+  constexpr AttributeKey() = default;
+
+  constexpr AttributeKey(WellKnownAttribute attribute)
+  : mId(static_cast<uint32_t>(attribute))
+  {
+  }
+
+  /**
+   * @brief Creates the key for name, interning it if needed.
+   */
+  explicit AttributeKey(std::string_view name);
+
+  /**
+   * @brief Returns the key for name without interning it.
+   *
+   * @return The key, or an invalid key if name was never interned
+   */
+  static AttributeKey Find(std::string_view name);
+
+  constexpr uint32_t GetId() const
+  {
+    return mId;
+  }
+
+  constexpr bool IsValid() const
+  {
+    return mId != INVALID_ID;
+  }
+
+  /**
+   * @brief Returns the name; an invalid key has an empty name.
+   */
+  const std::string& GetName() const;
+
+  constexpr bool operator==(AttributeKey other) const
+  {
+    return mId == other.mId;
+  }
+
+  constexpr bool operator!=(AttributeKey other) const
+  {
+    return mId != other.mId;
+  }
+
+  /**
+   * @brief Orders keys by id, which is not the order of their names.
+   */
+  constexpr bool operator<(AttributeKey other) const
+  {
+    return mId < other.mId;
+  }
+
+private:
+  uint32_t mId{INVALID_ID};
+};
+
+ACCESSIBILITY_API std::ostream& operator<<(std::ostream& stream, AttributeKey key);
+
+/**
+ * @brief Object attributes: a set of name/value pairs with unique names.
+ *
+ * Entries are kept in a flat vector sorted by key id; objects rarely have
+ * more than a handful of attributes, so a lookup is a short binary search
+ * over contiguous memory with integer compares. Copies share the entries
+ * until one of them is modified, which makes returning attributes by value
+ * cheap. Iteration yields entries in key id order.
+ *
+ * Attributes travel over D-Bus as the a{ss} dictionary. A dictionary is read
+ * with InsertByName(): names this process already knows become keys, and the
+ * others are kept as plain strings in a side list, so a peer cannot grow the
+ * key registry. Both are written back when the attributes are sent on. A
+ * side-list name may be interned later; modifying the attributes then moves
+ * its entry under the key, so no name is ever stored twice.
+ */
+class ACCESSIBILITY_API Attributes
+{
+public:
+  using value_type     = std::pair<AttributeKey, std::string>;
+  using const_iterator = std::vector<value_type>::const_iterator;
+  using iterator       = const_iterator;
+  using Uninterned     = std::vector<std::pair<std::string, std::string>>;
+
+  Attributes() = default;
+
+  /**
+   * @brief Creates attributes from {name, value} pairs; the first of repeated names wins.
+   */
+  Attributes(std::initializer_list<std::pair<std::string_view, std::string>> entries);
+
+  /**
+   * @brief Iterates the keyed entries; GetUninterned() lists the others.
+   */
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  /**
+   * @brief Returns the number of entries, including the uninterned ones.
+   */
+  std::size_t size() const;
+  bool        empty() const;
+
+  /**
+   * @brief Finds a keyed entry; use GetValue() to also search the side list.
+   */
+  const_iterator find(AttributeKey key) const;
+  const_iterator find(std::string_view name) const;
+
+  std::size_t count(AttributeKey key) const;
+  std::size_t count(std::string_view name) const;
+
+  /**
+   * @brief Returns the value for name from either list without interning it.
+   *
+   * @return The value, or null if no entry has the name
+   */
+  const std::string* GetValue(std::string_view name) const;
+
+  /**
+   * @brief Adds an entry unless its key is already present.
+   *
+   * @return The entry with the key and whether it was added
+   */
+  std::pair<const_iterator, bool> insert(value_type entry);
+
+  std::pair<const_iterator, bool> emplace(AttributeKey key, std::string value);
+
+  /**
+   * @brief Sets the value for key, adding the entry if needed.
+   */
+  void Set(AttributeKey key, std::string value);
+
+  /**
+   * @brief Adds an entry by name without interning the name.
+   *
+   * An interned name is stored under its key; any other name goes to the
+   * side list. Entries whose name is already present in either list are not
+   * added.
+   *
+   * @return Whether the entry was added
+   */
+  bool InsertByName(std::string_view name, std::string value);
+
+  /**
+   * @brief Returns the entries whose names were not interned, in insertion order.
+   */
+  const Uninterned& GetUninterned() const;
+
+  std::size_t erase(AttributeKey key);
+
+  void clear();
+
+  bool operator==(const Attributes& other) const;
+  bool operator!=(const Attributes& other) const;
+
+private:
+  using Entries = std::vector<value_type>;
+
+  /**
+   * @brief Returns entries safe to modify, detaching from shared copies.
+   */
+  Entries& Mutable();
+
+  /**
+   * @brief Moves side-list entries whose names have been interned since under their keys.
+   */
+  void AdoptInterned();
+
+  /**
+   * @brief Returns the side-list entry named name, or null.
+   */
+  const std::pair<std::string, std::string>* FindUninterned(std::string_view name) const;
+
+  std::shared_ptr<Entries>    mEntries;    ///< Sorted by key; null when empty
+  std::shared_ptr<Uninterned> mUninterned; ///< Null when empty
+};
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_ATTRIBUTES_H
@@ -0,0 +1,98 @@
+#ifndef ACCESSIBILITY_API_AUDIO_SINK_H
+#define ACCESSIBILITY_API_AUDIO_SINK_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <functional>
+#include <memory>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/speech-synthesizer.h>
+#include <accessibility/api/tts-engine.h>
+
+namespace Accessibility
+{
+/**
+ * @brief Abstract interface for playing PCM utterances.
+ *
+ * An utterance is a sequence of segments enqueued under one CommandId and
+ * closed by a segment with last set. Segments play back to back in enqueue
+ * order, so an utterance can start before all of its segments exist.
+ * Segments are shared, never copied or modified by the sink.
+ */
+class AudioSink
+{
+public:
+  virtual ~AudioSink() = default;
+
+  /**
+   * @brief Queues a segment of an utterance.
+   *
+   * @param[in] id The utterance the segment belongs to
+   * @param[in] segment The audio; may be empty (e.g. to only close the utterance)
+   * @param[in] discardable Whether purge(true) may drop the utterance
+   * @param[in] last true for the final segment of the utterance
+   */
+  virtual void enqueue(CommandId id, std::shared_ptr<const PcmBuffer> segment, bool discardable, bool last) = 0;
+
+  /**
+   * @brief Stops playback and drops every queued utterance.
+   */
+  virtual void stop() = 0;
+
+  /**
+   * @brief Drops queued and playing utterances.
+   *
+   * @param[in] onlyDiscardable If true, only drop discardable utterances
+   */
+  virtual void purge(bool onlyDiscardable) = 0;
+
+  /**
+   * @brief Pauses playback.
+   *
+   * @return true if pause succeeded
+   */
+  virtual bool pause() = 0;
+
+  /**
+   * @brief Resumes paused playback.
+   *
+   * @return true if resume succeeded
+   */
+  virtual bool resume() = 0;
+
+  /**
+   * @brief Returns whether playback is paused.
+   */
+  virtual bool isPaused() const = 0;
+
+  /**
+   * @brief Registers a callback for when the first segment of an utterance starts playing.
+   */
+  virtual void onUtteranceStarted(std::function<void(CommandId)> callback) = 0;
+
+  /**
+   * @brief Registers a callback for when the last segment of an utterance finishes.
+   */
+  virtual void onUtteranceCompleted(std::function<void(CommandId)> callback) = 0;
+};
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_API_AUDIO_SINK_H
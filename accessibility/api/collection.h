@@ -38,7 +38,7 @@ public:
   using MatchRule = std::tuple<
     std::array<int32_t, 2>,
     int32_t,
-    std::unordered_map<std::string, std::string>,
+    Attributes,
     int32_t,
     std::array<int32_t, 4>,
     int32_t,
@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -116,6 +117,35 @@ enum class NeighborSearchMode
   RECURSE_TO_OUTSIDE              = 3,
 };
 
+class NodeProxy;
+
+/**
+ * @brief One GetNeighbor step, including the bridge's recurse flag.
+ *
+ * When recurse is set, node lives on another bus: either the root of
+ * embedded content (a socket) to descend into, or the embedding object
+ * (the plug) to continue from once embedded content is exhausted.
+ */
+struct NeighborHop
+{
+  std::shared_ptr<NodeProxy> node;
+  bool                       recurse{false};
+};
+
+/**
+ * @brief The fields of one node that a tree snapshot records.
+ */
+struct SnapshotFields
+{
+  std::string                             name;
+  Role                                    role{Role::UNKNOWN};
+  std::string                             description;
+  std::string                             automationId;
+  States                                  states;
+  Rect<int>                               extents; ///< Screen coordinates
+  std::vector<std::shared_ptr<NodeProxy>> children;
+};
+
 /**
  * @brief Abstract proxy interface for querying a single accessible node.
  *
@@ -165,6 +195,27 @@ public:
    */
   virtual Attributes getAttributes() = 0;
 
+  /**
+   * @brief Gets the value of a single attribute.
+   *
+   * The default implementation looks the key up in getAttributes().
+   *
+   * @param[in] key The attribute name
+   * @param[out] value The attribute value; unchanged if the attribute is not set
+   * @return true if the attribute is set
+   */
+  virtual bool getAttribute(AttributeKey key, std::string& value)
+  {
+    auto attributes = getAttributes();
+    auto it         = attributes.find(key);
+    if(it == attributes.end())
+    {
+      return false;
+    }
+    value = it->second;
+    return true;
+  }
+
   /**
    * @brief Gets the list of implemented AT-SPI interface names.
    */
@@ -210,6 +261,21 @@ public:
    */
   virtual std::shared_ptr<NodeProxy> getNeighbor(std::shared_ptr<NodeProxy> root, bool forward, NeighborSearchMode searchMode) = 0;
 
+  /**
+   * @brief Gets the neighboring node together with the recurse flag.
+   *
+   * Proxies that cannot cross process boundaries never set recurse.
+   *
+   * @param[in] root The root node for navigation scope, or nullptr outside the root's process
+   * @param[in] forward true for next, false for previous
+   * @param[in] searchMode The search mode
+   * @return The neighbor and whether it lives on another bus
+   */
+  virtual NeighborHop getNeighborHop(std::shared_ptr<NodeProxy> root, bool forward, NeighborSearchMode searchMode)
+  {
+    return {getNeighbor(std::move(root), forward, searchMode), false};
+  }
+
   /**
    * @brief Gets the navigable node at the given screen point.
    *
@@ -235,6 +301,29 @@ public:
    */
   virtual DefaultLabelInfo getDefaultLabelInfo() = 0;
 
+  /**
+   * @brief Fetches the snapshot fields and children without waiting for the replies.
+   *
+   * The default implementation fetches them with blocking calls and calls
+   * callback before returning. Remote proxies send every request at once
+   * and call callback from the loop that dispatches the replies, after the
+   * last one has arrived. Fields whose request failed keep their defaults.
+   *
+   * @param[in] callback Receives the fetched fields
+   */
+  virtual void fetchSnapshotFields(std::function<void(SnapshotFields)> callback)
+  {
+    SnapshotFields fields;
+    fields.name        = getName();
+    fields.role        = getRole();
+    fields.description = getDescription();
+    fields.states      = getStates();
+    fields.extents     = getExtents(CoordinateType::SCREEN);
+    fields.children    = getChildren();
+    getAttribute(WellKnownAttribute::AUTOMATION_ID, fields.automationId);
+    callback(std::move(fields));
+  }
+
   // --- Component interface (7 methods) ---
 
   /**
@@ -272,6 +361,16 @@ public:
    */
   virtual bool doGesture(const GestureInfo& gesture) = 0;
 
+  /**
+   * @brief Checks whether this node scrolls its children.
+   *
+   * Not exposed over AT-SPI; remote proxies report false.
+   */
+  virtual bool isScrollable()
+  {
+    return false;
+  }
+
   // --- Action interface (3 methods) ---
 
   /**
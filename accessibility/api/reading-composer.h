@@ -19,6 +19,8 @@
  */
 
 // EXTERNAL INCLUDES
+#include <cstdint>
+#include <memory>
 #include <string>
 
 // INTERNAL INCLUDES
@@ -37,12 +39,27 @@ struct ReadingComposerConfig
   bool includeTvTraits    = false; ///< TV: true — include TV-specific role/state traits
 };
 
+/**
+ * @brief Hit statistics of the ReadingComposer result cache.
+ */
+struct ReadingComposerStats
+{
+  uint64_t hits{0};
+  uint64_t misses{0};
+};
+
 /**
  * @brief Composes human-readable TTS strings from ReadingMaterial.
  *
  * Assembles the spoken output from a node's reading material by combining
  * the name, role trait, state trait, and description into a single string
  * suitable for TTS output.
+ *
+ * The order of the parts and their separators is compiled once from the
+ * config; composing then appends each part straight into the output buffer.
+ * The last few results are cached by the fields they depend on, so reading
+ * the same node again (e.g. after PROPERTY_CHANGED) is a lookup.
+ * Thread-safe.
  */
 class ReadingComposer
 {
@@ -54,6 +71,12 @@ public:
    */
   explicit ReadingComposer(ReadingComposerConfig config = ReadingComposerConfig{});
 
+  ~ReadingComposer();
+
+  // Non-copyable
+  ReadingComposer(const ReadingComposer&)            = delete;
+  ReadingComposer& operator=(const ReadingComposer&) = delete;
+
   /**
    * @brief Composes the full TTS string from reading material.
    *
@@ -62,6 +85,16 @@ public:
    */
   std::string compose(const ReadingMaterial& rm) const;
 
+  /**
+   * @brief Composes the full TTS string into a caller-owned buffer.
+   *
+   * Reusing the buffer avoids allocating once its capacity suffices.
+   *
+   * @param[in] rm The reading material to compose
+   * @param[out] out Replaced with the composed TTS string
+   */
+  void composeInto(const ReadingMaterial& rm, std::string& out) const;
+
   /**
    * @brief Composes the role trait portion of the reading.
    *
@@ -86,8 +119,14 @@ public:
    */
   std::string composeDescriptionTrait(const ReadingMaterial& rm) const;
 
+  /**
+   * @brief Gets the result cache statistics.
+   */
+  ReadingComposerStats getStats() const;
+
 private:
-  ReadingComposerConfig mConfig;
+  struct Impl;
+  std::unique_ptr<Impl> mImpl;
 };
 
 } // namespace Accessibility
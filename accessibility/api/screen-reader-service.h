@@ -28,6 +28,7 @@
 #include <accessibility/api/reading-composer.h>
 #include <accessibility/api/screen-reader-switch.h>
 #include <accessibility/api/settings-provider.h>
+#include <accessibility/api/task-executor.h>
 #include <accessibility/api/tts-engine.h>
 
 namespace Accessibility
@@ -38,16 +39,28 @@ namespace Accessibility
  * Extends AccessibilityService with TTS, auditory/haptic feedback,
  * reading composition, settings management, and direct reading support.
  *
+ * Gestures and key events are handled on a TaskExecutor. A newer navigation
+ * gesture supersedes in-flight work for older ones: nodes passed over by a
+ * burst of flicks are highlighted but only the last one is read.
+ *
+ * The executor is chosen by whoever picks the registry. With an IPC-backed
+ * registry (AtSpiAppRegistry, TidlAppRegistry) every NodeProxy call blocks
+ * on a round trip, so the caller passes a ThreadTaskExecutor; otherwise the
+ * gesture thread stalls and flicks cannot supersede each other. The inline
+ * default suits in-process registries such as DirectAppRegistry, whose
+ * objects must be used on the toolkit thread that delivers the gestures.
+ *
  * Usage:
  * @code
  *   auto service = std::make_unique<ScreenReaderService>(
- *     std::move(registry),
+ *     std::make_unique<AtSpiAppRegistry>(),
  *     std::move(gestureProvider),
  *     std::move(ttsEngine),
  *     std::move(feedbackProvider),
  *     std::move(settingsProvider),
  *     std::move(screenReaderSwitch),
- *     std::move(directReadingService));
+ *     std::move(directReadingService),
+ *     std::make_unique<ThreadTaskExecutor>());
  *   service->startScreenReader();
  * @endcode
  */
@@ -64,6 +77,8 @@ public:
    * @param[in] settingsProvider The settings provider
    * @param[in] screenReaderSwitch The screen reader on/off switch
    * @param[in] directReadingService The direct reading service
+   * @param[in] executor Runs gesture handling; nullptr runs it inline on the gesture thread,
+   *            which only suits in-process registries (see the class description)
    */
   ScreenReaderService(std::unique_ptr<AppRegistry>          registry,
                       std::unique_ptr<GestureProvider>      gestureProvider,
@@ -71,7 +86,8 @@ public:
                       std::unique_ptr<FeedbackProvider>     feedbackProvider,
                       std::unique_ptr<SettingsProvider>     settingsProvider,
                       std::unique_ptr<ScreenReaderSwitch>   screenReaderSwitch,
-                      std::unique_ptr<DirectReadingService> directReadingService);
+                      std::unique_ptr<DirectReadingService> directReadingService,
+                      std::unique_ptr<TaskExecutor>         executor = nullptr);
 
   ~ScreenReaderService() override;
 
@@ -82,6 +98,8 @@ public:
 
   /**
    * @brief Stops the screen reader, disabling TTS and event processing.
+   *
+   * Waits for gesture work already running on the executor to finish.
    */
   void stopScreenReader();
 
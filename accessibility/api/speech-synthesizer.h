@@ -0,0 +1,90 @@
+#ifndef ACCESSIBILITY_API_SPEECH_SYNTHESIZER_H
+#define ACCESSIBILITY_API_SPEECH_SYNTHESIZER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Accessibility
+{
+/**
+ * @brief Mono signed 16-bit PCM audio.
+ */
+struct PcmBuffer
+{
+  uint32_t             sampleRate{0};
+  std::vector<int16_t> samples;
+};
+
+/**
+ * @brief Abstract interface for TTS backends that render text to PCM.
+ *
+ * Unlike TtsEngine, a synthesizer does not play audio; the caller decides
+ * when and how the samples reach the speaker. This lets rendered phrases
+ * be cached and replayed (see CachedTtsEngine).
+ */
+class SpeechSynthesizer
+{
+public:
+  virtual ~SpeechSynthesizer() = default;
+
+  /**
+   * @brief Identifies the current voice settings (voice, rate, pitch, ...).
+   *
+   * Audio rendered under one key is only reused while the key is unchanged.
+   */
+  virtual std::string getVoiceKey() const = 0;
+
+  /**
+   * @brief Renders text to PCM, blocking until done.
+   *
+   * @param[in] text The UTF-8 text to render
+   * @param[out] pcm The rendered audio
+   * @return false if synthesis failed
+   */
+  virtual bool synthesize(const std::string& text, PcmBuffer& pcm) = 0;
+
+  /**
+   * @brief Renders text to PCM, delivering audio in blocks as it is rendered.
+   *
+   * Lets playback start before the whole text is rendered. The default
+   * implementation delivers the result of synthesize() as a single block.
+   *
+   * @param[in] text The UTF-8 text to render
+   * @param[in] onBlock Called with each block; returning false cancels synthesis
+   * @return false if synthesis failed or was cancelled
+   */
+  virtual bool synthesizeStream(const std::string& text, const std::function<bool(std::shared_ptr<const PcmBuffer>)>& onBlock)
+  {
+    auto pcm = std::make_shared<PcmBuffer>();
+    if(!synthesize(text, *pcm))
+    {
+      return false;
+    }
+    return pcm->samples.empty() || onBlock(std::move(pcm));
+  }
+};
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_API_SPEECH_SYNTHESIZER_H
@@ -0,0 +1,121 @@
+#ifndef ACCESSIBILITY_API_TASK_EXECUTOR_H
+#define ACCESSIBILITY_API_TASK_EXECUTOR_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace Accessibility
+{
+/**
+ * @brief Abstract interface for running service work off the calling thread.
+ *
+ * Tasks posted to one executor run one at a time, in the order they were
+ * posted. Implementations may run them inline, on a worker thread, or from
+ * the platform main loop.
+ */
+class TaskExecutor
+{
+public:
+  virtual ~TaskExecutor() = default;
+
+  /**
+   * @brief Queues a task for execution.
+   *
+   * @param[in] task The task to run
+   */
+  virtual void post(std::function<void()> task) = 0;
+
+  /**
+   * @brief Blocks until every task posted so far has finished.
+   *
+   * Must not be called from inside a task.
+   */
+  virtual void waitIdle() = 0;
+};
+
+/**
+ * @brief Cheap, copyable handle that reports whether its work was superseded.
+ *
+ * A default-constructed token is never cancelled.
+ */
+class CancellationToken
+{
+public:
+  CancellationToken() = default;
+
+  CancellationToken(std::shared_ptr<const std::atomic<uint64_t>> generation, uint64_t issued)
+  : mGeneration(std::move(generation)),
+    mIssued(issued)
+  {
+  }
+
+  /**
+   * @brief Checks whether a newer token has been issued, or the source was cancelled.
+   */
+  bool isCancelled() const
+  {
+    return mGeneration && mGeneration->load(std::memory_order_acquire) != mIssued;
+  }
+
+private:
+  std::shared_ptr<const std::atomic<uint64_t>> mGeneration;
+  uint64_t                                     mIssued{0};
+};
+
+/**
+ * @brief Issues CancellationTokens where only the latest one stays live.
+ *
+ * Issuing a token cancels every token issued before it, which gives
+ * "latest request wins" semantics for work such as gesture navigation.
+ */
+class CancellationSource
+{
+public:
+  CancellationSource()
+  : mGeneration(std::make_shared<std::atomic<uint64_t>>(0))
+  {
+  }
+
+  /**
+   * @brief Cancels all outstanding tokens and returns a new live one.
+   */
+  CancellationToken next()
+  {
+    return CancellationToken(mGeneration, mGeneration->fetch_add(1, std::memory_order_acq_rel) + 1);
+  }
+
+  /**
+   * @brief Cancels all outstanding tokens.
+   */
+  void cancel()
+  {
+    mGeneration->fetch_add(1, std::memory_order_acq_rel);
+  }
+
+private:
+  std::shared_ptr<std::atomic<uint64_t>> mGeneration;
+};
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_API_TASK_EXECUTOR_H
@@ -19,6 +19,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <string>
@@ -103,6 +104,18 @@ public:
    * @param[in] callback Called with the CommandId of the completed utterance
    */
   virtual void onUtteranceCompleted(std::function<void(CommandId)> callback) = 0;
+
+  /**
+   * @brief Returns how many utterances the engine accepts beyond the playing one.
+   *
+   * Engines that render asynchronously prepare queued utterances while the
+   * current one plays, so they start without a gap. TtsCommandQueue keeps
+   * this many commands submitted ahead. Defaults to 0: one at a time.
+   */
+  virtual std::size_t getLookahead() const
+  {
+    return 0;
+  }
 };
 
 } // namespace Accessibility
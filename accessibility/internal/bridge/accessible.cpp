@@ -90,24 +90,24 @@ const auto IncludeShowingOnly = [](Accessible::DumpDetailLevel detailLevel) -> b
   return detailLevel == Accessible::DumpDetailLevel::DUMP_SHORT_SHOWING_ONLY || detailLevel == Accessible::DumpDetailLevel::DUMP_FULL_SHOWING_ONLY;
 };
 
-// Helper function to get type name from attributes map.
-const auto GetTypeString = [](const Attributes& attrs) -> std::string
+// Helper function to get type name from the "class" attribute.
+const auto GetTypeString = [](Accessible* node) -> std::string
 {
   std::ostringstream msg;
-  if(auto iter = attrs.find("class"); iter != attrs.end())
+  if(std::string type; node->GetAttribute(WellKnownAttribute::CLASS, type))
   {
-    msg << Quote(KEY_TYPE) << " : " << Quote(iter->second);
+    msg << Quote(KEY_TYPE) << " : " << Quote(type);
   }
   return msg.str();
 };
 
-// Helper function to get type name from attributes map.
-const auto GetAutomationIdString = [](const Attributes& attrs) -> std::string
+// Helper function to get the automation id attribute as a string.
+const auto GetAutomationIdString = [](Accessible* node) -> std::string
 {
   std::ostringstream msg;
-  if(auto iter = attrs.find(KEY_AUTOMATION_ID); iter != attrs.end())
+  if(std::string automationId; node->GetAttribute(WellKnownAttribute::AUTOMATION_ID, automationId))
   {
-    msg << Quote(KEY_AUTOMATION_ID) << " : " << Quote(iter->second, true);
+    msg << Quote(KEY_AUTOMATION_ID) << " : " << Quote(automationId, true);
   }
   return msg.str();
 };
@@ -133,13 +133,13 @@ const auto GetOtherAttributesString = [](const Attributes& attrs) -> std::string
   std::ostringstream msg;
   for(const auto& iter : attrs)
   {
-    if(iter.first != "class" && iter.first != KEY_AUTOMATION_ID)
+    if(iter.first != WellKnownAttribute::CLASS && iter.first != WellKnownAttribute::AUTOMATION_ID)
     {
       if(!msg.str().empty())
       {
         msg << ", ";
       }
-      msg << Quote(iter.first) << ": " << Quote(iter.second, true);
+      msg << Quote(iter.first.GetName()) << ": " << Quote(iter.second, true);
     }
   }
   return msg.str();
@@ -197,13 +197,12 @@ std::string DumpJson(Accessible* node, Accessible::DumpDetailLevel detailLevel,
     msg << ", " << value;
   }
 
-  const auto attributes = node->GetAttributes();
-  if(auto type = GetTypeString(attributes); !type.empty())
+  if(auto type = GetTypeString(node); !type.empty())
   {
     msg << ", " << type;
   }
 
-  if(auto automationId = GetAutomationIdString(attributes); !automationId.empty())
+  if(auto automationId = GetAutomationIdString(node); !automationId.empty())
   {
     msg << ", " << automationId;
   }
@@ -220,7 +219,7 @@ std::string DumpJson(Accessible* node, Accessible::DumpDetailLevel detailLevel,
 
   if(detailLevel == Accessible::DumpDetailLevel::DUMP_FULL || detailLevel == Accessible::DumpDetailLevel::DUMP_FULL_SHOWING_ONLY)
   {
-    if(auto otherAttrs = GetOtherAttributesString(attributes); !otherAttrs.empty())
+    if(auto otherAttrs = GetOtherAttributesString(node->GetAttributes()); !otherAttrs.empty())
     {
       msg << ", " << Quote(KEY_ATTRS) << ": { " << otherAttrs << " }";
     }
@@ -265,6 +264,18 @@ std::vector<Accessible*> Accessible::GetChildren()
   return {};
 }
 
+bool Accessible::GetAttribute(AttributeKey key, std::string& value) const
+{
+  auto attributes = GetAttributes();
+  auto iter       = attributes.find(key);
+  if(iter == attributes.end())
+  {
+    return false;
+  }
+  value = iter->second;
+  return true;
+}
+
 bool Accessible::IsHidden() const
 {
   return false;
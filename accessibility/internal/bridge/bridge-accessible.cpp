@@ -50,29 +50,24 @@ inline bool EqualsZero(float value)
   return std::abs(value) <= std::numeric_limits<float>::epsilon();
 }
 
-constexpr const char* VALUE_FORMAT_KEY          = "value_format";
-constexpr const char* VALUE_FORMAT_TEXT_VAL     = "text";
-constexpr const char* FORCE_CHILD_SEARCH_ATTR   = "forceChildSearch";
-constexpr const char* COLLECTION_INDEX_ATTR     = "collection_index";
-constexpr const char* COLLECTION_CONTAINER_ATTR = "collection_container";
+constexpr const char* VALUE_FORMAT_TEXT_VAL = "text";
 
 // Comparison function for sorting by collection_index.
 // Items with collection_index come before those without.
 // If both have it, sorted by the integer value.
 bool SortByCollectionIndex(Accessible* lhs, Accessible* rhs)
 {
-  auto lhsAttr = lhs->GetAttributes();
-  auto rhsAttr = rhs->GetAttributes();
+  std::string lhsCollectionIdx;
+  std::string rhsCollectionIdx;
+  bool        lhsHasCollectionIdx = lhs->GetAttribute(WellKnownAttribute::COLLECTION_INDEX, lhsCollectionIdx);
+  bool        rhsHasCollectionIdx = rhs->GetAttribute(WellKnownAttribute::COLLECTION_INDEX, rhsCollectionIdx);
 
-  auto lhsCollectionIdxAttr = lhsAttr.find(COLLECTION_INDEX_ATTR);
-  auto rhsCollectionIdxAttr = rhsAttr.find(COLLECTION_INDEX_ATTR);
-
-  if(lhsCollectionIdxAttr != lhsAttr.end() && rhsCollectionIdxAttr != rhsAttr.end())
+  if(lhsHasCollectionIdx && rhsHasCollectionIdx)
   {
     try
     {
-      int lhsIndex = std::stoi(lhsCollectionIdxAttr->second);
-      int rhsIndex = std::stoi(rhsCollectionIdxAttr->second);
+      int lhsIndex = std::stoi(lhsCollectionIdx);
+      int rhsIndex = std::stoi(rhsCollectionIdx);
       return lhsIndex < rhsIndex;
     }
     catch(const std::invalid_argument&)
@@ -84,7 +79,7 @@ bool SortByCollectionIndex(Accessible* lhs, Accessible* rhs)
       return false; // Or some default handling
     }
   }
-  else if(lhsCollectionIdxAttr != lhsAttr.end())
+  else if(lhsHasCollectionIdx)
   {
     return true; // lhs has it, rhs doesn't
   }
@@ -212,10 +207,8 @@ void ApplySortingToChildren(Accessible* parent, std::vector<Accessibility::Acces
     return;
   }
 
-  const auto& attributes                = parent->GetAttributes();
-  auto        collectionContainerAttrIt = attributes.find(COLLECTION_CONTAINER_ATTR);
-
-  if(collectionContainerAttrIt != attributes.end() && collectionContainerAttrIt->second == "true")
+  std::string collectionContainer;
+  if(parent->GetAttribute(WellKnownAttribute::COLLECTION_CONTAINER, collectionContainer) && collectionContainer == "true")
   {
     // If this object is a collection container, sort by collection index.
     SortChildrenByCollectionIndex(children);
@@ -227,18 +220,9 @@ void ApplySortingToChildren(Accessible* parent, std::vector<Accessibility::Acces
   }
 }
 
-static bool AcceptObjectCheckRelations(Accessible* obj)
+static bool AcceptObjectCheckRelations(Accessible* obj, RelationIndex& relationIndex)
 {
-  auto relations = obj->GetRelationSet();
-
-  for(const auto& it : relations)
-  {
-    if(it.mRelationType == RelationType::CONTROLLED_BY)
-    {
-      return false;
-    }
-  }
-  return true;
+  return !relationIndex.HasRelation(obj, RelationType::CONTROLLED_BY);
 }
 
 static Accessible* GetScrollableParent(Accessible* obj)
@@ -307,7 +291,7 @@ static bool IsChildVisibleInScrollableParent(Accessible* start, Accessible* acce
   return IsVisibleInScrollableParent(start) || IsVisibleInScrollableParent(accessible);
 }
 
-static bool IsObjectAcceptable(Accessible* obj)
+static bool IsObjectAcceptable(Accessible* obj, RelationIndex& relationIndex)
 {
   if(!obj)
   {
@@ -319,7 +303,7 @@ static bool IsObjectAcceptable(Accessible* obj)
   {
     return false;
   }
-  if(!AcceptObjectCheckRelations(obj))
+  if(!AcceptObjectCheckRelations(obj, relationIndex))
   {
     return false;
   }
@@ -483,24 +467,7 @@ static std::vector<Accessible*> GetNonDuplicatedScrollableParents(Accessible* ch
   return scrollableParentsOfChild;
 }
 
-Accessible* GetObjectInRelation(Accessible* obj, RelationType relationType)
-{
-  if(!obj)
-  {
-    return nullptr;
-  }
-
-  for(auto& relation : obj->GetRelationSet())
-  {
-    if(relation.mRelationType == relationType && !relation.mTargets.empty())
-    {
-      return relation.mTargets.front();
-    }
-  }
-  return nullptr;
-}
-
-Accessible* CalculateNavigableAccessibleAtPoint(Accessible* root, Point point, CoordinateType type, unsigned int maxRecursionDepth, bool isForceSearchPropagated)
+Accessible* CalculateNavigableAccessibleAtPoint(Accessible* root, Point point, CoordinateType type, unsigned int maxRecursionDepth, bool isForceSearchPropagated, RelationIndex& relationIndex)
 {
   if(!root || maxRecursionDepth == 0)
   {
@@ -509,12 +476,11 @@ Accessible* CalculateNavigableAccessibleAtPoint(Accessible* root, Point point, C
 
   LOG() << "CalculateNavigableAccessibleAtPoint: checking: " << MakeIndent(maxRecursionDepth) << GetComponentInfo(root);
 
-  bool        forceChildSearch     = false;
-  const auto& attributes           = root->GetAttributes();
-  auto        forceChildSearchAttr = attributes.find(FORCE_CHILD_SEARCH_ATTR);
-  if(forceChildSearchAttr != attributes.end())
+  bool        forceChildSearch = false;
+  std::string forceChildSearchAttr;
+  if(root->GetAttribute(WellKnownAttribute::FORCE_CHILD_SEARCH, forceChildSearchAttr))
   {
-    forceChildSearch = std::atoi(forceChildSearchAttr->second.c_str()) == 1;
+    forceChildSearch = std::atoi(forceChildSearchAttr.c_str()) == 1;
     ACCESSIBILITY_LOG_INFO("Force child search attr is set to %d.", forceChildSearch);
   }
 
@@ -529,7 +495,7 @@ Accessible* CalculateNavigableAccessibleAtPoint(Accessible* root, Point point, C
   for(auto childIt = children.rbegin(); childIt != children.rend(); childIt++)
   {
     //check recursively all children first
-    auto result = CalculateNavigableAccessibleAtPoint(*childIt, point, type, maxRecursionDepth - 1, currentForceSearchActive);
+    auto result = CalculateNavigableAccessibleAtPoint(*childIt, point, type, maxRecursionDepth - 1, currentForceSearchActive, relationIndex);
     if(result)
     {
       return result;
@@ -537,14 +503,14 @@ Accessible* CalculateNavigableAccessibleAtPoint(Accessible* root, Point point, C
   }
 
   //Found a candidate, all its children are already checked
-  auto controledBy = GetObjectInRelation(root, RelationType::CONTROLLED_BY);
+  auto controledBy = relationIndex.GetFirstTarget(root, RelationType::CONTROLLED_BY);
   if(!controledBy)
   {
     controledBy = root;
   }
 
   auto isContainingPoint = controledBy->IsAccessibleContainingPoint(point, type);
-  if((controledBy->IsProxy() && isContainingPoint) || (IsObjectAcceptable(controledBy) && (!currentForceSearchActive || isContainingPoint)))
+  if((controledBy->IsProxy() && isContainingPoint) || (IsObjectAcceptable(controledBy, relationIndex) && (!currentForceSearchActive || isContainingPoint)))
   {
     LOG() << "CalculateNavigableAccessibleAtPoint: found:    " << MakeIndent(maxRecursionDepth) << GetComponentInfo(root) << " " << controledBy->IsProxy();
     return controledBy;
@@ -570,6 +536,7 @@ void BridgeAccessible::RegisterInterfaces()
   AddFunctionToInterface(*desc, "GetLocalizedRoleName", &BridgeAccessible::GetLocalizedRoleName);
   AddFunctionToInterface(*desc, "GetState", &BridgeAccessible::GetStates);
   AddFunctionToInterface(*desc, "GetAttributes", &BridgeAccessible::GetAttributes);
+  AddFunctionToInterface(*desc, "GetAttributeValue", &BridgeAccessible::GetAttributeValue);
   AddFunctionToInterface(*desc, "GetInterfaces", &BridgeAccessible::GetInterfacesAsStrings);
   AddFunctionToInterface(*desc, "GetChildAtIndex", &BridgeAccessible::GetChildAtIndex);
   AddFunctionToInterface(*desc, "GetChildren", &BridgeAccessible::GetChildren);
@@ -594,23 +561,11 @@ Accessible* BridgeAccessible::FindSelf() const
 
 BridgeAccessible::ReadingMaterialType BridgeAccessible::GetReadingMaterial()
 {
-  auto self                     = FindSelf();
-  auto findObjectByRelationType = [this, &self](RelationType relationType)
-  {
-    auto relations = self->GetRelationSet();
-    auto relation  = std::find_if(relations.begin(),
-                                  relations.end(),
-                                  [relationType](const Accessibility::Relation& relation) -> bool
-     {
-      return relation.mRelationType == relationType;
-    });
-    return relations.end() != relation && !relation->mTargets.empty() ? relation->mTargets.back() : nullptr;
-  };
-
-  auto        labellingObject = findObjectByRelationType(RelationType::LABELLED_BY);
+  auto        self            = FindSelf();
+  auto        labellingObject = mRelationIndex.GetLastTarget(self, RelationType::LABELLED_BY);
   std::string labeledByName   = labellingObject ? labellingObject->GetName() : "";
 
-  auto describedByObject = findObjectByRelationType(RelationType::DESCRIBED_BY);
+  auto describedByObject = mRelationIndex.GetLastTarget(self, RelationType::DESCRIBED_BY);
   auto attributes        = self->GetAttributes();
 
   double      currentValue = 0.0;
@@ -632,7 +587,7 @@ BridgeAccessible::ReadingMaterialType BridgeAccessible::GetReadingMaterial()
     currentValueText = self->GetValue();
     if(!currentValueText.empty())
     {
-      attributes.insert({VALUE_FORMAT_KEY, VALUE_FORMAT_TEXT_VAL});
+      attributes.emplace(WellKnownAttribute::VALUE_FORMAT, VALUE_FORMAT_TEXT_VAL);
     }
   }
 
@@ -660,7 +615,7 @@ BridgeAccessible::ReadingMaterialType BridgeAccessible::GetReadingMaterial()
     }
   }
 
-  auto    itemCount         = attributes.find("item_count");
+  auto    itemCount         = attributes.find(WellKnownAttribute::ITEM_COUNT);
   auto    atspiRole         = self->GetRole();
   int32_t listChildrenCount = 0;
   if(itemCount != attributes.end())
@@ -764,7 +719,7 @@ BridgeAccessible::NodeInfoType BridgeAccessible::GetNodeInfo()
     currentValueText = self->GetValue();
     if(!currentValueText.empty())
     {
-      attributes.insert({VALUE_FORMAT_KEY, VALUE_FORMAT_TEXT_VAL});
+      attributes.emplace(WellKnownAttribute::VALUE_FORMAT, VALUE_FORMAT_TEXT_VAL);
     }
   }
 
@@ -803,7 +758,7 @@ DBus::ValueOrError<Accessible*, uint8_t, Accessible*> BridgeAccessible::GetNavig
   }
 
   LOG() << "GetNavigableAtPoint: " << x << ", " << y << " type: " << coordinateType;
-  auto target  = CalculateNavigableAccessibleAtPoint(accessible, {x, y}, cType, GET_NAVIGABLE_AT_POINT_MAX_RECURSION_DEPTH, false);
+  auto target  = CalculateNavigableAccessibleAtPoint(accessible, {x, y}, cType, GET_NAVIGABLE_AT_POINT_MAX_RECURSION_DEPTH, false, mRelationIndex);
   bool recurse = false;
   if(target)
   {
@@ -814,7 +769,7 @@ DBus::ValueOrError<Accessible*, uint8_t, Accessible*> BridgeAccessible::GetNavig
       do
       {
         parent = parent->GetParent();
-        if(IsObjectAcceptable(parent))
+        if(IsObjectAcceptable(parent, mRelationIndex))
         {
           deputy = parent;
           LOG() << "deputy:    " << GetComponentInfo(deputy);
@@ -1028,7 +983,7 @@ Accessible* BridgeAccessible::CalculateNeighbor(Accessible* root, Accessible* st
     //    Objects with those roles shouldnt be reachable, when navigating next / prev.
     bool areAllChildrenVisitedOrMovingForward = (children.size() == 0 || forward || areAllChildrenVisited);
 
-    if(!forceNext && node != start && areAllChildrenVisitedOrMovingForward && IsObjectAcceptable(node) && IsChildVisibleInScrollableParent(start, node))
+    if(!forceNext && node != start && areAllChildrenVisitedOrMovingForward && IsObjectAcceptable(node, mRelationIndex) && IsChildVisibleInScrollableParent(start, node))
     {
       if(start == NULL || IsRoleAcceptableWhenNavigatingNextPrev(node))
       {
@@ -1036,7 +991,7 @@ Accessible* BridgeAccessible::CalculateNeighbor(Accessible* root, Accessible* st
       }
     }
 
-    Accessible* nextRelatedInDirection = !forceNext ? GetObjectInRelation(node, forward ? RelationType::FLOWS_TO : RelationType::FLOWS_FROM) : nullptr;
+    Accessible* nextRelatedInDirection = !forceNext ? mRelationIndex.GetFirstTarget(node, forward ? RelationType::FLOWS_TO : RelationType::FLOWS_FROM) : nullptr;
     if(nextRelatedInDirection && start && start->GetStates()[State::DEFUNCT])
     {
       nextRelatedInDirection = NULL;
@@ -1135,25 +1090,58 @@ DBus::ValueOrError<std::array<uint32_t, 2>> BridgeAccessible::GetStates()
   return FindSelf()->GetStates().GetRawData();
 }
 
-DBus::ValueOrError<std::unordered_map<std::string, std::string>> BridgeAccessible::GetAttributes()
+DBus::ValueOrError<Attributes> BridgeAccessible::GetAttributes()
 {
-  auto                                         self       = FindSelf();
-  std::unordered_map<std::string, std::string> attributes = self->GetAttributes();
+  auto       self       = FindSelf();
+  Attributes attributes = self->GetAttributes();
 
   if(mIsScreenReaderSuppressed)
   {
-    attributes.insert({"suppress-screen-reader", "true"});
+    attributes.emplace(WellKnownAttribute::SUPPRESS_SCREEN_READER, "true");
   }
 
   auto valueInterface = self->GetFeature<Value>();
   if(!valueInterface && !self->GetValue().empty())
   {
-    attributes.insert({VALUE_FORMAT_KEY, VALUE_FORMAT_TEXT_VAL});
+    attributes.emplace(WellKnownAttribute::VALUE_FORMAT, VALUE_FORMAT_TEXT_VAL);
   }
 
   return attributes;
 }
 
+DBus::ValueOrError<bool, std::string> BridgeAccessible::GetAttributeValue(std::string name)
+{
+  auto self = FindSelf();
+
+  // Toolkits may intern their names only when building GetAttributes(), so
+  // an unknown name is looked up by name there; the caller's string is never
+  // interned
+  auto key = AttributeKey::Find(name);
+  if(!key.IsValid())
+  {
+    auto attributes = self->GetAttributes();
+    auto found      = attributes.GetValue(name);
+    return found ? DBus::ValueOrError<bool, std::string>{true, *found} : DBus::ValueOrError<bool, std::string>{false, std::string{}};
+  }
+
+  std::string value;
+
+  // Same precedence as GetAttributes(): the object's own value comes first
+  if(self->GetAttribute(key, value))
+  {
+    return {true, std::move(value)};
+  }
+  if(key == WellKnownAttribute::SUPPRESS_SCREEN_READER && mIsScreenReaderSuppressed)
+  {
+    return {true, "true"};
+  }
+  if(key == WellKnownAttribute::VALUE_FORMAT && !self->GetFeature<Value>() && !self->GetValue().empty())
+  {
+    return {true, VALUE_FORMAT_TEXT_VAL};
+  }
+  return {false, std::string{}};
+}
+
 DBus::ValueOrError<std::vector<std::string>> BridgeAccessible::GetInterfacesAsStrings()
 {
   return FindSelf()->GetInterfacesAsStrings();
@@ -1178,7 +1166,7 @@ std::string BridgeAccessible::GetName()
   return FindSelf()->GetName();
 }
 
-DBus::ValueOrError<Accessible*, uint32_t, std::unordered_map<std::string, std::string>> BridgeAccessible::GetDefaultLabelInfo()
+DBus::ValueOrError<Accessible*, uint32_t, Attributes> BridgeAccessible::GetDefaultLabelInfo()
 {
   auto* defaultLabel = GetDefaultLabel(FindSelf());
   assert(defaultLabel);
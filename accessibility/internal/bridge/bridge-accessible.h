@@ -64,7 +64,7 @@ public:
   };
 
   using ReadingMaterialType = DBus::ValueOrError<
-    std::unordered_map<std::string, std::string>, // attributes
+    Accessibility::Attributes,                    // attributes
     std::string,                                  // name
     std::string,                                  // labeledByName
     std::string,                                  // textIfceName
@@ -95,7 +95,7 @@ public:
     std::string,                                    // role name
     std::string,                                    // name
     std::string,                                    // toolkit name
-    std::unordered_map<std::string, std::string>,   // attributes
+    Accessibility::Attributes,                // attributes
     Accessibility::States,                    // states
     std::tuple<int32_t, int32_t, int32_t, int32_t>, // screen extents
     std::tuple<int32_t, int32_t, int32_t, int32_t>, // window extents
@@ -171,7 +171,15 @@ public:
   /**
    * @copydoc Accessibility::Accessible::GetAttributes()
    */
-  DBus::ValueOrError<std::unordered_map<std::string, std::string>> GetAttributes();
+  DBus::ValueOrError<Accessibility::Attributes> GetAttributes();
+
+  /**
+   * @brief Gets the value of one attribute, as GetAttributes() would report it.
+   *
+   * @param[in] name The attribute name
+   * @return Whether the attribute is set, and its value
+   */
+  DBus::ValueOrError<bool, std::string> GetAttributeValue(std::string name);
 
   /**
    * @copydoc Accessibility::Accessible::GetInterfacesAsStrings()
@@ -209,7 +217,7 @@ public:
    * @note This is a Tizen only feature not present in upstream ATSPI.
    * Feature can be enabled/disabled for particular context root object by setting value of its accessibility attribute "default_label".
    */
-  DBus::ValueOrError<Accessibility::Accessible*, uint32_t, std::unordered_map<std::string, std::string>> GetDefaultLabelInfo();
+  DBus::ValueOrError<Accessibility::Accessible*, uint32_t, Accessibility::Attributes> GetDefaultLabelInfo();
 
   /**
    * @brief Gets Reading material information of the self object.
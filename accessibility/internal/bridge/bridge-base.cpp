@@ -291,7 +291,21 @@ std::vector<Accessible*> ApplicationAccessible::GetMatchesInMatches(MatchRule fi
 
 // BridgeBase implementation
 BridgeBase::BridgeBase()
-: mApplication{std::make_shared<ApplicationAccessible>()}
+: mApplication{std::make_shared<ApplicationAccessible>()},
+  mRelationIndex{[this](const std::string& path) -> Accessible* {
+    if(path == "root")
+    {
+      return mApplication.get();
+    }
+    try
+    {
+      return GetAccessible(path).get();
+    }
+    catch(const std::exception&)
+    {
+      return nullptr;
+    }
+  }}
 {
   mApplication->InitDefaultFeatures();
 }
@@ -446,6 +460,7 @@ void BridgeBase::ForceDown()
   Bridge::ForceDown();
   gTickTimer.Stop();
   mCoalescableMessages.clear();
+  mRelationIndex.Clear();
   if(auto* wrapper = DBusWrapper::Installed())
   {
     wrapper->Strings.clear();
@@ -592,6 +607,15 @@ Accessible* BridgeBase::GetDefaultLabel(Accessible* root)
   return root;
 }
 
+void BridgeBase::RelationsChanged(Accessible* accessible)
+{
+  mRelationIndex.Enable();
+  if(accessible)
+  {
+    mRelationIndex.Invalidate(accessible->GetAddress().GetPath());
+  }
+}
+
 std::string BridgeBase::StripPrefix(const std::string& path)
 {
   auto size = strlen(AtspiPath);
@@ -34,6 +34,7 @@
 #include <accessibility/internal/bridge/ipc/ipc-registry-client.h>
 #include <accessibility/internal/bridge/ipc/ipc-server.h>
 #include <accessibility/internal/bridge/ipc/ipc-transport-factory.h>
+#include <accessibility/internal/bridge/relation-index.h>
 #ifdef ENABLE_TIDL_BACKEND
 #include <accessibility/internal/bridge/tidl/tidl-interface-description.h>
 #endif
@@ -187,6 +188,11 @@ public:
    */
   Accessibility::Accessible* GetDefaultLabel(Accessibility::Accessible* root) override;
 
+  /**
+   * @copydoc Accessibility::Bridge::RelationsChanged()
+   */
+  void RelationsChanged(Accessibility::Accessible* accessible) override;
+
   /**
    * @copydoc Accessibility::Bridge::GetApplication()
    */
@@ -482,8 +488,9 @@ protected:
 
   std::shared_ptr<Accessibility::ApplicationAccessible> mApplication;
 
-  DefaultLabelsType mDefaultLabels;
-  bool              mIsScreenReaderSuppressed = false;
+  DefaultLabelsType            mDefaultLabels;
+  Accessibility::RelationIndex mRelationIndex;
+  bool                         mIsScreenReaderSuppressed = false;
 
 private:
   /**
@@ -120,7 +120,13 @@ public:
    */
   bool AddAccessible(uint32_t actorId, std::shared_ptr<Accessible> accessible) override
   {
-    mAccessibles[actorId] = std::move(accessible);
+    auto& entry = mAccessibles[actorId];
+    if(entry)
+    {
+      // The new object may have other relations, and sets targeting the old one are stale
+      mRelationIndex.Remove(entry->GetAddress().GetPath());
+    }
+    entry = std::move(accessible);
     return true;
   }
 
@@ -129,7 +135,13 @@ public:
    */
   void RemoveAccessible(uint32_t actorId) override
   {
-    mAccessibles.erase(actorId);
+    auto iter = mAccessibles.find(actorId);
+    if(iter != mAccessibles.end())
+    {
+      mRelationIndex.Remove(iter->second->GetAddress().GetPath());
+      ForgetEmittedState(iter->second.get());
+      mAccessibles.erase(iter);
+    }
   }
 
   /**
@@ -328,6 +340,7 @@ public:
     }
 
     BridgeAccessible::ForceDown();
+    ClearEmittedStates();
     mKeyEventForwarder.reset();
     mDirectReadingClient.reset();
     mDirectReadingCallbacks.clear();
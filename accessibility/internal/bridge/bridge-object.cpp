@@ -19,11 +19,14 @@
 #include <accessibility/internal/bridge/bridge-object.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <string>
 #include <string_view>
-#include <unordered_map>
 
+#include <accessibility/api/accessibility-names.h>
 #include <accessibility/api/accessible.h>
 
 using namespace Accessibility;
@@ -35,9 +38,28 @@ inline std::string GetAccessiblePath(Accessible* accessible)
   auto address = accessible->GetAddress();
   return address ? ATSPI_PREFIX_PATH + address.GetPath() : ATSPI_NULL_PATH;
 }
+
+// Entries of destroyed objects are swept once the map doubles past this size
+constexpr std::size_t EMITTED_STATES_MIN_PRUNE_SIZE = 64u;
+
+/**
+ * @brief Records value as the last emitted one; returns false if it repeats the previous one.
+ */
+bool UpdateEmittedHash(bool& known, std::size_t& hash, const std::string& value)
+{
+  auto newHash = std::hash<std::string>{}(value);
+  if(known && hash == newHash)
+  {
+    return false;
+  }
+  known = true;
+  hash  = newHash;
+  return true;
+}
 } // namespace
 
 BridgeObject::BridgeObject()
+: mEmittedStatesPruneSize(EMITTED_STATES_MIN_PRUNE_SIZE)
 {
 }
 
@@ -72,23 +94,32 @@ void BridgeObject::EmitActiveDescendantChanged(Accessible* obj, Accessible* chil
 
 void BridgeObject::Emit(std::shared_ptr<Accessible> obj, ObjectPropertyChangeEvent event)
 {
-  static const std::unordered_map<ObjectPropertyChangeEvent, std::string_view> eventMap{
-    {ObjectPropertyChangeEvent::NAME, "accessible-name"},
-    {ObjectPropertyChangeEvent::DESCRIPTION, "accessible-description"},
-    {ObjectPropertyChangeEvent::VALUE, "accessible-value"},
-    {ObjectPropertyChangeEvent::PARENT, "accessible-parent"},
-    {ObjectPropertyChangeEvent::ROLE, "accessible-role"},
-  };
-
   if(!IsUp() || obj->IsHidden() || obj->GetSuppressedEvents()[AtspiEvent::PROPERTY_CHANGED])
   {
     return;
   }
 
-  auto eventName = eventMap.find(event);
+  auto eventName = PROPERTY_CHANGE_EVENT_NAMES[event];
 
-  if(eventName != eventMap.end())
+  if(!eventName.empty())
   {
+    bool changed = true;
+    if(event == ObjectPropertyChangeEvent::NAME)
+    {
+      auto& emitted = GetEmittedState(obj);
+      changed       = UpdateEmittedHash(emitted.hasName, emitted.nameHash, obj->GetName());
+    }
+    else if(event == ObjectPropertyChangeEvent::DESCRIPTION)
+    {
+      auto& emitted = GetEmittedState(obj);
+      changed       = UpdateEmittedHash(emitted.hasDescription, emitted.descriptionHash, obj->GetDescription());
+    }
+    if(!changed)
+    {
+      ++mSuppressedSignals.propertyChanged;
+      return;
+    }
+
     AddCoalescableMessage(static_cast<CoalescableMessages>(static_cast<int>(CoalescableMessages::PROPERTY_CHANGED_BEGIN) + static_cast<int>(event)), obj.get(), 1.0f, [=, weakObj = std::weak_ptr<Accessible>(obj)]()
     {
       if(auto accessible = weakObj.lock())
@@ -98,7 +129,7 @@ void BridgeObject::Emit(std::shared_ptr<Accessible> obj, ObjectPropertyChangeEve
           GetAccessiblePath(accessible.get()),
           Accessible::GetInterfaceName(AtspiInterface::EVENT_OBJECT),
           "PropertyChange",
-          std::string{eventName->second},
+          std::string{eventName},
           0,
           0,
           0,
@@ -110,29 +141,6 @@ void BridgeObject::Emit(std::shared_ptr<Accessible> obj, ObjectPropertyChangeEve
 
 void BridgeObject::Emit(Accessible* obj, WindowEvent event, unsigned int detail)
 {
-  static const std::unordered_map<WindowEvent, std::string_view> eventMap{
-    {WindowEvent::PROPERTY_CHANGE, "PropertyChange"},
-    {WindowEvent::MINIMIZE, "Minimize"},
-    {WindowEvent::MAXIMIZE, "Maximize"},
-    {WindowEvent::RESTORE, "Restore"},
-    {WindowEvent::CLOSE, "Close"},
-    {WindowEvent::CREATE, "Create"},
-    {WindowEvent::REPARENT, "Reparent"},
-    {WindowEvent::DESKTOP_CREATE, "DesktopCreate"},
-    {WindowEvent::DESKTOP_DESTROY, "DesktopDestroy"},
-    {WindowEvent::DESTROY, "Destroy"},
-    {WindowEvent::ACTIVATE, "Activate"},
-    {WindowEvent::DEACTIVATE, "Deactivate"},
-    {WindowEvent::RAISE, "Raise"},
-    {WindowEvent::LOWER, "Lower"},
-    {WindowEvent::MOVE, "Move"},
-    {WindowEvent::RESIZE, "Resize"},
-    {WindowEvent::SHADE, "Shade"},
-    {WindowEvent::UU_SHADE, "uUshade"},
-    {WindowEvent::RESTYLE, "Restyle"},
-    {WindowEvent::POST_RENDER, "PostRender"},
-  };
-
   if(!IsUp() || obj->IsHidden() || obj->GetSuppressedEvents()[AtspiEvent::WINDOW_CHANGED])
   {
     return;
@@ -140,14 +148,14 @@ void BridgeObject::Emit(Accessible* obj, WindowEvent event, unsigned int detail)
 
   if(!mIpcServer) return;
 
-  auto eventName = eventMap.find(event);
+  auto eventName = WINDOW_EVENT_NAMES[event];
 
-  if(eventName != eventMap.end())
+  if(!eventName.empty())
   {
     mIpcServer->emitSignal(
       GetAccessiblePath(obj),
       Accessible::GetInterfaceName(AtspiInterface::EVENT_WINDOW),
-      std::string{eventName->second},
+      std::string{eventName},
       "",
       detail,
       0,
@@ -158,64 +166,25 @@ void BridgeObject::Emit(Accessible* obj, WindowEvent event, unsigned int detail)
 
 void BridgeObject::EmitStateChanged(std::shared_ptr<Accessible> obj, State state, int newValue, int reserved)
 {
-  static const std::unordered_map<State, std::string_view> stateMap{
-    {State::INVALID, "invalid"},
-    {State::ACTIVE, "active"},
-    {State::ARMED, "armed"},
-    {State::BUSY, "busy"},
-    {State::CHECKED, "checked"},
-    {State::COLLAPSED, "collapsed"},
-    {State::DEFUNCT, "defunct"},
-    {State::EDITABLE, "editable"},
-    {State::ENABLED, "enabled"},
-    {State::EXPANDABLE, "expandable"},
-    {State::EXPANDED, "expanded"},
-    {State::FOCUSABLE, "focusable"},
-    {State::FOCUSED, "focused"},
-    {State::HAS_TOOLTIP, "has-tooltip"},
-    {State::HORIZONTAL, "horizontal"},
-    {State::ICONIFIED, "iconified"},
-    {State::MODAL, "modal"},
-    {State::MULTI_LINE, "multi-line"},
-    {State::MULTI_SELECTABLE, "multiselectable"},
-    {State::OPAQUE, "opaque"},
-    {State::PRESSED, "pressed"},
-    {State::RESIZEABLE, "resizable"},
-    {State::SELECTABLE, "selectable"},
-    {State::SELECTED, "selected"},
-    {State::SENSITIVE, "sensitive"},
-    {State::SHOWING, "showing"},
-    {State::SINGLE_LINE, "single-line"},
-    {State::STALE, "stale"},
-    {State::TRANSIENT, "transient"},
-    {State::VERTICAL, "vertical"},
-    {State::VISIBLE, "visible"},
-    {State::MANAGES_DESCENDANTS, "manages-descendants"},
-    {State::INDETERMINATE, "indeterminate"},
-    {State::REQUIRED, "required"},
-    {State::TRUNCATED, "truncated"},
-    {State::ANIMATED, "animated"},
-    {State::INVALID_ENTRY, "invalid-entry"},
-    {State::SUPPORTS_AUTOCOMPLETION, "supports-autocompletion"},
-    {State::SELECTABLE_TEXT, "selectable-text"},
-    {State::IS_DEFAULT, "is-default"},
-    {State::VISITED, "visited"},
-    {State::CHECKABLE, "checkable"},
-    {State::HAS_POPUP, "has-popup"},
-    {State::READ_ONLY, "read-only"},
-    {State::HIGHLIGHTED, "highlighted"},
-    {State::HIGHLIGHTABLE, "highlightable"},
-  };
-
   if(!IsUp() || obj->IsHidden() || obj->GetSuppressedEvents()[AtspiEvent::STATE_CHANGED]) // separate ?
   {
     return;
   }
 
-  auto stateName = stateMap.find(state);
+  auto stateName = STATE_NAMES[state];
 
-  if(stateName != stateMap.end())
+  if(!stateName.empty())
   {
+    auto& emitted = GetEmittedState(obj);
+    bool  value   = newValue != 0;
+    if(emitted.knownStates[state] && emitted.states[state] == value)
+    {
+      ++mSuppressedSignals.stateChanged;
+      return;
+    }
+    emitted.knownStates[state] = true;
+    emitted.states[state]      = value;
+
     AddCoalescableMessage(static_cast<CoalescableMessages>(static_cast<int>(CoalescableMessages::STATE_CHANGED_BEGIN) + static_cast<int>(state)), obj.get(), 1.0f, [=, weakObj = std::weak_ptr<Accessible>(obj)]()
     {
       if(auto accessible = weakObj.lock())
@@ -225,7 +194,7 @@ void BridgeObject::EmitStateChanged(std::shared_ptr<Accessible> obj, State state
           GetAccessiblePath(accessible.get()),
           Accessible::GetInterfaceName(AtspiInterface::EVENT_OBJECT),
           "StateChanged",
-          std::string{stateName->second},
+          std::string{stateName},
           newValue,
           reserved,
           0,
@@ -298,11 +267,6 @@ void BridgeObject::EmitCursorMoved(Accessible* obj, unsigned int cursorPosition)
 
 void BridgeObject::EmitTextChanged(Accessible* obj, TextChangedState state, unsigned int position, unsigned int length, const std::string& content)
 {
-  static const std::unordered_map<TextChangedState, std::string_view> stateMap{
-    {TextChangedState::INSERTED, "insert"},
-    {TextChangedState::DELETED, "delete"},
-  };
-
   if(!IsUp() || obj->IsHidden() || obj->GetSuppressedEvents()[AtspiEvent::TEXT_CHANGED])
   {
     return;
@@ -310,15 +274,15 @@ void BridgeObject::EmitTextChanged(Accessible* obj, TextChangedState state, unsi
 
   if(!mIpcServer) return;
 
-  auto stateName = stateMap.find(state);
+  auto stateName = TEXT_CHANGED_STATE_NAMES[state];
 
-  if(stateName != stateMap.end())
+  if(!stateName.empty())
   {
     mIpcServer->emitSignal(
       GetAccessiblePath(obj),
       Accessible::GetInterfaceName(AtspiInterface::EVENT_OBJECT),
       "TextChanged",
-      std::string{stateName->second},
+      std::string{stateName},
       position,
       length,
       content,
@@ -385,3 +349,39 @@ void BridgeObject::EmitScrollFinished(Accessible* obj)
     0,
     {"", "root"});
 }
+
+SuppressedSignalStats BridgeObject::GetSuppressedSignalStats() const
+{
+  return mSuppressedSignals;
+}
+
+void BridgeObject::ForgetEmittedState(Accessible* obj)
+{
+  mEmittedStates.erase(obj);
+}
+
+void BridgeObject::ClearEmittedStates()
+{
+  mEmittedStates.clear();
+  mEmittedStatesPruneSize = EMITTED_STATES_MIN_PRUNE_SIZE;
+}
+
+BridgeObject::EmittedState& BridgeObject::GetEmittedState(const std::shared_ptr<Accessible>& obj)
+{
+  if(mEmittedStates.size() >= mEmittedStatesPruneSize)
+  {
+    for(auto it = mEmittedStates.begin(); it != mEmittedStates.end();)
+    {
+      it = it->second.object.expired() ? mEmittedStates.erase(it) : std::next(it);
+    }
+    mEmittedStatesPruneSize = std::max(EMITTED_STATES_MIN_PRUNE_SIZE, mEmittedStates.size() * 2u);
+  }
+
+  auto& emitted = mEmittedStates[obj.get()];
+  if(emitted.object.expired())
+  {
+    emitted        = {};
+    emitted.object = obj;
+  }
+  return emitted;
+}
@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <array>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -100,6 +101,46 @@ protected:
    */
   void EmitScrollFinished(Accessibility::Accessible* obj) override;
 
+  /**
+   * @copydoc Accessibility::Bridge::GetSuppressedSignalStats()
+   */
+  Accessibility::SuppressedSignalStats GetSuppressedSignalStats() const override;
+
+  /**
+   * @brief Forgets what was emitted for the object; its next signals are always sent.
+   *
+   * @param[in] obj The accessible object
+   */
+  void ForgetEmittedState(Accessibility::Accessible* obj);
+
+  /**
+   * @brief Forgets what was emitted for all objects, e.g. when the bridge goes down.
+   */
+  void ClearEmittedStates();
+
+private:
+  /**
+   * @brief The last emitted states, name and description of an object.
+   */
+  struct EmittedState
+  {
+    std::weak_ptr<Accessibility::Accessible> object;      ///< Expired if the entry belongs to a destroyed object at the same address
+    Accessibility::States                    knownStates; ///< States emitted at least once
+    Accessibility::States                    states;      ///< Last emitted value of each known state
+    std::size_t                              nameHash{0};
+    std::size_t                              descriptionHash{0};
+    bool                                     hasName{false};
+    bool                                     hasDescription{false};
+  };
+
+  /**
+   * @brief Returns the entry of obj, starting a fresh one if none is live.
+   */
+  EmittedState& GetEmittedState(const std::shared_ptr<Accessibility::Accessible>& obj);
+
+  std::unordered_map<Accessibility::Accessible*, EmittedState> mEmittedStates;
+  std::size_t                                                  mEmittedStatesPruneSize;
+  Accessibility::SuppressedSignalStats                         mSuppressedSignals;
 };
 
 #endif // ACCESSIBILITY_INTERNAL_ACCESSIBILITY_BRIDGE_OBJECT_H
@@ -172,9 +172,9 @@ struct Comparer
    */
   struct ComparerAttributes
   {
-    std::unordered_map<std::string, std::string> mRequested;
-    std::unordered_map<std::string, std::string> mObject;
-    Mode                                         mMode = Mode::INVALID;
+    Attributes mRequested;
+    Attributes mObject;
+    Mode       mMode = Mode::INVALID;
 
     ComparerAttributes(MatchRule* rule)
     : mMode(ConvertToMatchType(std::get<static_cast<std::size_t>(Index::ATTRIBUTES_MATCH_TYPE)>(*rule)))
@@ -200,16 +200,31 @@ struct Comparer
     bool Compare(CompareFuncExit exit)
     {
       bool foundAny = false;
+      auto isExit   = [&](bool found) {
+        if(found)
+        {
+          foundAny = true;
+        }
+        return found == (exit == CompareFuncExit::FIRST_FOUND);
+      };
+
       for(auto& iname : mRequested)
       {
         auto it    = mObject.find(iname.first);
         bool found = it != mObject.end() && iname.second == it->second;
-        if(found)
+        if(isExit(found))
         {
-          foundAny = true;
+          return found;
         }
+      }
 
-        if(found == (exit == CompareFuncExit::FIRST_FOUND))
+      // Toolkits intern names lazily in GetAttributes(), so a name that was
+      // unknown when the rule was read may be a key by now
+      for(auto& iname : mRequested.GetUninterned())
+      {
+        auto value = mObject.GetValue(iname.first);
+        bool found = value && iname.second == *value;
+        if(isExit(found))
         {
           return found;
         }
@@ -1502,6 +1502,58 @@ struct signature<std::map<A, B>> : signature_helper<signature<std::map<A, B>>>
   }
 };
 
+/**
+ * @brief Signature class for marshalling Accessibility::Attributes
+ *
+ * Attributes are sent as the a{ss} dictionary, the same as
+ * std::unordered_map<std::string, std::string>. Names are written straight
+ * from the interned keys and looked up again on receive, so no intermediate
+ * map is built on either side. Received names are never interned; unknown
+ * ones stay in the uninterned side list.
+ */
+template<>
+struct signature<Accessibility::Attributes> : signature_helper<signature<Accessibility::Attributes>>
+{
+  static constexpr auto name_v = concat("Attributes");
+  static constexpr auto sig_v  = concat("a{ss}");
+
+  /**
+   * @brief Marshals value v as marshalled type into message
+   */
+  static void set(const DBusWrapper::MessageIterPtr& iter, const Accessibility::Attributes& v)
+  {
+    auto lst = DBUS_W->eldbus_message_iter_container_new_impl(iter, 'a', "{ss}");
+    assert(lst);
+    for(auto& a : v)
+    {
+      auto entry = DBUS_W->eldbus_message_iter_container_new_impl(lst, 'e', "");
+      signature<std::string>::set(entry, a.first.GetName());
+      signature<std::string>::set(entry, a.second);
+    }
+    for(auto& a : v.GetUninterned())
+    {
+      auto entry = DBUS_W->eldbus_message_iter_container_new_impl(lst, 'e', "");
+      signature<std::string>::set(entry, a.first);
+      signature<std::string>::set(entry, a.second);
+    }
+  }
+
+  /**
+   * @brief Marshals value from marshalled type into variable v
+   */
+  static bool get(const DBusWrapper::MessageIterPtr& iter, Accessibility::Attributes& v)
+  {
+    auto s = DBUS_W->eldbus_message_iter_get_and_next_by_type_impl(iter, 'a');
+    v.clear();
+    if(!s)
+      return false;
+    std::pair<std::string, std::string> a;
+    while(signature<std::pair<std::string, std::string>>::get(s, a))
+      v.InsertByName(a.first, std::move(a.second));
+    return true;
+  }
+};
+
 /**
  * @brief Signature helper class for marshalling const reference types
  */
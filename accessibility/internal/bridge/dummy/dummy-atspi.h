@@ -57,6 +57,10 @@ struct DummyBridge : Accessibility::Bridge
   {
   }
 
+  void RelationsChanged(Accessibility::Accessible* accessible) override
+  {
+  }
+
   Accessibility::Accessible* GetDefaultLabel(Accessibility::Accessible* root) override
   {
     return nullptr;
@@ -173,6 +177,11 @@ struct DummyBridge : Accessibility::Bridge
   {
   }
 
+  Accessibility::SuppressedSignalStats GetSuppressedSignalStats() const override
+  {
+    return {};
+  }
+
   void EmitBoundsChanged(std::shared_ptr<Accessibility::Accessible> obj, Rect<int> rect) override
   {
   }
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <accessibility/internal/bridge/relation-index.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/accessible.h>
+
+namespace Accessibility
+{
+namespace
+{
+/**
+ * @brief Returns the first relation of the given type in a set read from the toolkit, or nullptr.
+ */
+const Relation* FindToolkitRelation(const std::vector<Relation>& relations, RelationType type)
+{
+  auto it = std::find_if(relations.begin(), relations.end(), [type](const Relation& relation)
+                         { return relation.mRelationType == type; });
+  return it != relations.end() ? &*it : nullptr;
+}
+
+} // namespace
+
+RelationIndex::RelationIndex(Resolver resolver)
+: mResolver(std::move(resolver))
+{
+}
+
+Accessible* RelationIndex::GetFirstTarget(Accessible* source, RelationType type)
+{
+  if(!source)
+  {
+    return nullptr;
+  }
+
+  if(auto relations = GetRelations(source))
+  {
+    for(auto& relation : *relations)
+    {
+      if(relation.type == type && !relation.targets.empty())
+      {
+        return Resolve(relation.targets.front());
+      }
+    }
+    return nullptr;
+  }
+
+  for(auto& relation : source->GetRelationSet())
+  {
+    if(relation.mRelationType == type && !relation.mTargets.empty())
+    {
+      return relation.mTargets.front();
+    }
+  }
+  return nullptr;
+}
+
+Accessible* RelationIndex::GetLastTarget(Accessible* source, RelationType type)
+{
+  if(!source)
+  {
+    return nullptr;
+  }
+
+  if(auto relations = GetRelations(source))
+  {
+    auto relation = FindRelation(*relations, type);
+    return relation && !relation->targets.empty() ? Resolve(relation->targets.back()) : nullptr;
+  }
+
+  auto relation = FindToolkitRelation(source->GetRelationSet(), type);
+  return relation && !relation->mTargets.empty() ? relation->mTargets.back() : nullptr;
+}
+
+bool RelationIndex::HasRelation(Accessible* source, RelationType type)
+{
+  if(!source)
+  {
+    return false;
+  }
+
+  if(auto relations = GetRelations(source))
+  {
+    return FindRelation(*relations, type) != nullptr;
+  }
+  return FindToolkitRelation(source->GetRelationSet(), type) != nullptr;
+}
+
+void RelationIndex::Enable()
+{
+  mEnabled = true;
+}
+
+void RelationIndex::Invalidate(const std::string& path)
+{
+  auto it = mRelations.find(path);
+  if(it == mRelations.end())
+  {
+    return;
+  }
+
+  for(auto& relation : it->second)
+  {
+    for(auto& target : relation.targets)
+    {
+      auto sources = mSources.find(target);
+      if(sources == mSources.end())
+      {
+        continue;
+      }
+      auto& list = sources->second;
+      list.erase(std::remove(list.begin(), list.end(), path), list.end());
+      if(list.empty())
+      {
+        mSources.erase(sources);
+      }
+    }
+  }
+  mRelations.erase(it);
+}
+
+void RelationIndex::Remove(const std::string& path)
+{
+  Invalidate(path);
+
+  auto it = mSources.find(path);
+  if(it == mSources.end())
+  {
+    return;
+  }
+
+  auto sources = std::move(it->second);
+  mSources.erase(it);
+  for(auto& source : sources)
+  {
+    Invalidate(source);
+  }
+}
+
+void RelationIndex::Clear()
+{
+  mRelations.clear();
+  mSources.clear();
+}
+
+const RelationIndex::RelationSet* RelationIndex::GetRelations(Accessible* source)
+{
+  if(!mEnabled)
+  {
+    return nullptr;
+  }
+
+  auto path = source->GetAddress().GetPath();
+  if(auto it = mRelations.find(path); it != mRelations.end())
+  {
+    return &it->second;
+  }
+
+  // Only sets the registry can answer for are kept: a source or target it
+  // does not hold could be destroyed without the bridge being told
+  if(Resolve(path) != source)
+  {
+    return nullptr;
+  }
+
+  RelationSet relations;
+  for(auto& relation : source->GetRelationSet())
+  {
+    CachedRelation cached{relation.mRelationType, {}};
+    cached.targets.reserve(relation.mTargets.size());
+    for(auto target : relation.mTargets)
+    {
+      cached.targets.push_back(target ? target->GetAddress().GetPath() : std::string{});
+      if(Resolve(cached.targets.back()) != target)
+      {
+        return nullptr;
+      }
+    }
+    relations.push_back(std::move(cached));
+  }
+
+  for(auto& relation : relations)
+  {
+    for(auto& target : relation.targets)
+    {
+      if(target.empty())
+      {
+        continue;
+      }
+      auto& sources = mSources[target];
+      if(std::find(sources.begin(), sources.end(), path) == sources.end())
+      {
+        sources.push_back(path);
+      }
+    }
+  }
+  return &mRelations.emplace(std::move(path), std::move(relations)).first->second;
+}
+
+const RelationIndex::CachedRelation* RelationIndex::FindRelation(const RelationSet& relations, RelationType type)
+{
+  auto it = std::find_if(relations.begin(), relations.end(), [type](const CachedRelation& relation)
+                         { return relation.type == type; });
+  return it != relations.end() ? &*it : nullptr;
+}
+
+Accessible* RelationIndex::Resolve(const std::string& path) const
+{
+  return path.empty() ? nullptr : mResolver(path);
+}
+
+} // namespace Accessibility
@@ -0,0 +1,145 @@
+#ifndef ACCESSIBILITY_INTERNAL_ACCESSIBILITY_RELATION_INDEX_H
+#define ACCESSIBILITY_INTERNAL_ACCESSIBILITY_RELATION_INDEX_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/accessibility.h>
+
+namespace Accessibility
+{
+/**
+ * @brief Relation sets of accessible objects, cached for navigation.
+ *
+ * Neighbor search and reading material look up relations of every object
+ * they visit; each Accessible::GetRelationSet() call builds a new vector.
+ * The index asks an object once and answers later lookups from the cached
+ * set without allocating.
+ *
+ * Sets are keyed by object path, and targets are kept as paths that are
+ * resolved through the bridge's registry on every lookup, so the index
+ * never hands out an object the bridge no longer holds. Only objects that
+ * the registry resolves, with targets it resolves too, are cached; any
+ * other set is read from the toolkit each time. A reverse index maps each
+ * target to the sources whose cached sets point at it.
+ *
+ * Caching is off until Enable() is called, because nothing tells the
+ * bridge about relation changes unless the toolkit reports them through
+ * Bridge::RelationsChanged(); until then every lookup reads the toolkit.
+ * Cached sets are kept until such a report, or until the object is
+ * replaced or removed.
+ */
+class RelationIndex
+{
+public:
+  /**
+   * @brief Returns the registered object at the given path, or nullptr.
+   */
+  using Resolver = std::function<Accessible*(const std::string& path)>;
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] resolver Looks objects up in the bridge's registry
+   */
+  explicit RelationIndex(Resolver resolver);
+
+  /**
+   * @brief Returns the first target of the first non-empty relation of the given type.
+   *
+   * @param[in] source The object owning the relation
+   * @param[in] type The relation type
+   * @return The target, or nullptr if source has no such relation
+   */
+  Accessible* GetFirstTarget(Accessible* source, RelationType type);
+
+  /**
+   * @brief Returns the last target of the first relation of the given type.
+   *
+   * @param[in] source The object owning the relation
+   * @param[in] type The relation type
+   * @return The target, or nullptr if that relation is missing or has no targets
+   */
+  Accessible* GetLastTarget(Accessible* source, RelationType type);
+
+  /**
+   * @brief Checks whether source has a relation of the given type, with or without targets.
+   */
+  bool HasRelation(Accessible* source, RelationType type);
+
+  /**
+   * @brief Starts caching relation sets; the toolkit has promised to report changes.
+   */
+  void Enable();
+
+  /**
+   * @brief Drops the cached relation set of the object at path; the next lookup asks it again.
+   */
+  void Invalidate(const std::string& path);
+
+  /**
+   * @brief Drops the cached sets of the object at path and of every object whose relations target it.
+   */
+  void Remove(const std::string& path);
+
+  /**
+   * @brief Drops all cached relation sets.
+   */
+  void Clear();
+
+private:
+  struct CachedRelation
+  {
+    RelationType             type;
+    std::vector<std::string> targets; ///< Target paths; empty for a null target
+  };
+
+  using RelationSet = std::vector<CachedRelation>;
+
+  /**
+   * @brief Returns the cached relation set of source, reading it on first use.
+   *
+   * @return The set, or nullptr if caching is off or source or one of its targets is not registered
+   */
+  const RelationSet* GetRelations(Accessible* source);
+
+  /**
+   * @brief Returns the first cached relation of the given type, or nullptr.
+   */
+  static const CachedRelation* FindRelation(const RelationSet& relations, RelationType type);
+
+  /**
+   * @brief Returns the registered object at path, or nullptr for an empty path.
+   */
+  Accessible* Resolve(const std::string& path) const;
+
+  Resolver                                                  mResolver;
+  bool                                                      mEnabled{false};
+  std::unordered_map<std::string, RelationSet>              mRelations; ///< Forward index: source path -> relation set
+  std::unordered_map<std::string, std::vector<std::string>> mSources;   ///< Reverse index: target path -> sources with a cached set pointing at it
+};
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_INTERNAL_ACCESSIBILITY_RELATION_INDEX_H
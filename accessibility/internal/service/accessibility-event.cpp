@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <accessibility/api/accessibility-event.h>
+
+// EXTERNAL INCLUDES
+#include <array>
+
+namespace Accessibility
+{
+namespace
+{
+/**
+ * Detail strings indexed by EventDetail::Id. CUSTOM has no entry.
+ */
+constexpr std::array<std::string_view, EventDetail::CUSTOM> DETAIL_NAMES{
+  "",
+  "active",
+  "armed",
+  "busy",
+  "checked",
+  "collapsed",
+  "defunct",
+  "editable",
+  "enabled",
+  "expandable",
+  "expanded",
+  "focusable",
+  "focused",
+  "modal",
+  "pressed",
+  "selectable",
+  "selected",
+  "sensitive",
+  "showing",
+  "visible",
+  "checkable",
+  "read-only",
+  "highlighted",
+  "highlightable",
+  "accessible-name",
+  "accessible-description",
+  "accessible-value",
+  "accessible-parent",
+  "accessible-role",
+  "insert",
+  "delete",
+  "Activate",
+  "Deactivate",
+  "Create",
+  "Destroy",
+};
+
+static_assert(DETAIL_NAMES[EventDetail::CUSTOM - 1] == "Destroy", "DETAIL_NAMES must match EventDetail::Id");
+} // namespace
+
+EventDetail::EventDetail(std::string_view text)
+: mId(intern(text))
+{
+  if(mId == CUSTOM)
+  {
+    mCustom.assign(text.data(), text.size());
+  }
+}
+
+std::string_view EventDetail::view() const
+{
+  return mId == CUSTOM ? std::string_view(mCustom) : DETAIL_NAMES[mId];
+}
+
+EventDetail::Id EventDetail::intern(std::string_view text)
+{
+  if(text.empty())
+  {
+    return NONE;
+  }
+
+  for(std::size_t i = 1; i < DETAIL_NAMES.size(); ++i)
+  {
+    if(DETAIL_NAMES[i].size() == text.size() && DETAIL_NAMES[i] == text)
+    {
+      return static_cast<Id>(i);
+    }
+  }
+  return CUSTOM;
+}
+
+} // namespace Accessibility
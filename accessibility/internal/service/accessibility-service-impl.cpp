@@ -18,15 +18,295 @@
 // CLASS HEADER
 #include <accessibility/api/accessibility-service.h>
 
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/log.h>
+#include <accessibility/internal/service/event-route-table.h>
+#include <accessibility/internal/service/neighbor-resolver.h>
+#include <accessibility/internal/service/thread-task-executor.h>
+#include <accessibility/internal/service/window-mirror.h>
+
 namespace Accessibility
 {
+namespace
+{
+// Past this many events during one load the fresh copy is reloaded instead
+constexpr std::size_t MIRROR_BACKLOG_LIMIT = 256u;
+} // namespace
+
 struct AccessibilityService::Impl
 {
   std::unique_ptr<AppRegistry>     registry;
   std::unique_ptr<GestureProvider> gestureProvider;
   std::shared_ptr<NodeProxy>       currentNode;
   std::shared_ptr<NodeProxy>       currentWindow;
-  bool                             running{false};
+  EventRouteTable                  routes;
+  mutable std::mutex               mutex; ///< Guards currentNode, currentWindow and routes
+  std::atomic<bool>                running{false};
+
+  WindowMirror                    mirror;
+  std::mutex                      mirrorMutex; ///< Guards the mirror* members below; never held together with mutex
+  std::atomic<bool>               mirrored{false};
+  std::shared_ptr<TaskExecutor>   mirrorLoader;
+  std::shared_ptr<NodeProxy>      mirrorWindow;        ///< The window the mirror should hold
+  bool                            mirrorRefreshPosted{false};
+  unsigned int                    mirrorLoads{0};      ///< Loads in progress
+  std::vector<AccessibilityEvent> mirrorBacklog;       ///< Events seen during a load, replayed onto the fresh copy
+  bool                            mirrorBacklogFull{false};
+
+  NeighborResolver resolver;
+
+  std::shared_ptr<NodeProxy> getCurrentNode() const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return currentNode;
+  }
+
+  void setCurrentNode(std::shared_ptr<NodeProxy> node)
+  {
+    Address address = node ? node->getAddress() : Address{};
+
+    // Resolving the parent costs a round trip, so only do it when subscribed,
+    // and never while holding the lock
+    bool    wantParent;
+    Address parentAddress;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      wantParent = routes.getSubscription(EventTarget::CURRENT_PARENT) != 0;
+    }
+    if(wantParent && node)
+    {
+      auto parent = node->getParent();
+      parentAddress = parent ? parent->getAddress() : Address{};
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    currentNode = std::move(node);
+    routes.setTargetAddress(EventTarget::CURRENT_NODE, address);
+    if(wantParent)
+    {
+      routes.setTargetAddress(EventTarget::CURRENT_PARENT, parentAddress);
+    }
+  }
+
+  std::shared_ptr<NodeProxy> setCurrentWindow(std::shared_ptr<NodeProxy> window)
+  {
+    Address address = window ? window->getAddress() : Address{};
+
+    std::lock_guard<std::mutex> lock(mutex);
+    currentWindow = std::move(window);
+    routes.setTargetAddress(EventTarget::ACTIVE_WINDOW, address);
+    return currentWindow;
+  }
+
+  ~Impl()
+  {
+    // Loads capture this
+    if(mirrorLoader)
+    {
+      mirrorLoader->waitIdle();
+    }
+  }
+
+  void applyMirrorEvent(const AccessibilityEvent& event)
+  {
+    if(!mirrored)
+    {
+      return;
+    }
+
+    bool refresh;
+    {
+      std::lock_guard<std::mutex> lock(mirrorMutex);
+      mirror.applyEvent(event);
+      if(mirrorLoads > 0)
+      {
+        if(mirrorBacklog.size() < MIRROR_BACKLOG_LIMIT)
+        {
+          mirrorBacklog.push_back(event);
+        }
+        else
+        {
+          mirrorBacklogFull = true;
+        }
+      }
+
+      // A load in progress picks the change up when it replays the backlog
+      refresh = mirrorLoads == 0 && mirror.isLoaded() && mirror.needsRefresh();
+    }
+    if(refresh)
+    {
+      requestMirrorRefresh();
+    }
+  }
+
+  /**
+   * @brief Posts refreshMirror() to the loader unless it is already queued.
+   */
+  void requestMirrorRefresh()
+  {
+    std::shared_ptr<TaskExecutor> loader;
+    {
+      std::lock_guard<std::mutex> lock(mirrorMutex);
+      if(mirrorRefreshPosted || !mirrorLoader)
+      {
+        return;
+      }
+      mirrorRefreshPosted = true;
+      loader              = mirrorLoader;
+    }
+    loader->post([this]()
+    {
+      {
+        std::lock_guard<std::mutex> lock(mirrorMutex);
+        mirrorRefreshPosted = false;
+      }
+      refreshMirror();
+    });
+  }
+
+  /**
+   * @brief Brings the mirror up to date with mirrorWindow.
+   *
+   * A mirror of another window, or a stale one, is loaded again; otherwise
+   * only the dirty subtrees and nodes are refetched. Nodes are fetched without holding
+   * mirrorMutex, so events and gestures keep flowing. Events that arrive
+   * meanwhile are replayed onto the result, which only needs another
+   * refresh if one of them touches it.
+   */
+  void refreshMirror()
+  {
+    std::shared_ptr<NodeProxy>              window;
+    std::vector<std::shared_ptr<NodeProxy>> subtrees;
+    std::vector<std::shared_ptr<NodeProxy>> nodes;
+    bool                                    full;
+    {
+      std::lock_guard<std::mutex> lock(mirrorMutex);
+      window = mirrorWindow;
+      if(!window)
+      {
+        return;
+      }
+      full = !mirror.isLoaded() || mirror.isStale() || mirror.getWindowAddress() != window->getAddress();
+      if(!full)
+      {
+        subtrees = mirror.getDirtySubtrees();
+        nodes    = mirror.getDirtyNodes();
+        if(subtrees.empty() && nodes.empty())
+        {
+          return;
+        }
+      }
+      ++mirrorLoads;
+    }
+
+    WindowMirror                           fresh;
+    std::vector<WindowMirror>              fragments(subtrees.size());
+    std::vector<WindowMirror::NodeRefresh> refreshes;
+    if(full)
+    {
+      fresh.load(window);
+    }
+    else
+    {
+      for(std::size_t i = 0; i < subtrees.size(); ++i)
+      {
+        fragments[i].loadSubtree(subtrees[i], window->getAddress().GetBus());
+      }
+      for(auto& node : nodes)
+      {
+        refreshes.push_back(WindowMirror::fetchNode(node));
+      }
+    }
+
+    bool again;
+    {
+      std::lock_guard<std::mutex> lock(mirrorMutex);
+      if(full)
+      {
+        mirror = std::move(fresh);
+      }
+      else
+      {
+        for(auto& fragment : fragments)
+        {
+          mirror.replaceSubtree(std::move(fragment));
+        }
+        for(auto& refresh : refreshes)
+        {
+          mirror.refreshNode(refresh);
+        }
+      }
+
+      bool replayed = !mirrorBacklog.empty();
+      for(auto& event : mirrorBacklog)
+      {
+        mirror.applyEvent(event);
+      }
+      if(mirrorBacklogFull)
+      {
+        mirror.invalidate();
+      }
+      if(--mirrorLoads == 0)
+      {
+        mirrorBacklog.clear();
+        mirrorBacklogFull = false;
+      }
+      again = replayed && mirror.needsRefresh();
+    }
+    if(again)
+    {
+      requestMirrorRefresh();
+    }
+  }
+
+  /**
+   * @brief One GetNeighbor step, answered by the mirror when it can.
+   *
+   * The window is only passed as root to nodes in the window's own process;
+   * other bridges cannot resolve it.
+   */
+  NeighborHop findNeighborHop(const std::shared_ptr<NodeProxy>& window, const std::shared_ptr<NodeProxy>& start, bool forward, NeighborSearchMode searchMode)
+  {
+    const auto& windowBus = window->getAddress().GetBus();
+    bool        inWindow  = start->getAddress().GetBus() == windowBus;
+    if(mirrored && inWindow)
+    {
+      // Never load on the gesture path; ask the bridge until the mirror is current
+      bool current;
+      {
+        std::shared_ptr<NodeProxy>  neighbor;
+        std::lock_guard<std::mutex> lock(mirrorMutex);
+        if(!mirrorWindow || mirrorWindow->getAddress() != window->getAddress())
+        {
+          mirrorWindow = window;
+        }
+        current = mirror.isLoaded() && !mirror.needsRefresh() && mirror.getWindowAddress() == window->getAddress();
+        if(current && mirror.findNeighbor(start->getAddress(), forward, searchMode, neighbor))
+        {
+          return {neighbor, neighbor && neighbor->getAddress().GetBus() != windowBus};
+        }
+      }
+      if(!current)
+      {
+        requestMirrorRefresh();
+      }
+    }
+    return start->getNeighborHop(inWindow ? window : nullptr, forward, searchMode);
+  }
+
+  std::shared_ptr<NodeProxy> findNeighbor(const std::shared_ptr<NodeProxy>& window, const std::shared_ptr<NodeProxy>& start, bool forward)
+  {
+    return resolver.resolve(start, [&](const std::shared_ptr<NodeProxy>& node, NeighborSearchMode searchMode)
+    {
+      return findNeighborHop(window, node, forward, searchMode);
+    });
+  }
 };
 
 AccessibilityService::AccessibilityService(std::unique_ptr<AppRegistry> registry,
@@ -66,60 +346,145 @@ void AccessibilityService::start()
   // Get the initial active window
   if(mImpl->registry)
   {
-    mImpl->currentWindow = mImpl->registry->getActiveWindow();
+    mImpl->setCurrentWindow(mImpl->registry->getActiveWindow());
   }
 }
 
 void AccessibilityService::stop()
 {
-  mImpl->running       = false;
-  mImpl->currentNode   = nullptr;
-  mImpl->currentWindow = nullptr;
+  mImpl->running = false;
+
+  {
+    std::lock_guard<std::mutex> lock(mImpl->mutex);
+    mImpl->currentNode   = nullptr;
+    mImpl->currentWindow = nullptr;
+    mImpl->routes.clearTargets();
+  }
+
+  std::lock_guard<std::mutex> lock(mImpl->mirrorMutex);
+  mImpl->mirror       = WindowMirror{};
+  mImpl->mirrorWindow = nullptr;
 }
 
-std::shared_ptr<NodeProxy> AccessibilityService::getActiveWindow()
+void AccessibilityService::setMirroredNavigation(bool enabled, std::shared_ptr<TaskExecutor> loader)
 {
-  if(mImpl->registry)
+  mImpl->mirrored = enabled;
+
+  std::shared_ptr<TaskExecutor> previous;
   {
-    mImpl->currentWindow = mImpl->registry->getActiveWindow();
+    // Events are not applied while disabled, so any copy is out of date
+    std::lock_guard<std::mutex> lock(mImpl->mirrorMutex);
+    mImpl->mirror       = WindowMirror{};
+    mImpl->mirrorWindow = nullptr;
+    if(!enabled)
+    {
+      return;
+    }
+    if(loader || !mImpl->mirrorLoader)
+    {
+      previous            = std::move(mImpl->mirrorLoader);
+      mImpl->mirrorLoader = loader ? std::move(loader) : std::make_shared<ThreadTaskExecutor>();
+    }
+  }
+
+  // Loads already posted to the old loader must finish before it goes away
+  if(previous)
+  {
+    previous->waitIdle();
   }
-  return mImpl->currentWindow;
 }
 
-std::shared_ptr<NodeProxy> AccessibilityService::navigateNext()
+bool AccessibilityService::isMirroredNavigationEnabled() const
+{
+  return mImpl->mirrored;
+}
+
+std::size_t AccessibilityService::verifyMirroredNavigation()
 {
   auto window = getActiveWindow();
   if(!window)
   {
-    return nullptr;
+    return 0;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mImpl->mirrorMutex);
+    mImpl->mirrorWindow = window;
+  }
+  mImpl->refreshMirror();
+  std::vector<NeighborMismatch> mismatches;
+  {
+    std::lock_guard<std::mutex> lock(mImpl->mirrorMutex);
+    mismatches = mImpl->mirror.verify(window);
+  }
+
+  for(auto& mismatch : mismatches)
+  {
+    ACCESSIBILITY_LOG_ERROR("Mirrored %s neighbor of %s is %s, bridge returned %s\n",
+                            mismatch.forward ? "next" : "prev",
+                            mismatch.start.ToString().c_str(),
+                            mismatch.mirrored.ToString().c_str(),
+                            mismatch.remote.ToString().c_str());
   }
+  return mismatches.size();
+}
 
-  std::shared_ptr<NodeProxy> startNode = mImpl->currentNode ? mImpl->currentNode : window;
-  auto next = startNode->getNeighbor(window, true, NeighborSearchMode::RECURSE_FROM_ROOT);
+std::shared_ptr<NodeProxy> AccessibilityService::getActiveWindow()
+{
+  if(mImpl->registry)
+  {
+    return mImpl->setCurrentWindow(mImpl->registry->getActiveWindow());
+  }
+  std::lock_guard<std::mutex> lock(mImpl->mutex);
+  return mImpl->currentWindow;
+}
+
+std::shared_ptr<NodeProxy> AccessibilityService::navigateNext()
+{
+  auto next = findNeighbor(mImpl->getCurrentNode(), true);
   if(next)
   {
-    mImpl->currentNode = next;
+    mImpl->setCurrentNode(next);
     next->grabHighlight();
   }
   return next;
 }
 
 std::shared_ptr<NodeProxy> AccessibilityService::navigatePrev()
+{
+  auto prev = findNeighbor(mImpl->getCurrentNode(), false);
+  if(prev)
+  {
+    mImpl->setCurrentNode(prev);
+    prev->grabHighlight();
+  }
+  return prev;
+}
+
+std::shared_ptr<NodeProxy> AccessibilityService::findNeighbor(std::shared_ptr<NodeProxy> start, bool forward)
 {
   auto window = getActiveWindow();
   if(!window)
   {
     return nullptr;
   }
+  return mImpl->findNeighbor(window, start ? start : window, forward);
+}
 
-  std::shared_ptr<NodeProxy> startNode = mImpl->currentNode ? mImpl->currentNode : window;
-  auto prev = startNode->getNeighbor(window, false, NeighborSearchMode::RECURSE_FROM_ROOT);
-  if(prev)
+NeighborHopStats AccessibilityService::getNeighborHopStats() const
+{
+  return mImpl->resolver.getStats();
+}
+
+std::shared_ptr<NodeProxy> AccessibilityService::navigateTo(std::shared_ptr<NodeProxy> node)
+{
+  if(!node || !node->grabHighlight())
   {
-    mImpl->currentNode = prev;
-    prev->grabHighlight();
+    return nullptr;
   }
-  return prev;
+
+  mImpl->setCurrentNode(node);
+  return node;
 }
 
 bool AccessibilityService::highlightNode(std::shared_ptr<NodeProxy> node)
@@ -132,14 +497,14 @@ bool AccessibilityService::highlightNode(std::shared_ptr<NodeProxy> node)
   bool result = node->grabHighlight();
   if(result)
   {
-    mImpl->currentNode = node;
+    mImpl->setCurrentNode(node);
   }
   return result;
 }
 
 std::shared_ptr<NodeProxy> AccessibilityService::getCurrentNode() const
 {
-  return mImpl->currentNode;
+  return mImpl->getCurrentNode();
 }
 
 void AccessibilityService::dispatchEvent(const AccessibilityEvent& event)
@@ -149,13 +514,24 @@ void AccessibilityService::dispatchEvent(const AccessibilityEvent& event)
     return;
   }
 
+  // The mirror tracks the whole window, regardless of subscriptions
+  mImpl->applyMirrorEvent(event);
+
+  // Drop events from objects the service has not subscribed to
+  {
+    std::lock_guard<std::mutex> lock(mImpl->mutex);
+    if(!mImpl->routes.accepts(event))
+    {
+      return;
+    }
+  }
+
   // Route window change events
   if(event.type == AccessibilityEvent::Type::WINDOW_CHANGED)
   {
     auto window = getActiveWindow();
     if(window)
     {
-      mImpl->currentWindow = window;
       onWindowChanged(window);
     }
   }
@@ -173,4 +549,30 @@ AppRegistry& AccessibilityService::getRegistry()
   return *mImpl->registry;
 }
 
+void AccessibilityService::subscribeEvents(EventTarget target, EventTypeMask types)
+{
+  {
+    std::lock_guard<std::mutex> lock(mImpl->mutex);
+    mImpl->routes.setSubscription(target, types);
+  }
+
+  auto current = mImpl->getCurrentNode();
+  if(target == EventTarget::CURRENT_PARENT && types != 0 && current)
+  {
+    mImpl->setCurrentNode(std::move(current));
+  }
+}
+
+void AccessibilityService::setEventTargetAddress(EventTarget target, const Address& address)
+{
+  std::lock_guard<std::mutex> lock(mImpl->mutex);
+  mImpl->routes.setTargetAddress(target, address);
+}
+
+std::size_t AccessibilityService::getRejectedEventCount() const
+{
+  std::lock_guard<std::mutex> lock(mImpl->mutex);
+  return mImpl->routes.getRejectedCount();
+}
+
 } // namespace Accessibility
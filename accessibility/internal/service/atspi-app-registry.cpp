@@ -24,7 +24,8 @@
 namespace Accessibility
 {
 AtSpiAppRegistry::AtSpiAppRegistry(DBusWrapper::ConnectionPtr connection)
-: mConnection(std::move(connection))
+: mConnection(std::move(connection)),
+  mCapabilities(std::make_shared<BusCapabilities>())
 {
 }
 
@@ -35,7 +36,7 @@ std::shared_ptr<NodeProxy> AtSpiAppRegistry::createNodeProxy(const Address& addr
     return createNodeProxy(addr);
   };
 
-  return std::make_shared<AtSpiNodeProxy>(address, mConnection, std::move(factory));
+  return std::make_shared<AtSpiNodeProxy>(address, mConnection, std::move(factory), mCapabilities);
 }
 
 std::shared_ptr<NodeProxy> AtSpiAppRegistry::getDesktop()
@@ -57,6 +57,7 @@ public:
 
 private:
   DBusWrapper::ConnectionPtr           mConnection;
+  std::shared_ptr<BusCapabilities>     mCapabilities; ///< Shared by every proxy this registry creates
   std::vector<AppCallback>             mRegisteredCallbacks;
   std::vector<AppCallback>             mDeregisteredCallbacks;
   std::shared_ptr<NodeProxy>           mDesktop;
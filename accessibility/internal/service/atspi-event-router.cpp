@@ -46,6 +46,7 @@ struct AtSpiEventRouter::Impl
       {"MoveOuted", AccessibilityEvent::Type::MOVED_OUT},
       {"ScrollStarted", AccessibilityEvent::Type::SCROLL_STARTED},
       {"ScrollFinished", AccessibilityEvent::Type::SCROLL_FINISHED},
+      {"ChildrenChanged", AccessibilityEvent::Type::CHILDREN_CHANGED},
     };
     return map;
   }
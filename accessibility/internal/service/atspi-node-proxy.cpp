@@ -20,6 +20,8 @@
 
 // EXTERNAL INCLUDES
 #include <array>
+#include <atomic>
+#include <string_view>
 
 // INTERNAL INCLUDES
 #include <accessibility/internal/bridge/accessibility-common.h>
@@ -34,14 +36,40 @@ static constexpr const char* COMPONENT_IFACE  = "org.a11y.atspi.Component";
 static constexpr const char* ACTION_IFACE     = "org.a11y.atspi.Action";
 static constexpr const char* VALUE_IFACE      = "org.a11y.atspi.Value";
 static constexpr const char* TEXT_IFACE        = "org.a11y.atspi.Text";
+
+constexpr std::string_view UNKNOWN_METHOD_ERROR = "org.freedesktop.DBus.Error.UnknownMethod";
+
+/**
+ * @brief Checks whether a call failed because the bridge lacks the method.
+ *
+ * Blocking calls report a D-Bus error reply as "<name>: <message>".
+ */
+bool IsUnknownMethod(const DBus::Error& error)
+{
+  return error.message.compare(0, UNKNOWN_METHOD_ERROR.size(), UNKNOWN_METHOD_ERROR) == 0;
+}
 } // namespace
 
+bool BusCapabilities::HasAttributeValue(const std::string& bus) const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mWithoutAttributeValue.count(bus) == 0;
+}
+
+void BusCapabilities::SetNoAttributeValue(const std::string& bus)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mWithoutAttributeValue.insert(bus);
+}
+
 AtSpiNodeProxy::AtSpiNodeProxy(Address address,
                                DBusWrapper::ConnectionPtr connection,
-                               NodeProxyFactory factory)
+                               NodeProxyFactory factory,
+                               std::shared_ptr<BusCapabilities> capabilities)
 : mAddress(std::move(address)),
   mConnection(std::move(connection)),
-  mFactory(std::move(factory))
+  mFactory(std::move(factory)),
+  mCapabilities(std::move(capabilities))
 {
 }
 
@@ -123,10 +151,40 @@ States AtSpiNodeProxy::getStates()
 Attributes AtSpiNodeProxy::getAttributes()
 {
   auto client = createAccessibleClient();
-  auto result = client.method<DBus::ValueOrError<std::unordered_map<std::string, std::string>>()>("GetAttributes").call();
+  auto result = client.method<DBus::ValueOrError<Attributes>()>("GetAttributes").call();
   return result ? std::get<0>(result.getValues()) : Attributes{};
 }
 
+bool AtSpiNodeProxy::getAttribute(AttributeKey key, std::string& value)
+{
+  // Bridges without GetAttributeValue still answer GetAttributes
+  if(mCapabilities && !mCapabilities->HasAttributeValue(mAddress.GetBus()))
+  {
+    return NodeProxy::getAttribute(key, value);
+  }
+
+  auto client = createAccessibleClient();
+  auto result = client.method<DBus::ValueOrError<bool, std::string>(std::string)>("GetAttributeValue").call(key.GetName());
+  if(!result)
+  {
+    if(!IsUnknownMethod(result.getError()))
+    {
+      return false;
+    }
+    if(mCapabilities)
+    {
+      mCapabilities->SetNoAttributeValue(mAddress.GetBus());
+    }
+    return NodeProxy::getAttribute(key, value);
+  }
+  if(!std::get<0>(result.getValues()))
+  {
+    return false;
+  }
+  value = std::get<1>(result.getValues());
+  return true;
+}
+
 std::vector<std::string> AtSpiNodeProxy::getInterfaces()
 {
   auto client = createAccessibleClient();
@@ -217,6 +275,11 @@ std::vector<RemoteRelation> AtSpiNodeProxy::getRelationSet()
 }
 
 std::shared_ptr<NodeProxy> AtSpiNodeProxy::getNeighbor(std::shared_ptr<NodeProxy> root, bool forward, NeighborSearchMode searchMode)
+{
+  return getNeighborHop(std::move(root), forward, searchMode).node;
+}
+
+NeighborHop AtSpiNodeProxy::getNeighborHop(std::shared_ptr<NodeProxy> root, bool forward, NeighborSearchMode searchMode)
 {
   auto client = createAccessibleClient();
   std::string rootPath;
@@ -233,10 +296,10 @@ std::shared_ptr<NodeProxy> AtSpiNodeProxy::getNeighbor(std::shared_ptr<NodeProxy
     auto addr = std::get<0>(result.getValues());
     if(addr)
     {
-      return mFactory(addr);
+      return {mFactory(addr), std::get<1>(result.getValues()) != 0};
     }
   }
-  return nullptr;
+  return {};
 }
 
 std::shared_ptr<NodeProxy> AtSpiNodeProxy::getNavigableAtPoint(int32_t x, int32_t y, CoordinateType type)
@@ -260,7 +323,7 @@ ReadingMaterial AtSpiNodeProxy::getReadingMaterial()
 {
   auto client = createAccessibleClient();
   using RMType = DBus::ValueOrError<
-    std::unordered_map<std::string, std::string>,
+    Attributes,
     std::string, std::string, std::string,
     uint32_t, States, std::string,
     int32_t, double, std::string,
@@ -308,7 +371,7 @@ NodeInfo AtSpiNodeProxy::getNodeInfo()
   auto client = createAccessibleClient();
   using NIType = DBus::ValueOrError<
     std::string, std::string, std::string,
-    std::unordered_map<std::string, std::string>,
+    Attributes,
     States,
     std::tuple<int32_t, int32_t, int32_t, int32_t>,
     std::tuple<int32_t, int32_t, int32_t, int32_t>,
@@ -340,7 +403,7 @@ NodeInfo AtSpiNodeProxy::getNodeInfo()
 DefaultLabelInfo AtSpiNodeProxy::getDefaultLabelInfo()
 {
   auto client = createAccessibleClient();
-  auto result = client.method<DBus::ValueOrError<Address, uint32_t, std::unordered_map<std::string, std::string>>()>("GetDefaultLabelInfo").call();
+  auto result = client.method<DBus::ValueOrError<Address, uint32_t, Attributes>()>("GetDefaultLabelInfo").call();
   DefaultLabelInfo info{};
   if(result)
   {
@@ -352,6 +415,82 @@ DefaultLabelInfo AtSpiNodeProxy::getDefaultLabelInfo()
   return info;
 }
 
+void AtSpiNodeProxy::fetchSnapshotFields(std::function<void(SnapshotFields)> callback)
+{
+  // GetNodeInfo carries name, states, screen extents and attributes; role,
+  // description and children take one more call each. All four are sent at
+  // once and the last reply hands the fields over.
+  struct Pending
+  {
+    SnapshotFields                      fields;
+    std::atomic<int>                    remaining{4};
+    std::function<void(SnapshotFields)> callback;
+
+    void Done()
+    {
+      if(remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      {
+        callback(std::move(fields));
+      }
+    }
+  };
+  auto pending      = std::make_shared<Pending>();
+  pending->callback = std::move(callback);
+
+  using NIType = DBus::ValueOrError<
+    std::string, std::string, std::string,
+    Attributes,
+    States,
+    std::tuple<int32_t, int32_t, int32_t, int32_t>,
+    std::tuple<int32_t, int32_t, int32_t, int32_t>,
+    double, double, double, double, std::string>;
+
+  auto client = createAccessibleClient();
+  client.method<NIType()>("GetNodeInfo").asyncCall([pending](NIType result) {
+    if(result)
+    {
+      auto& v                = result.getValues();
+      pending->fields.name   = std::get<1>(v);
+      pending->fields.states = std::get<4>(v);
+      auto& se               = std::get<5>(v);
+      pending->fields.extents = Rect<int>{std::get<0>(se), std::get<1>(se), std::get<2>(se), std::get<3>(se)};
+      auto automationId      = std::get<3>(v).find(WellKnownAttribute::AUTOMATION_ID);
+      if(automationId != std::get<3>(v).end())
+      {
+        pending->fields.automationId = automationId->second;
+      }
+    }
+    pending->Done();
+  });
+  client.method<DBus::ValueOrError<uint32_t>()>("GetRole").asyncCall([pending](DBus::ValueOrError<uint32_t> result) {
+    if(result)
+    {
+      pending->fields.role = static_cast<Role>(std::get<0>(result.getValues()));
+    }
+    pending->Done();
+  });
+  client.property<std::string>("Description").asyncGet([pending](DBus::ValueOrError<std::string> result) {
+    if(result)
+    {
+      pending->fields.description = std::get<0>(result.getValues());
+    }
+    pending->Done();
+  });
+  client.method<DBus::ValueOrError<std::vector<Address>>()>("GetChildren").asyncCall([pending, factory = mFactory](DBus::ValueOrError<std::vector<Address>> result) {
+    if(result)
+    {
+      for(auto& address : std::get<0>(result.getValues()))
+      {
+        if(auto child = address ? factory(address) : nullptr)
+        {
+          pending->fields.children.push_back(std::move(child));
+        }
+      }
+    }
+    pending->Done();
+  });
+}
+
 // ========================================================================
 // Component interface (7 methods)
 // ========================================================================
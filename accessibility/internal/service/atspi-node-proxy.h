@@ -21,7 +21,9 @@
 // EXTERNAL INCLUDES
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_set>
 
 // INTERNAL INCLUDES
 #include <accessibility/api/node-proxy.h>
@@ -34,6 +36,31 @@ namespace Accessibility
  */
 using NodeProxyFactory = std::function<std::shared_ptr<NodeProxy>(const Address&)>;
 
+/**
+ * @brief Optional bridge methods that applications turned out not to implement.
+ *
+ * Shared by the proxies of one registry and keyed by bus name, so a bridge
+ * without a method answers UnknownMethod once and later calls to any of its
+ * objects go straight to the fallback. Unique bus names are never reused.
+ */
+class BusCapabilities
+{
+public:
+  /**
+   * @brief Checks whether the bridge on bus may implement GetAttributeValue.
+   */
+  bool HasAttributeValue(const std::string& bus) const;
+
+  /**
+   * @brief Records that the bridge on bus does not implement GetAttributeValue.
+   */
+  void SetNoAttributeValue(const std::string& bus);
+
+private:
+  mutable std::mutex              mMutex;
+  std::unordered_set<std::string> mWithoutAttributeValue;
+};
+
 /**
  * @brief D-Bus implementation of NodeProxy.
  *
@@ -49,10 +76,12 @@ public:
    * @param[in] address The bus name and object path of the target accessible
    * @param[in] connection The D-Bus connection to use
    * @param[in] factory Factory for creating child/parent/neighbor proxies
+   * @param[in] capabilities Methods known to be missing per bus; null to always try them
    */
   AtSpiNodeProxy(Address address,
                  DBusWrapper::ConnectionPtr connection,
-                 NodeProxyFactory factory);
+                 NodeProxyFactory factory,
+                 std::shared_ptr<BusCapabilities> capabilities = nullptr);
 
   // --- Accessible interface ---
   std::string getName() override;
@@ -62,6 +91,7 @@ public:
   std::string getLocalizedRoleName() override;
   States getStates() override;
   Attributes getAttributes() override;
+  bool getAttribute(AttributeKey key, std::string& value) override;
   std::vector<std::string> getInterfaces() override;
   std::shared_ptr<NodeProxy> getParent() override;
   int32_t getChildCount() override;
@@ -70,10 +100,12 @@ public:
   int32_t getIndexInParent() override;
   std::vector<RemoteRelation> getRelationSet() override;
   std::shared_ptr<NodeProxy> getNeighbor(std::shared_ptr<NodeProxy> root, bool forward, NeighborSearchMode searchMode) override;
+  NeighborHop getNeighborHop(std::shared_ptr<NodeProxy> root, bool forward, NeighborSearchMode searchMode) override;
   std::shared_ptr<NodeProxy> getNavigableAtPoint(int32_t x, int32_t y, CoordinateType type) override;
   ReadingMaterial getReadingMaterial() override;
   NodeInfo getNodeInfo() override;
   DefaultLabelInfo getDefaultLabelInfo() override;
+  void fetchSnapshotFields(std::function<void(SnapshotFields)> callback) override;
 
   // --- Component interface ---
   Rect<int> getExtents(CoordinateType type) override;
@@ -115,9 +147,10 @@ private:
   DBus::DBusClient createValueClient();
   DBus::DBusClient createTextClient();
 
-  Address                    mAddress;
-  DBusWrapper::ConnectionPtr mConnection;
-  NodeProxyFactory           mFactory;
+  Address                          mAddress;
+  DBusWrapper::ConnectionPtr       mConnection;
+  NodeProxyFactory                 mFactory;
+  std::shared_ptr<BusCapabilities> mCapabilities;
 };
 
 } // namespace Accessibility
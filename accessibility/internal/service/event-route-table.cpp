@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <accessibility/internal/service/event-route-table.h>
+
+namespace Accessibility
+{
+EventRouteTable::EventRouteTable()
+{
+  // Services that never subscribe keep receiving every event.
+  mMasks[static_cast<std::size_t>(EventTarget::ANY_SOURCE)] = ALL_EVENT_TYPES;
+}
+
+void EventRouteTable::setSubscription(EventTarget target, EventTypeMask types)
+{
+  auto index = static_cast<std::size_t>(target);
+  if(index >= TARGET_COUNT || mMasks[index] == types)
+  {
+    return;
+  }
+
+  mMasks[index] = types;
+  rebuild();
+}
+
+EventTypeMask EventRouteTable::getSubscription(EventTarget target) const
+{
+  auto index = static_cast<std::size_t>(target);
+  return index < TARGET_COUNT ? mMasks[index] : 0;
+}
+
+void EventRouteTable::setTargetAddress(EventTarget target, const Address& address)
+{
+  auto index = static_cast<std::size_t>(target);
+  if(target == EventTarget::ANY_SOURCE || index >= TARGET_COUNT || mAddresses[index] == address)
+  {
+    return;
+  }
+
+  mAddresses[index] = address;
+  rebuild();
+}
+
+const Address& EventRouteTable::getTargetAddress(EventTarget target) const
+{
+  auto index = static_cast<std::size_t>(target);
+  return mAddresses[index < TARGET_COUNT ? index : 0];
+}
+
+void EventRouteTable::clearTargets()
+{
+  for(auto& address : mAddresses)
+  {
+    address = Address{};
+  }
+  mRoutes.clear();
+}
+
+bool EventRouteTable::accepts(const AccessibilityEvent& event) const
+{
+  auto bit = EventTypeBit(event.type);
+
+  if(event.type == AccessibilityEvent::Type::WINDOW_CHANGED || !event.source)
+  {
+    return true;
+  }
+
+  if(mMasks[static_cast<std::size_t>(EventTarget::ANY_SOURCE)] & bit)
+  {
+    return true;
+  }
+
+  auto it = mRoutes.find(event.source);
+  if(it != mRoutes.end() && (it->second & bit))
+  {
+    return true;
+  }
+
+  ++mRejectedCount;
+  return false;
+}
+
+std::size_t EventRouteTable::getRejectedCount() const
+{
+  return mRejectedCount;
+}
+
+void EventRouteTable::rebuild()
+{
+  mRoutes.clear();
+  for(std::size_t i = 0; i < TARGET_COUNT; ++i)
+  {
+    if(mMasks[i] != 0 && mAddresses[i])
+    {
+      // Targets may share an address (e.g. the window is the current node)
+      mRoutes[mAddresses[i]] |= mMasks[i];
+    }
+  }
+}
+
+} // namespace Accessibility
@@ -0,0 +1,116 @@
+#ifndef ACCESSIBILITY_INTERNAL_SERVICE_EVENT_ROUTE_TABLE_H
+#define ACCESSIBILITY_INTERNAL_SERVICE_EVENT_ROUTE_TABLE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+// EXTERNAL INCLUDES
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/accessibility-event.h>
+
+namespace Accessibility
+{
+/**
+ * @brief Hashes an Address by object path.
+ *
+ * Paths are unique per bus in practice, and hashing only the path avoids the
+ * bridge lookup done by Address::GetBus() for local addresses.
+ */
+struct AddressPathHash
+{
+  std::size_t operator()(const Address& address) const
+  {
+    return std::hash<std::string>()(address.GetPath());
+  }
+};
+
+/**
+ * @brief Routing table deciding which events reach a service.
+ *
+ * A service subscribes per EventTarget (current node, its parent, active
+ * window, or any source) with a mask of event types. The table keeps one
+ * entry per target address, so an event is accepted or rejected with a
+ * single hash lookup, before any IPC is issued by the service.
+ *
+ * Always accepted:
+ * - WINDOW_CHANGED events (window tracking is handled by the base service)
+ * - Events without a source address (synthetic or locally generated events)
+ */
+class EventRouteTable
+{
+public:
+  EventRouteTable();
+
+  /**
+   * @brief Sets the event types the service wants from the given target.
+   *
+   * @param[in] target The object to subscribe to
+   * @param[in] types Mask of event types (0 unsubscribes)
+   */
+  void setSubscription(EventTarget target, EventTypeMask types);
+
+  /**
+   * @brief Returns the event types subscribed for the given target.
+   */
+  EventTypeMask getSubscription(EventTarget target) const;
+
+  /**
+   * @brief Updates the address currently bound to a target.
+   *
+   * @param[in] target The target (ANY_SOURCE is ignored)
+   * @param[in] address The address of the object, or an empty Address to unbind
+   */
+  void setTargetAddress(EventTarget target, const Address& address);
+
+  /**
+   * @brief Returns the address currently bound to a target.
+   */
+  const Address& getTargetAddress(EventTarget target) const;
+
+  /**
+   * @brief Unbinds all target addresses.
+   */
+  void clearTargets();
+
+  /**
+   * @brief Returns true if the event should be delivered to the service.
+   */
+  bool accepts(const AccessibilityEvent& event) const;
+
+  /**
+   * @brief Returns the number of events rejected by accepts().
+   */
+  std::size_t getRejectedCount() const;
+
+private:
+  void rebuild();
+
+  static constexpr std::size_t TARGET_COUNT = static_cast<std::size_t>(EventTarget::MAX_COUNT);
+
+  std::array<EventTypeMask, TARGET_COUNT>                     mMasks{};
+  std::array<Address, TARGET_COUNT>                           mAddresses;
+  std::unordered_map<Address, EventTypeMask, AddressPathHash> mRoutes;
+  mutable std::size_t                                         mRejectedCount{0};
+};
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_INTERNAL_SERVICE_EVENT_ROUTE_TABLE_H
@@ -0,0 +1,78 @@
+#ifndef ACCESSIBILITY_INTERNAL_SERVICE_INLINE_TASK_EXECUTOR_H
+#define ACCESSIBILITY_INTERNAL_SERVICE_INLINE_TASK_EXECUTOR_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <deque>
+#include <functional>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/task-executor.h>
+
+namespace Accessibility
+{
+/**
+ * @brief TaskExecutor that runs each task immediately on the posting thread.
+ *
+ * A task posted from inside a running task is queued and runs once the
+ * running task has returned, so tasks still run one at a time and in order.
+ *
+ * Used when the NodeProxy backend is bound to the caller's thread
+ * (e.g. in-process toolkit objects), and in tests.
+ */
+class InlineTaskExecutor : public TaskExecutor
+{
+public:
+  void post(std::function<void()> task) override
+  {
+    mPending.push_back(std::move(task));
+    if(mRunning)
+    {
+      return;
+    }
+
+    mRunning = true;
+    while(!mPending.empty())
+    {
+      auto next = std::move(mPending.front());
+      mPending.pop_front();
+      try
+      {
+        next();
+      }
+      catch(...)
+      {
+        mPending.clear();
+        mRunning = false;
+        throw;
+      }
+    }
+    mRunning = false;
+  }
+
+  void waitIdle() override {}
+
+private:
+  std::deque<std::function<void()>> mPending;
+  bool                              mRunning{false};
+};
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_INTERNAL_SERVICE_INLINE_TASK_EXECUTOR_H
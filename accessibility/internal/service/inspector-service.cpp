@@ -18,6 +18,9 @@
 // CLASS HEADER
 #include <accessibility/internal/service/inspector-service.h>
 
+// INTERNAL INCLUDES
+#include <accessibility/api/log.h>
+
 namespace Accessibility
 {
 InspectorService::InspectorService(std::unique_ptr<AppRegistry> registry,
@@ -26,6 +29,7 @@ InspectorService::InspectorService(std::unique_ptr<AppRegistry> registry,
 : AccessibilityService(std::move(registry), std::move(gestureProvider)),
   mConfig(config)
 {
+  mQueryEngine.SetCrawlerConfig(mConfig.crawler);
 }
 
 InspectorService::~InspectorService()
@@ -80,6 +84,15 @@ void InspectorService::refreshSnapshot()
   if(window)
   {
     mQueryEngine.BuildSnapshot(window);
+
+    auto stats = mQueryEngine.GetCrawlStats();
+    ACCESSIBILITY_LOG_DEBUG_INFO("Inspector snapshot: %zu nodes from %zu buses in %lld us (%.0f nodes/s, %zu peak / %.1f mean in flight)\n",
+                                 stats.nodes,
+                                 stats.buses,
+                                 static_cast<long long>(stats.elapsed.count()),
+                                 stats.NodesPerSecond(),
+                                 stats.peakInFlight,
+                                 stats.meanInFlight);
   }
 }
 
@@ -98,9 +111,13 @@ int InspectorService::getPort() const
   return mConfig.port;
 }
 
-void InspectorService::onAccessibilityEvent(const AccessibilityEvent& /*event*/)
+void InspectorService::onAccessibilityEvent(const AccessibilityEvent& event)
 {
-  // Inspector is passive — no action on events
+  // Keep the snapshot current without re-crawling the window
+  if(mInspectorRunning)
+  {
+    mQueryEngine.ApplyEvent(event);
+  }
 }
 
 void InspectorService::onWindowChanged(std::shared_ptr<NodeProxy> /*window*/)
@@ -44,6 +44,8 @@ public:
   struct Config
   {
     int port = 8080;
+
+    InspectorEngine::SnapshotCrawler::Config crawler; ///< Request window for snapshot crawls
   };
 
   /**
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <accessibility/internal/service/neighbor-resolver.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/log.h>
+
+namespace Accessibility
+{
+namespace
+{
+/**
+ * @brief Checks whether address is an application root, i.e. a socket.
+ */
+bool IsApplicationRoot(const Address& address)
+{
+  const auto& path = address.GetPath();
+  return path == "root" || (path.size() > 5 && path.compare(path.size() - 5, 5, "/root") == 0);
+}
+
+} // namespace
+
+std::shared_ptr<NodeProxy> NeighborResolver::resolve(std::shared_ptr<NodeProxy> start, const HopFunction& hop)
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    ++mStats.lookups;
+  }
+
+  auto node       = std::move(start);
+  auto searchMode = NeighborSearchMode::RECURSE_FROM_ROOT;
+  for(unsigned int hops = 0; node && hops < MAX_HOPS; ++hops)
+  {
+    auto began  = std::chrono::steady_clock::now();
+    auto result = hop(node, searchMode);
+    recordHop(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - began), result.recurse);
+
+    if(!result.recurse || !result.node)
+    {
+      return result.node;
+    }
+
+    // Entering embedded content lands on its socket (an application root);
+    // anything else is the plug the embedded process hands back on leaving
+    bool leaving = !IsApplicationRoot(result.node->getAddress());
+
+    searchMode = leaving ? NeighborSearchMode::CONTINUE_AFTER_FAILED_RECURSION : NeighborSearchMode::RECURSE_FROM_ROOT;
+    node       = std::move(result.node);
+  }
+
+  if(node)
+  {
+    ACCESSIBILITY_LOG_ERROR("Neighbor search exceeded %u hops at %s\n", MAX_HOPS, node->getAddress().ToString().c_str());
+  }
+  return nullptr;
+}
+
+NeighborHopStats NeighborResolver::getStats() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mStats;
+}
+
+void NeighborResolver::recordHop(std::chrono::microseconds latency, bool crossBus)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  ++mStats.hops;
+  if(crossBus)
+  {
+    ++mStats.crossBusHops;
+  }
+  mStats.totalLatency += latency;
+  mStats.maxHopLatency = std::max(mStats.maxHopLatency, latency);
+}
+
+} // namespace Accessibility
@@ -0,0 +1,80 @@
+#ifndef ACCESSIBILITY_INTERNAL_SERVICE_NEIGHBOR_RESOLVER_H
+#define ACCESSIBILITY_INTERNAL_SERVICE_NEIGHBOR_RESOLVER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/accessibility-service.h>
+#include <accessibility/api/node-proxy.h>
+
+namespace Accessibility
+{
+/**
+ * @brief Follows GetNeighbor across process boundaries.
+ *
+ * The bridge answers GetNeighbor within its own process only. When the walk
+ * reaches embedded content it returns the socket (the embedded root, on the
+ * other bus) with the recurse flag set; the caller continues there with
+ * RECURSE_FROM_ROOT. When embedded content is exhausted, the embedded
+ * bridge returns its plug (the embedding object, back on the host bus) with
+ * recurse set; the caller continues from the plug with
+ * CONTINUE_AFTER_FAILED_RECURSION, which skips the plug and its subtree.
+ */
+class NeighborResolver
+{
+public:
+  /**
+   * @brief Performs one GetNeighbor step from start.
+   */
+  using HopFunction = std::function<NeighborHop(const std::shared_ptr<NodeProxy>& start, NeighborSearchMode searchMode)>;
+
+  /**
+   * @brief Upper bound on hops per resolve(), guarding against cyclic embedding.
+   */
+  static constexpr unsigned int MAX_HOPS = 16;
+
+  /**
+   * @brief Resolves the neighbor of start, following recurse hops.
+   *
+   * @param[in] start The node to start from
+   * @param[in] hop Performs a single step (IPC or mirrored)
+   * @return The neighbor, or nullptr at the end of the window
+   */
+  std::shared_ptr<NodeProxy> resolve(std::shared_ptr<NodeProxy> start, const HopFunction& hop);
+
+  /**
+   * @brief Gets accumulated hop statistics.
+   */
+  NeighborHopStats getStats() const;
+
+private:
+  void recordHop(std::chrono::microseconds latency, bool crossBus);
+
+  mutable std::mutex mMutex;
+  NeighborHopStats   mStats;
+};
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_INTERNAL_SERVICE_NEIGHBOR_RESOLVER_H
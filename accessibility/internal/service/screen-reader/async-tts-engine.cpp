@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <accessibility/internal/service/screen-reader/async-tts-engine.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+namespace Accessibility
+{
+AsyncTtsEngine::AsyncTtsEngine(std::unique_ptr<SpeechSynthesizer> synthesizer, std::unique_ptr<AudioSink> sink)
+: mSynthesizer(std::move(synthesizer)),
+  mSink(std::move(sink))
+{
+  mWorker = std::thread([this]() { run(); });
+}
+
+AsyncTtsEngine::~AsyncTtsEngine()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mQuit = true;
+    cancelRendering(false);
+  }
+  mWakeUp.notify_all();
+  mWorker.join();
+}
+
+CommandId AsyncTtsEngine::speak(const std::string& text, const SpeakOptions& options)
+{
+  CommandId id;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if(options.interrupt)
+    {
+      cancelRendering(false);
+      mSink->stop();
+    }
+    id = mNextId++;
+    mJobs.push_back({id, text, options.discardable});
+  }
+  mWakeUp.notify_all();
+  return id;
+}
+
+void AsyncTtsEngine::stop()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  cancelRendering(false);
+  mSink->stop();
+}
+
+bool AsyncTtsEngine::pause()
+{
+  // Rendering continues; the sink holds the audio until resume()
+  return mSink->pause();
+}
+
+bool AsyncTtsEngine::resume()
+{
+  return mSink->resume();
+}
+
+bool AsyncTtsEngine::isPaused() const
+{
+  return mSink->isPaused();
+}
+
+void AsyncTtsEngine::purge(bool onlyDiscardable)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  cancelRendering(onlyDiscardable);
+  mSink->purge(onlyDiscardable);
+}
+
+void AsyncTtsEngine::onUtteranceStarted(std::function<void(CommandId)> callback)
+{
+  mSink->onUtteranceStarted(std::move(callback));
+}
+
+void AsyncTtsEngine::onUtteranceCompleted(std::function<void(CommandId)> callback)
+{
+  mSink->onUtteranceCompleted(std::move(callback));
+}
+
+std::size_t AsyncTtsEngine::getLookahead() const
+{
+  return 1;
+}
+
+void AsyncTtsEngine::waitIdle()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  mIdle.wait(lock, [this]() { return mJobs.empty() && mRenderingId == 0; });
+}
+
+void AsyncTtsEngine::cancelRendering(bool onlyDiscardable)
+{
+  mJobs.erase(std::remove_if(mJobs.begin(), mJobs.end(), [onlyDiscardable](const Job& job) { return !onlyDiscardable || job.discardable; }),
+              mJobs.end());
+  if(mRenderingId != 0 && (!onlyDiscardable || mRenderingDiscardable))
+  {
+    mCancelRendering = true;
+  }
+  if(mJobs.empty() && mRenderingId == 0)
+  {
+    mIdle.notify_all();
+  }
+}
+
+void AsyncTtsEngine::run()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  while(true)
+  {
+    mWakeUp.wait(lock, [this]() { return mQuit || !mJobs.empty(); });
+    if(mQuit)
+    {
+      break;
+    }
+
+    auto job              = std::move(mJobs.front());
+    mJobs.pop_front();
+    mRenderingId          = job.id;
+    mRenderingDiscardable = job.discardable;
+    mCancelRendering      = false;
+    lock.unlock();
+
+    // Blocks are passed on under the lock, so none arrives after a stop or purge
+    mSynthesizer->synthesizeStream(job.text, [this, &job](std::shared_ptr<const PcmBuffer> block)
+    {
+      std::lock_guard<std::mutex> blockLock(mMutex);
+      if(mCancelRendering)
+      {
+        return false;
+      }
+      mSink->enqueue(job.id, std::move(block), job.discardable, false);
+      return true;
+    });
+
+    lock.lock();
+    if(!mCancelRendering)
+    {
+      // Close the utterance, even if synthesis failed, so it still completes
+      mSink->enqueue(job.id, nullptr, job.discardable, true);
+    }
+    mRenderingId = 0;
+    if(mJobs.empty())
+    {
+      mIdle.notify_all();
+    }
+  }
+}
+
+} // namespace Accessibility
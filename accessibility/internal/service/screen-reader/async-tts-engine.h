@@ -0,0 +1,110 @@
+#ifndef ACCESSIBILITY_INTERNAL_SERVICE_SCREEN_READER_ASYNC_TTS_ENGINE_H
+#define ACCESSIBILITY_INTERNAL_SERVICE_SCREEN_READER_ASYNC_TTS_ENGINE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/audio-sink.h>
+#include <accessibility/api/speech-synthesizer.h>
+#include <accessibility/api/tts-engine.h>
+
+namespace Accessibility
+{
+/**
+ * @brief TtsEngine that renders on a worker thread and reports progress from playback.
+ *
+ * speak() only queues the text. A worker thread renders utterances in order
+ * with SpeechSynthesizer::synthesizeStream() and hands each block to the
+ * AudioSink as soon as it is rendered. The worker does not wait for
+ * playback, so the next utterance is rendered while the current one plays
+ * and follows it without a gap (see getLookahead()).
+ *
+ * Started and completed callbacks come from the sink, i.e. from the actual
+ * audio position, on the sink's thread. Stopped or purged utterances never
+ * complete.
+ */
+class AsyncTtsEngine : public TtsEngine
+{
+public:
+  /**
+   * @brief Constructor. Starts the synthesis thread.
+   *
+   * @param[in] synthesizer Renders the text
+   * @param[in] sink Plays the rendered audio
+   */
+  AsyncTtsEngine(std::unique_ptr<SpeechSynthesizer> synthesizer, std::unique_ptr<AudioSink> sink);
+
+  /**
+   * @brief Destructor. Cancels rendering and joins the synthesis thread.
+   */
+  ~AsyncTtsEngine() override;
+
+  CommandId   speak(const std::string& text, const SpeakOptions& options) override;
+  void        stop() override;
+  bool        pause() override;
+  bool        resume() override;
+  bool        isPaused() const override;
+  void        purge(bool onlyDiscardable) override;
+  void        onUtteranceStarted(std::function<void(CommandId)> callback) override;
+  void        onUtteranceCompleted(std::function<void(CommandId)> callback) override;
+  std::size_t getLookahead() const override;
+
+  /**
+   * @brief Blocks until every utterance spoken so far has been rendered (or dropped).
+   *
+   * Playback may still be in progress.
+   */
+  void waitIdle();
+
+private:
+  struct Job
+  {
+    CommandId   id;
+    std::string text;
+    bool        discardable;
+  };
+
+  void run();
+  void cancelRendering(bool onlyDiscardable);
+
+  std::unique_ptr<SpeechSynthesizer> mSynthesizer;
+  std::unique_ptr<AudioSink>         mSink;
+  std::deque<Job>                    mJobs;
+  CommandId                          mNextId{1};
+  CommandId                          mRenderingId{0};
+  bool                               mRenderingDiscardable{false};
+  bool                               mCancelRendering{false};
+  bool                               mQuit{false};
+  std::mutex                         mMutex;
+  std::condition_variable            mWakeUp;
+  std::condition_variable            mIdle;
+  std::thread                        mWorker;
+};
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_INTERNAL_SERVICE_SCREEN_READER_ASYNC_TTS_ENGINE_H
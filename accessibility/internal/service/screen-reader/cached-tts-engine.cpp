@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <accessibility/internal/service/screen-reader/cached-tts-engine.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+namespace Accessibility
+{
+namespace
+{
+bool IsPhraseBreak(char c)
+{
+  return c == ',' || c == ';' || c == '.' || c == '!' || c == '?';
+}
+
+void AppendTrimmed(std::vector<std::string>& phrases, const std::string& text, std::size_t begin, std::size_t end)
+{
+  while(begin < end && text[begin] == ' ')
+  {
+    ++begin;
+  }
+  while(end > begin && text[end - 1] == ' ')
+  {
+    --end;
+  }
+  if(begin < end)
+  {
+    phrases.emplace_back(text, begin, end - begin);
+  }
+}
+
+} // namespace
+
+CachedTtsEngine::CachedTtsEngine(std::unique_ptr<SpeechSynthesizer> synthesizer, std::unique_ptr<AudioSink> sink)
+: CachedTtsEngine(std::move(synthesizer), std::move(sink), Config())
+{
+}
+
+CachedTtsEngine::CachedTtsEngine(std::unique_ptr<SpeechSynthesizer> synthesizer, std::unique_ptr<AudioSink> sink, Config config)
+: mSynthesizer(std::move(synthesizer)),
+  mSink(std::move(sink)),
+  mConfig(config),
+  mCache(config.cacheBytes)
+{
+  mWorker = std::thread([this]() { run(); });
+}
+
+CachedTtsEngine::~CachedTtsEngine()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mQuit = true;
+    cancelRendering(false);
+  }
+  mWakeUp.notify_all();
+  mWorker.join();
+}
+
+std::vector<std::string> CachedTtsEngine::SplitPhrases(const std::string& text)
+{
+  // Break after punctuation followed by a space, so "1,000" or "v1.2" stay whole
+  std::vector<std::string> phrases;
+  std::size_t              begin = 0;
+  for(std::size_t i = 0; i < text.size(); ++i)
+  {
+    if(IsPhraseBreak(text[i]) && (i + 1 == text.size() || text[i + 1] == ' '))
+    {
+      AppendTrimmed(phrases, text, begin, i);
+      begin = i + 1;
+    }
+  }
+  AppendTrimmed(phrases, text, begin, text.size());
+  return phrases;
+}
+
+std::shared_ptr<const PcmBuffer> CachedTtsEngine::getSilence(uint32_t sampleRate)
+{
+  if(!mSilence || mSilence->sampleRate != sampleRate)
+  {
+    auto silence        = std::make_shared<PcmBuffer>();
+    silence->sampleRate = sampleRate;
+    silence->samples.assign(static_cast<std::size_t>(sampleRate) * mConfig.phraseGapMs / 1000, 0);
+    mSilence = std::move(silence);
+  }
+  return mSilence;
+}
+
+CommandId CachedTtsEngine::speak(const std::string& text, const SpeakOptions& options)
+{
+  CommandId id;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if(options.interrupt)
+    {
+      cancelRendering(false);
+      mSink->stop();
+    }
+    id = mNextId++;
+    mJobs.push_back({id, text, options.discardable});
+  }
+  mWakeUp.notify_all();
+  return id;
+}
+
+void CachedTtsEngine::stop()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  cancelRendering(false);
+  mSink->stop();
+}
+
+bool CachedTtsEngine::pause()
+{
+  return mSink->pause();
+}
+
+bool CachedTtsEngine::resume()
+{
+  return mSink->resume();
+}
+
+bool CachedTtsEngine::isPaused() const
+{
+  return mSink->isPaused();
+}
+
+void CachedTtsEngine::purge(bool onlyDiscardable)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  cancelRendering(onlyDiscardable);
+  mSink->purge(onlyDiscardable);
+}
+
+void CachedTtsEngine::onUtteranceStarted(std::function<void(CommandId)> callback)
+{
+  mSink->onUtteranceStarted(std::move(callback));
+}
+
+void CachedTtsEngine::onUtteranceCompleted(std::function<void(CommandId)> callback)
+{
+  mSink->onUtteranceCompleted(std::move(callback));
+}
+
+std::size_t CachedTtsEngine::getLookahead() const
+{
+  return 1;
+}
+
+void CachedTtsEngine::waitIdle()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  mIdle.wait(lock, [this]() { return mJobs.empty() && mRenderingId == 0; });
+}
+
+void CachedTtsEngine::cancelRendering(bool onlyDiscardable)
+{
+  mJobs.erase(std::remove_if(mJobs.begin(), mJobs.end(), [onlyDiscardable](const Job& job) { return !onlyDiscardable || job.discardable; }),
+              mJobs.end());
+  if(mRenderingId != 0 && (!onlyDiscardable || mRenderingDiscardable))
+  {
+    mCancelRendering = true;
+  }
+  if(mJobs.empty() && mRenderingId == 0)
+  {
+    mIdle.notify_all();
+  }
+}
+
+void CachedTtsEngine::run()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  while(true)
+  {
+    mWakeUp.wait(lock, [this]() { return mQuit || !mJobs.empty(); });
+    if(mQuit)
+    {
+      break;
+    }
+
+    auto job              = std::move(mJobs.front());
+    mJobs.pop_front();
+    mRenderingId          = job.id;
+    mRenderingDiscardable = job.discardable;
+    mCancelRendering      = false;
+    lock.unlock();
+
+    render(job);
+
+    lock.lock();
+    if(!mCancelRendering)
+    {
+      // Close the utterance, even if nothing could be rendered
+      mSink->enqueue(job.id, nullptr, job.discardable, true);
+    }
+    mRenderingId = 0;
+    if(mJobs.empty())
+    {
+      mIdle.notify_all();
+    }
+  }
+}
+
+void CachedTtsEngine::render(const Job& job)
+{
+  auto voiceKey = mSynthesizer->getVoiceKey();
+  bool first    = true;
+  for(auto& phrase : SplitPhrases(job.text))
+  {
+    std::shared_ptr<const PcmBuffer> pcm;
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      if(mCancelRendering)
+      {
+        return;
+      }
+      pcm = mCache.find(voiceKey, phrase);
+    }
+
+    if(!pcm)
+    {
+      auto rendered = std::make_shared<PcmBuffer>();
+      if(!mSynthesizer->synthesize(phrase, *rendered) || rendered->samples.empty())
+      {
+        continue;
+      }
+      pcm = rendered;
+      std::lock_guard<std::mutex> lock(mMutex);
+      mCache.insert(voiceKey, phrase, pcm);
+    }
+
+    // Segments are passed on under the lock, so none arrives after a stop or purge
+    std::lock_guard<std::mutex> lock(mMutex);
+    if(mCancelRendering)
+    {
+      return;
+    }
+    if(!first && mConfig.phraseGapMs > 0)
+    {
+      mSink->enqueue(job.id, getSilence(pcm->sampleRate), job.discardable, false);
+    }
+    mSink->enqueue(job.id, std::move(pcm), job.discardable, false);
+    first = false;
+  }
+}
+
+PcmCacheStats CachedTtsEngine::getCacheStats() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mCache.getStats();
+}
+
+void CachedTtsEngine::clearCache()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mCache.clear();
+}
+
+} // namespace Accessibility
@@ -0,0 +1,151 @@
+#ifndef ACCESSIBILITY_INTERNAL_SERVICE_SCREEN_READER_CACHED_TTS_ENGINE_H
+#define ACCESSIBILITY_INTERNAL_SERVICE_SCREEN_READER_CACHED_TTS_ENGINE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/audio-sink.h>
+#include <accessibility/api/speech-synthesizer.h>
+#include <accessibility/api/tts-engine.h>
+#include <accessibility/internal/service/screen-reader/pcm-cache.h>
+
+namespace Accessibility
+{
+/**
+ * @brief TtsEngine that renders phrases once and replays them from a cache.
+ *
+ * Text is split into phrases at clause punctuation (", " as produced by
+ * ReadingComposer, and sentence ends). Each phrase is looked up in a PcmCache
+ * by (voice key, phrase); misses are rendered by the SpeechSynthesizer and
+ * cached. Phrases are streamed to the AudioSink in order, so an utterance
+ * starting with cached phrases such as a role or a usage hint begins
+ * playing before the rest is synthesized.
+ *
+ * Like AsyncTtsEngine, speak() only queues the text; a worker thread renders
+ * utterances in order, one ahead of playback (see getLookahead()). The
+ * cache is locked only around lookups and inserts, so stop(), purge() and
+ * an interrupting speak() cut the utterance being rendered short after the
+ * current phrase.
+ */
+class CachedTtsEngine : public TtsEngine
+{
+public:
+  struct Config
+  {
+    std::size_t cacheBytes  = 4 * 1024 * 1024; ///< About 95 s of 22 kHz audio
+    uint32_t    phraseGapMs = 0;               ///< Extra silence between phrases; the synthesizer already pauses at phrase ends
+  };
+
+  /**
+   * @brief Constructor with the default Config.
+   *
+   * @param[in] synthesizer Renders phrases that are not cached
+   * @param[in] sink Plays the rendered phrases
+   */
+  CachedTtsEngine(std::unique_ptr<SpeechSynthesizer> synthesizer, std::unique_ptr<AudioSink> sink);
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] synthesizer Renders phrases that are not cached
+   * @param[in] sink Plays the rendered phrases
+   * @param[in] config Cache and splicing parameters
+   */
+  CachedTtsEngine(std::unique_ptr<SpeechSynthesizer> synthesizer, std::unique_ptr<AudioSink> sink, Config config);
+
+  /**
+   * @brief Destructor. Cancels rendering and joins the synthesis thread.
+   */
+  ~CachedTtsEngine() override;
+
+  CommandId   speak(const std::string& text, const SpeakOptions& options) override;
+  void        stop() override;
+  bool        pause() override;
+  bool        resume() override;
+  bool        isPaused() const override;
+  void        purge(bool onlyDiscardable) override;
+  void        onUtteranceStarted(std::function<void(CommandId)> callback) override;
+  void        onUtteranceCompleted(std::function<void(CommandId)> callback) override;
+  std::size_t getLookahead() const override;
+
+  /**
+   * @brief Blocks until every utterance spoken so far has been rendered (or dropped).
+   *
+   * Playback may still be in progress.
+   */
+  void waitIdle();
+
+  /**
+   * @brief Gets the phrase cache statistics.
+   */
+  PcmCacheStats getCacheStats() const;
+
+  /**
+   * @brief Drops every cached phrase, e.g. after a language change.
+   */
+  void clearCache();
+
+  /**
+   * @brief Splits text into the phrases that are cached independently.
+   */
+  static std::vector<std::string> SplitPhrases(const std::string& text);
+
+private:
+  struct Job
+  {
+    CommandId   id;
+    std::string text;
+    bool        discardable;
+  };
+
+  void                             run();
+  void                             render(const Job& job);
+  std::shared_ptr<const PcmBuffer> getSilence(uint32_t sampleRate);
+  void                             cancelRendering(bool onlyDiscardable);
+
+  std::unique_ptr<SpeechSynthesizer> mSynthesizer; ///< Used by the worker only
+  std::unique_ptr<AudioSink>         mSink;
+  Config                             mConfig;
+  PcmCache                           mCache;
+  std::shared_ptr<const PcmBuffer>   mSilence;
+  std::deque<Job>                    mJobs;
+  CommandId                          mNextId{1};
+  CommandId                          mRenderingId{0};
+  bool                               mRenderingDiscardable{false};
+  bool                               mCancelRendering{false};
+  bool                               mQuit{false};
+  mutable std::mutex                 mMutex; ///< Guards everything but the synthesizer
+  std::condition_variable            mWakeUp;
+  std::condition_variable            mIdle;
+  std::thread                        mWorker;
+};
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_INTERNAL_SERVICE_SCREEN_READER_CACHED_TTS_ENGINE_H
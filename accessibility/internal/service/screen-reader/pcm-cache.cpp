@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <accessibility/internal/service/screen-reader/pcm-cache.h>
+
+namespace Accessibility
+{
+PcmCache::PcmCache(std::size_t capacityBytes)
+: mCapacityBytes(capacityBytes)
+{
+}
+
+std::string PcmCache::MakeKey(const std::string& voiceKey, const std::string& text)
+{
+  // Unit separator; cannot appear in a voice key
+  std::string key;
+  key.reserve(voiceKey.size() + 1 + text.size());
+  key += voiceKey;
+  key += '\x1f';
+  key += text;
+  return key;
+}
+
+std::shared_ptr<const PcmBuffer> PcmCache::find(const std::string& voiceKey, const std::string& text)
+{
+  auto it = mIndex.find(MakeKey(voiceKey, text));
+  if(it == mIndex.end())
+  {
+    ++mStats.misses;
+    return nullptr;
+  }
+
+  ++mStats.hits;
+  mEntries.splice(mEntries.begin(), mEntries, it->second);
+  return it->second->pcm;
+}
+
+void PcmCache::insert(const std::string& voiceKey, const std::string& text, std::shared_ptr<const PcmBuffer> pcm)
+{
+  if(!pcm)
+  {
+    return;
+  }
+
+  auto bytes = pcm->samples.size() * sizeof(int16_t);
+  if(bytes > mCapacityBytes)
+  {
+    return;
+  }
+
+  auto key = MakeKey(voiceKey, text);
+  auto it  = mIndex.find(key);
+  if(it != mIndex.end())
+  {
+    mStats.bytes -= it->second->bytes;
+    mEntries.erase(it->second);
+    mIndex.erase(it);
+  }
+
+  while(!mEntries.empty() && mStats.bytes + bytes > mCapacityBytes)
+  {
+    auto& victim = mEntries.back();
+    mStats.bytes -= victim.bytes;
+    mIndex.erase(victim.key);
+    mEntries.pop_back();
+    ++mStats.evictions;
+  }
+
+  mEntries.push_front({key, std::move(pcm), bytes});
+  mIndex.emplace(std::move(key), mEntries.begin());
+  mStats.bytes += bytes;
+  mStats.entries = mEntries.size();
+}
+
+void PcmCache::clear()
+{
+  mEntries.clear();
+  mIndex.clear();
+  mStats.bytes   = 0;
+  mStats.entries = 0;
+}
+
+PcmCacheStats PcmCache::getStats() const
+{
+  auto stats    = mStats;
+  stats.entries = mEntries.size();
+  return stats;
+}
+
+} // namespace Accessibility
@@ -0,0 +1,115 @@
+#ifndef ACCESSIBILITY_INTERNAL_SERVICE_SCREEN_READER_PCM_CACHE_H
+#define ACCESSIBILITY_INTERNAL_SERVICE_SCREEN_READER_PCM_CACHE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/speech-synthesizer.h>
+
+namespace Accessibility
+{
+/**
+ * @brief Hit statistics of a PcmCache.
+ */
+struct PcmCacheStats
+{
+  uint64_t    hits{0};
+  uint64_t    misses{0};
+  uint64_t    evictions{0};
+  std::size_t entries{0};
+  std::size_t bytes{0};
+
+  /**
+   * @brief Fraction of lookups served from the cache, 0 if there were none.
+   */
+  double getHitRate() const
+  {
+    auto lookups = hits + misses;
+    return lookups ? static_cast<double>(hits) / lookups : 0.0;
+  }
+};
+
+/**
+ * @brief LRU cache of rendered phrases, keyed by (voice key, text).
+ *
+ * Bounded by the total size of the cached samples. Buffers are shared, so
+ * an evicted phrase that is still queued for playback stays valid.
+ *
+ * Not thread-safe; the owner serializes access.
+ */
+class PcmCache
+{
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] capacityBytes Upper bound on the size of cached samples
+   */
+  explicit PcmCache(std::size_t capacityBytes);
+
+  /**
+   * @brief Looks up a phrase and marks it most recently used.
+   *
+   * @return The cached audio, or nullptr on a miss
+   */
+  std::shared_ptr<const PcmBuffer> find(const std::string& voiceKey, const std::string& text);
+
+  /**
+   * @brief Caches a phrase, evicting least recently used ones to fit.
+   *
+   * Phrases larger than the whole capacity are not cached.
+   */
+  void insert(const std::string& voiceKey, const std::string& text, std::shared_ptr<const PcmBuffer> pcm);
+
+  /**
+   * @brief Drops every cached phrase. Statistics are kept.
+   */
+  void clear();
+
+  /**
+   * @brief Gets the hit statistics.
+   */
+  PcmCacheStats getStats() const;
+
+private:
+  struct Entry
+  {
+    std::string                      key;
+    std::shared_ptr<const PcmBuffer> pcm;
+    std::size_t                      bytes;
+  };
+
+  static std::string MakeKey(const std::string& voiceKey, const std::string& text);
+
+  std::size_t                                                  mCapacityBytes;
+  std::list<Entry>                                             mEntries; ///< Most recently used first
+  std::unordered_map<std::string, std::list<Entry>::iterator> mIndex;
+  PcmCacheStats                                                mStats;
+};
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_INTERNAL_SERVICE_SCREEN_READER_PCM_CACHE_H
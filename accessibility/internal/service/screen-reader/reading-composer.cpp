@@ -18,16 +18,64 @@
 // CLASS HEADER
 #include <accessibility/api/reading-composer.h>
 
+// EXTERNAL INCLUDES
+#include <array>
+#include <charconv>
+#include <functional>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
 namespace Accessibility
 {
-ReadingComposer::ReadingComposer(ReadingComposerConfig config)
-: mConfig(config)
+namespace
 {
-}
+/**
+ * @brief One part of the reading, in spoken order.
+ */
+enum class Field : uint8_t
+{
+  CHECKED,
+  SELECTED,
+  EXPANDED,
+  DISABLED,
+  READ_ONLY,
+  REQUIRED,
+  NAME,
+  ROLE,
+  ITEM_COUNT,   ///< TV trait
+  PROGRESS,     ///< TV trait
+  SLIDER_VALUE,
+  DESCRIPTION,
+  TOUCH_HINT,
+};
 
-std::string ReadingComposer::composeRoleTrait(const ReadingMaterial& rm) const
+/**
+ * @brief The trait a field belongs to; traits are joined with ", ".
+ */
+enum class Trait : uint8_t
 {
-  switch(rm.role)
+  STATE,
+  NAME,
+  ROLE,
+  DESCRIPTION,
+};
+
+/**
+ * @brief A compiled step: the field and its separator within its trait.
+ */
+struct Step
+{
+  Field            field;
+  Trait            trait;
+  std::string_view separator;
+};
+
+constexpr std::string_view TRAIT_SEPARATOR = ", ";
+
+std::string_view GetRoleTrait(Role role)
+{
+  switch(role)
   {
     case Role::PUSH_BUTTON:      return "Button";
     case Role::CHECK_BOX:        return "Check box";
@@ -70,171 +118,330 @@ std::string ReadingComposer::composeRoleTrait(const ReadingMaterial& rm) const
   }
 }
 
-std::string ReadingComposer::composeStateTrait(const ReadingMaterial& rm) const
+bool HasTouchHint(Role role)
 {
-  std::string result;
+  return role == Role::PUSH_BUTTON || role == Role::CHECK_BOX || role == Role::RADIO_BUTTON ||
+         role == Role::TOGGLE_BUTTON || role == Role::LINK;
+}
+
+void AppendInt(std::string& out, long long value)
+{
+  char buffer[24];
+  auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  out.append(buffer, result.ptr);
+}
 
-  // Checked/unchecked for checkable items
-  if(rm.states[State::CHECKABLE])
+void AppendField(Field field, const ReadingMaterial& rm, std::string& out)
+{
+  switch(field)
   {
-    if(rm.states[State::CHECKED])
+    case Field::CHECKED:
     {
-      result += "Checked";
+      if(rm.states[State::CHECKABLE])
+      {
+        out += rm.states[State::CHECKED] ? "Checked" : "Not checked";
+      }
+      break;
     }
-    else
+    case Field::SELECTED:
+    {
+      if(rm.states[State::SELECTED])
+      {
+        out += "Selected";
+      }
+      break;
+    }
+    case Field::EXPANDED:
+    {
+      if(rm.states[State::EXPANDABLE])
+      {
+        out += rm.states[State::EXPANDED] ? "Expanded" : "Collapsed";
+      }
+      break;
+    }
+    case Field::DISABLED:
+    {
+      if(!rm.states[State::ENABLED])
+      {
+        out += "Disabled";
+      }
+      break;
+    }
+    case Field::READ_ONLY:
+    {
+      if(rm.states[State::READ_ONLY] && rm.states[State::EDITABLE])
+      {
+        out += "Read only";
+      }
+      break;
+    }
+    case Field::REQUIRED:
+    {
+      if(rm.states[State::REQUIRED])
+      {
+        out += "Required";
+      }
+      break;
+    }
+    case Field::NAME:
+    {
+      // Priority: labeledByName > name > textIfceName
+      out += !rm.labeledByName.empty() ? rm.labeledByName : !rm.name.empty() ? rm.name : rm.textIfceName;
+      break;
+    }
+    case Field::ROLE:
+    {
+      out += GetRoleTrait(rm.role);
+      break;
+    }
+    case Field::ITEM_COUNT:
+    {
+      if(rm.role == Role::POPUP_MENU && rm.childCount > 0)
+      {
+        AppendInt(out, rm.childCount);
+        out += " items";
+      }
+      break;
+    }
+    case Field::PROGRESS:
     {
-      result += "Not checked";
+      if(rm.role == Role::PROGRESS_BAR)
+      {
+        AppendInt(out, static_cast<int>(rm.currentValue));
+        out += '%';
+      }
+      break;
+    }
+    case Field::SLIDER_VALUE:
+    {
+      if(rm.role == Role::SLIDER)
+      {
+        if(rm.formattedValue.empty())
+        {
+          AppendInt(out, static_cast<int>(rm.currentValue));
+        }
+        else
+        {
+          out += rm.formattedValue;
+        }
+      }
+      break;
+    }
+    case Field::DESCRIPTION:
+    {
+      out += rm.description;
+      break;
+    }
+    case Field::TOUCH_HINT:
+    {
+      if(HasTouchHint(rm.role))
+      {
+        out += "Double tap to activate";
+      }
+      else if(rm.role == Role::SLIDER)
+      {
+        out += "Swipe up or down to adjust";
+      }
+      break;
     }
   }
+}
 
-  // Selected
-  if(rm.states[State::SELECTED])
+/**
+ * @brief Appends the non-empty fields of the given steps, with separators.
+ *
+ * A field is preceded by its step separator if its trait already has
+ * content, by ", " if only earlier traits do, and by nothing otherwise.
+ */
+void Run(const std::vector<Step>& steps, const ReadingMaterial& rm, std::string& out)
+{
+  bool  traitHasContent = false;
+  Trait trait           = steps.empty() ? Trait::STATE : steps.front().trait;
+  for(auto& step : steps)
   {
-    if(!result.empty()) result += ", ";
-    result += "Selected";
-  }
+    if(step.trait != trait)
+    {
+      trait           = step.trait;
+      traitHasContent = false;
+    }
 
-  // Expanded/collapsed
-  if(rm.states[State::EXPANDABLE])
-  {
-    if(!result.empty()) result += ", ";
-    if(rm.states[State::EXPANDED])
+    auto mark = out.size();
+    if(!out.empty())
+    {
+      out += traitHasContent ? step.separator : TRAIT_SEPARATOR;
+    }
+    auto start = out.size();
+    AppendField(step.field, rm, out);
+    if(out.size() == start)
     {
-      result += "Expanded";
+      out.resize(mark);
     }
     else
     {
-      result += "Collapsed";
+      traitHasContent = true;
     }
   }
+}
 
-  // Disabled
-  if(!rm.states[State::ENABLED])
-  {
-    if(!result.empty()) result += ", ";
-    result += "Disabled";
-  }
-
-  // Read-only
-  if(rm.states[State::READ_ONLY] && rm.states[State::EDITABLE])
-  {
-    if(!result.empty()) result += ", ";
-    result += "Read only";
-  }
-
-  // Required
-  if(rm.states[State::REQUIRED])
-  {
-    if(!result.empty()) result += ", ";
-    result += "Required";
-  }
+void AppendKey(std::string& key, std::string_view value)
+{
+  auto size = static_cast<uint32_t>(value.size());
+  key.append(reinterpret_cast<const char*>(&size), sizeof(size));
+  key.append(value);
+}
 
-  return result;
+template<typename T>
+void AppendKeyBytes(std::string& key, const T& value)
+{
+  key.append(reinterpret_cast<const char*>(&value), sizeof(value));
 }
 
-std::string ReadingComposer::composeDescriptionTrait(const ReadingMaterial& rm) const
+} // namespace
+
+struct ReadingComposer::Impl
 {
-  std::string result;
+  static constexpr std::size_t CACHE_SIZE = 8;
+
+  struct Entry
+  {
+    std::size_t hash{0};
+    std::string key;
+    std::string text;
+    bool        valid{false};
+  };
 
-  // Item count for lists/popup menus (TV trait)
-  if(mConfig.includeTvTraits)
+  explicit Impl(const ReadingComposerConfig& config)
   {
-    if(rm.role == Role::POPUP_MENU && rm.childCount > 0)
+    // Tizen screen reader order: state, name, role, description
+    steps = {
+      {Field::CHECKED, Trait::STATE, TRAIT_SEPARATOR},
+      {Field::SELECTED, Trait::STATE, TRAIT_SEPARATOR},
+      {Field::EXPANDED, Trait::STATE, TRAIT_SEPARATOR},
+      {Field::DISABLED, Trait::STATE, TRAIT_SEPARATOR},
+      {Field::READ_ONLY, Trait::STATE, TRAIT_SEPARATOR},
+      {Field::REQUIRED, Trait::STATE, TRAIT_SEPARATOR},
+      {Field::NAME, Trait::NAME, TRAIT_SEPARATOR},
+      {Field::ROLE, Trait::ROLE, TRAIT_SEPARATOR},
+    };
+    if(config.includeTvTraits)
     {
-      result += std::to_string(rm.childCount) + " items";
+      steps.push_back({Field::ITEM_COUNT, Trait::DESCRIPTION, TRAIT_SEPARATOR});
+      steps.push_back({Field::PROGRESS, Trait::DESCRIPTION, ""});
+    }
+    steps.push_back({Field::SLIDER_VALUE, Trait::DESCRIPTION, TRAIT_SEPARATOR});
+    steps.push_back({Field::DESCRIPTION, Trait::DESCRIPTION, TRAIT_SEPARATOR});
+    if(!config.suppressTouchHints)
+    {
+      steps.push_back({Field::TOUCH_HINT, Trait::DESCRIPTION, ". "});
     }
 
-    if(rm.role == Role::PROGRESS_BAR)
+    for(auto& step : steps)
     {
-      result += std::to_string(static_cast<int>(rm.currentValue)) + "%";
+      if(step.trait == Trait::STATE)
+      {
+        stateSteps.push_back(step);
+      }
+      else if(step.trait == Trait::DESCRIPTION)
+      {
+        descriptionSteps.push_back(step);
+      }
     }
   }
 
-  // Slider value
-  if(rm.role == Role::SLIDER)
+  /**
+   * @brief Serializes the fields the compiled steps read into keyBuffer.
+   */
+  void buildKey(const ReadingMaterial& rm)
   {
-    if(!result.empty()) result += ", ";
-    result += rm.formattedValue.empty()
-              ? std::to_string(static_cast<int>(rm.currentValue))
-              : rm.formattedValue;
+    keyBuffer.clear();
+    AppendKeyBytes(keyBuffer, rm.role);
+    AppendKeyBytes(keyBuffer, rm.states.GetRawData());
+    AppendKeyBytes(keyBuffer, rm.childCount);
+    AppendKeyBytes(keyBuffer, static_cast<int>(rm.currentValue));
+    AppendKey(keyBuffer, rm.labeledByName);
+    AppendKey(keyBuffer, rm.name);
+    AppendKey(keyBuffer, rm.textIfceName);
+    AppendKey(keyBuffer, rm.formattedValue);
+    AppendKey(keyBuffer, rm.description);
   }
 
-  // Description
-  if(!rm.description.empty())
-  {
-    if(!result.empty()) result += ", ";
-    result += rm.description;
-  }
+  std::vector<Step>           steps;
+  std::vector<Step>           stateSteps;
+  std::vector<Step>           descriptionSteps;
+  std::array<Entry, CACHE_SIZE> cache;
+  std::size_t                 nextVictim{0};
+  std::string                 keyBuffer;
+  ReadingComposerStats        stats;
+  std::mutex                  mutex;
+};
 
-  // Touch hint (suppressed on TV)
-  if(!mConfig.suppressTouchHints)
-  {
-    if(rm.role == Role::PUSH_BUTTON || rm.role == Role::CHECK_BOX ||
-       rm.role == Role::RADIO_BUTTON || rm.role == Role::TOGGLE_BUTTON ||
-       rm.role == Role::LINK)
-    {
-      if(!result.empty()) result += ". ";
-      result += "Double tap to activate";
-    }
-    else if(rm.role == Role::SLIDER)
-    {
-      if(!result.empty()) result += ". ";
-      result += "Swipe up or down to adjust";
-    }
-  }
+ReadingComposer::ReadingComposer(ReadingComposerConfig config)
+: mImpl(std::make_unique<Impl>(config))
+{
+}
+
+ReadingComposer::~ReadingComposer() = default;
 
+std::string ReadingComposer::composeRoleTrait(const ReadingMaterial& rm) const
+{
+  return std::string(GetRoleTrait(rm.role));
+}
+
+std::string ReadingComposer::composeStateTrait(const ReadingMaterial& rm) const
+{
+  std::string result;
+  Run(mImpl->stateSteps, rm, result);
   return result;
 }
 
-std::string ReadingComposer::compose(const ReadingMaterial& rm) const
+std::string ReadingComposer::composeDescriptionTrait(const ReadingMaterial& rm) const
 {
   std::string result;
+  Run(mImpl->descriptionSteps, rm, result);
+  return result;
+}
 
-  // 1. State trait (matches Tizen screen reader order: state → name → role → description)
-  auto stateTrait = composeStateTrait(rm);
-  if(!stateTrait.empty())
-  {
-    result = stateTrait;
-  }
+std::string ReadingComposer::compose(const ReadingMaterial& rm) const
+{
+  std::string result;
+  composeInto(rm, result);
+  return result;
+}
 
-  // 2. Name (priority: labeledByName > name > textIfceName)
-  std::string name;
-  if(!rm.labeledByName.empty())
-  {
-    name = rm.labeledByName;
-  }
-  else if(!rm.name.empty())
-  {
-    name = rm.name;
-  }
-  else if(!rm.textIfceName.empty())
-  {
-    name = rm.textIfceName;
-  }
+void ReadingComposer::composeInto(const ReadingMaterial& rm, std::string& out) const
+{
+  auto&                       impl = *mImpl;
+  std::lock_guard<std::mutex> lock(impl.mutex);
 
-  if(!name.empty())
+  impl.buildKey(rm);
+  auto hash = std::hash<std::string_view>{}(impl.keyBuffer);
+  for(auto& entry : impl.cache)
   {
-    if(!result.empty()) result += ", ";
-    result += name;
+    if(entry.valid && entry.hash == hash && entry.key == impl.keyBuffer)
+    {
+      ++impl.stats.hits;
+      out.assign(entry.text);
+      return;
+    }
   }
 
-  // 3. Role trait
-  auto roleTrait = composeRoleTrait(rm);
-  if(!roleTrait.empty())
-  {
-    if(!result.empty()) result += ", ";
-    result += roleTrait;
-  }
+  ++impl.stats.misses;
+  out.clear();
+  Run(impl.steps, rm, out);
 
-  // 4. Description trait
-  auto descTrait = composeDescriptionTrait(rm);
-  if(!descTrait.empty())
-  {
-    if(!result.empty()) result += ", ";
-    result += descTrait;
-  }
+  // Round-robin replacement; entries keep their capacity
+  auto& victim = impl.cache[impl.nextVictim];
+  impl.nextVictim = (impl.nextVictim + 1) % Impl::CACHE_SIZE;
+  victim.hash     = hash;
+  victim.key.assign(impl.keyBuffer);
+  victim.text.assign(out);
+  victim.valid = true;
+}
 
-  return result;
+ReadingComposerStats ReadingComposer::getStats() const
+{
+  std::lock_guard<std::mutex> lock(mImpl->mutex);
+  return mImpl->stats;
 }
 
 } // namespace Accessibility
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <accessibility/internal/service/screen-reader/reading-prefetcher.h>
+
+namespace Accessibility
+{
+uint64_t ReadingPrefetcher::beginFetch() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mEpoch;
+}
+
+void ReadingPrefetcher::store(uint64_t epoch, const Address& origin, bool forward, Prediction prediction)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  if(epoch != mEpoch)
+  {
+    return;
+  }
+
+  auto& slot      = entry(forward);
+  slot.valid      = true;
+  slot.origin     = origin;
+  slot.prediction = std::move(prediction);
+}
+
+bool ReadingPrefetcher::take(const Address& origin, bool forward, Prediction& prediction)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto& slot = entry(forward);
+  bool  hit  = slot.valid && slot.origin == origin;
+  if(hit)
+  {
+    prediction = std::move(slot.prediction);
+    ++mHits;
+  }
+  else
+  {
+    ++mMisses;
+  }
+
+  mForward  = {};
+  mBackward = {};
+  ++mEpoch;
+  return hit;
+}
+
+void ReadingPrefetcher::invalidate(const Address& address)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  for(auto* slot : {&mForward, &mBackward})
+  {
+    if(slot->valid && slot->prediction.address == address)
+    {
+      *slot = {};
+    }
+  }
+  ++mEpoch;
+}
+
+void ReadingPrefetcher::clear()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mForward  = {};
+  mBackward = {};
+  ++mEpoch;
+}
+
+Address ReadingPrefetcher::getPredictedAddress(bool forward) const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto& slot = entry(forward);
+  return slot.valid ? slot.prediction.address : Address{};
+}
+
+size_t ReadingPrefetcher::getHitCount() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mHits;
+}
+
+size_t ReadingPrefetcher::getMissCount() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mMisses;
+}
+
+} // namespace Accessibility
@@ -0,0 +1,124 @@
+#ifndef ACCESSIBILITY_INTERNAL_SERVICE_SCREEN_READER_READING_PREFETCHER_H
+#define ACCESSIBILITY_INTERNAL_SERVICE_SCREEN_READER_READING_PREFETCHER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/node-proxy.h>
+
+namespace Accessibility
+{
+/**
+ * @brief Cache of the predicted next/previous node and its composed text.
+ *
+ * Pure C++ logic, no platform dependency. While speech for the current
+ * node plays, the service resolves both neighbors of the current node and
+ * stores them here. A flick that starts from the same origin node can then
+ * speak the cached text without any IPC on the critical path.
+ *
+ * Entries are dropped when an event reports a change on the predicted
+ * node (invalidate) or around the origin (clear). Every drop bumps an
+ * epoch, so a fetch that was in flight during the change is not stored.
+ *
+ * Thread-safe: fetches run on the service executor while invalidation
+ * comes from the event dispatch thread.
+ */
+class ReadingPrefetcher
+{
+public:
+  struct Prediction
+  {
+    std::shared_ptr<NodeProxy> node;
+    Address                    address;
+    std::string                text;
+  };
+
+  /**
+   * @brief Starts a fetch, returning the epoch to pass to store().
+   */
+  uint64_t beginFetch() const;
+
+  /**
+   * @brief Stores a prediction for navigating from origin in the given direction.
+   *
+   * Ignored if the cache was invalidated or cleared since beginFetch().
+   *
+   * @param[in] epoch The value returned by beginFetch()
+   * @param[in] origin The address of the node navigation starts from
+   * @param[in] forward The navigation direction
+   * @param[in] prediction The predicted neighbor and its composed text
+   */
+  void store(uint64_t epoch, const Address& origin, bool forward, Prediction prediction);
+
+  /**
+   * @brief Takes the prediction for navigating from origin, if any.
+   *
+   * Counts a hit or miss. The whole cache is cleared either way, since
+   * navigation moves the origin.
+   *
+   * @return true and fills @p prediction on a hit
+   */
+  bool take(const Address& origin, bool forward, Prediction& prediction);
+
+  /**
+   * @brief Drops any prediction whose node has the given address.
+   */
+  void invalidate(const Address& address);
+
+  /**
+   * @brief Drops all predictions.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the address of the predicted node, or an empty Address.
+   */
+  Address getPredictedAddress(bool forward) const;
+
+  size_t getHitCount() const;
+  size_t getMissCount() const;
+
+private:
+  struct Entry
+  {
+    bool       valid{false};
+    Address    origin;
+    Prediction prediction;
+  };
+
+  Entry& entry(bool forward) { return forward ? mForward : mBackward; }
+  const Entry& entry(bool forward) const { return forward ? mForward : mBackward; }
+
+  mutable std::mutex mMutex;
+  Entry              mForward;
+  Entry              mBackward;
+  uint64_t           mEpoch{0};
+  size_t             mHits{0};
+  size_t             mMisses{0};
+};
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_INTERNAL_SERVICE_SCREEN_READER_READING_PREFETCHER_H
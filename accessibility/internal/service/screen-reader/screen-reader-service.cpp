@@ -18,16 +18,39 @@
 // CLASS HEADER
 #include <accessibility/api/screen-reader-service.h>
 
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <mutex>
+
 // INTERNAL INCLUDES
 #include <accessibility/api/accessibility.h>
 #include <accessibility/api/node-proxy.h>
 #include <accessibility/api/reading-composer.h>
+#include <accessibility/internal/service/inline-task-executor.h>
+#include <accessibility/internal/service/screen-reader/reading-prefetcher.h>
+#include <accessibility/internal/service/screen-reader/symbol-table.h>
+#include <accessibility/internal/service/screen-reader/text-mirror.h>
 #include <accessibility/internal/service/screen-reader/tts-command-queue.h>
 
 namespace Accessibility
 {
+namespace
+{
+// Events that can change which nodes are a node's neighbors
+constexpr EventTypeMask STRUCTURE_EVENTS = EventTypeBit(AccessibilityEvent::Type::CHILDREN_CHANGED) |
+                                           EventTypeBit(AccessibilityEvent::Type::SCROLL_STARTED) |
+                                           EventTypeBit(AccessibilityEvent::Type::SCROLL_FINISHED) |
+                                           EventTypeBit(AccessibilityEvent::Type::MOVED_OUT);
+} // namespace
+
 struct ScreenReaderService::Impl
 {
+  explicit Impl(ScreenReaderService& owner)
+  : self(owner)
+  {
+  }
+
+  ScreenReaderService&                  self;
   std::unique_ptr<TtsEngine>            ttsEngine;
   std::unique_ptr<FeedbackProvider>     feedbackProvider;
   std::unique_ptr<SettingsProvider>     settingsProvider;
@@ -35,7 +58,234 @@ struct ScreenReaderService::Impl
   std::unique_ptr<DirectReadingService> directReadingService;
   ReadingComposer                       composer;
   std::unique_ptr<TtsCommandQueue>      ttsQueue;
-  bool                                  running{false};
+  std::atomic<bool>                     running{false};
+
+  mutable std::mutex   settingsMutex;
+  ScreenReaderSettings settings; ///< Snapshot, refreshed by onSettingsChanged
+
+  CancellationSource        navigation;
+  CancellationSource        prefetching;
+  std::atomic<unsigned int> pendingNavigations{0};
+  ReadingPrefetcher         prefetcher;
+
+  TextMirror              textMirror;     ///< Text of the current node; only used on the executor
+  std::weak_ptr<NodeProxy> textNode;       ///< The current node textMirror was loaded for
+  int32_t                 typedCaret{-1}; ///< Caret offset expected after the last echoed edit
+
+  // Declared last so it is drained before the members its tasks use
+  std::unique_ptr<TaskExecutor> executor;
+
+  ScreenReaderSettings getSettings() const
+  {
+    std::lock_guard<std::mutex> lock(settingsMutex);
+    return settings;
+  }
+
+  void setSettings(const ScreenReaderSettings& newSettings)
+  {
+    std::lock_guard<std::mutex> lock(settingsMutex);
+    settings = newSettings;
+  }
+
+  void playSound(SoundType type)
+  {
+    if(getSettings().soundFeedback)
+    {
+      feedbackProvider->playSound(type);
+    }
+  }
+
+  void read(NodeProxy& node, const CancellationToken& token = {})
+  {
+    auto rm = node.getReadingMaterial();
+    if(token.isCancelled()) return;
+
+    auto text = composer.compose(rm);
+    if(!text.empty() && !token.isCancelled())
+    {
+      ttsQueue->enqueue(text, true, true);
+    }
+  }
+
+  /**
+   * @brief Speaks a text edit or caret move of the current node.
+   *
+   * The node's text is fetched once and then patched from the events, so
+   * echoing typed characters and reading the character at the caret need
+   * no IPC. A caret move caused by the echoed edit is not read again.
+   */
+  void onTextEvent(const AccessibilityEvent& event)
+  {
+    auto current = self.getCurrentNode();
+    if(!current || current->getAddress() != event.source) return;
+
+    // Edits made while the node was not current were never applied; this
+    // also catches moves made through navigateTo() or highlightNode()
+    if(textNode.lock() != current)
+    {
+      resetText();
+      textNode = current;
+    }
+
+    std::string changed;
+    if(!textMirror.applyEvent(event, &changed))
+    {
+      // The fetched text already includes this change
+      if(!textMirror.load(current)) return;
+      if(event.type == AccessibilityEvent::Type::TEXT_CHANGED)
+      {
+        changed = event.detail == EventDetail::TEXT_INSERT
+                    ? textMirror.getText(event.detail1, event.detail1 + event.detail2)
+                    : event.text;
+      }
+    }
+
+    std::string text;
+    if(event.type == AccessibilityEvent::Type::TEXT_CHANGED)
+    {
+      typedCaret = event.detail == EventDetail::TEXT_INSERT ? event.detail1 + event.detail2 : event.detail1;
+      if(getSettings().keyboardFeedback)
+      {
+        text = std::move(changed);
+      }
+    }
+    else if(event.detail1 == typedCaret)
+    {
+      typedCaret = -1;
+    }
+    else
+    {
+      typedCaret = -1;
+      text       = textMirror.getTextAtOffset(textMirror.getCaretOffset(), TextBoundary::CHARACTER).content;
+    }
+
+    // A single character is spoken by name ("space", "dot")
+    auto spoken = SymbolTable::lookup(text);
+    if(!spoken.empty())
+    {
+      text = spoken;
+    }
+    if(!text.empty())
+    {
+      ttsQueue->enqueue(text, true, true);
+    }
+  }
+
+  /**
+   * @brief Drops the current node's text; called whenever the current node changes.
+   */
+  void resetText()
+  {
+    textMirror.clear();
+    textNode.reset();
+    typedCaret = -1;
+  }
+
+  /**
+   * @brief Posts a navigation step that supersedes every older one.
+   *
+   * The step always runs, so the highlight still moves once per gesture,
+   * but a superseded step stops before reading or playing sounds.
+   */
+  void postNavigation(bool forward, bool withSounds)
+  {
+    auto token = navigation.next();
+    prefetching.cancel();
+    ++pendingNavigations;
+    executor->post([this, forward, withSounds, token]()
+    {
+      if(running)
+      {
+        navigate(forward, withSounds, token);
+      }
+      --pendingNavigations;
+    });
+  }
+
+  void navigate(bool forward, bool withSounds, const CancellationToken& token)
+  {
+    // On a predicted hit the highlight is the only IPC before speech; a
+    // predicted node that no longer takes it falls back to a regular step
+    auto                          origin = self.getCurrentNode();
+    ReadingPrefetcher::Prediction predicted;
+    std::shared_ptr<NodeProxy>    node;
+    if(origin && prefetcher.take(origin->getAddress(), forward, predicted))
+    {
+      node = self.navigateTo(std::move(predicted.node));
+      if(node && !predicted.text.empty() && !token.isCancelled())
+      {
+        ttsQueue->enqueue(predicted.text, true, true);
+      }
+    }
+    if(!node)
+    {
+      node = forward ? self.navigateNext() : self.navigatePrev();
+      if(node && !token.isCancelled())
+      {
+        read(*node, token);
+      }
+    }
+    resetText();
+    self.setEventTargetAddress(EventTarget::NEXT_NODE, Address{});
+    self.setEventTargetAddress(EventTarget::PREV_NODE, Address{});
+
+    if(token.isCancelled()) return;
+
+    if(withSounds)
+    {
+      playSound(node ? SoundType::HIGHLIGHT : SoundType::FOCUS_CHAIN_END);
+    }
+    if(node)
+    {
+      postPrefetch(std::move(node));
+    }
+  }
+
+  /**
+   * @brief Posts the prefetch for node as a task of its own.
+   *
+   * It runs after the navigation step that posted it, once that step has
+   * queued its speech, and is skipped if another navigation is already
+   * waiting.
+   */
+  void postPrefetch(std::shared_ptr<NodeProxy> node)
+  {
+    auto token = prefetching.next();
+    executor->post([this, node = std::move(node), token]()
+    {
+      if(running && pendingNavigations == 0 && !token.isCancelled())
+      {
+        prefetch(node, token);
+      }
+    });
+  }
+
+  /**
+   * @brief Resolves both neighbors of node and caches their composed text.
+   *
+   * Each neighbor's address is bound for event routing before its reading
+   * material is fetched, so a change racing the fetch discards the result.
+   */
+  void prefetch(const std::shared_ptr<NodeProxy>& node, const CancellationToken& token)
+  {
+    auto origin = node->getAddress();
+    for(bool forward : {true, false})
+    {
+      if(token.isCancelled()) return;
+
+      auto neighbor = self.findNeighbor(node, forward);
+      if(!neighbor) continue;
+
+      ReadingPrefetcher::Prediction prediction;
+      prediction.address = neighbor->getAddress();
+      self.setEventTargetAddress(forward ? EventTarget::NEXT_NODE : EventTarget::PREV_NODE, prediction.address);
+
+      auto epoch        = prefetcher.beginFetch();
+      prediction.text   = composer.compose(neighbor->getReadingMaterial());
+      prediction.node   = std::move(neighbor);
+      prefetcher.store(epoch, origin, forward, std::move(prediction));
+    }
+  }
 };
 
 ScreenReaderService::ScreenReaderService(
@@ -45,9 +295,10 @@ ScreenReaderService::ScreenReaderService(
   std::unique_ptr<FeedbackProvider>     feedbackProvider,
   std::unique_ptr<SettingsProvider>     settingsProvider,
   std::unique_ptr<ScreenReaderSwitch>   screenReaderSwitch,
-  std::unique_ptr<DirectReadingService> directReadingService)
+  std::unique_ptr<DirectReadingService> directReadingService,
+  std::unique_ptr<TaskExecutor>         executor)
 : AccessibilityService(std::move(registry), std::move(gestureProvider)),
-  mImpl(std::make_unique<Impl>())
+  mImpl(std::make_unique<Impl>(*this))
 {
   mImpl->ttsEngine            = std::move(ttsEngine);
   mImpl->feedbackProvider     = std::move(feedbackProvider);
@@ -55,6 +306,27 @@ ScreenReaderService::ScreenReaderService(
   mImpl->screenReaderSwitch   = std::move(screenReaderSwitch);
   mImpl->directReadingService = std::move(directReadingService);
   mImpl->ttsQueue             = std::make_unique<TtsCommandQueue>(*mImpl->ttsEngine);
+  mImpl->executor             = executor ? std::move(executor) : std::make_unique<InlineTaskExecutor>();
+
+  mImpl->settings = mImpl->settingsProvider->getSettings();
+  Impl* impl      = mImpl.get();
+  mImpl->settingsProvider->onSettingsChanged([impl](const ScreenReaderSettings& settings)
+  {
+    impl->setSettings(settings);
+  });
+
+  // Only the highlighted node's own state/property changes affect what is read;
+  // changes on the prefetched neighbors invalidate their cached reading.
+  // Structural changes anywhere (reparenting included, which toolkits report
+  // as children changes) can move the neighbors, so they drop the predictions.
+  constexpr auto CHANGE_EVENTS = EventTypeBit(AccessibilityEvent::Type::STATE_CHANGED) |
+                                 EventTypeBit(AccessibilityEvent::Type::PROPERTY_CHANGED);
+  subscribeEvents(EventTarget::ANY_SOURCE, STRUCTURE_EVENTS);
+  constexpr auto TEXT_EVENTS = EventTypeBit(AccessibilityEvent::Type::TEXT_CHANGED) |
+                               EventTypeBit(AccessibilityEvent::Type::TEXT_CARET_MOVED);
+  subscribeEvents(EventTarget::CURRENT_NODE, CHANGE_EVENTS | TEXT_EVENTS);
+  subscribeEvents(EventTarget::NEXT_NODE, CHANGE_EVENTS | EventTypeBit(AccessibilityEvent::Type::TEXT_CHANGED));
+  subscribeEvents(EventTarget::PREV_NODE, CHANGE_EVENTS | EventTypeBit(AccessibilityEvent::Type::TEXT_CHANGED));
 }
 
 ScreenReaderService::~ScreenReaderService()
@@ -71,6 +343,8 @@ void ScreenReaderService::startScreenReader()
 
   start();
 
+  mImpl->setSettings(mImpl->settingsProvider->getSettings());
+
   if(mImpl->screenReaderSwitch)
   {
     mImpl->screenReaderSwitch->setScreenReaderEnabled(true);
@@ -89,6 +363,13 @@ void ScreenReaderService::stopScreenReader()
 {
   if(!mImpl->running) return;
 
+  mImpl->running = false;
+  mImpl->navigation.cancel();
+  mImpl->prefetching.cancel();
+  mImpl->executor->waitIdle();
+  mImpl->prefetcher.clear();
+  mImpl->resetText();
+
   mImpl->ttsQueue->purgeAll();
 
   if(mImpl->directReadingService)
@@ -102,7 +383,6 @@ void ScreenReaderService::stopScreenReader()
     mImpl->screenReaderSwitch->setScreenReaderEnabled(false);
   }
 
-  mImpl->running = false;
   stop();
 }
 
@@ -110,12 +390,13 @@ void ScreenReaderService::readNode(std::shared_ptr<NodeProxy> node)
 {
   if(!node || !mImpl->running) return;
 
-  auto rm = node->getReadingMaterial();
-  auto text = mImpl->composer.compose(rm);
-  if(!text.empty())
+  mImpl->executor->post([this, node]()
   {
-    mImpl->ttsQueue->enqueue(text, true, true);
-  }
+    if(mImpl->running)
+    {
+      mImpl->read(*node);
+    }
+  });
 }
 
 TtsEngine& ScreenReaderService::getTtsEngine()
@@ -142,18 +423,36 @@ void ScreenReaderService::onAccessibilityEvent(const AccessibilityEvent& event)
 {
   if(!mImpl->running) return;
 
+  // Highlight moves do not change what is read. Otherwise, non-structural
+  // events from a prefetched neighbor only invalidate its cached reading,
+  // and anything else may change what the neighbors are.
+  if(event.detail != EventDetail::HIGHLIGHTED)
+  {
+    bool structural = (EventTypeBit(event.type) & STRUCTURE_EVENTS) != 0;
+    if(!structural && event.source && (event.source == mImpl->prefetcher.getPredictedAddress(true) ||
+                                       event.source == mImpl->prefetcher.getPredictedAddress(false)))
+    {
+      mImpl->prefetcher.invalidate(event.source);
+      return;
+    }
+    mImpl->prefetcher.clear();
+  }
+
   switch(event.type)
   {
     case AccessibilityEvent::Type::STATE_CHANGED:
     {
-      if(event.detail == "highlighted" && event.detail1 == 1)
+      if(event.detail == EventDetail::HIGHLIGHTED && event.detail1 == 1)
       {
-        auto current = getCurrentNode();
-        if(current)
+        mImpl->executor->post([this]()
         {
-          readNode(current);
-          auto settings = mImpl->settingsProvider->getSettings();
-          if(settings.soundFeedback)
+          // A pending navigation will read its own target; this highlight is stale
+          auto current = getCurrentNode();
+          if(!mImpl->running || !current || mImpl->pendingNavigations != 0) return;
+
+          mImpl->resetText();
+          mImpl->read(*current);
+          if(mImpl->getSettings().soundFeedback)
           {
             auto states = current->getStates();
             if(states[State::FOCUSABLE])
@@ -165,26 +464,33 @@ void ScreenReaderService::onAccessibilityEvent(const AccessibilityEvent& event)
               mImpl->feedbackProvider->playSound(SoundType::HIGHLIGHT);
             }
           }
-        }
+        });
       }
       break;
     }
     case AccessibilityEvent::Type::PROPERTY_CHANGED:
     {
-      auto current = getCurrentNode();
-      if(current)
+      readNode(getCurrentNode());
+      break;
+    }
+    case AccessibilityEvent::Type::TEXT_CHANGED:
+    case AccessibilityEvent::Type::TEXT_CARET_MOVED:
+    {
+      mImpl->executor->post([this, event]()
       {
-        readNode(current);
-      }
+        if(mImpl->running)
+        {
+          mImpl->onTextEvent(event);
+        }
+      });
       break;
     }
     case AccessibilityEvent::Type::WINDOW_CHANGED:
     {
-      auto settings = mImpl->settingsProvider->getSettings();
-      if(settings.soundFeedback)
+      mImpl->executor->post([this]()
       {
-        mImpl->feedbackProvider->playSound(SoundType::WINDOW_STATE_CHANGE);
-      }
+        mImpl->playSound(SoundType::WINDOW_STATE_CHANGE);
+      });
       break;
     }
     default:
@@ -205,87 +511,46 @@ void ScreenReaderService::onGesture(const GestureInfo& gesture)
   {
     case Gesture::ONE_FINGER_FLICK_RIGHT:
     {
-      auto node = navigateNext();
-      if(node)
-      {
-        readNode(node);
-        auto settings = mImpl->settingsProvider->getSettings();
-        if(settings.soundFeedback)
-        {
-          mImpl->feedbackProvider->playSound(SoundType::HIGHLIGHT);
-        }
-      }
-      else
-      {
-        auto settings = mImpl->settingsProvider->getSettings();
-        if(settings.soundFeedback)
-        {
-          mImpl->feedbackProvider->playSound(SoundType::FOCUS_CHAIN_END);
-        }
-      }
+      mImpl->postNavigation(true, true);
       break;
     }
     case Gesture::ONE_FINGER_FLICK_LEFT:
     {
-      auto node = navigatePrev();
-      if(node)
-      {
-        readNode(node);
-        auto settings = mImpl->settingsProvider->getSettings();
-        if(settings.soundFeedback)
-        {
-          mImpl->feedbackProvider->playSound(SoundType::HIGHLIGHT);
-        }
-      }
-      else
-      {
-        auto settings = mImpl->settingsProvider->getSettings();
-        if(settings.soundFeedback)
-        {
-          mImpl->feedbackProvider->playSound(SoundType::FOCUS_CHAIN_END);
-        }
-      }
+      mImpl->postNavigation(false, true);
       break;
     }
     case Gesture::ONE_FINGER_DOUBLE_TAP:
     {
-      auto current = getCurrentNode();
-      if(current)
+      mImpl->executor->post([this]()
       {
-        bool activated = current->doActionByName("activate");
-        auto settings = mImpl->settingsProvider->getSettings();
-        if(settings.soundFeedback)
+        auto current = getCurrentNode();
+        if(mImpl->running && current)
         {
-          mImpl->feedbackProvider->playSound(SoundType::ACTION);
+          current->doActionByName("activate");
+          mImpl->playSound(SoundType::ACTION);
         }
-        (void)activated;
-      }
+      });
       break;
     }
     case Gesture::TWO_FINGERS_SINGLE_TAP:
     {
-      if(mImpl->ttsQueue->isPaused())
+      mImpl->executor->post([this]()
       {
-        mImpl->ttsQueue->resume();
-      }
-      else
-      {
-        mImpl->ttsQueue->pause();
-      }
+        if(mImpl->ttsQueue->isPaused())
+        {
+          mImpl->ttsQueue->resume();
+        }
+        else
+        {
+          mImpl->ttsQueue->pause();
+        }
+      });
       break;
     }
     case Gesture::THREE_FINGERS_SINGLE_TAP:
     {
       // Review from top: navigate to first element and read
-      auto window = getActiveWindow();
-      if(window)
-      {
-        auto first = navigateNext();
-        if(first)
-        {
-          readNode(first);
-        }
-      }
+      mImpl->postNavigation(true, false);
       break;
     }
     case Gesture::ONE_FINGER_SINGLE_TAP:
@@ -306,16 +571,15 @@ bool ScreenReaderService::onKeyEvent(const KeyEvent& key)
   {
     if(key.keyName == "Back")
     {
-      auto prev = navigatePrev();
-      if(prev)
-      {
-        readNode(prev);
-      }
+      mImpl->postNavigation(false, false);
       return true;
     }
     else if(key.keyName == "Power")
     {
-      mImpl->ttsQueue->purgeAll();
+      // Silence in-flight reads as well as queued speech
+      mImpl->navigation.cancel();
+      mImpl->prefetching.cancel();
+      mImpl->executor->post([this]() { mImpl->ttsQueue->purgeAll(); });
       return true;
     }
   }
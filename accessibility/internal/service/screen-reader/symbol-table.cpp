@@ -19,80 +19,468 @@
 #include <accessibility/internal/service/screen-reader/symbol-table.h>
 
 // EXTERNAL INCLUDES
-#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <map>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/log.h>
 
 namespace Accessibility
 {
-const std::string& SymbolTable::lookup(const std::string& symbol)
-{
-  static const std::unordered_map<std::string, std::string> table = {
-    {".", "dot"},
-    {",", "comma"},
-    {"!", "exclamation mark"},
-    {"?", "question mark"},
-    {"@", "at sign"},
-    {"#", "hash"},
-    {"$", "dollar sign"},
-    {"%", "percent"},
-    {"^", "caret"},
-    {"&", "ampersand"},
-    {"*", "asterisk"},
-    {"(", "left parenthesis"},
-    {")", "right parenthesis"},
-    {"-", "hyphen"},
-    {"_", "underscore"},
-    {"+", "plus"},
-    {"=", "equals"},
-    {"{", "left brace"},
-    {"}", "right brace"},
-    {"[", "left bracket"},
-    {"]", "right bracket"},
-    {"|", "vertical bar"},
-    {"\\", "backslash"},
-    {"/", "slash"},
-    {":", "colon"},
-    {";", "semicolon"},
-    {"\"", "quotation mark"},
-    {"'", "apostrophe"},
-    {"<", "less than"},
-    {">", "greater than"},
-    {"~", "tilde"},
-    {"`", "grave accent"},
-    {"\n", "new line"},
-    {"\t", "tab"},
-    {" ", "space"},
-    {"\xC2\xA9", "copyright"},
-    {"\xC2\xAE", "registered"},
-    {"\xE2\x84\xA2", "trademark"},
-    {"\xC2\xB0", "degree"},
-    {"\xC2\xA3", "pound sign"},
-    {"\xC2\xA5", "yen sign"},
-    {"\xE2\x82\xAC", "euro sign"},
-    {"\xC2\xA2", "cent sign"},
-    {"\xC2\xB1", "plus minus"},
-    {"\xC3\x97", "multiplication sign"},
-    {"\xC3\xB7", "division sign"},
-    {"\xE2\x88\x9E", "infinity"},
-    {"\xE2\x89\xA0", "not equal"},
-    {"\xE2\x89\xA4", "less than or equal"},
-    {"\xE2\x89\xA5", "greater than or equal"},
-    {"\xE2\x80\xA6", "ellipsis"},
-    {"\xE2\x80\x93", "en dash"},
-    {"\xE2\x80\x94", "em dash"},
-    {"\xE2\x80\x98", "left single quotation mark"},
-    {"\xE2\x80\x99", "right single quotation mark"},
-    {"\xE2\x80\x9C", "left double quotation mark"},
-    {"\xE2\x80\x9D", "right double quotation mark"},
+namespace
+{
+const std::pair<const char*, const char*> BUILT_IN_SYMBOLS[] = {
+  {".", "dot"},
+  {",", "comma"},
+  {"!", "exclamation mark"},
+  {"?", "question mark"},
+  {"@", "at sign"},
+  {"#", "hash"},
+  {"$", "dollar sign"},
+  {"%", "percent"},
+  {"^", "caret"},
+  {"&", "ampersand"},
+  {"*", "asterisk"},
+  {"(", "left parenthesis"},
+  {")", "right parenthesis"},
+  {"-", "hyphen"},
+  {"_", "underscore"},
+  {"+", "plus"},
+  {"=", "equals"},
+  {"{", "left brace"},
+  {"}", "right brace"},
+  {"[", "left bracket"},
+  {"]", "right bracket"},
+  {"|", "vertical bar"},
+  {"\\", "backslash"},
+  {"/", "slash"},
+  {":", "colon"},
+  {";", "semicolon"},
+  {"\"", "quotation mark"},
+  {"'", "apostrophe"},
+  {"<", "less than"},
+  {">", "greater than"},
+  {"~", "tilde"},
+  {"`", "grave accent"},
+  {"\n", "new line"},
+  {"\t", "tab"},
+  {" ", "space"},
+  {"\xC2\xA9", "copyright"},
+  {"\xC2\xAE", "registered"},
+  {"\xE2\x84\xA2", "trademark"},
+  {"\xC2\xB0", "degree"},
+  {"\xC2\xA3", "pound sign"},
+  {"\xC2\xA5", "yen sign"},
+  {"\xE2\x82\xAC", "euro sign"},
+  {"\xC2\xA2", "cent sign"},
+  {"\xC2\xB1", "plus minus"},
+  {"\xC3\x97", "multiplication sign"},
+  {"\xC3\xB7", "division sign"},
+  {"\xE2\x88\x9E", "infinity"},
+  {"\xE2\x89\xA0", "not equal"},
+  {"\xE2\x89\xA4", "less than or equal"},
+  {"\xE2\x89\xA5", "greater than or equal"},
+  {"\xE2\x80\xA6", "ellipsis"},
+  {"\xE2\x80\x93", "en dash"},
+  {"\xE2\x80\x94", "em dash"},
+  {"\xE2\x80\x98", "left single quotation mark"},
+  {"\xE2\x80\x99", "right single quotation mark"},
+  {"\xE2\x80\x9C", "left double quotation mark"},
+  {"\xE2\x80\x9D", "right double quotation mark"},
+};
+
+constexpr char     FILE_MAGIC[4]   = {'A', 'S', 'Y', 'M'};
+constexpr uint16_t FILE_VERSION    = 1;
+constexpr uint16_t FILE_BYTE_ORDER = 0x0102;
+constexpr uint32_t NO_NODE         = 0; ///< The root is never a child, so 0 marks "no edge"
+
+struct FileHeader
+{
+  char     magic[4];
+  uint16_t version;
+  uint16_t byteOrder;
+  uint32_t nodeCount;
+  uint32_t edgeCount;
+  uint32_t stringBytes;
+  uint32_t symbolCount;
+};
+
+struct FileNode
+{
+  uint32_t firstEdge;
+  uint32_t edgeCount;
+  uint32_t valueOffset;
+  uint32_t valueLength; ///< 0 if no symbol ends at this node
+};
+
+static_assert(sizeof(FileHeader) == 24 && sizeof(FileNode) == 16, "Data file layout must not depend on padding");
+
+constexpr std::size_t ROOT_TABLE_SIZE = 256;
+
+std::size_t GetFileSize(const FileHeader& header)
+{
+  return sizeof(FileHeader) + ROOT_TABLE_SIZE * sizeof(uint32_t) + std::size_t{header.nodeCount} * sizeof(FileNode) +
+         std::size_t{header.edgeCount} * (sizeof(uint32_t) + 1) + header.stringBytes;
+}
+
+bool IsWhitespace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+} // namespace
+
+struct SymbolTable::Impl
+{
+  ~Impl()
+  {
+    if(mapped)
+    {
+      munmap(mapped, mappedSize);
+    }
+  }
+
+  /**
+   * @brief Points the views into data, checking every offset against its size.
+   */
+  bool attach(const char* data, std::size_t size)
+  {
+    if(size < sizeof(FileHeader))
+    {
+      return false;
+    }
+    std::memcpy(&header, data, sizeof(FileHeader));
+    if(std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 || header.version != FILE_VERSION ||
+       header.byteOrder != FILE_BYTE_ORDER || header.nodeCount == 0 || GetFileSize(header) != size)
+    {
+      return false;
+    }
+
+    auto cursor  = data + sizeof(FileHeader);
+    rootTable    = reinterpret_cast<const uint32_t*>(cursor);
+    cursor      += ROOT_TABLE_SIZE * sizeof(uint32_t);
+    nodes        = reinterpret_cast<const FileNode*>(cursor);
+    cursor      += std::size_t{header.nodeCount} * sizeof(FileNode);
+    edgeChildren = reinterpret_cast<const uint32_t*>(cursor);
+    cursor      += std::size_t{header.edgeCount} * sizeof(uint32_t);
+    edgeBytes    = reinterpret_cast<const uint8_t*>(cursor);
+    cursor      += header.edgeCount;
+    strings      = cursor;
+
+    for(std::size_t i = 0; i < ROOT_TABLE_SIZE; ++i)
+    {
+      if(rootTable[i] >= header.nodeCount)
+      {
+        return false;
+      }
+    }
+    for(uint32_t i = 0; i < header.nodeCount; ++i)
+    {
+      auto& node = nodes[i];
+      if(node.firstEdge > header.edgeCount || node.edgeCount > header.edgeCount - node.firstEdge ||
+         node.valueOffset > header.stringBytes || node.valueLength > header.stringBytes - node.valueOffset)
+      {
+        return false;
+      }
+    }
+    for(uint32_t i = 0; i < header.edgeCount; ++i)
+    {
+      if(edgeChildren[i] == NO_NODE || edgeChildren[i] >= header.nodeCount)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  uint32_t child(uint32_t node, uint8_t byte) const
+  {
+    auto& n     = nodes[node];
+    auto  begin = edgeBytes + n.firstEdge;
+    auto  end   = begin + n.edgeCount;
+    auto  it    = std::lower_bound(begin, end, byte);
+    return (it != end && *it == byte) ? edgeChildren[it - edgeBytes] : NO_NODE;
+  }
+
+  std::string_view value(uint32_t node) const
+  {
+    return {strings + nodes[node].valueOffset, nodes[node].valueLength};
+  }
+
+  std::string      owned;           ///< Backing storage for tables built in memory
+  void*            mapped{nullptr}; ///< Backing storage for tables mapped from a file
+  std::size_t      mappedSize{0};
+  FileHeader       header{};
+  const uint32_t*  rootTable{nullptr};
+  const FileNode*  nodes{nullptr};
+  const uint32_t*  edgeChildren{nullptr};
+  const uint8_t*   edgeBytes{nullptr};
+  const char*      strings{nullptr};
+};
+
+SymbolTable::SymbolTable(std::unique_ptr<Impl> impl)
+: mImpl(std::move(impl))
+{
+}
+
+SymbolTable::~SymbolTable() = default;
+
+std::shared_ptr<const SymbolTable> SymbolTable::getDefault()
+{
+  static const auto table = []() {
+    std::vector<Entry> entries;
+    for(auto& [symbol, spoken] : BUILT_IN_SYMBOLS)
+    {
+      entries.emplace_back(symbol, spoken);
+    }
+    return create(entries);
+  }();
+  return table;
+}
+
+std::string SymbolTable::serialize(const std::vector<Entry>& entries)
+{
+  struct BuildNode
+  {
+    std::map<uint8_t, uint32_t> children;
+    std::string                 value;
   };
 
-  static const std::string empty;
+  std::vector<BuildNode> trie(1);
+  for(auto& [symbol, spoken] : entries)
+  {
+    if(symbol.empty() || spoken.empty())
+    {
+      continue;
+    }
+    uint32_t node = 0;
+    for(auto c : symbol)
+    {
+      auto byte = static_cast<uint8_t>(c);
+      auto it   = trie[node].children.find(byte);
+      if(it == trie[node].children.end())
+      {
+        it = trie[node].children.emplace(byte, static_cast<uint32_t>(trie.size())).first;
+        trie.emplace_back();
+      }
+      node = it->second;
+    }
+    trie[node].value = spoken;
+  }
+
+  FileHeader header{};
+  std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+  header.version   = FILE_VERSION;
+  header.byteOrder = FILE_BYTE_ORDER;
+  header.nodeCount = static_cast<uint32_t>(trie.size());
+
+  std::vector<uint32_t> rootTable(ROOT_TABLE_SIZE, NO_NODE);
+  std::vector<FileNode> nodes;
+  std::vector<uint32_t> edgeChildren;
+  std::vector<uint8_t>  edgeBytes;
+  std::string           strings;
+  for(auto& node : trie)
+  {
+    FileNode fileNode{};
+    fileNode.firstEdge = static_cast<uint32_t>(edgeChildren.size());
+    fileNode.edgeCount = static_cast<uint32_t>(node.children.size());
+    for(auto& [byte, child] : node.children)
+    {
+      edgeBytes.push_back(byte);
+      edgeChildren.push_back(child);
+    }
+    if(!node.value.empty())
+    {
+      fileNode.valueOffset = static_cast<uint32_t>(strings.size());
+      fileNode.valueLength = static_cast<uint32_t>(node.value.size());
+      strings += node.value;
+      ++header.symbolCount;
+    }
+    nodes.push_back(fileNode);
+  }
+  for(auto& [byte, child] : trie[0].children)
+  {
+    rootTable[byte] = child;
+  }
+  header.edgeCount   = static_cast<uint32_t>(edgeChildren.size());
+  header.stringBytes = static_cast<uint32_t>(strings.size());
+
+  std::string data;
+  data.reserve(GetFileSize(header));
+  data.append(reinterpret_cast<const char*>(&header), sizeof(header));
+  data.append(reinterpret_cast<const char*>(rootTable.data()), rootTable.size() * sizeof(uint32_t));
+  data.append(reinterpret_cast<const char*>(nodes.data()), nodes.size() * sizeof(FileNode));
+  data.append(reinterpret_cast<const char*>(edgeChildren.data()), edgeChildren.size() * sizeof(uint32_t));
+  data.append(reinterpret_cast<const char*>(edgeBytes.data()), edgeBytes.size());
+  data += strings;
+  return data;
+}
+
+std::shared_ptr<const SymbolTable> SymbolTable::create(const std::vector<Entry>& entries)
+{
+  auto impl   = std::make_unique<Impl>();
+  impl->owned = serialize(entries);
+  if(!impl->attach(impl->owned.data(), impl->owned.size()))
+  {
+    return nullptr;
+  }
+  return std::shared_ptr<const SymbolTable>(new SymbolTable(std::move(impl)));
+}
+
+std::shared_ptr<const SymbolTable> SymbolTable::load(const std::string& path)
+{
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if(fd < 0)
+  {
+    return nullptr;
+  }
+
+  struct stat info;
+  if(fstat(fd, &info) != 0 || info.st_size <= 0)
+  {
+    close(fd);
+    ACCESSIBILITY_LOG_ERROR("Cannot map symbol table %s\n", path.c_str());
+    return nullptr;
+  }
 
-  auto it = table.find(symbol);
-  if(it != table.end())
+  auto size   = static_cast<std::size_t>(info.st_size);
+  auto mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(mapped == MAP_FAILED)
   {
-    return it->second;
+    ACCESSIBILITY_LOG_ERROR("Cannot map symbol table %s\n", path.c_str());
+    return nullptr;
   }
-  return empty;
+
+  auto impl        = std::make_unique<Impl>();
+  impl->mapped     = mapped;
+  impl->mappedSize = size;
+  if(!impl->attach(static_cast<const char*>(mapped), size))
+  {
+    ACCESSIBILITY_LOG_ERROR("Malformed symbol table %s\n", path.c_str());
+    return nullptr;
+  }
+  return std::shared_ptr<const SymbolTable>(new SymbolTable(std::move(impl)));
+}
+
+std::shared_ptr<const SymbolTable> SymbolTable::loadForLanguage(const std::string& directory, const std::string& language)
+{
+  if(language.empty())
+  {
+    return nullptr;
+  }
+  if(auto table = load(directory + "/" + language + ".symbols"))
+  {
+    return table;
+  }
+  auto separator = language.find_first_of("_-.@");
+  if(separator != std::string::npos && separator > 0)
+  {
+    return load(directory + "/" + language.substr(0, separator) + ".symbols");
+  }
+  return nullptr;
+}
+
+std::string_view SymbolTable::lookup(std::string_view symbol)
+{
+  return getDefault()->find(symbol);
+}
+
+std::string_view SymbolTable::find(std::string_view symbol) const
+{
+  std::string_view spoken;
+  return (!symbol.empty() && match(symbol, 0, spoken) == symbol.size()) ? spoken : std::string_view{};
+}
+
+std::size_t SymbolTable::match(std::string_view text, std::size_t offset, std::string_view& spoken) const
+{
+  auto& impl = *mImpl;
+  if(offset >= text.size())
+  {
+    return 0;
+  }
+
+  uint32_t    node   = impl.rootTable[static_cast<uint8_t>(text[offset])];
+  std::size_t length = 0;
+  for(std::size_t i = offset + 1; node != NO_NODE; ++i)
+  {
+    if(impl.nodes[node].valueLength > 0)
+    {
+      spoken = impl.value(node);
+      length = i - offset;
+    }
+    if(i == text.size())
+    {
+      break;
+    }
+    node = impl.child(node, static_cast<uint8_t>(text[i]));
+  }
+  return length;
+}
+
+void SymbolTable::expand(std::string_view text, std::string& out, bool expandWhitespace) const
+{
+  auto& impl = *mImpl;
+  out.reserve(out.size() + text.size() + text.size() / 2);
+
+  // Set after a spoken text, so the next literal character is separated from it
+  bool        pendingSpace = false;
+  std::size_t i            = 0;
+  while(i < text.size())
+  {
+    // Copy the run of bytes that cannot start a symbol in one go
+    auto runEnd = i;
+    while(runEnd < text.size() && impl.rootTable[static_cast<uint8_t>(text[runEnd])] == NO_NODE)
+    {
+      ++runEnd;
+    }
+
+    std::size_t      length = 0;
+    std::string_view spoken;
+    if(runEnd == i)
+    {
+      length = match(text, i, spoken);
+      if(length > 0 && !expandWhitespace && IsWhitespace(text[i]))
+      {
+        length = 0;
+      }
+      if(length == 0)
+      {
+        runEnd = i + 1;
+      }
+    }
+
+    if(length > 0)
+    {
+      if(!out.empty() && !IsWhitespace(out.back()))
+      {
+        out += ' ';
+      }
+      out += spoken;
+      pendingSpace = true;
+      i += length;
+      continue;
+    }
+
+    if(pendingSpace && !IsWhitespace(text[i]))
+    {
+      out += ' ';
+    }
+    pendingSpace = false;
+    out.append(text.data() + i, runEnd - i);
+    i = runEnd;
+  }
+}
+
+std::size_t SymbolTable::getSymbolCount() const
+{
+  return mImpl->header.symbolCount;
 }
 
 } // namespace Accessibility
@@ -19,7 +19,12 @@
  */
 
 // EXTERNAL INCLUDES
+#include <cstddef>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace Accessibility
 {
@@ -28,17 +33,117 @@ namespace Accessibility
  *
  * Maps punctuation and special characters to their spoken equivalents
  * (e.g., "." → "dot", "@" → "at sign"). Pure logic, no platform dependency.
+ *
+ * Symbols are stored as a byte trie flattened into one contiguous block,
+ * with a direct table for the first byte. The block has the same layout in
+ * memory and on disk, so per-language tables are mapped from their data
+ * file instead of parsed; see serialize() for the format.
+ *
+ * Immutable once created; safe to share between threads.
  */
 class SymbolTable
 {
 public:
   /**
-   * @brief Looks up the spoken form of a symbol.
+   * @brief A symbol (UTF-8) and its spoken text.
+   */
+  using Entry = std::pair<std::string, std::string>;
+
+  ~SymbolTable();
+
+  SymbolTable(const SymbolTable&)            = delete;
+  SymbolTable& operator=(const SymbolTable&) = delete;
+
+  /**
+   * @brief Gets the built-in (English) table.
+   */
+  static std::shared_ptr<const SymbolTable> getDefault();
+
+  /**
+   * @brief Builds a table from entries.
+   *
+   * Entries with an empty symbol or spoken text are ignored; for duplicate
+   * symbols the last entry wins.
+   */
+  static std::shared_ptr<const SymbolTable> create(const std::vector<Entry>& entries);
+
+  /**
+   * @brief Maps a data file written from serialize().
+   *
+   * @param[in] path The file to map
+   * @return The table, or nullptr if the file is missing or malformed
+   */
+  static std::shared_ptr<const SymbolTable> load(const std::string& path);
+
+  /**
+   * @brief Loads the table for a language from "<directory>/<language>.symbols".
+   *
+   * A regional tag such as "en_US" or "en-GB" falls back to the file of its
+   * base language ("en.symbols").
+   *
+   * @return The table, or nullptr if no file matches
+   */
+  static std::shared_ptr<const SymbolTable> loadForLanguage(const std::string& directory, const std::string& language);
+
+  /**
+   * @brief Encodes entries in the data file format.
+   *
+   * The format is a header, a 256-entry first-byte table, the trie nodes,
+   * the edges (children, then bytes, sorted per node) and the spoken texts,
+   * in host byte order.
+   */
+  static std::string serialize(const std::vector<Entry>& entries);
+
+  /**
+   * @brief Looks up the spoken form of a symbol in the built-in table.
    *
    * @param[in] symbol The symbol character(s) to look up
-   * @return The spoken text, or empty string if not found
+   * @return The spoken text, or empty if not found
+   */
+  static std::string_view lookup(std::string_view symbol);
+
+  /**
+   * @brief Looks up the spoken form of a symbol.
+   *
+   * @return The spoken text, or empty if symbol is not in the table
+   */
+  std::string_view find(std::string_view symbol) const;
+
+  /**
+   * @brief Finds the longest symbol starting at offset.
+   *
+   * @param[in] text The text to scan
+   * @param[in] offset The byte offset to match at
+   * @param[out] spoken The spoken text of the match
+   * @return The byte length of the match, 0 if no symbol starts at offset
+   */
+  std::size_t match(std::string_view text, std::size_t offset, std::string_view& spoken) const;
+
+  /**
+   * @brief Appends text to out with every symbol replaced by its spoken text.
+   *
+   * Scans text once, matching the longest symbol at each position. Spoken
+   * texts are separated from their neighbours by single spaces. Whitespace
+   * symbols (space, tab, new line) are kept as they are unless
+   * expandWhitespace is set, as when reading character by character.
+   *
+   * @param[in] text The UTF-8 text to expand
+   * @param[in,out] out The buffer to append to
+   * @param[in] expandWhitespace true to speak whitespace symbols as well
    */
-  static const std::string& lookup(const std::string& symbol);
+  void expand(std::string_view text, std::string& out, bool expandWhitespace = false) const;
+
+  /**
+   * @brief Gets the number of symbols in the table.
+   */
+  std::size_t getSymbolCount() const;
+
+private:
+  struct Impl;
+
+  explicit SymbolTable(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> mImpl;
 };
 
 } // namespace Accessibility
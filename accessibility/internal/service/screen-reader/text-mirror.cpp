@@ -0,0 +1,497 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <accessibility/internal/service/screen-reader/text-mirror.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+namespace Accessibility
+{
+namespace
+{
+constexpr char32_t REPLACEMENT_CHARACTER = 0xFFFD;
+constexpr char32_t ZERO_WIDTH_JOINER     = 0x200D;
+
+std::u32string DecodeUtf8(const std::string& text)
+{
+  std::u32string result;
+  result.reserve(text.size());
+  for(std::size_t i = 0; i < text.size();)
+  {
+    auto     lead = static_cast<unsigned char>(text[i]);
+    int      length;
+    char32_t c;
+    if(lead < 0x80)
+    {
+      length = 1;
+      c      = lead;
+    }
+    else if((lead & 0xE0) == 0xC0)
+    {
+      length = 2;
+      c      = lead & 0x1F;
+    }
+    else if((lead & 0xF0) == 0xE0)
+    {
+      length = 3;
+      c      = lead & 0x0F;
+    }
+    else if((lead & 0xF8) == 0xF0)
+    {
+      length = 4;
+      c      = lead & 0x07;
+    }
+    else
+    {
+      result += REPLACEMENT_CHARACTER;
+      ++i;
+      continue;
+    }
+
+    if(i + length > text.size())
+    {
+      result += REPLACEMENT_CHARACTER;
+      break;
+    }
+    bool valid = true;
+    for(int k = 1; k < length; ++k)
+    {
+      auto next = static_cast<unsigned char>(text[i + k]);
+      valid     = valid && (next & 0xC0) == 0x80;
+      c         = (c << 6) | (next & 0x3F);
+    }
+    result += valid ? c : REPLACEMENT_CHARACTER;
+    i += valid ? length : 1;
+  }
+  return result;
+}
+
+void AppendUtf8(std::string& out, char32_t c)
+{
+  if(c < 0x80)
+  {
+    out += static_cast<char>(c);
+  }
+  else if(c < 0x800)
+  {
+    out += static_cast<char>(0xC0 | (c >> 6));
+    out += static_cast<char>(0x80 | (c & 0x3F));
+  }
+  else if(c < 0x10000)
+  {
+    out += static_cast<char>(0xE0 | (c >> 12));
+    out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (c & 0x3F));
+  }
+  else
+  {
+    out += static_cast<char>(0xF0 | (c >> 18));
+    out += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+    out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (c & 0x3F));
+  }
+}
+
+std::string EncodeUtf8(const std::u32string& text, std::size_t start, std::size_t end)
+{
+  std::string result;
+  result.reserve(end - start);
+  for(auto i = start; i < end; ++i)
+  {
+    AppendUtf8(result, text[i]);
+  }
+  return result;
+}
+
+/**
+ * @brief Checks for code points that attach to the preceding character.
+ */
+bool IsExtend(char32_t c)
+{
+  return (c >= 0x0300 && c <= 0x036F) ||   // Combining diacritical marks
+         (c >= 0x1AB0 && c <= 0x1AFF) ||   // ... extended
+         (c >= 0x1DC0 && c <= 0x1DFF) ||   // ... supplement
+         (c >= 0x20D0 && c <= 0x20FF) ||   // ... for symbols
+         (c >= 0xFE20 && c <= 0xFE2F) ||   // Combining half marks
+         (c >= 0xFE00 && c <= 0xFE0F) ||   // Variation selectors
+         (c >= 0x1F3FB && c <= 0x1F3FF) || // Emoji skin tone modifiers
+         (c >= 0xE0100 && c <= 0xE01EF) || // Variation selectors supplement
+         c == ZERO_WIDTH_JOINER;
+}
+
+bool IsSpace(char32_t c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == 0x0B || c == 0x0C || c == 0xA0 ||
+         (c >= 0x2000 && c <= 0x200A) || c == 0x2028 || c == 0x2029 || c == 0x202F || c == 0x3000;
+}
+
+/**
+ * @brief Checks for ideographs and kana, which form a word each.
+ */
+bool IsIdeographic(char32_t c)
+{
+  return (c >= 0x3040 && c <= 0x30FF) || (c >= 0x3400 && c <= 0x4DBF) || (c >= 0x4E00 && c <= 0x9FFF) ||
+         (c >= 0xF900 && c <= 0xFAFF) || (c >= 0x20000 && c <= 0x2FFFF);
+}
+
+bool IsPunctuation(char32_t c)
+{
+  if(c < 0x80)
+  {
+    return !((c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '_');
+  }
+  return (c >= 0x00A1 && c <= 0x00BF) || c == 0x00D7 || c == 0x00F7 || (c >= 0x2010 && c <= 0x205E) ||
+         (c >= 0x20A0 && c <= 0x20CF) || (c >= 0x2190 && c <= 0x2BFF) || (c >= 0x3001 && c <= 0x303F) ||
+         (c >= 0xFF01 && c <= 0xFF0F) || (c >= 0x1F000 && c <= 0x1FAFF);
+}
+
+bool IsWordCharacter(char32_t c)
+{
+  return !IsSpace(c) && !IsPunctuation(c) && !IsExtend(c);
+}
+
+bool IsApostrophe(char32_t c)
+{
+  return c == '\'' || c == 0x2019;
+}
+
+bool IsSentenceTerminator(char32_t c)
+{
+  return c == '.' || c == '!' || c == '?' || c == 0x2026 || c == 0x3002 || c == 0xFF01 || c == 0xFF1F;
+}
+
+bool IsClosing(char32_t c)
+{
+  return c == '"' || c == '\'' || c == ')' || c == ']' || c == 0x2019 || c == 0x201D || c == 0x300D;
+}
+
+struct Span
+{
+  std::size_t start;
+  std::size_t end;
+};
+
+Span CharacterAt(const std::u32string& text, std::size_t offset)
+{
+  auto start = offset;
+  while(start > 0 && (IsExtend(text[start]) || text[start - 1] == ZERO_WIDTH_JOINER))
+  {
+    --start;
+  }
+  auto end = start + 1;
+  if(text[start] == '\r' && end < text.size() && text[end] == '\n')
+  {
+    return {start, end + 1};
+  }
+  while(end < text.size() && (IsExtend(text[end]) || text[end - 1] == ZERO_WIDTH_JOINER))
+  {
+    ++end;
+  }
+  return {start, end};
+}
+
+Span WordAt(const std::u32string& text, std::size_t offset)
+{
+  auto character = CharacterAt(text, offset);
+  auto c         = text[character.start];
+  if(IsSpace(c))
+  {
+    auto start = character.start;
+    auto end   = character.end;
+    while(start > 0 && IsSpace(text[start - 1]))
+    {
+      --start;
+    }
+    while(end < text.size() && IsSpace(text[end]))
+    {
+      ++end;
+    }
+    return {start, end};
+  }
+  if(!IsWordCharacter(c) || IsIdeographic(c))
+  {
+    // Punctuation and ideographs are read one at a time
+    return character;
+  }
+
+  // A letter or digit run, with apostrophes inside it ("don't")
+  auto inWord = [&](std::size_t i) {
+    auto ch = text[i];
+    if(IsExtend(ch))
+    {
+      return true;
+    }
+    if(IsApostrophe(ch))
+    {
+      return i > 0 && i + 1 < text.size() && IsWordCharacter(text[i - 1]) && IsWordCharacter(text[i + 1]);
+    }
+    return IsWordCharacter(ch) && !IsIdeographic(ch);
+  };
+  auto start = character.start;
+  auto end   = character.end;
+  while(start > 0 && inWord(start - 1))
+  {
+    --start;
+  }
+  while(end < text.size() && inWord(end))
+  {
+    ++end;
+  }
+  return {start, end};
+}
+
+Span LineAt(const std::u32string& text, std::size_t offset)
+{
+  auto start = offset;
+  while(start > 0 && text[start - 1] != '\n')
+  {
+    --start;
+  }
+  auto end = text.find(U'\n', offset);
+  return {start, end == std::u32string::npos ? text.size() : end + 1};
+}
+
+/**
+ * @brief Returns the end of the sentence starting at start, within [start, limit).
+ *
+ * A sentence ends after its terminators, any closing quotes or brackets,
+ * and the spaces that follow up to a new line, or after a new line.
+ */
+std::size_t SentenceEnd(const std::u32string& text, std::size_t start, std::size_t limit)
+{
+  for(auto i = start; i < limit; ++i)
+  {
+    if(text[i] == '\n')
+    {
+      return i + 1;
+    }
+    if(!IsSentenceTerminator(text[i]))
+    {
+      continue;
+    }
+    auto end = i + 1;
+    while(end < limit && (IsSentenceTerminator(text[end]) || IsClosing(text[end])))
+    {
+      ++end;
+    }
+    if(end == limit || IsSpace(text[end]))
+    {
+      while(end < limit && IsSpace(text[end]))
+      {
+        if(text[end++] == '\n')
+        {
+          break;
+        }
+      }
+      return end;
+    }
+    i = end - 1; // "3.14", "e.g": not a sentence end
+  }
+  return limit;
+}
+
+Span SentenceAt(const std::u32string& text, std::size_t offset)
+{
+  // Sentences never span lines, so only the line needs scanning
+  auto line  = LineAt(text, offset);
+  auto start = line.start;
+  while(true)
+  {
+    auto end = SentenceEnd(text, start, line.end);
+    if(offset < end || end == line.end)
+    {
+      return {start, end};
+    }
+    start = end;
+  }
+}
+
+} // namespace
+
+bool TextMirror::load(const std::shared_ptr<NodeProxy>& node)
+{
+  clear();
+  if(!node)
+  {
+    return false;
+  }
+
+  mAddress = node->getAddress();
+  mText    = DecodeUtf8(node->getText(0, -1));
+  mCaret   = std::clamp<int32_t>(node->getCursorOffset(), 0, getCharacterCount());
+  mValid   = true;
+  return true;
+}
+
+void TextMirror::clear()
+{
+  mAddress = {};
+  mText.clear();
+  mCaret = 0;
+  mValid = false;
+}
+
+bool TextMirror::isValid() const
+{
+  return mValid;
+}
+
+const Address& TextMirror::getAddress() const
+{
+  return mAddress;
+}
+
+bool TextMirror::applyEvent(const AccessibilityEvent& event, std::string* changed)
+{
+  if(!mValid || event.source != mAddress)
+  {
+    return false;
+  }
+
+  auto size = mText.size();
+  switch(event.type)
+  {
+    case AccessibilityEvent::Type::TEXT_CARET_MOVED:
+    {
+      if(event.detail1 >= 0 && static_cast<std::size_t>(event.detail1) <= size)
+      {
+        mCaret = event.detail1;
+        return true;
+      }
+      break;
+    }
+    case AccessibilityEvent::Type::TEXT_CHANGED:
+    {
+      if(event.detail1 < 0 || event.detail2 < 0)
+      {
+        break;
+      }
+      auto position = static_cast<std::size_t>(event.detail1);
+      auto length   = static_cast<std::size_t>(event.detail2);
+
+      if(event.detail == EventDetail::TEXT_INSERT)
+      {
+        auto inserted = DecodeUtf8(event.text);
+        if(position > size || inserted.size() != length || (length > 0 && event.text.empty()))
+        {
+          break;
+        }
+        mText.insert(position, inserted);
+        if(mCaret >= event.detail1)
+        {
+          mCaret += static_cast<int32_t>(length);
+        }
+        if(changed)
+        {
+          *changed = event.text;
+        }
+        return true;
+      }
+      if(event.detail == EventDetail::TEXT_DELETE)
+      {
+        if(position > size || length > size - position)
+        {
+          break;
+        }
+        auto removed = EncodeUtf8(mText, position, position + length);
+        if(!event.text.empty() && event.text != removed)
+        {
+          break;
+        }
+        mText.erase(position, length);
+        if(mCaret > event.detail1)
+        {
+          mCaret = std::max<int32_t>(event.detail1, mCaret - static_cast<int32_t>(length));
+        }
+        if(changed)
+        {
+          *changed = std::move(removed);
+        }
+        return true;
+      }
+      break;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+
+  mValid = false;
+  return false;
+}
+
+int32_t TextMirror::getCharacterCount() const
+{
+  return static_cast<int32_t>(mText.size());
+}
+
+int32_t TextMirror::getCaretOffset() const
+{
+  return mCaret;
+}
+
+std::string TextMirror::getText(int32_t startOffset, int32_t endOffset) const
+{
+  auto size  = mText.size();
+  auto start = static_cast<std::size_t>(std::clamp<int32_t>(startOffset, 0, static_cast<int32_t>(size)));
+  auto end   = endOffset < 0 ? size : std::min(static_cast<std::size_t>(endOffset), size);
+  return start < end ? EncodeUtf8(mText, start, end) : std::string();
+}
+
+Range TextMirror::getTextAtOffset(int32_t offset, TextBoundary boundary) const
+{
+  if(offset < 0 || static_cast<std::size_t>(offset) >= mText.size())
+  {
+    return {};
+  }
+
+  Span span{};
+  switch(boundary)
+  {
+    case TextBoundary::CHARACTER:
+    {
+      span = CharacterAt(mText, offset);
+      break;
+    }
+    case TextBoundary::WORD:
+    {
+      span = WordAt(mText, offset);
+      break;
+    }
+    case TextBoundary::SENTENCE:
+    {
+      span = SentenceAt(mText, offset);
+      break;
+    }
+    case TextBoundary::LINE:
+    case TextBoundary::PARAGRAPH:
+    {
+      span = LineAt(mText, offset);
+      break;
+    }
+    default:
+    {
+      return {};
+    }
+  }
+  return Range(span.start, span.end, EncodeUtf8(mText, span.start, span.end));
+}
+
+} // namespace Accessibility
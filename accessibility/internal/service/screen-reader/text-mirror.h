@@ -0,0 +1,121 @@
+#ifndef ACCESSIBILITY_INTERNAL_SERVICE_SCREEN_READER_TEXT_MIRROR_H
+#define ACCESSIBILITY_INTERNAL_SERVICE_SCREEN_READER_TEXT_MIRROR_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/accessibility-event.h>
+#include <accessibility/api/node-proxy.h>
+
+namespace Accessibility
+{
+/**
+ * @brief Local copy of one node's text for reading by granularity.
+ *
+ * load() fetches the text and caret offset once. applyEvent() then keeps
+ * the copy current from TEXT_CHANGED and TEXT_CARET_MOVED deltas, and
+ * getTextAtOffset() computes character, word, sentence and line boundaries
+ * locally, so reading around the caret while typing costs no IPC.
+ *
+ * Offsets are in characters (code points), as on the AT-SPI Text interface.
+ * Boundaries follow simplified UTF-8 segmentation rules: a character keeps
+ * its combining marks and joined emoji, words are runs of letters and
+ * digits (each ideograph on its own), and lines are logical lines ending
+ * in a new line, since visual wrapping is not known locally.
+ *
+ * Not thread-safe; the owner serializes access.
+ */
+class TextMirror
+{
+public:
+  /**
+   * @brief Loads the text and caret offset of node, replacing any previous copy.
+   *
+   * @param[in] node The node to mirror
+   * @return false if node is null
+   */
+  bool load(const std::shared_ptr<NodeProxy>& node);
+
+  /**
+   * @brief Drops the copy.
+   */
+  void clear();
+
+  /**
+   * @brief Returns true if a copy is loaded and no event made it unreliable.
+   */
+  bool isValid() const;
+
+  /**
+   * @brief Returns the address of the mirrored node.
+   */
+  const Address& getAddress() const;
+
+  /**
+   * @brief Updates the copy from a TEXT_CHANGED or TEXT_CARET_MOVED event of its node.
+   *
+   * An insertion can only be applied if the event carries the inserted
+   * text; a removal is checked against the text it carries, if any.
+   * Events the copy cannot apply invalidate it.
+   *
+   * @param[in] event The event
+   * @param[out] changed For TEXT_CHANGED, the inserted or removed text; may be null
+   * @return true if the event was applied
+   */
+  bool applyEvent(const AccessibilityEvent& event, std::string* changed = nullptr);
+
+  /**
+   * @brief Gets the number of characters.
+   */
+  int32_t getCharacterCount() const;
+
+  /**
+   * @brief Gets the caret offset.
+   */
+  int32_t getCaretOffset() const;
+
+  /**
+   * @brief Gets the text between two offsets.
+   *
+   * @param[in] startOffset The first character
+   * @param[in] endOffset One past the last character, or -1 for the end of the text
+   */
+  std::string getText(int32_t startOffset, int32_t endOffset) const;
+
+  /**
+   * @brief Gets the character, word, sentence or line containing offset.
+   *
+   * PARAGRAPH is treated as LINE. Offsets outside the text give an empty Range.
+   */
+  Range getTextAtOffset(int32_t offset, TextBoundary boundary) const;
+
+private:
+  Address        mAddress;
+  std::u32string mText;
+  int32_t        mCaret{0};
+  bool           mValid{false};
+};
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_INTERNAL_SERVICE_SCREEN_READER_TEXT_MIRROR_H
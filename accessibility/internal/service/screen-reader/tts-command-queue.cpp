@@ -18,6 +18,9 @@
 // CLASS HEADER
 #include <accessibility/internal/service/screen-reader/tts-command-queue.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+
 // INTERNAL INCLUDES
 #include <accessibility/api/tts-engine.h>
 
@@ -33,28 +36,27 @@ TtsCommandQueue::TtsCommandQueue(TtsEngine& engine, Config config)
   });
 }
 
-void TtsCommandQueue::enqueue(const std::string& text, bool discardable, bool interrupt)
+void TtsCommandQueue::enqueue(std::string text, bool discardable, bool interrupt)
+{
+  enqueue(std::move(text), discardable ? Priority::NORMAL : Priority::IMPORTANT, interrupt);
+}
+
+void TtsCommandQueue::enqueue(std::string text, Priority priority, bool interrupt)
 {
   if(text.empty())
   {
     return;
   }
 
+  std::lock_guard<std::recursive_mutex> lock(mMutex);
   if(interrupt)
   {
     purgeDiscardable();
   }
 
-  auto chunks = chunkText(text, mConfig.maxChunkSize);
-  for(auto& chunk : chunks)
-  {
-    Command cmd;
-    cmd.text        = std::move(chunk);
-    cmd.discardable = discardable;
-    mQueue.push_back(std::move(cmd));
-  }
+  mLanes[static_cast<size_t>(priority)].push_back({std::make_shared<const std::string>(std::move(text)), 0});
 
-  if(!mSpeaking && !mPaused)
+  if(!mPaused)
   {
     speakNext();
   }
@@ -62,28 +64,26 @@ void TtsCommandQueue::enqueue(const std::string& text, bool discardable, bool in
 
 void TtsCommandQueue::purgeDiscardable()
 {
+  std::lock_guard<std::recursive_mutex> lock(mMutex);
   mEngine.purge(true);
 
-  auto it = mQueue.begin();
-  while(it != mQueue.end())
-  {
-    if(it->discardable)
-    {
-      it = mQueue.erase(it);
-    }
-    else
-    {
-      ++it;
-    }
-  }
+  mLanes[static_cast<size_t>(Priority::NORMAL)].clear();
+  mLanes[static_cast<size_t>(Priority::HINT)].clear();
 
-  if(mSpeaking)
+  stopSpeaking([](Priority priority) { return priority != Priority::IMPORTANT; });
+
+  if(!mPaused)
   {
-    mEngine.stop();
-    mSpeaking = false;
+    speakNext();
   }
+}
+
+void TtsCommandQueue::purge(Priority priority)
+{
+  std::lock_guard<std::recursive_mutex> lock(mMutex);
+  mLanes[static_cast<size_t>(priority)].clear();
 
-  if(!mQueue.empty() && !mPaused)
+  if(stopSpeaking([priority](Priority lane) { return lane == priority; }) && !mPaused)
   {
     speakNext();
   }
@@ -91,17 +91,22 @@ void TtsCommandQueue::purgeDiscardable()
 
 void TtsCommandQueue::purgeAll()
 {
+  std::lock_guard<std::recursive_mutex> lock(mMutex);
   mEngine.stop();
-  mQueue.clear();
-  mSpeaking = false;
+  for(auto& lane : mLanes)
+  {
+    lane.clear();
+  }
+  mInFlight.clear();
 }
 
 void TtsCommandQueue::pause()
 {
+  std::lock_guard<std::recursive_mutex> lock(mMutex);
   if(!mPaused)
   {
     mPaused = true;
-    if(mSpeaking)
+    if(!mInFlight.empty())
     {
       mEngine.pause();
     }
@@ -110,96 +115,155 @@ void TtsCommandQueue::pause()
 
 void TtsCommandQueue::resume()
 {
+  std::lock_guard<std::recursive_mutex> lock(mMutex);
   if(mPaused)
   {
     mPaused = false;
-    if(mSpeaking)
+    if(!mInFlight.empty())
     {
       mEngine.resume();
     }
-    else if(!mQueue.empty())
-    {
-      speakNext();
-    }
+    speakNext();
   }
 }
 
 bool TtsCommandQueue::isPaused() const
 {
+  std::lock_guard<std::recursive_mutex> lock(mMutex);
   return mPaused;
 }
 
 size_t TtsCommandQueue::pendingCount() const
 {
-  return mQueue.size();
+  std::lock_guard<std::recursive_mutex> lock(mMutex);
+  size_t count = 0;
+  for(auto& lane : mLanes)
+  {
+    count += lane.size();
+  }
+  return count;
 }
 
 void TtsCommandQueue::onUtteranceCompleted(uint32_t commandId)
 {
-  if(commandId == mCurrentCommandId)
+  std::lock_guard<std::recursive_mutex> lock(mMutex);
+  for(auto it = mInFlight.begin(); it != mInFlight.end(); ++it)
   {
-    mSpeaking = false;
-    if(!mQueue.empty() && !mPaused)
+    if(it->commandId == commandId)
     {
-      speakNext();
+      // Commands submitted earlier have finished too
+      mInFlight.erase(mInFlight.begin(), it + 1);
+      if(!mPaused)
+      {
+        speakNext();
+      }
+      return;
     }
   }
 }
 
 void TtsCommandQueue::speakNext()
 {
-  if(mQueue.empty())
+  const auto limit = 1 + mEngine.getLookahead();
+  size_t     lane  = 0;
+  while(mInFlight.size() < limit && lane < LANE_COUNT)
   {
-    return;
-  }
+    if(mLanes[lane].empty())
+    {
+      ++lane;
+      continue;
+    }
 
-  auto cmd = std::move(mQueue.front());
-  mQueue.pop_front();
+    // Split off the next chunk only now; the rest stays in the shared text
+    auto& utterance = mLanes[lane].front();
+    auto  text      = utterance.text;
+    auto  range     = nextChunk(*text, utterance.offset, mConfig.maxChunkSize);
+    if(utterance.offset >= text->size())
+    {
+      mLanes[lane].pop_front();
+    }
+    if(range.begin == range.end)
+    {
+      continue;
+    }
 
-  SpeakOptions options;
-  options.discardable = cmd.discardable;
-  options.interrupt   = false;
+    SpeakOptions options;
+    options.discardable = static_cast<Priority>(lane) != Priority::IMPORTANT;
+    options.interrupt   = false;
 
-  mCurrentCommandId = mEngine.speak(cmd.text, options);
-  cmd.commandId     = mCurrentCommandId;
-  mSpeaking         = true;
+    auto id = mEngine.speak(text->substr(range.begin, range.end - range.begin), options);
+    mInFlight.push_back({id, static_cast<Priority>(lane), std::move(text), range});
+  }
 }
 
-std::vector<std::string> TtsCommandQueue::chunkText(const std::string& text, size_t maxSize)
+bool TtsCommandQueue::stopSpeaking(const std::function<bool(Priority)>& dropped)
 {
-  std::vector<std::string> chunks;
-
-  if(text.size() <= maxSize)
+  if(std::none_of(mInFlight.begin(), mInFlight.end(), [&dropped](const Command& command) { return dropped(command.priority); }))
   {
-    chunks.push_back(text);
-    return chunks;
+    return false;
   }
 
-  size_t pos = 0;
-  while(pos < text.size())
+  // The engine cannot stop single commands; kept ones are resubmitted from
+  // their chunk, newest first so each lane ends up in submission order
+  mEngine.stop();
+  for(auto it = mInFlight.rbegin(); it != mInFlight.rend(); ++it)
   {
-    if(pos + maxSize >= text.size())
+    if(dropped(it->priority))
     {
-      chunks.push_back(text.substr(pos));
-      break;
+      continue;
     }
-
-    // Find the last space within maxSize
-    size_t end = pos + maxSize;
-    size_t lastSpace = text.rfind(' ', end);
-
-    if(lastSpace != std::string::npos && lastSpace > pos)
+    auto& lane = mLanes[static_cast<size_t>(it->priority)];
+    if(!lane.empty() && lane.front().text == it->text)
     {
-      chunks.push_back(text.substr(pos, lastSpace - pos));
-      pos = lastSpace + 1; // skip the space
+      lane.front().offset = it->range.begin;
     }
     else
     {
-      // No space found — force break at maxSize
-      chunks.push_back(text.substr(pos, maxSize));
-      pos += maxSize;
+      lane.push_front({it->text, it->range.begin});
     }
   }
+  mInFlight.clear();
+  return true;
+}
+
+TtsCommandQueue::TextRange TtsCommandQueue::nextChunk(std::string_view text, size_t& offset, size_t maxSize)
+{
+  auto pos = offset;
+  if(pos >= text.size())
+  {
+    return {pos, pos};
+  }
+
+  if(pos + maxSize >= text.size())
+  {
+    offset = text.size();
+    return {pos, text.size()};
+  }
+
+  // Find the last space within maxSize
+  size_t end       = pos + maxSize;
+  size_t lastSpace = text.rfind(' ', end);
+
+  if(lastSpace != std::string_view::npos && lastSpace > pos)
+  {
+    offset = lastSpace + 1; // skip the space
+    return {pos, lastSpace};
+  }
+
+  // No space found — force break at maxSize
+  offset = end;
+  return {pos, end};
+}
+
+std::vector<std::string> TtsCommandQueue::chunkText(const std::string& text, size_t maxSize)
+{
+  std::vector<std::string> chunks;
+  size_t                   offset = 0;
+  do
+  {
+    auto range = nextChunk(text, offset, maxSize);
+    chunks.emplace_back(text, range.begin, range.end - range.begin);
+  } while(offset < text.size());
 
   return chunks;
 }
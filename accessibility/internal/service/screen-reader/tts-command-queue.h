@@ -19,9 +19,15 @@
  */
 
 // EXTERNAL INCLUDES
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace Accessibility
@@ -35,10 +41,17 @@ class TtsEngine;
  * the order and chunking of utterances.
  *
  * Features:
- * - Text chunking at configurable max length (default 300 chars)
- * - Discardable vs non-discardable commands
- * - Purge discardable commands (for interrupt)
+ * - Priority lanes: important (non-discardable), normal and hint speech.
+ *   The next chunk always comes from the highest non-empty lane
+ * - Text chunking at configurable max length (default 300 chars). Texts
+ *   are stored once and split lazily, one chunk per submission, so purged
+ *   text is never split or copied
+ * - Purge discardable commands (for interrupt) by clearing whole lanes
  * - Pause/resume state tracking
+ * - Lookahead: up to TtsEngine::getLookahead() commands are submitted
+ *   beyond the playing one, so asynchronous engines can render them early
+ *
+ * Thread-safe: engines may report completion from their own thread.
  */
 class TtsCommandQueue
 {
@@ -48,6 +61,25 @@ public:
     size_t maxChunkSize = 300;
   };
 
+  /**
+   * @brief Speech lanes, highest priority first.
+   */
+  enum class Priority
+  {
+    IMPORTANT, ///< Non-discardable, e.g. alerts
+    NORMAL,    ///< Discardable, e.g. the reading of the highlighted node
+    HINT,      ///< Discardable, spoken only when nothing else is queued
+  };
+
+  /**
+   * @brief A chunk of a text as an offset range, [begin, end).
+   */
+  struct TextRange
+  {
+    size_t begin{0};
+    size_t end{0};
+  };
+
   explicit TtsCommandQueue(TtsEngine& engine, Config config = {300});
 
   /**
@@ -57,16 +89,37 @@ public:
    * all existing discardable commands are purged first.
    *
    * @param[in] text The text to speak
-   * @param[in] discardable Whether this command can be purged
+   * @param[in] discardable Whether this command can be purged (IMPORTANT or NORMAL lane)
    * @param[in] interrupt Whether to purge existing commands first
    */
-  void enqueue(const std::string& text, bool discardable = true, bool interrupt = false);
+  void enqueue(std::string text, bool discardable = true, bool interrupt = false);
 
   /**
-   * @brief Purges all discardable commands and stops current speech.
+   * @brief Enqueues text to be spoken in the given lane.
+   *
+   * @param[in] text The text to speak
+   * @param[in] priority The lane
+   * @param[in] interrupt Whether to purge existing discardable commands first
+   */
+  void enqueue(std::string text, Priority priority, bool interrupt = false);
+
+  /**
+   * @brief Purges all discardable commands, including submitted ones.
+   *
+   * Submitted important commands are kept: if the engine has to be stopped
+   * for a discardable one, they are resubmitted from the start of their chunk.
    */
   void purgeDiscardable();
 
+  /**
+   * @brief Purges one lane; speech stops only if a command from that lane was submitted.
+   *
+   * Submitted commands from other lanes are resubmitted like in purgeDiscardable().
+   *
+   * @param[in] priority The lane to clear
+   */
+  void purge(Priority priority);
+
   /**
    * @brief Purges all commands and stops current speech.
    */
@@ -88,7 +141,7 @@ public:
   bool isPaused() const;
 
   /**
-   * @brief Returns the number of pending commands.
+   * @brief Returns the number of texts with chunks not yet submitted to the engine.
    */
   size_t pendingCount() const;
 
@@ -106,22 +159,60 @@ public:
    */
   static std::vector<std::string> chunkText(const std::string& text, size_t maxSize);
 
+  /**
+   * @brief Finds the chunk of text starting at offset.
+   *
+   * Breaks at the last space within maxSize characters, or at maxSize if
+   * there is none.
+   *
+   * @param[in] text The text to chunk
+   * @param[in,out] offset Start of the chunk; advanced past it and the space it ends at
+   * @param[in] maxSize Maximum chunk size in characters
+   * @return The chunk, empty if offset is at the end of text
+   */
+  static TextRange nextChunk(std::string_view text, size_t& offset, size_t maxSize);
+
 private:
+  static constexpr size_t LANE_COUNT = 3;
+
+  /**
+   * @brief A queued text; chunks before offset have been submitted.
+   */
+  struct Utterance
+  {
+    std::shared_ptr<const std::string> text;
+    size_t                             offset{0};
+  };
+
+  /**
+   * @brief A chunk submitted to the engine.
+   */
   struct Command
   {
-    std::string text;
-    bool        discardable;
-    uint32_t    commandId{0};
+    uint32_t                           commandId{0};
+    Priority                           priority{Priority::NORMAL};
+    std::shared_ptr<const std::string> text;
+    TextRange                          range;
   };
 
   void speakNext();
 
-  TtsEngine&          mEngine;
-  Config              mConfig;
-  std::deque<Command> mQueue;
-  bool                mPaused{false};
-  bool                mSpeaking{false};
-  uint32_t            mCurrentCommandId{0};
+  /**
+   * @brief Stops the engine if a submitted command is in a dropped lane.
+   *
+   * The other submitted commands go back to the head of their lanes.
+   *
+   * @param[in] dropped Whether commands of a lane are dropped
+   * @return Whether the engine was stopped
+   */
+  bool stopSpeaking(const std::function<bool(Priority)>& dropped);
+
+  TtsEngine&                                   mEngine;
+  Config                                       mConfig;
+  std::array<std::deque<Utterance>, LANE_COUNT> mLanes;
+  std::deque<Command>                          mInFlight; ///< Submitted to the engine, oldest (playing) first
+  bool                                         mPaused{false};
+  mutable std::recursive_mutex                 mMutex;    ///< Recursive: engine callbacks may re-enter the queue
 };
 
 } // namespace Accessibility
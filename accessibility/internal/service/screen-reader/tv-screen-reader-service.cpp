@@ -48,6 +48,11 @@ TvScreenReaderService::TvScreenReaderService(
 {
   mImpl->ttsEngine       = std::move(ttsEngine);
   mImpl->settingsProvider = std::move(settingsProvider);
+
+  // Focus moves to a node that is not yet current, so focus changes are taken
+  // from any source; property changes only matter for the current node.
+  subscribeEvents(EventTarget::ANY_SOURCE, EventTypeBit(AccessibilityEvent::Type::STATE_CHANGED));
+  subscribeEvents(EventTarget::CURRENT_NODE, EventTypeBit(AccessibilityEvent::Type::PROPERTY_CHANGED));
 }
 
 TvScreenReaderService::~TvScreenReaderService()
@@ -109,7 +114,7 @@ void TvScreenReaderService::onAccessibilityEvent(const AccessibilityEvent& event
     case AccessibilityEvent::Type::STATE_CHANGED:
     {
       // TV mode: focus change triggers read
-      if(event.detail == "focused" && event.detail1 == 1)
+      if(event.detail == EventDetail::FOCUSED && event.detail1 == 1)
       {
         auto current = getCurrentNode();
         if(current)
@@ -136,7 +141,7 @@ void TvScreenReaderService::onAccessibilityEvent(const AccessibilityEvent& event
         SpeakOptions options;
         options.discardable = true;
         options.interrupt   = true;
-        mImpl->ttsEngine->speak(event.detail, options);
+        mImpl->ttsEngine->speak(event.detail.str(), options);
       }
       break;
     }
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <accessibility/internal/service/thread-task-executor.h>
+
+namespace Accessibility
+{
+ThreadTaskExecutor::ThreadTaskExecutor()
+: mThread([this]() { run(); })
+{
+}
+
+ThreadTaskExecutor::~ThreadTaskExecutor()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mQuit = true;
+  }
+  mWakeUp.notify_one();
+  mThread.join();
+}
+
+void ThreadTaskExecutor::post(std::function<void()> task)
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mTasks.push_back(std::move(task));
+  }
+  mWakeUp.notify_one();
+}
+
+void ThreadTaskExecutor::waitIdle()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  mIdle.wait(lock, [this]() { return mTasks.empty() && !mBusy; });
+}
+
+void ThreadTaskExecutor::run()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  for(;;)
+  {
+    mWakeUp.wait(lock, [this]() { return mQuit || !mTasks.empty(); });
+    if(mTasks.empty())
+    {
+      return; // mQuit, and nothing left to drain
+    }
+
+    auto task = std::move(mTasks.front());
+    mTasks.pop_front();
+    mBusy = true;
+
+    lock.unlock();
+    task();
+    lock.lock();
+
+    mBusy = false;
+    if(mTasks.empty())
+    {
+      mIdle.notify_all();
+    }
+  }
+}
+
+} // namespace Accessibility
@@ -0,0 +1,69 @@
+#ifndef ACCESSIBILITY_INTERNAL_SERVICE_THREAD_TASK_EXECUTOR_H
+#define ACCESSIBILITY_INTERNAL_SERVICE_THREAD_TASK_EXECUTOR_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/task-executor.h>
+
+namespace Accessibility
+{
+/**
+ * @brief TaskExecutor backed by a single worker thread.
+ *
+ * Suitable for IPC-backed NodeProxy implementations (AT-SPI, TIDL), where
+ * each call blocks on a round trip and must not stall the gesture thread.
+ * Whoever constructs a ScreenReaderService over such a registry passes one
+ * in; the service itself defaults to InlineTaskExecutor.
+ * Pending tasks still run on destruction.
+ */
+class ThreadTaskExecutor : public TaskExecutor
+{
+public:
+  ThreadTaskExecutor();
+
+  ~ThreadTaskExecutor() override;
+
+  ThreadTaskExecutor(const ThreadTaskExecutor&)            = delete;
+  ThreadTaskExecutor& operator=(const ThreadTaskExecutor&) = delete;
+
+  void post(std::function<void()> task) override;
+
+  void waitIdle() override;
+
+private:
+  void run();
+
+  std::mutex                        mMutex;
+  std::condition_variable           mWakeUp;
+  std::condition_variable           mIdle;
+  std::deque<std::function<void()>> mTasks;
+  bool                              mBusy{false};
+  bool                              mQuit{false};
+  std::thread                       mThread;
+};
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_INTERNAL_SERVICE_THREAD_TASK_EXECUTOR_H
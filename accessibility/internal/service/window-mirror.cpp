@@ -0,0 +1,1024 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <accessibility/internal/service/window-mirror.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/accessibility-names.h>
+
+namespace Accessibility
+{
+namespace
+{
+bool EqualsZero(float value)
+{
+  return std::abs(value) <= std::numeric_limits<float>::epsilon();
+}
+
+Rect<float> ToFloatRect(const Rect<int>& rect)
+{
+  return {static_cast<float>(rect.x), static_cast<float>(rect.y), static_cast<float>(rect.width), static_cast<float>(rect.height)};
+}
+
+/**
+ * @brief Gets the role from the node info, asking the node only for unknown role names.
+ */
+Role GetRole(NodeProxy& proxy, const NodeInfo& info)
+{
+  Role role{Role::UNKNOWN};
+  if(!ROLE_NAMES.Find(info.roleName, role))
+  {
+    role = proxy.getRole();
+  }
+  return role;
+}
+
+/**
+ * @brief Maps a state-changed event detail to the state it reports.
+ *
+ * @return false for details that do not name a State
+ */
+bool DetailToState(EventDetail::Id id, State& state)
+{
+  switch(id)
+  {
+    case EventDetail::ACTIVE:        state = State::ACTIVE;        return true;
+    case EventDetail::ARMED:         state = State::ARMED;         return true;
+    case EventDetail::BUSY:          state = State::BUSY;          return true;
+    case EventDetail::CHECKED:       state = State::CHECKED;       return true;
+    case EventDetail::COLLAPSED:     state = State::COLLAPSED;     return true;
+    case EventDetail::DEFUNCT:       state = State::DEFUNCT;       return true;
+    case EventDetail::EDITABLE:      state = State::EDITABLE;      return true;
+    case EventDetail::ENABLED:       state = State::ENABLED;       return true;
+    case EventDetail::EXPANDABLE:    state = State::EXPANDABLE;    return true;
+    case EventDetail::EXPANDED:      state = State::EXPANDED;      return true;
+    case EventDetail::FOCUSABLE:     state = State::FOCUSABLE;     return true;
+    case EventDetail::FOCUSED:       state = State::FOCUSED;       return true;
+    case EventDetail::MODAL:         state = State::MODAL;         return true;
+    case EventDetail::PRESSED:       state = State::PRESSED;       return true;
+    case EventDetail::SELECTABLE:    state = State::SELECTABLE;    return true;
+    case EventDetail::SELECTED:      state = State::SELECTED;      return true;
+    case EventDetail::SENSITIVE:     state = State::SENSITIVE;     return true;
+    case EventDetail::SHOWING:       state = State::SHOWING;       return true;
+    case EventDetail::VISIBLE:       state = State::VISIBLE;       return true;
+    case EventDetail::CHECKABLE:     state = State::CHECKABLE;     return true;
+    case EventDetail::READ_ONLY:     state = State::READ_ONLY;     return true;
+    case EventDetail::HIGHLIGHTED:   state = State::HIGHLIGHTED;   return true;
+    case EventDetail::HIGHLIGHTABLE: state = State::HIGHLIGHTABLE; return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief Same cycle detection as the bridge (Brent's algorithm).
+ */
+template<class T>
+struct CycleDetection
+{
+  explicit CycleDetection(const T value)
+  : mKey(value),
+    mCurrentSearchSize(1),
+    mCounter(1)
+  {
+  }
+
+  bool Check(const T value)
+  {
+    if(mKey == value)
+    {
+      return true;
+    }
+
+    if(--mCounter == 0)
+    {
+      mCurrentSearchSize <<= 1;
+      if(mCurrentSearchSize == 0)
+      {
+        return true;
+      }
+      mCounter = mCurrentSearchSize;
+      mKey     = value;
+    }
+    return false;
+  }
+
+  T            mKey;
+  unsigned int mCurrentSearchSize;
+  unsigned int mCounter;
+};
+
+} // namespace
+
+bool WindowMirror::load(const std::shared_ptr<NodeProxy>& window)
+{
+  if(!window)
+  {
+    *this = WindowMirror{};
+    return false;
+  }
+
+  fetch(window, window->getAddress().GetBus());
+  return true;
+}
+
+bool WindowMirror::loadSubtree(const std::shared_ptr<NodeProxy>& root, const std::string& windowBus)
+{
+  if(!root)
+  {
+    *this = WindowMirror{};
+    return false;
+  }
+
+  fetch(root, windowBus);
+  return true;
+}
+
+void WindowMirror::fetch(const std::shared_ptr<NodeProxy>& root, const std::string& windowBus)
+{
+  *this = WindowMirror{};
+
+  // Breadth-first, so ids follow the tree level by level
+  Node rootNode;
+  rootNode.proxy    = root;
+  rootNode.address  = root->getAddress();
+  rootNode.embedded = rootNode.address.GetBus() != windowBus;
+  mNodes.push_back(std::move(rootNode));
+
+  for(NodeId id = 0; id < mNodes.size(); ++id)
+  {
+    auto proxy = mNodes[id].proxy;
+    auto info  = proxy->getNodeInfo();
+
+    Node& node = mNodes[id];
+    node.role        = GetRole(*proxy, info);
+    node.states      = info.states;
+    node.extents     = ToFloatRect(info.windowExtents);
+    node.scrollable  = proxy->isScrollable();
+    mIndex[node.address] = id;
+
+    auto container           = info.attributes.find(WellKnownAttribute::COLLECTION_CONTAINER);
+    node.collectionContainer = container != info.attributes.end() && container->second == "true";
+    auto index               = info.attributes.find(WellKnownAttribute::COLLECTION_INDEX);
+    if(index != info.attributes.end())
+    {
+      node.hasCollectionIndex = true;
+      try
+      {
+        node.collectionIndex      = std::stoi(index->second);
+        node.collectionIndexValid = true;
+      }
+      catch(const std::exception&)
+      {
+        node.collectionIndexValid = false;
+      }
+    }
+
+    // The bridge follows the first target of the first matching relation
+    for(auto& relation : proxy->getRelationSet())
+    {
+      if(relation.type == RelationType::CONTROLLED_BY)
+      {
+        node.controlledBy = true;
+      }
+      if(relation.targets.empty())
+      {
+        continue;
+      }
+      if(relation.type == RelationType::FLOWS_TO && !node.hasFlowsTo)
+      {
+        node.hasFlowsTo    = true;
+        node.flowsToTarget = relation.targets.front();
+      }
+      else if(relation.type == RelationType::FLOWS_FROM && !node.hasFlowsFrom)
+      {
+        node.hasFlowsFrom    = true;
+        node.flowsFromTarget = relation.targets.front();
+      }
+    }
+
+    if(node.embedded)
+    {
+      continue;
+    }
+
+    for(auto& child : proxy->getChildren())
+    {
+      Node childNode;
+      childNode.address  = child->getAddress();
+      childNode.embedded = childNode.address.GetBus() != windowBus;
+      childNode.parent   = id;
+      childNode.proxy    = std::move(child);
+      mNodes[id].children.push_back(static_cast<NodeId>(mNodes.size()));
+      mNodes.push_back(std::move(childNode));
+    }
+  }
+
+  resolveRelations();
+}
+
+void WindowMirror::resolveRelations()
+{
+  // Relations can point anywhere in the window, so they are resolved by
+  // address once every node is in place
+  auto resolve = [this](bool hasTarget, const Address& address, NodeId& target, bool& unresolved)
+  {
+    target     = INVALID_NODE;
+    unresolved = false;
+    if(!hasTarget)
+    {
+      return;
+    }
+    auto it = mIndex.find(address);
+    if(it != mIndex.end())
+    {
+      target = it->second;
+    }
+    else
+    {
+      unresolved = true;
+    }
+  };
+
+  for(auto& node : mNodes)
+  {
+    resolve(node.hasFlowsTo, node.flowsToTarget, node.flowsTo, node.flowsToUnresolved);
+    resolve(node.hasFlowsFrom, node.flowsFromTarget, node.flowsFrom, node.flowsFromUnresolved);
+  }
+}
+
+bool WindowMirror::replaceSubtree(WindowMirror subtree)
+{
+  if(mNodes.empty() || subtree.mNodes.empty())
+  {
+    return false;
+  }
+
+  auto it = mIndex.find(subtree.mNodes.front().address);
+  if(it == mIndex.end())
+  {
+    return false;
+  }
+  NodeId rootId = it->second;
+
+  std::vector<NodeId> pending = mNodes[rootId].children;
+  while(!pending.empty())
+  {
+    NodeId id = pending.back();
+    pending.pop_back();
+    pending.insert(pending.end(), mNodes[id].children.begin(), mNodes[id].children.end());
+    removeNode(id);
+  }
+
+  // Fresh nodes go to the end; the root keeps its id and its parent
+  NodeId base  = static_cast<NodeId>(mNodes.size());
+  auto   remap = [rootId, base](NodeId id)
+  {
+    return id == 0 ? rootId : base + id - 1;
+  };
+
+  for(NodeId id = 0; id < subtree.mNodes.size(); ++id)
+  {
+    auto& node = subtree.mNodes[id];
+    for(auto& child : node.children)
+    {
+      child = remap(child);
+    }
+    if(id == 0)
+    {
+      node.parent = mNodes[rootId].parent;
+      if(mNodes[rootId].subtreeDirty)
+      {
+        --mDirtySubtrees;
+      }
+      if(mNodes[rootId].dirty)
+      {
+        --mDirtyNodes;
+      }
+      mNodes[rootId] = std::move(node);
+      continue;
+    }
+    node.parent         = remap(node.parent);
+    mIndex[node.address] = static_cast<NodeId>(mNodes.size());
+    mNodes.push_back(std::move(node));
+  }
+
+  if(mRemovedNodes > mNodes.size() / 2)
+  {
+    compact();
+  }
+  resolveRelations();
+  return true;
+}
+
+void WindowMirror::markDirty(NodeId id)
+{
+  if(!mNodes[id].dirty)
+  {
+    mNodes[id].dirty = true;
+    ++mDirtyNodes;
+  }
+}
+
+void WindowMirror::markSubtreeDirty(NodeId id)
+{
+  if(!mNodes[id].subtreeDirty)
+  {
+    mNodes[id].subtreeDirty = true;
+    ++mDirtySubtrees;
+  }
+}
+
+void WindowMirror::removeNode(NodeId id)
+{
+  auto& node = mNodes[id];
+
+  // A node that moved may already be indexed at its new place
+  auto it = mIndex.find(node.address);
+  if(it != mIndex.end() && it->second == id)
+  {
+    mIndex.erase(it);
+  }
+  if(node.subtreeDirty)
+  {
+    --mDirtySubtrees;
+  }
+  if(node.dirty)
+  {
+    --mDirtyNodes;
+  }
+  node = Node{};
+  node.removed = true;
+  ++mRemovedNodes;
+}
+
+void WindowMirror::compact()
+{
+  std::vector<NodeId> newIds(mNodes.size(), INVALID_NODE);
+  std::vector<Node>   nodes;
+  nodes.reserve(mNodes.size() - mRemovedNodes);
+  for(NodeId id = 0; id < mNodes.size(); ++id)
+  {
+    if(!mNodes[id].removed)
+    {
+      newIds[id] = static_cast<NodeId>(nodes.size());
+      nodes.push_back(std::move(mNodes[id]));
+    }
+  }
+
+  mIndex.clear();
+  for(NodeId id = 0; id < nodes.size(); ++id)
+  {
+    auto& node = nodes[id];
+    if(node.parent != INVALID_NODE)
+    {
+      node.parent = newIds[node.parent];
+    }
+    for(auto& child : node.children)
+    {
+      child = newIds[child];
+    }
+    mIndex[node.address] = id;
+  }
+
+  mNodes        = std::move(nodes);
+  mRemovedNodes = 0;
+}
+
+bool WindowMirror::isLoaded() const
+{
+  return !mNodes.empty();
+}
+
+bool WindowMirror::isStale() const
+{
+  return mStale;
+}
+
+bool WindowMirror::needsRefresh() const
+{
+  return mStale || mDirtySubtrees > 0 || mDirtyNodes > 0;
+}
+
+std::vector<std::shared_ptr<NodeProxy>> WindowMirror::getDirtySubtrees() const
+{
+  std::vector<std::shared_ptr<NodeProxy>> roots;
+  if(mDirtySubtrees == 0)
+  {
+    return roots;
+  }
+
+  for(auto& node : mNodes)
+  {
+    if(!node.subtreeDirty)
+    {
+      continue;
+    }
+
+    bool nested = false;
+    for(auto parent = node.parent; parent != INVALID_NODE && !nested; parent = mNodes[parent].parent)
+    {
+      nested = mNodes[parent].subtreeDirty;
+    }
+    if(!nested)
+    {
+      roots.push_back(node.proxy);
+    }
+  }
+  return roots;
+}
+
+std::vector<std::shared_ptr<NodeProxy>> WindowMirror::getDirtyNodes() const
+{
+  std::vector<std::shared_ptr<NodeProxy>> nodes;
+  if(mDirtyNodes == 0)
+  {
+    return nodes;
+  }
+
+  for(auto& node : mNodes)
+  {
+    if(node.dirty)
+    {
+      nodes.push_back(node.proxy);
+    }
+  }
+  return nodes;
+}
+
+WindowMirror::NodeRefresh WindowMirror::fetchNode(const std::shared_ptr<NodeProxy>& proxy)
+{
+  // One GetNodeInfo round trip carries both the role name and the extents
+  auto        info = proxy->getNodeInfo();
+  NodeRefresh refresh;
+  refresh.address = proxy->getAddress();
+  refresh.role    = GetRole(*proxy, info);
+  refresh.extents = ToFloatRect(info.windowExtents);
+  return refresh;
+}
+
+bool WindowMirror::refreshNode(const NodeRefresh& refresh)
+{
+  auto it = mIndex.find(refresh.address);
+  if(it == mIndex.end())
+  {
+    return false;
+  }
+
+  auto& node   = mNodes[it->second];
+  node.role    = refresh.role;
+  node.extents = refresh.extents;
+  if(node.dirty)
+  {
+    node.dirty = false;
+    --mDirtyNodes;
+  }
+  return true;
+}
+
+void WindowMirror::invalidate()
+{
+  mStale = true;
+}
+
+const Address& WindowMirror::getWindowAddress() const
+{
+  static const Address EMPTY;
+  return mNodes.empty() ? EMPTY : mNodes.front().address;
+}
+
+std::size_t WindowMirror::getNodeCount() const
+{
+  return mNodes.size() - mRemovedNodes;
+}
+
+bool WindowMirror::applyEvent(const AccessibilityEvent& event)
+{
+  if(mNodes.empty() || mStale)
+  {
+    return false;
+  }
+
+  // Only mirrored nodes, the window included, can change the copy; a node
+  // entering the window is announced by CHILDREN_CHANGED on its new parent
+  auto it = event.source ? mIndex.find(event.source) : mIndex.end();
+  if(it == mIndex.end())
+  {
+    return false;
+  }
+
+  auto& node = mNodes[it->second];
+  switch(event.type)
+  {
+    case AccessibilityEvent::Type::WINDOW_CHANGED:
+    {
+      mStale = true;
+      return true;
+    }
+    case AccessibilityEvent::Type::SCROLL_STARTED:
+    case AccessibilityEvent::Type::SCROLL_FINISHED:
+    case AccessibilityEvent::Type::MOVED_OUT:
+    case AccessibilityEvent::Type::CHILDREN_CHANGED:
+    {
+      // Structure or geometry may have changed below the source only
+      markSubtreeDirty(it->second);
+      return true;
+    }
+    case AccessibilityEvent::Type::STATE_CHANGED:
+    {
+      State state;
+      if(!DetailToState(event.detail.id(), state))
+      {
+        return false;
+      }
+      node.states[state] = event.detail1 != 0;
+      return true;
+    }
+    case AccessibilityEvent::Type::PROPERTY_CHANGED:
+    {
+      if(event.detail == EventDetail::ACCESSIBLE_ROLE)
+      {
+        markDirty(it->second);
+        return true;
+      }
+      if(event.detail == EventDetail::ACCESSIBLE_PARENT)
+      {
+        // The node left its old parent; a new parent in the window reports
+        // CHILDREN_CHANGED itself
+        markSubtreeDirty(node.parent != INVALID_NODE ? node.parent : it->second);
+        return true;
+      }
+      return false;
+    }
+    case AccessibilityEvent::Type::BOUNDS_CHANGED:
+    {
+      markDirty(it->second);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+bool WindowMirror::findNeighbor(const Address& start, bool forward, NeighborSearchMode searchMode, std::shared_ptr<NodeProxy>& neighbor)
+{
+  if(mNodes.empty() || needsRefresh())
+  {
+    return false;
+  }
+
+  NodeId startId = 0;
+  if(start)
+  {
+    auto it = mIndex.find(start);
+    if(it == mIndex.end())
+    {
+      return false;
+    }
+    startId = it->second;
+  }
+
+  mDeclined   = false;
+  auto result = calculateNeighbor(0, startId, forward, searchMode);
+  if(mDeclined)
+  {
+    return false;
+  }
+
+  neighbor = result == INVALID_NODE ? nullptr : mNodes[result].proxy;
+  return true;
+}
+
+std::vector<NeighborMismatch> WindowMirror::verify(const std::shared_ptr<NodeProxy>& window)
+{
+  std::vector<NeighborMismatch> mismatches;
+  for(NodeId id = 0; id < mNodes.size(); ++id)
+  {
+    if(mNodes[id].removed)
+    {
+      continue;
+    }
+    for(bool forward : {true, false})
+    {
+      std::shared_ptr<NodeProxy> mirrored;
+      if(!findNeighbor(id == 0 ? Address{} : mNodes[id].address, forward, NeighborSearchMode::RECURSE_FROM_ROOT, mirrored))
+      {
+        continue;
+      }
+
+      auto    remote        = mNodes[id].proxy->getNeighbor(window, forward, NeighborSearchMode::RECURSE_FROM_ROOT);
+      Address mirroredAddress = mirrored ? mirrored->getAddress() : Address{};
+      Address remoteAddress   = remote ? remote->getAddress() : Address{};
+      if(mirroredAddress != remoteAddress)
+      {
+        mismatches.push_back({mNodes[id].address, forward, mirroredAddress, remoteAddress});
+      }
+    }
+  }
+  return mismatches;
+}
+
+// The helpers below follow bridge-accessible.cpp one to one, over node ids.
+// Keep them in sync with it; verify() reports any divergence.
+
+WindowMirror::NodeId WindowMirror::getScrollableParent(NodeId id) const
+{
+  while(id != INVALID_NODE)
+  {
+    id = mNodes[id].parent;
+    if(id != INVALID_NODE && mNodes[id].scrollable)
+    {
+      return id;
+    }
+  }
+  return INVALID_NODE;
+}
+
+std::vector<WindowMirror::NodeId> WindowMirror::getScrollableParents(NodeId id) const
+{
+  std::vector<NodeId> scrollableParents;
+  while(id != INVALID_NODE)
+  {
+    id = mNodes[id].parent;
+    if(id != INVALID_NODE && mNodes[id].scrollable)
+    {
+      scrollableParents.push_back(id);
+    }
+  }
+  return scrollableParents;
+}
+
+bool WindowMirror::isZeroSize(NodeId id) const
+{
+  auto& extents = mNodes[id].extents;
+  return EqualsZero(extents.height) || EqualsZero(extents.width);
+}
+
+bool WindowMirror::isVisibleInScrollableParent(NodeId id) const
+{
+  if(id == INVALID_NODE)
+  {
+    return true;
+  }
+
+  auto scrollableParent = getScrollableParent(id);
+  if(scrollableParent == INVALID_NODE)
+  {
+    return true;
+  }
+  return mNodes[scrollableParent].extents.Intersects(mNodes[id].extents);
+}
+
+bool WindowMirror::isChildVisibleInScrollableParent(NodeId start, NodeId id) const
+{
+  return isVisibleInScrollableParent(start) || isVisibleInScrollableParent(id);
+}
+
+bool WindowMirror::isAcceptable(NodeId id) const
+{
+  if(id == INVALID_NODE)
+  {
+    return false;
+  }
+
+  auto& node = mNodes[id];
+  if(!node.states[State::VISIBLE] || node.controlledBy || !node.states[State::HIGHLIGHTABLE])
+  {
+    return false;
+  }
+
+  if(getScrollableParent(id) != INVALID_NODE)
+  {
+    if(node.parent != INVALID_NODE)
+    {
+      auto& parentStates = mNodes[node.parent].states;
+      bool  isItem       = node.role == Role::LIST_ITEM || node.role == Role::MENU_ITEM;
+      bool  isCollapsed  = parentStates[State::EXPANDABLE] && !parentStates[State::EXPANDED];
+      return !isItem || !isCollapsed;
+    }
+  }
+  else
+  {
+    if(isZeroSize(id) || !node.states[State::SHOWING])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<WindowMirror::NodeId> WindowMirror::getValidChildren(const std::vector<NodeId>& children, NodeId start) const
+{
+  if(children.empty())
+  {
+    return {};
+  }
+
+  // Scrollable parents of the first child that start is not also inside
+  auto ofChild = getScrollableParents(children.front());
+  auto ofStart = start == INVALID_NODE ? std::vector<NodeId>{} : getScrollableParents(start);
+  while(!ofChild.empty() && !ofStart.empty() && ofChild.back() == ofStart.back())
+  {
+    ofChild.pop_back();
+    ofStart.pop_back();
+  }
+
+  Rect<float> clip;
+  if(!ofChild.empty())
+  {
+    clip = mNodes[ofChild.front()].extents;
+  }
+
+  std::vector<NodeId> valid;
+  for(auto child : children)
+  {
+    if(ofChild.empty() || clip.Intersects(mNodes[child].extents))
+    {
+      valid.push_back(child);
+    }
+  }
+  return valid;
+}
+
+void WindowMirror::applySorting(NodeId parent, std::vector<NodeId>& children) const
+{
+  if(parent == INVALID_NODE || children.empty())
+  {
+    return;
+  }
+
+  if(mNodes[parent].collectionContainer)
+  {
+    std::sort(children.begin(), children.end(), [this](NodeId lhs, NodeId rhs)
+    {
+      auto& l = mNodes[lhs];
+      auto& r = mNodes[rhs];
+      if(l.hasCollectionIndex && r.hasCollectionIndex)
+      {
+        return l.collectionIndexValid && r.collectionIndexValid && l.collectionIndex < r.collectionIndex;
+      }
+      return l.hasCollectionIndex;
+    });
+    return;
+  }
+
+  // Top-left to bottom-right: sort by y, split into lines, sort lines by x
+  std::sort(children.begin(), children.end(), [this](NodeId lhs, NodeId rhs)
+  {
+    return mNodes[lhs].extents.y < mNodes[rhs].extents.y;
+  });
+
+  auto first = std::find_if(children.begin(), children.end(), [this](NodeId id) { return !isZeroSize(id); });
+  if(first == children.end())
+  {
+    children.clear();
+    return;
+  }
+
+  std::vector<std::vector<NodeId>> lines(1);
+  Rect<float>                      lineRect = mNodes[*first].extents;
+  for(auto it = first; it != children.end(); ++it)
+  {
+    auto& rect = mNodes[*it].extents;
+    if(EqualsZero(rect.height) || EqualsZero(rect.width))
+    {
+      continue;
+    }
+
+    if(lineRect.y + (0.5 * lineRect.height) >= rect.y + (0.5 * rect.height))
+    {
+      lines.back().push_back(*it);
+    }
+    else
+    {
+      lineRect = rect;
+      lines.emplace_back();
+      lines.back().push_back(*it);
+    }
+  }
+
+  std::vector<NodeId> sorted;
+  for(auto& line : lines)
+  {
+    std::sort(line.begin(), line.end(), [this](NodeId lhs, NodeId rhs)
+    {
+      return mNodes[lhs].extents.x < mNodes[rhs].extents.x;
+    });
+    sorted.insert(sorted.end(), line.begin(), line.end());
+  }
+  children = std::move(sorted);
+}
+
+WindowMirror::NodeId WindowMirror::findNonDefunctChild(const std::vector<NodeId>& children, unsigned int index, bool forward, NodeId start) const
+{
+  unsigned int count = children.size();
+  for(; index < count; forward ? ++index : --index)
+  {
+    auto child = children[index];
+    if(!mNodes[child].states[State::DEFUNCT] && isChildVisibleInScrollableParent(start, child))
+    {
+      return child;
+    }
+  }
+  return INVALID_NODE;
+}
+
+WindowMirror::NodeId WindowMirror::findNonDefunctChildDepthFirst(NodeId node, const std::vector<NodeId>& children, bool forward, NodeId start) const
+{
+  if(node == INVALID_NODE || children.empty())
+  {
+    return INVALID_NODE;
+  }
+
+  auto& states    = mNodes[node].states;
+  bool  isShowing = getScrollableParent(node) == INVALID_NODE ? states[State::SHOWING] : states[State::VISIBLE];
+  if(!isShowing)
+  {
+    return INVALID_NODE;
+  }
+  return findNonDefunctChild(children, forward ? 0 : children.size() - 1, forward, start);
+}
+
+WindowMirror::NodeId WindowMirror::getNextNonDefunctSibling(NodeId node, NodeId start, bool forward) const
+{
+  if(node == INVALID_NODE)
+  {
+    return INVALID_NODE;
+  }
+
+  auto parent = mNodes[node].parent;
+  if(parent == INVALID_NODE)
+  {
+    return INVALID_NODE;
+  }
+  if(mNodes[parent].embedded)
+  {
+    return parent;
+  }
+
+  auto children = getValidChildren(mNodes[parent].children, start);
+  applySorting(parent, children);
+
+  unsigned int count   = children.size();
+  unsigned int current = 0;
+  for(; current < count && children[current] != node; ++current)
+  {
+  }
+  if(current >= count)
+  {
+    return INVALID_NODE;
+  }
+
+  forward ? ++current : --current;
+  return findNonDefunctChild(children, current, forward, start);
+}
+
+WindowMirror::NodeId WindowMirror::findNonDefunctSibling(bool& areAllChildrenVisited, NodeId node, NodeId start, NodeId root, bool forward) const
+{
+  while(true)
+  {
+    auto sibling = getNextNonDefunctSibling(node, start, forward);
+    if(sibling != INVALID_NODE)
+    {
+      node                  = sibling;
+      areAllChildrenVisited = false;
+      break;
+    }
+
+    node = mNodes[node].parent;
+    if(node == INVALID_NODE || node == root)
+    {
+      return INVALID_NODE;
+    }
+
+    // in backward traversing stop the walk up on parent
+    if(!forward)
+    {
+      break;
+    }
+  }
+  return node;
+}
+
+WindowMirror::NodeId WindowMirror::calculateNeighbor(NodeId root, NodeId start, bool forward, NeighborSearchMode searchMode) const
+{
+  if(root != INVALID_NODE && mNodes[root].states[State::DEFUNCT])
+  {
+    return INVALID_NODE;
+  }
+  if(start != INVALID_NODE && mNodes[start].states[State::DEFUNCT])
+  {
+    start   = INVALID_NODE;
+    forward = true;
+  }
+
+  if(searchMode == NeighborSearchMode::RECURSE_TO_OUTSIDE)
+  {
+    searchMode = NeighborSearchMode::CONTINUE_AFTER_FAILED_RECURSION;
+  }
+
+  NodeId node = start != INVALID_NODE ? start : root;
+  if(node == INVALID_NODE)
+  {
+    return INVALID_NODE;
+  }
+
+  bool areAllChildrenVisited = (start != root) && (searchMode != NeighborSearchMode::RECURSE_FROM_ROOT && !forward);
+  bool forceNext             = (searchMode == NeighborSearchMode::CONTINUE_AFTER_FAILED_RECURSION);
+
+  CycleDetection<NodeId> cycleDetection(node);
+  while(node != INVALID_NODE)
+  {
+    auto& current = mNodes[node];
+    if(current.states[State::DEFUNCT])
+    {
+      return INVALID_NODE;
+    }
+
+    // always accept proxy object from different world
+    if(!forceNext && current.embedded)
+    {
+      return node;
+    }
+
+    auto children = getValidChildren(current.children, start);
+    applySorting(node, children);
+
+    bool areAllChildrenVisitedOrMovingForward = (children.empty() || forward || areAllChildrenVisited);
+    if(!forceNext && node != start && areAllChildrenVisitedOrMovingForward && isAcceptable(node) && isChildVisibleInScrollableParent(start, node))
+    {
+      if(start == INVALID_NODE || (current.role != Role::POPUP_MENU && current.role != Role::DIALOG))
+      {
+        return node;
+      }
+    }
+
+    NodeId nextRelated = INVALID_NODE;
+    if(!forceNext)
+    {
+      if(forward ? current.flowsToUnresolved : current.flowsFromUnresolved)
+      {
+        // The bridge would leave the window here; let it answer
+        mDeclined = true;
+        return INVALID_NODE;
+      }
+      nextRelated = forward ? current.flowsTo : current.flowsFrom;
+    }
+
+    bool wantCycleDetection = false;
+    if(nextRelated != INVALID_NODE)
+    {
+      node               = nextRelated;
+      wantCycleDetection = true;
+    }
+    else
+    {
+      auto child = !forceNext && !areAllChildrenVisited ? findNonDefunctChildDepthFirst(node, children, forward, start) : INVALID_NODE;
+      if(child != INVALID_NODE)
+      {
+        wantCycleDetection = true;
+      }
+      else
+      {
+        if(!forceNext && node == root)
+        {
+          return INVALID_NODE;
+        }
+        areAllChildrenVisited = true;
+        child                 = findNonDefunctSibling(areAllChildrenVisited, node, start, root, forward);
+      }
+      node = child;
+    }
+
+    forceNext = false;
+    if(wantCycleDetection && cycleDetection.Check(node))
+    {
+      return INVALID_NODE;
+    }
+  }
+  return INVALID_NODE;
+}
+
+} // namespace Accessibility
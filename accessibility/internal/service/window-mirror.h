@@ -0,0 +1,258 @@
+#ifndef ACCESSIBILITY_INTERNAL_SERVICE_WINDOW_MIRROR_H
+#define ACCESSIBILITY_INTERNAL_SERVICE_WINDOW_MIRROR_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/accessibility-event.h>
+#include <accessibility/api/node-proxy.h>
+#include <accessibility/internal/service/event-route-table.h>
+
+namespace Accessibility
+{
+/**
+ * @brief A neighbor the mirror computed differently from the bridge.
+ */
+struct NeighborMismatch
+{
+  Address start;
+  bool    forward{true};
+  Address mirrored; ///< Neighbor computed by WindowMirror
+  Address remote;   ///< Neighbor returned by the bridge's GetNeighbor
+};
+
+/**
+ * @brief Local copy of a window's subtree for client-side navigation.
+ *
+ * load() fetches role, states, attributes, window extents, relations and
+ * children for every node once. findNeighbor() then runs the same ordering
+ * rules as BridgeAccessible::CalculateNeighbor (top-left line splitting,
+ * collection index sorting, FLOWS_TO/FLOWS_FROM, scrollable-parent clipping)
+ * without IPC.
+ *
+ * applyEvent() keeps the copy current without IPC. Events from objects
+ * outside the copy are ignored. State changes are applied in place. Role
+ * and bounds changes mark the node dirty; the owner refetches it with
+ * fetchNode() and applies the result with refreshNode(). Changes below one
+ * node (children, scrolling, reparenting) mark that node's subtree dirty;
+ * the owner refetches it with loadSubtree() and splices it in with
+ * replaceSubtree(). Only window changes mark the whole copy stale. The copy
+ * declines to answer while anything is dirty or stale.
+ *
+ * Embedded content from other processes (children on a different bus) is
+ * not mirrored; like the bridge, the walk returns the embedding node itself.
+ *
+ * Not thread-safe; the owner serializes access.
+ */
+class WindowMirror
+{
+public:
+  /**
+   * @brief Fresh properties of a node marked dirty by a role or bounds change.
+   */
+  struct NodeRefresh
+  {
+    Address     address;
+    Role        role{Role::UNKNOWN};
+    Rect<float> extents;
+  };
+
+  /**
+   * @brief Loads the subtree rooted at window, replacing any previous copy.
+   *
+   * @param[in] window The window to mirror
+   * @return false if window is null
+   */
+  bool load(const std::shared_ptr<NodeProxy>& window);
+
+  /**
+   * @brief Returns true once load() has succeeded.
+   */
+  bool isLoaded() const;
+
+  /**
+   * @brief Loads the subtree rooted at root, for use with replaceSubtree().
+   *
+   * @param[in] root The subtree root
+   * @param[in] windowBus The bus of the mirrored window; nodes on other buses are not descended into
+   * @return false if root is null
+   */
+  bool loadSubtree(const std::shared_ptr<NodeProxy>& root, const std::string& windowBus);
+
+  /**
+   * @brief Replaces a mirrored node and its descendants with a fresh copy.
+   *
+   * @param[in] subtree A copy made by loadSubtree()
+   * @return false if the subtree root is no longer mirrored
+   */
+  bool replaceSubtree(WindowMirror subtree);
+
+  /**
+   * @brief Returns true if an event made the whole copy unreliable.
+   */
+  bool isStale() const;
+
+  /**
+   * @brief Returns true if the copy is stale or has dirty nodes or subtrees.
+   */
+  bool needsRefresh() const;
+
+  /**
+   * @brief Returns the roots of the dirty subtrees, outermost only.
+   */
+  std::vector<std::shared_ptr<NodeProxy>> getDirtySubtrees() const;
+
+  /**
+   * @brief Returns the nodes whose role or bounds changed.
+   */
+  std::vector<std::shared_ptr<NodeProxy>> getDirtyNodes() const;
+
+  /**
+   * @brief Fetches the properties refreshNode() applies; costs IPC.
+   *
+   * @param[in] proxy A node returned by getDirtyNodes()
+   */
+  static NodeRefresh fetchNode(const std::shared_ptr<NodeProxy>& proxy);
+
+  /**
+   * @brief Applies properties fetched by fetchNode() and clears the node's dirty mark.
+   *
+   * @return false if the node is no longer mirrored
+   */
+  bool refreshNode(const NodeRefresh& refresh);
+
+  /**
+   * @brief Marks the copy stale.
+   */
+  void invalidate();
+
+  /**
+   * @brief Returns the address of the mirrored window.
+   */
+  const Address& getWindowAddress() const;
+
+  /**
+   * @brief Returns the number of mirrored nodes.
+   */
+  std::size_t getNodeCount() const;
+
+  /**
+   * @brief Updates the copy from an accessibility event, without IPC.
+   *
+   * @return true if the event changed the copy, or marked it dirty or stale
+   */
+  bool applyEvent(const AccessibilityEvent& event);
+
+  /**
+   * @brief Computes the neighbor of start within the mirrored window.
+   *
+   * @param[in] start The node to start from; an empty Address starts from the window
+   * @param[in] forward The navigation direction
+   * @param[in] searchMode The bridge search mode to emulate
+   * @param[out] neighbor The neighbor, or nullptr if there is none
+   * @return false if the mirror cannot answer (not loaded, in need of a
+   *         refresh, start not mirrored, or the walk follows a relation out
+   *         of the window)
+   */
+  bool findNeighbor(const Address& start, bool forward, NeighborSearchMode searchMode, std::shared_ptr<NodeProxy>& neighbor);
+
+  /**
+   * @brief Compares findNeighbor() against the bridge for every mirrored node.
+   *
+   * Costs two GetNeighbor round trips per node; intended for diagnostics.
+   *
+   * @param[in] window The mirrored window, passed as root to GetNeighbor
+   * @return The neighbors that differ
+   */
+  std::vector<NeighborMismatch> verify(const std::shared_ptr<NodeProxy>& window);
+
+private:
+  using NodeId = uint32_t;
+
+  static constexpr NodeId INVALID_NODE = UINT32_MAX;
+
+  struct Node
+  {
+    std::shared_ptr<NodeProxy> proxy;
+    Address                    address;
+    Role                       role{Role::UNKNOWN};
+    States                     states;
+    Rect<float>                extents;
+    NodeId                     parent{INVALID_NODE};
+    std::vector<NodeId>        children;
+    Address                    flowsToTarget;   ///< First FLOWS_TO target, if hasFlowsTo
+    Address                    flowsFromTarget; ///< First FLOWS_FROM target, if hasFlowsFrom
+    bool                       hasFlowsTo{false};
+    bool                       hasFlowsFrom{false};
+    NodeId                     flowsTo{INVALID_NODE};
+    NodeId                     flowsFrom{INVALID_NODE};
+    bool                       flowsToUnresolved{false};   ///< The FLOWS_TO target is outside the mirror
+    bool                       flowsFromUnresolved{false}; ///< The FLOWS_FROM target is outside the mirror
+    bool                       controlledBy{false};
+    bool                       scrollable{false};
+    bool                       embedded{false}; ///< On another bus; contents not mirrored
+    bool                       collectionContainer{false};
+    bool                       hasCollectionIndex{false};
+    bool                       collectionIndexValid{false};
+    int                        collectionIndex{0};
+    bool                       dirty{false}; ///< Role or bounds changed since the fetch
+    bool                       subtreeDirty{false};
+    bool                       removed{false}; ///< Dropped by replaceSubtree(); reclaimed by compact()
+  };
+
+  void fetch(const std::shared_ptr<NodeProxy>& root, const std::string& windowBus);
+  void resolveRelations();
+  void markSubtreeDirty(NodeId id);
+  void removeNode(NodeId id);
+  void compact();
+  void markDirty(NodeId id);
+
+  NodeId getScrollableParent(NodeId id) const;
+  std::vector<NodeId> getScrollableParents(NodeId id) const;
+  bool isZeroSize(NodeId id) const;
+  bool isVisibleInScrollableParent(NodeId id) const;
+  bool isChildVisibleInScrollableParent(NodeId start, NodeId id) const;
+  bool isAcceptable(NodeId id) const;
+  std::vector<NodeId> getValidChildren(const std::vector<NodeId>& children, NodeId start) const;
+  void applySorting(NodeId parent, std::vector<NodeId>& children) const;
+  NodeId findNonDefunctChild(const std::vector<NodeId>& children, unsigned int index, bool forward, NodeId start) const;
+  NodeId findNonDefunctChildDepthFirst(NodeId node, const std::vector<NodeId>& children, bool forward, NodeId start) const;
+  NodeId getNextNonDefunctSibling(NodeId node, NodeId start, bool forward) const;
+  NodeId findNonDefunctSibling(bool& areAllChildrenVisited, NodeId node, NodeId start, NodeId root, bool forward) const;
+  NodeId calculateNeighbor(NodeId root, NodeId start, bool forward, NeighborSearchMode searchMode) const;
+
+  std::vector<Node>                                    mNodes;
+  std::unordered_map<Address, NodeId, AddressPathHash> mIndex;
+  std::size_t                                          mDirtySubtrees{0};
+  std::size_t                                          mDirtyNodes{0};
+  std::size_t                                          mRemovedNodes{0};
+  bool                                                 mStale{false};
+  mutable bool                                         mDeclined{false};
+};
+
+} // namespace Accessibility
+
+#endif // ACCESSIBILITY_INTERNAL_SERVICE_WINDOW_MIRROR_H
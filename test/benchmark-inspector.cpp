@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/accessibility.h>
+#include <tools/inspector/node-store.h>
+
+using namespace Accessibility;
+using namespace InspectorEngine;
+
+namespace
+{
+constexpr uint32_t NODE_COUNT = 100000;
+
+/**
+ * @brief An element laid out like NodeProxyQueryEngine's published snapshot entries.
+ */
+struct MapElement
+{
+  uint32_t              id;
+  std::shared_ptr<void> proxy;
+  std::string           bus;
+  std::string           path;
+  std::string           name;
+  std::string           role;
+  std::string           description;
+  std::string           automationId;
+  States                states;
+  float                 boundsX{0.0f};
+  float                 boundsY{0.0f};
+  float                 boundsWidth{0.0f};
+  float                 boundsHeight{0.0f};
+  int                   childCount{0};
+  std::vector<uint32_t> childIds;
+  uint32_t              parentId{0};
+};
+
+using ElementMap = std::unordered_map<uint32_t, std::shared_ptr<const MapElement>>;
+
+/**
+ * @brief Runs body iterations times and prints the mean time per iteration.
+ */
+void Measure(const char* name, int iterations, const std::function<void()>& body)
+{
+  auto start = std::chrono::steady_clock::now();
+  for(int i = 0; i < iterations; ++i)
+  {
+    body();
+  }
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  printf("%-48s %10.0f ns/op  (%d ops)\n", name, static_cast<double>(elapsed.count()) / iterations, iterations);
+}
+
+/**
+ * @brief A 1080x1920 screen of nested rows; about a third of the nodes are off screen.
+ */
+std::vector<MapElement> MakeElements()
+{
+  static const char* ROLES[] = {"PUSH_BUTTON", "LABEL", "IMAGE", "LIST_ITEM", "PANEL", "CHECK_BOX", "ENTRY", "SCROLL_PANE"};
+
+  std::vector<MapElement> elements(NODE_COUNT);
+  uint32_t                seed = 12345;
+  auto                    next = [&seed]() {
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 8;
+  };
+  for(uint32_t i = 0; i < NODE_COUNT; ++i)
+  {
+    auto& elem        = elements[i];
+    elem.id           = i + 1;
+    elem.bus          = ":1.42";
+    elem.path         = "/org/a11y/atspi/accessible/" + std::to_string(elem.id);
+    elem.role         = ROLES[next() % 8];
+    elem.name         = "Item " + std::to_string(next() % 5000);
+    elem.parentId     = i / 8;
+    elem.boundsX      = static_cast<float>(next() % 1080);
+    elem.boundsY      = static_cast<float>(next() % 5760) - 1920.0f;
+    elem.boundsWidth  = static_cast<float>(20 + next() % 400);
+    elem.boundsHeight = static_cast<float>(20 + next() % 200);
+    elem.states[State::ENABLED] = true;
+    elem.states[State::VISIBLE] = next() % 4 != 0;
+    elem.states[State::SHOWING] = elem.boundsY + elem.boundsHeight > 0.0f && elem.boundsY < 1920.0f;
+    elem.states[State::HIGHLIGHTABLE] = next() % 3 != 0;
+  }
+  return elements;
+}
+
+// ========================================================================
+// "Visible, highlightable and intersecting R": element map vs. NodeStore
+// ========================================================================
+void BenchmarkAreaFilter()
+{
+  printf("\n--- Area filter over %u nodes ---\n", NODE_COUNT);
+
+  auto       elements = MakeElements();
+  ElementMap map;
+  NodeStore  store;
+  map.reserve(elements.size());
+  for(auto& elem : elements)
+  {
+    map.emplace(elem.id, std::make_shared<const MapElement>(elem));
+
+    NodeStore::Node node;
+    node.id          = elem.id;
+    node.parentId    = elem.parentId;
+    node.role        = elem.role;
+    node.name        = elem.name;
+    node.description = elem.description;
+    node.states      = elem.states.GetRawData64();
+    node.x           = elem.boundsX;
+    node.y           = elem.boundsY;
+    node.width       = elem.boundsWidth;
+    node.height      = elem.boundsHeight;
+    store.Upsert(node);
+  }
+  printf("%-48s %10zu\n", "interned strings", store.GetStringCount());
+
+  const float areaX = 200.0f, areaY = 600.0f, areaWidth = 400.0f, areaHeight = 300.0f;
+
+  States required;
+  required[State::VISIBLE]       = true;
+  required[State::HIGHLIGHTABLE] = true;
+
+  size_t mapMatches = 0;
+  Measure("element map scan", 50, [&]() {
+    std::vector<uint32_t> ids;
+    for(auto& [id, elem] : map)
+    {
+      if((elem->states & required) == required && elem->boundsX < areaX + areaWidth &&
+         elem->boundsX + elem->boundsWidth > areaX && elem->boundsY < areaY + areaHeight &&
+         elem->boundsY + elem->boundsHeight > areaY)
+      {
+        ids.push_back(id);
+      }
+    }
+    std::sort(ids.begin(), ids.end());
+    mapMatches = ids.size();
+  });
+
+  NodeStore::Filter filter;
+  filter.requiredStates = required.GetRawData64();
+  filter.intersects     = true;
+  filter.x              = areaX;
+  filter.y              = areaY;
+  filter.width          = areaWidth;
+  filter.height         = areaHeight;
+
+  size_t storeMatches = 0;
+  Measure("NodeStore::Select", 50, [&]() { storeMatches = store.Select(filter).size(); });
+
+  filter.role = "PUSH_BUTTON";
+  Measure("NodeStore::Select with role", 50, [&]() { store.Select(filter); });
+
+  printf("%-48s %10zu / %zu\n", "matches (map / store)", mapMatches, storeMatches);
+  if(mapMatches != storeMatches)
+  {
+    printf("MISMATCH\n");
+    exit(EXIT_FAILURE);
+  }
+}
+
+// ========================================================================
+// Keeping the columns current: the per-publish update cost
+// ========================================================================
+void BenchmarkUpsert()
+{
+  printf("\n--- NodeStore updates ---\n");
+
+  auto      elements = MakeElements();
+  NodeStore store;
+  auto      toNode = [](const MapElement& elem) {
+    NodeStore::Node node;
+    node.id     = elem.id;
+    node.role   = elem.role;
+    node.name   = elem.name;
+    node.states = elem.states.GetRawData64();
+    node.x      = elem.boundsX;
+    node.y      = elem.boundsY;
+    node.width  = elem.boundsWidth;
+    node.height = elem.boundsHeight;
+    return node;
+  };
+
+  Measure("insert 100k nodes", 5, [&]() {
+    store.Clear();
+    for(auto& elem : elements)
+    {
+      store.Upsert(toNode(elem));
+    }
+  });
+
+  size_t next = 0;
+  Measure("update one node", 100000, [&]() {
+    auto node = toNode(elements[next++ % elements.size()]);
+    node.y += 1.0f;
+    store.Upsert(node);
+  });
+}
+
+} // namespace
+
+int main()
+{
+  printf("=== Inspector Benchmarks ===\n");
+
+  BenchmarkAreaFilter();
+  BenchmarkUpsert();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,535 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/reading-composer.h>
+#include <accessibility/api/screen-reader-service.h>
+#include <accessibility/api/tts-engine.h>
+#include <accessibility/internal/service/screen-reader/stub/stub-direct-reading-service.h>
+#include <accessibility/internal/service/screen-reader/symbol-table.h>
+#include <accessibility/internal/service/screen-reader/tts-command-queue.h>
+#include <test/mock/mock-app-registry.h>
+#include <test/mock/mock-feedback-provider.h>
+#include <test/mock/mock-gesture-provider.h>
+#include <test/mock/mock-screen-reader-switch.h>
+#include <test/mock/mock-settings-provider.h>
+#include <test/mock/simulated-tts-engine.h>
+
+using namespace Accessibility;
+
+namespace
+{
+/**
+ * @brief TtsEngine that only counts, so the benchmark measures the queue.
+ */
+class CountingTtsEngine : public TtsEngine
+{
+public:
+  CommandId speak(const std::string& text, const SpeakOptions&) override
+  {
+    mSpokenBytes += text.size();
+    return ++mNextId;
+  }
+  void stop() override { ++mStops; }
+  bool pause() override { return true; }
+  bool resume() override { return true; }
+  bool isPaused() const override { return false; }
+  void purge(bool) override {}
+  void onUtteranceStarted(std::function<void(CommandId)>) override {}
+  void onUtteranceCompleted(std::function<void(CommandId)> callback) override { mCompleted = std::move(callback); }
+
+  void complete() { if(mCompleted) mCompleted(mNextId); }
+
+  CommandId                      mNextId{0};
+  uint64_t                       mSpokenBytes{0};
+  uint64_t                       mStops{0};
+  std::function<void(CommandId)> mCompleted;
+};
+
+/**
+ * @brief Runs body iterations times and prints the mean time per iteration.
+ */
+void Measure(const char* name, int iterations, const std::function<void()>& body)
+{
+  auto start = std::chrono::steady_clock::now();
+  for(int i = 0; i < iterations; ++i)
+  {
+    body();
+  }
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  printf("%-48s %10.0f ns/op  (%d ops)\n", name, static_cast<double>(elapsed.count()) / iterations, iterations);
+}
+
+std::string MakeLiveRegionText(size_t size)
+{
+  static const std::string WORDS[] = {"download", "progress", "updated", "file", "received", "of", "megabytes,", "remaining."};
+  std::string text;
+  for(size_t i = 0; text.size() < size; ++i)
+  {
+    text += WORDS[i % 8];
+    text += ' ';
+  }
+  return text;
+}
+
+// ========================================================================
+// TtsCommandQueue: long live-region text interleaved with rapid flicks
+// ========================================================================
+void BenchmarkTtsCommandQueue()
+{
+  printf("\n--- TtsCommandQueue ---\n");
+
+  const auto liveText = MakeLiveRegionText(64 * 1024);
+
+  {
+    CountingTtsEngine engine;
+    TtsCommandQueue   queue(engine);
+    Measure("enqueue 64 KiB live region", 2000, [&]() { queue.enqueue(liveText, TtsCommandQueue::Priority::NORMAL); });
+    queue.purgeAll();
+  }
+
+  {
+    // Each live-region update is immediately interrupted by a flick
+    CountingTtsEngine engine;
+    TtsCommandQueue   queue(engine);
+    Measure("live region update + interrupting flick", 20000, [&]() {
+      queue.enqueue(liveText, TtsCommandQueue::Priority::NORMAL);
+      queue.enqueue("Button, Settings, double tap to activate", true, true);
+      engine.complete();
+    });
+  }
+
+  {
+    // Important live region keeps playing chunk by chunk under a stream of flicks
+    CountingTtsEngine engine;
+    TtsCommandQueue   queue(engine);
+    queue.enqueue(liveText, TtsCommandQueue::Priority::IMPORTANT);
+    Measure("flick while important live region queued", 20000, [&]() {
+      queue.enqueue("Item, list, 3 of 20", true, true);
+      engine.complete();
+    });
+  }
+
+  {
+    size_t chunks = 0;
+    Measure("chunkText 64 KiB (eager copies)", 500, [&]() { chunks += TtsCommandQueue::chunkText(liveText, 300).size(); });
+    Measure("nextChunk 64 KiB (offset ranges)", 500, [&]() {
+      size_t offset = 0;
+      while(offset < liveText.size())
+      {
+        TtsCommandQueue::nextChunk(liveText, offset, 300);
+        ++chunks;
+      }
+    });
+    if(chunks == 0)
+    {
+      printf("unexpected: no chunks\n");
+    }
+  }
+}
+
+// ========================================================================
+// ReadingComposer: mobile and TV templates, cold and warm
+// ========================================================================
+std::vector<ReadingMaterial> MakeListItems(size_t count)
+{
+  std::vector<ReadingMaterial> items(count);
+  for(size_t i = 0; i < count; ++i)
+  {
+    auto& rm                    = items[i];
+    rm.name                     = "Contact " + std::to_string(i);
+    rm.description              = "Last called yesterday";
+    rm.role                     = (i % 3 == 0) ? Role::CHECK_BOX : Role::LIST_ITEM;
+    rm.states[State::ENABLED]   = true;
+    rm.states[State::CHECKABLE] = (i % 3 == 0);
+    rm.states[State::CHECKED]   = (i % 6 == 0);
+  }
+  return items;
+}
+
+void BenchmarkReadingComposer()
+{
+  printf("\n--- ReadingComposer ---\n");
+
+  // More distinct nodes than cache entries, so every compose renders
+  const auto items = MakeListItems(64);
+
+  const std::pair<const char*, ReadingComposerConfig> configs[] = {
+    {"mobile", ReadingComposerConfig{}},
+    {"tv", ReadingComposerConfig{true, true}},
+  };
+
+  for(auto& [label, config] : configs)
+  {
+    ReadingComposer composer(config);
+    size_t          bytes = 0;
+    size_t          i     = 0;
+    std::string     name;
+
+    name = std::string(label) + ": compose, distinct nodes";
+    Measure(name.c_str(), 200000, [&]() { bytes += composer.compose(items[i++ % items.size()]).size(); });
+
+    name = std::string(label) + ": compose, same node";
+    Measure(name.c_str(), 200000, [&]() { bytes += composer.compose(items[0]).size(); });
+
+    std::string buffer;
+    name = std::string(label) + ": composeInto, distinct nodes";
+    Measure(name.c_str(), 200000, [&]() {
+      composer.composeInto(items[i++ % items.size()], buffer);
+      bytes += buffer.size();
+    });
+
+    name = std::string(label) + ": composeInto, same node";
+    Measure(name.c_str(), 200000, [&]() {
+      composer.composeInto(items[0], buffer);
+      bytes += buffer.size();
+    });
+
+    auto stats = composer.getStats();
+    printf("%-48s %10llu hits, %llu misses (%zu bytes)\n", label, static_cast<unsigned long long>(stats.hits), static_cast<unsigned long long>(stats.misses), bytes);
+  }
+}
+
+// ========================================================================
+// SymbolTable: punctuation-verbose reading of a long text
+// ========================================================================
+void BenchmarkSymbolExpansion()
+{
+  printf("\n--- SymbolTable ---\n");
+
+  std::string text;
+  while(text.size() < 16 * 1024)
+  {
+    text += "Mail user@example.com (re: \xE2\x80\x9Cinvoice #42\xE2\x80\x9D) \xE2\x80\x94 total \xE2\x82\xAC""19.99; thanks! ";
+  }
+
+  auto        table = SymbolTable::getDefault();
+  std::string out;
+
+  Measure("lookup per code point, 16 KiB", 200, [&]() {
+    out.clear();
+    for(size_t i = 0; i < text.size();)
+    {
+      auto   lead   = static_cast<unsigned char>(text[i]);
+      size_t length = lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+      auto   spoken = SymbolTable::lookup(std::string_view(text).substr(i, length));
+      if(spoken.empty() || text[i] == ' ')
+      {
+        out.append(text, i, length);
+      }
+      else
+      {
+        out += ' ';
+        out += spoken;
+        out += ' ';
+      }
+      i += length;
+    }
+  });
+
+  Measure("expand single pass, 16 KiB", 200, [&]() {
+    out.clear();
+    table->expand(text, out);
+  });
+
+  Measure("expand single pass with whitespace, 16 KiB", 200, [&]() {
+    out.clear();
+    table->expand(text, out, true);
+  });
+}
+
+// ========================================================================
+// Simulated timelines (virtual clock, no audio hardware)
+// ========================================================================
+using std::chrono::milliseconds;
+using Time = SimulatedTtsEngine::Time;
+
+/**
+ * @brief A scripted action at a simulated time.
+ */
+struct Step
+{
+  Time                  at;
+  std::function<void()> action;
+};
+
+/**
+ * @brief Gesture-to-first-audio latency and queue depth of one timeline.
+ */
+struct TimelineReport
+{
+  std::vector<double> latenciesMs;   ///< Per gesture that got audio
+  int                 superseded{0}; ///< Gestures whose speech never started
+  std::vector<int>    depthPerSecond; ///< Maximum queue depth in each second
+  double              meanDepth{0.0};
+};
+
+double Percentile(std::vector<double> values, double fraction)
+{
+  if(values.empty())
+  {
+    return 0.0;
+  }
+  std::sort(values.begin(), values.end());
+  return values[static_cast<size_t>(fraction * (values.size() - 1))];
+}
+
+void PrintReport(const char* name, const TimelineReport& report)
+{
+  printf("%-40s first audio p50 %6.1f ms  p95 %6.1f ms  max %6.1f ms  (%zu spoken, %d superseded)\n",
+         name,
+         Percentile(report.latenciesMs, 0.5),
+         Percentile(report.latenciesMs, 0.95),
+         Percentile(report.latenciesMs, 1.0),
+         report.latenciesMs.size(),
+         report.superseded);
+  printf("%-40s queue depth mean %.2f, max per second:", "", report.meanDepth);
+  for(auto depth : report.depthPerSecond)
+  {
+    printf(" %d", depth);
+  }
+  printf("\n");
+}
+
+/**
+ * @brief Runs steps in time order, sampling depth() every 50 ms until end.
+ */
+void RunTimeline(SimulatedTtsEngine& engine, std::vector<Step> steps, Time end, const std::function<size_t()>& depth, TimelineReport& report)
+{
+  std::stable_sort(steps.begin(), steps.end(), [](const Step& a, const Step& b) { return a.at < b.at; });
+
+  const Time sampleInterval = milliseconds(50);
+  size_t     next           = 0;
+  size_t     samples        = 0;
+  double     depthSum       = 0.0;
+  for(Time now = Time(0); now <= end; now += sampleInterval)
+  {
+    while(next < steps.size() && steps[next].at <= now)
+    {
+      engine.advanceTo(steps[next].at);
+      steps[next++].action();
+    }
+    engine.advanceTo(now);
+
+    auto   current = static_cast<int>(depth());
+    size_t second  = static_cast<size_t>(std::chrono::duration_cast<std::chrono::seconds>(now).count());
+    if(report.depthPerSecond.size() <= second)
+    {
+      report.depthPerSecond.resize(second + 1, 0);
+    }
+    report.depthPerSecond[second] = std::max(report.depthPerSecond[second], current);
+    depthSum += current;
+    ++samples;
+  }
+  report.meanDepth = samples ? depthSum / samples : 0.0;
+}
+
+/**
+ * @brief ScreenReaderService on a simulated engine, with the demo tree.
+ */
+struct SimulatedScreenReader
+{
+  SimulatedTtsEngine*                  engine{nullptr};
+  MockGestureProvider*                 gestures{nullptr};
+  std::unique_ptr<ScreenReaderService> service;
+  std::vector<std::pair<Time, CommandId>> gestureSpeech; ///< First command each gesture spoke
+  int                                  silentGestures{0};
+
+  explicit SimulatedScreenReader(SimulatedTtsEngine::Config config)
+  {
+    auto tts      = std::make_unique<SimulatedTtsEngine>(config);
+    auto gesture  = std::make_unique<MockGestureProvider>();
+    engine        = tts.get();
+    gestures      = gesture.get();
+    service       = std::make_unique<ScreenReaderService>(std::make_unique<MockAppRegistry>(),
+                                                    std::move(gesture),
+                                                    std::move(tts),
+                                                    std::make_unique<MockFeedbackProvider>(),
+                                                    std::make_unique<MockSettingsProvider>(),
+                                                    std::make_unique<MockScreenReaderSwitch>(),
+                                                    std::make_unique<StubDirectReadingService>());
+    service->startScreenReader();
+  }
+
+  void flick(bool forward)
+  {
+    auto        first = engine->getLastCommandId() + 1;
+    GestureInfo gesture;
+    gesture.type = forward ? Gesture::ONE_FINGER_FLICK_RIGHT : Gesture::ONE_FINGER_FLICK_LEFT;
+    gestures->fireGesture(gesture);
+    if(engine->getLastCommandId() >= first)
+    {
+      gestureSpeech.emplace_back(engine->now(), first);
+    }
+    else
+    {
+      ++silentGestures;
+    }
+  }
+
+  void propertyChanged()
+  {
+    auto current = service->getCurrentNode();
+    if(current)
+    {
+      AccessibilityEvent event;
+      event.type   = AccessibilityEvent::Type::PROPERTY_CHANGED;
+      event.source = current->getAddress();
+      service->dispatchEvent(event);
+    }
+  }
+
+  void collect(TimelineReport& report) const
+  {
+    for(auto& [at, id] : gestureSpeech)
+    {
+      auto* record = engine->findRecord(id);
+      if(record && record->startedAt >= Time(0))
+      {
+        report.latenciesMs.push_back(std::chrono::duration<double, std::milli>(record->startedAt - at).count());
+      }
+      else
+      {
+        ++report.superseded;
+      }
+    }
+  }
+};
+
+/**
+ * @brief Flicks back and forth over the demo tree, so every flick lands on a node.
+ */
+std::vector<Step> FlickSteps(SimulatedScreenReader& reader, Time start, Time interval, int count)
+{
+  std::vector<Step> steps;
+  for(int i = 0; i < count; ++i)
+  {
+    bool forward = (i / 4) % 2 == 0;
+    steps.push_back({start + interval * i, [&reader, forward]() { reader.flick(forward); }});
+  }
+  return steps;
+}
+
+void BenchmarkSimulatedTimelines()
+{
+  printf("\n--- Simulated timelines (synthesis 80 +/- 30 ms, 15 chars/s) ---\n");
+
+  SimulatedTtsEngine::Config config;
+  config.synthesisLatency    = milliseconds(80);
+  config.jitter              = milliseconds(30);
+  config.charactersPerSecond = 15.0;
+
+  {
+    SimulatedScreenReader reader(config);
+    TimelineReport        report;
+    RunTimeline(*reader.engine, FlickSteps(reader, Time(0), milliseconds(2000), 16), Time(milliseconds(34000)),
+                [&reader]() { return reader.engine->getQueueDepth(); }, report);
+    reader.collect(report);
+    PrintReport("slow flicks (every 2 s)", report);
+  }
+
+  {
+    SimulatedScreenReader reader(config);
+    TimelineReport        report;
+    RunTimeline(*reader.engine, FlickSteps(reader, Time(0), milliseconds(150), 40), Time(milliseconds(10000)),
+                [&reader]() { return reader.engine->getQueueDepth(); }, report);
+    reader.collect(report);
+    PrintReport("rapid flicks (every 150 ms)", report);
+  }
+
+  {
+    // The highlighted node keeps changing while the user navigates
+    SimulatedScreenReader reader(config);
+    TimelineReport        report;
+    auto                  steps = FlickSteps(reader, Time(0), milliseconds(600), 16);
+    for(Time at = milliseconds(250); at < milliseconds(9600); at += milliseconds(250))
+    {
+      steps.push_back({at, [&reader]() { reader.propertyChanged(); }});
+    }
+    RunTimeline(*reader.engine, std::move(steps), Time(milliseconds(12000)),
+                [&reader]() { return reader.engine->getQueueDepth(); }, report);
+    reader.collect(report);
+    PrintReport("flicks + property changes (250 ms)", report);
+  }
+
+  {
+    // Queue level: polite live region every 3 s, an alert every 10 s,
+    // and a burst of interrupting flicks between 5 s and 8 s
+    SimulatedTtsEngine engine(config);
+    TtsCommandQueue    queue(engine);
+    TimelineReport     report;
+    std::vector<Step>  steps;
+    const auto         liveText = MakeLiveRegionText(600);
+    std::vector<std::pair<Time, CommandId>> flicks;
+    for(Time at = Time(0); at < milliseconds(20000); at += milliseconds(3000))
+    {
+      steps.push_back({at, [&]() { queue.enqueue(liveText, TtsCommandQueue::Priority::NORMAL); }});
+    }
+    for(Time at = milliseconds(1000); at < milliseconds(20000); at += milliseconds(10000))
+    {
+      steps.push_back({at, [&]() { queue.enqueue("Battery low, 10 percent", TtsCommandQueue::Priority::IMPORTANT); }});
+    }
+    for(Time at = milliseconds(5000); at < milliseconds(8000); at += milliseconds(300))
+    {
+      steps.push_back({at, [&]() {
+        auto first = engine.getLastCommandId() + 1;
+        queue.enqueue("Item, list, 3 of 20", true, true);
+        flicks.emplace_back(engine.now(), first);
+      }});
+    }
+    RunTimeline(engine, std::move(steps), Time(milliseconds(24000)),
+                [&]() { return queue.pendingCount() + engine.getQueueDepth(); }, report);
+    for(auto& [at, id] : flicks)
+    {
+      auto* record = engine.findRecord(id);
+      if(record && record->startedAt >= Time(0))
+      {
+        report.latenciesMs.push_back(std::chrono::duration<double, std::milli>(record->startedAt - at).count());
+      }
+      else
+      {
+        ++report.superseded;
+      }
+    }
+    PrintReport("queue: live region + alerts + flicks", report);
+  }
+}
+
+} // namespace
+
+int main()
+{
+  printf("=== Screen Reader Benchmarks ===\n");
+
+  BenchmarkTtsCommandQueue();
+  BenchmarkReadingComposer();
+  BenchmarkSymbolExpansion();
+  BenchmarkSimulatedTimelines();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+#ifndef ACCESSIBILITY_TEST_MOCK_AUDIO_SINK_H
+#define ACCESSIBILITY_TEST_MOCK_AUDIO_SINK_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <memory>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/audio-sink.h>
+
+/**
+ * @brief Mock AudioSink that records enqueued segments for test assertions.
+ */
+class MockAudioSink : public Accessibility::AudioSink
+{
+public:
+  struct Segment
+  {
+    Accessibility::CommandId                         id;
+    std::shared_ptr<const Accessibility::PcmBuffer> pcm;
+    bool                                             discardable;
+    bool                                             last;
+  };
+
+  void enqueue(Accessibility::CommandId id, std::shared_ptr<const Accessibility::PcmBuffer> pcm, bool discardable, bool last) override
+  {
+    mSegments.push_back({id, std::move(pcm), discardable, last});
+  }
+
+  void stop() override { ++mStopCount; }
+
+  void purge(bool onlyDiscardable) override
+  {
+    ++mPurgeCount;
+    mLastPurgeOnlyDiscardable = onlyDiscardable;
+  }
+
+  bool pause() override { mPaused = true; return true; }
+
+  bool resume() override { mPaused = false; return true; }
+
+  bool isPaused() const override { return mPaused; }
+
+  void onUtteranceStarted(std::function<void(Accessibility::CommandId)> callback) override
+  {
+    mStartedCallback = std::move(callback);
+  }
+
+  void onUtteranceCompleted(std::function<void(Accessibility::CommandId)> callback) override
+  {
+    mCompletedCallback = std::move(callback);
+  }
+
+  // Test helpers
+  const std::vector<Segment>& getSegments() const { return mSegments; }
+  int getStopCount() const { return mStopCount; }
+  int getPurgeCount() const { return mPurgeCount; }
+  bool getLastPurgeOnlyDiscardable() const { return mLastPurgeOnlyDiscardable; }
+
+  void fireUtteranceStarted(Accessibility::CommandId id)
+  {
+    if(mStartedCallback) mStartedCallback(id);
+  }
+
+  void fireUtteranceCompleted(Accessibility::CommandId id)
+  {
+    if(mCompletedCallback) mCompletedCallback(id);
+  }
+
+  void reset()
+  {
+    mSegments.clear();
+    mStopCount  = 0;
+    mPurgeCount = 0;
+    mPaused     = false;
+  }
+
+private:
+  std::vector<Segment>                          mSegments;
+  std::function<void(Accessibility::CommandId)> mStartedCallback;
+  std::function<void(Accessibility::CommandId)> mCompletedCallback;
+  int  mStopCount{0};
+  int  mPurgeCount{0};
+  bool mPaused{false};
+  bool mLastPurgeOnlyDiscardable{false};
+};
+
+#endif // ACCESSIBILITY_TEST_MOCK_AUDIO_SINK_H
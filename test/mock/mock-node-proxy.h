@@ -19,6 +19,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <string>
@@ -92,6 +93,11 @@ public:
     return mAccessible ? mAccessible->GetAttributes() : Accessibility::Attributes{};
   }
 
+  bool getAttribute(Accessibility::AttributeKey key, std::string& value) override
+  {
+    return mAccessible && mAccessible->GetAttribute(key, value);
+  }
+
   std::vector<std::string> getInterfaces() override
   {
     return mAccessible ? mAccessible->GetInterfacesAsStrings() : std::vector<std::string>{};
@@ -136,7 +142,19 @@ public:
 
   std::vector<Accessibility::RemoteRelation> getRelationSet() override
   {
-    return {};
+    std::vector<Accessibility::RemoteRelation> result;
+    if(!mAccessible) return result;
+    for(auto& relation : mAccessible->GetRelationSet())
+    {
+      Accessibility::RemoteRelation remote;
+      remote.type = relation.mRelationType;
+      for(auto* target : relation.mTargets)
+      {
+        remote.targets.push_back(target->GetAddress());
+      }
+      result.push_back(std::move(remote));
+    }
+    return result;
   }
 
   std::shared_ptr<Accessibility::NodeProxy> getNeighbor(std::shared_ptr<Accessibility::NodeProxy> root, bool forward, Accessibility::NeighborSearchMode searchMode) override
@@ -223,10 +241,15 @@ public:
       info.name     = mAccessible->GetName();
       info.roleName = mAccessible->GetRoleName();
       info.states   = mAccessible->GetStates();
+      info.attributes = mAccessible->GetAttributes();
       auto ext      = mAccessible->GetExtents(Accessibility::CoordinateType::SCREEN);
       info.screenExtents = Accessibility::Rect<int>{
         static_cast<int>(ext.x), static_cast<int>(ext.y),
         static_cast<int>(ext.width), static_cast<int>(ext.height)};
+      auto windowExt = mAccessible->GetExtents(Accessibility::CoordinateType::WINDOW);
+      info.windowExtents = Accessibility::Rect<int>{
+        static_cast<int>(windowExt.x), static_cast<int>(windowExt.y),
+        static_cast<int>(windowExt.width), static_cast<int>(windowExt.height)};
     }
     return info;
   }
@@ -276,6 +299,11 @@ public:
     return mAccessible ? mAccessible->DoGesture(gesture) : false;
   }
 
+  bool isScrollable() override
+  {
+    return mAccessible ? mAccessible->IsScrollable() : false;
+  }
+
   // --- Action interface ---
 
   int32_t getActionCount() override { return 0; }
@@ -292,9 +320,44 @@ public:
 
   // --- Text interface ---
 
-  std::string getText(int32_t startOffset, int32_t endOffset) override { return ""; }
-  int32_t getCharacterCount() override { return 0; }
-  int32_t getCursorOffset() override { return 0; }
+  std::string getText(int32_t startOffset, int32_t endOffset) override
+  {
+    auto* test = dynamic_cast<TestAccessible*>(mAccessible);
+    if(!test) return "";
+    test->CountTextRequest();
+
+    // Offsets are in characters; step over UTF-8 continuation bytes
+    auto& text     = test->GetText();
+    auto  toByte   = [&text](int32_t offset) {
+      std::size_t byte = 0;
+      for(; byte < text.size() && offset > 0; --offset)
+      {
+        ++byte;
+        while(byte < text.size() && (static_cast<unsigned char>(text[byte]) & 0xC0) == 0x80) ++byte;
+      }
+      return byte;
+    };
+    auto start = toByte(startOffset);
+    auto end   = endOffset < 0 ? text.size() : toByte(endOffset);
+    return start < end ? text.substr(start, end - start) : "";
+  }
+
+  int32_t getCharacterCount() override
+  {
+    auto* test = dynamic_cast<TestAccessible*>(mAccessible);
+    if(!test) return 0;
+    test->CountTextRequest();
+    return static_cast<int32_t>(std::count_if(test->GetText().begin(), test->GetText().end(), [](char c) { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; }));
+  }
+
+  int32_t getCursorOffset() override
+  {
+    auto* test = dynamic_cast<TestAccessible*>(mAccessible);
+    if(!test) return 0;
+    test->CountTextRequest();
+    return test->GetCursorOffset();
+  }
+
   Accessibility::Range getTextAtOffset(int32_t offset, Accessibility::TextBoundary boundary) override { return {}; }
   Accessibility::Range getRangeOfSelection(int32_t selectionIndex) override { return {}; }
 
@@ -33,6 +33,7 @@ class MockSettingsProvider : public Accessibility::SettingsProvider
 public:
   Accessibility::ScreenReaderSettings getSettings() const override
   {
+    ++mGetSettingsCount;
     return mSettings;
   }
 
@@ -52,6 +53,8 @@ public:
   }
 
   // Test helpers
+  int getGetSettingsCount() const { return mGetSettingsCount; }
+
   void setSettings(const Accessibility::ScreenReaderSettings& settings)
   {
     mSettings = settings;
@@ -84,6 +87,7 @@ public:
 
 private:
   Accessibility::ScreenReaderSettings mSettings;
+  mutable int mGetSettingsCount{0};
   std::vector<std::function<void(const Accessibility::ScreenReaderSettings&)>> mSettingsCallbacks;
   std::vector<std::function<void()>> mLanguageCallbacks;
   std::vector<std::function<void(bool)>> mKeyboardCallbacks;
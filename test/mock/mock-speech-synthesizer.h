@@ -0,0 +1,62 @@
+#ifndef ACCESSIBILITY_TEST_MOCK_SPEECH_SYNTHESIZER_H
+#define ACCESSIBILITY_TEST_MOCK_SPEECH_SYNTHESIZER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/speech-synthesizer.h>
+
+/**
+ * @brief Mock SpeechSynthesizer that renders one sample per character.
+ *
+ * Each sample holds the character code, so tests can tell phrases apart in
+ * the rendered audio.
+ */
+class MockSpeechSynthesizer : public Accessibility::SpeechSynthesizer
+{
+public:
+  std::string getVoiceKey() const override { return mVoiceKey; }
+
+  bool synthesize(const std::string& text, Accessibility::PcmBuffer& pcm) override
+  {
+    mSynthesizedTexts.push_back(text);
+    if(mFail) return false;
+    pcm.sampleRate = mSampleRate;
+    pcm.samples.assign(text.begin(), text.end());
+    return true;
+  }
+
+  // Test helpers
+  const std::vector<std::string>& getSynthesizedTexts() const { return mSynthesizedTexts; }
+  void setVoiceKey(const std::string& key) { mVoiceKey = key; }
+  void setSampleRate(uint32_t rate) { mSampleRate = rate; }
+  void setFail(bool fail) { mFail = fail; }
+  void reset() { mSynthesizedTexts.clear(); }
+
+private:
+  std::vector<std::string> mSynthesizedTexts;
+  std::string              mVoiceKey{"default"};
+  uint32_t                 mSampleRate{1000};
+  bool                     mFail{false};
+};
+
+#endif // ACCESSIBILITY_TEST_MOCK_SPEECH_SYNTHESIZER_H
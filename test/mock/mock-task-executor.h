@@ -0,0 +1,64 @@
+#ifndef ACCESSIBILITY_TEST_MOCK_TASK_EXECUTOR_H
+#define ACCESSIBILITY_TEST_MOCK_TASK_EXECUTOR_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <deque>
+#include <functional>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/task-executor.h>
+
+/**
+ * @brief Mock TaskExecutor that holds tasks until the test runs them.
+ *
+ * Lets tests queue several gestures before any of them executes, which is
+ * how a burst of flicks looks to a busy worker thread.
+ */
+class MockTaskExecutor : public Accessibility::TaskExecutor
+{
+public:
+  void post(std::function<void()> task) override
+  {
+    mTasks.push_back(std::move(task));
+  }
+
+  void waitIdle() override
+  {
+    runAll();
+  }
+
+  // Test helpers
+  void runAll()
+  {
+    while(!mTasks.empty())
+    {
+      auto task = std::move(mTasks.front());
+      mTasks.pop_front();
+      task();
+    }
+  }
+
+  size_t getPendingCount() const { return mTasks.size(); }
+
+private:
+  std::deque<std::function<void()>> mTasks;
+};
+
+#endif // ACCESSIBILITY_TEST_MOCK_TASK_EXECUTOR_H
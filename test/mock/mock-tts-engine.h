@@ -64,12 +64,15 @@ public:
     mCompletedCallback = std::move(callback);
   }
 
+  std::size_t getLookahead() const override { return mLookahead; }
+
   // Test helpers
   const std::vector<std::string>& getSpokenTexts() const { return mSpokenTexts; }
   const std::vector<Accessibility::SpeakOptions>& getSpeakOptions() const { return mSpeakOptions; }
   int getStopCount() const { return mStopCount; }
   int getPurgeCount() const { return mPurgeCount; }
   bool getLastPurgeOnlyDiscardable() const { return mLastPurgeOnlyDiscardable; }
+  void setLookahead(std::size_t lookahead) { mLookahead = lookahead; }
 
   void fireUtteranceCompleted(Accessibility::CommandId id)
   {
@@ -91,6 +94,7 @@ private:
   std::function<void(Accessibility::CommandId)> mStartedCallback;
   std::function<void(Accessibility::CommandId)> mCompletedCallback;
   Accessibility::CommandId mNextId{0};
+  std::size_t mLookahead{0};
   int  mStopCount{0};
   int  mPurgeCount{0};
   bool mPaused{false};
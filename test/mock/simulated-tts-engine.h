@@ -0,0 +1,289 @@
+#ifndef ACCESSIBILITY_TEST_MOCK_SIMULATED_TTS_ENGINE_H
+#define ACCESSIBILITY_TEST_MOCK_SIMULATED_TTS_ENGINE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/tts-engine.h>
+
+/**
+ * @brief TtsEngine that simulates synthesis and playback on a virtual clock.
+ *
+ * Nothing happens in real time: the owner moves the clock with advanceTo()
+ * or advanceBy(), and started/completed callbacks fire at their simulated
+ * times, in order, with now() set to the event time. Callbacks may speak
+ * again; the new utterances are scheduled from that time.
+ *
+ * Model: one synthesizer renders utterances in the order they were spoken,
+ * each taking synthesisLatency plus a pseudo-random jitter. An utterance
+ * plays once it is rendered and the previous one has finished, for
+ * length / charactersPerSecond. Jitter comes from a seeded generator, so a
+ * run is reproducible.
+ */
+class SimulatedTtsEngine : public Accessibility::TtsEngine
+{
+public:
+  using Duration = std::chrono::microseconds;
+  using Time     = std::chrono::microseconds; ///< Since the start of the simulation
+
+  struct Config
+  {
+    Duration    synthesisLatency{std::chrono::milliseconds(80)};
+    Duration    jitter{0};                 ///< Latency varies uniformly within +/- jitter
+    double      charactersPerSecond{15.0}; ///< About 180 words per minute
+    std::size_t lookahead{1};              ///< Reported by getLookahead()
+    uint64_t    seed{1};
+  };
+
+  /**
+   * @brief What happened to one utterance.
+   */
+  struct Record
+  {
+    Accessibility::CommandId id{0};
+    std::size_t              length{0};
+    bool                     discardable{true};
+    Time                     spokenAt{0};
+    Time                     startedAt{-1};  ///< -1 if it never started
+    Time                     finishedAt{-1}; ///< Completion or interruption; -1 while pending
+    bool                     completed{false};
+  };
+
+  SimulatedTtsEngine()
+  : SimulatedTtsEngine(Config())
+  {
+  }
+
+  explicit SimulatedTtsEngine(Config config)
+  : mConfig(config),
+    mRandom(config.seed)
+  {
+  }
+
+  Accessibility::CommandId speak(const std::string& text, const Accessibility::SpeakOptions& options) override
+  {
+    if(options.interrupt)
+    {
+      stop();
+    }
+
+    Record record;
+    record.id          = ++mLastId;
+    record.length      = text.size();
+    record.discardable = options.discardable;
+    record.spokenAt    = mNow;
+    mRecords.push_back(record);
+
+    auto latency   = std::max(Duration(0), mConfig.synthesisLatency + nextJitter());
+    mSynthesisFree = std::max(mNow, mSynthesisFree) + latency;
+    mPending.push_back({mRecords.size() - 1, mSynthesisFree, Duration(0)});
+    return record.id;
+  }
+
+  void stop() override
+  {
+    while(!mPending.empty())
+    {
+      drop(0);
+    }
+    mSynthesisFree = mNow;
+  }
+
+  bool pause() override
+  {
+    if(!mPaused)
+    {
+      mPaused = true;
+      if(!mPending.empty() && isStarted(mPending.front()))
+      {
+        mPending.front().remaining = mPending.front().endAt - mNow;
+      }
+    }
+    return true;
+  }
+
+  bool resume() override
+  {
+    if(mPaused)
+    {
+      mPaused = false;
+      if(!mPending.empty() && isStarted(mPending.front()))
+      {
+        mPending.front().endAt = mNow + mPending.front().remaining;
+      }
+    }
+    return true;
+  }
+
+  bool isPaused() const override { return mPaused; }
+
+  void purge(bool onlyDiscardable) override
+  {
+    for(std::size_t i = mPending.size(); i-- > 0;)
+    {
+      if(!onlyDiscardable || mRecords[mPending[i].record].discardable)
+      {
+        drop(i);
+      }
+    }
+  }
+
+  void onUtteranceStarted(std::function<void(Accessibility::CommandId)> callback) override
+  {
+    mStartedCallback = std::move(callback);
+  }
+
+  void onUtteranceCompleted(std::function<void(Accessibility::CommandId)> callback) override
+  {
+    mCompletedCallback = std::move(callback);
+  }
+
+  std::size_t getLookahead() const override { return mConfig.lookahead; }
+
+  // Simulation control
+
+  Time now() const { return mNow; }
+
+  /**
+   * @brief Runs the simulation up to time, firing every event due by then.
+   */
+  void advanceTo(Time time)
+  {
+    Time due;
+    while(nextEvent(due) && due <= time)
+    {
+      mNow = due;
+      fireNextEvent();
+    }
+    mNow = std::max(mNow, time);
+  }
+
+  void advanceBy(Duration duration) { advanceTo(mNow + duration); }
+
+  /**
+   * @brief Runs the simulation until nothing is left to play (or playback is paused).
+   */
+  void runUntilIdle()
+  {
+    Time due;
+    while(nextEvent(due))
+    {
+      mNow = due;
+      fireNextEvent();
+    }
+  }
+
+  /**
+   * @brief Returns the number of accepted utterances that have not finished.
+   */
+  std::size_t getQueueDepth() const { return mPending.size(); }
+
+  Accessibility::CommandId getLastCommandId() const { return mLastId; }
+
+  const std::vector<Record>& getRecords() const { return mRecords; }
+
+  const Record* findRecord(Accessibility::CommandId id) const
+  {
+    // Ids are issued in order starting from 1
+    return (id >= 1 && id <= mRecords.size()) ? &mRecords[id - 1] : nullptr;
+  }
+
+private:
+  struct Pending
+  {
+    std::size_t record;    ///< Index into mRecords
+    Time        readyAt;   ///< Synthesis done
+    Duration    remaining; ///< Playback left when paused
+    Time        endAt{-1};
+  };
+
+  bool isStarted(const Pending& pending) const { return mRecords[pending.record].startedAt >= Time(0); }
+
+  Duration nextJitter()
+  {
+    if(mConfig.jitter <= Duration(0))
+    {
+      return Duration(0);
+    }
+    // 64-bit LCG; fixed, unlike std distributions, across standard libraries
+    mRandom     = mRandom * 6364136223846793005ULL + 1442695040888963407ULL;
+    auto span   = static_cast<uint64_t>(mConfig.jitter.count()) * 2 + 1;
+    auto offset = static_cast<int64_t>((mRandom >> 33) % span);
+    return Duration(offset - mConfig.jitter.count());
+  }
+
+  bool nextEvent(Time& due) const
+  {
+    if(mPending.empty() || mPaused)
+    {
+      return false;
+    }
+    auto& head = mPending.front();
+    due        = isStarted(head) ? head.endAt : std::max(head.readyAt, mNow);
+    return true;
+  }
+
+  void fireNextEvent()
+  {
+    auto& head   = mPending.front();
+    auto& record = mRecords[head.record];
+    if(!isStarted(head))
+    {
+      record.startedAt = mNow;
+      head.endAt       = mNow + Duration(static_cast<int64_t>(record.length * 1e6 / mConfig.charactersPerSecond));
+      if(mStartedCallback) mStartedCallback(record.id);
+      return;
+    }
+
+    record.finishedAt = mNow;
+    record.completed  = true;
+    auto id           = record.id;
+    mPending.pop_front();
+    if(mCompletedCallback) mCompletedCallback(id);
+  }
+
+  void drop(std::size_t index)
+  {
+    auto& record = mRecords[mPending[index].record];
+    record.finishedAt = mNow;
+    mPending.erase(mPending.begin() + index);
+  }
+
+  Config                                        mConfig;
+  Time                                          mNow{0};
+  Time                                          mSynthesisFree{0};
+  uint64_t                                      mRandom;
+  std::vector<Record>                           mRecords;
+  std::deque<Pending>                           mPending; ///< Oldest first; the head plays once ready
+  Accessibility::CommandId                      mLastId{0};
+  bool                                          mPaused{false};
+  std::function<void(Accessibility::CommandId)> mStartedCallback;
+  std::function<void(Accessibility::CommandId)> mCompletedCallback;
+};
+
+#endif // ACCESSIBILITY_TEST_MOCK_SIMULATED_TTS_ENGINE_H
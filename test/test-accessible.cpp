@@ -19,6 +19,7 @@
 #include <test/test-accessible.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <stdexcept>
 
 // INTERNAL INCLUDES
@@ -39,6 +40,16 @@ void TestAccessible::AddChild(std::shared_ptr<TestAccessible> child)
   mChildren.push_back(std::move(child));
 }
 
+void TestAccessible::RemoveChild(const std::shared_ptr<TestAccessible>& child)
+{
+  auto it = std::find(mChildren.begin(), mChildren.end(), child);
+  if(it != mChildren.end())
+  {
+    (*it)->mParent = nullptr;
+    mChildren.erase(it);
+  }
+}
+
 std::string TestAccessible::GetName() const
 {
   return mName;
@@ -125,7 +136,19 @@ Accessibility::States TestAccessible::GetStates()
 
 Accessibility::Attributes TestAccessible::GetAttributes() const
 {
-  return {};
+  ++mAttributesCalls;
+  return mAttributes;
+}
+
+bool TestAccessible::GetAttribute(Accessibility::AttributeKey key, std::string& value) const
+{
+  auto iter = mAttributes.find(key);
+  if(iter == mAttributes.end())
+  {
+    return false;
+  }
+  value = iter->second;
+  return true;
 }
 
 bool TestAccessible::DoGesture(const Accessibility::GestureInfo& gestureInfo)
@@ -135,7 +158,8 @@ bool TestAccessible::DoGesture(const Accessibility::GestureInfo& gestureInfo)
 
 std::vector<Accessibility::Relation> TestAccessible::GetRelationSet()
 {
-  return {};
+  ++mRelationSetCalls;
+  return mRelations;
 }
 
 Accessibility::Address TestAccessible::GetAddress() const
@@ -187,7 +211,8 @@ double TestAccessible::GetAlpha() const
 
 bool TestAccessible::GrabHighlight()
 {
-  return false;
+  // Like a toolkit object that went away, a defunct one cannot be highlighted
+  return !mStates[Accessibility::State::DEFUNCT];
 }
 
 bool TestAccessible::ClearHighlight()
@@ -197,5 +222,5 @@ bool TestAccessible::ClearHighlight()
 
 bool TestAccessible::IsScrollable() const
 {
-  return false;
+  return mScrollable;
 }
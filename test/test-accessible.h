@@ -50,11 +50,49 @@ public:
    * @brief Adds a child to this accessible, setting its parent pointer.
    */
   void AddChild(std::shared_ptr<TestAccessible> child);
+  void RemoveChild(const std::shared_ptr<TestAccessible>& child);
 
   // --- Configuration ---
 
+  void SetName(std::string name) { mName = std::move(name); }
   void SetStates(Accessibility::States states) { mStates = states; }
   void SetExtents(Accessibility::Rect<float> extents) { mExtents = extents; }
+  void SetAttributes(Accessibility::Attributes attributes) { mAttributes = std::move(attributes); }
+  void SetScrollable(bool scrollable) { mScrollable = scrollable; }
+
+  /**
+   * @brief Sets the text MockNodeProxy serves through the Text methods.
+   */
+  void SetText(std::string text) { mText = std::move(text); }
+  const std::string& GetText() const { return mText; }
+  void SetCursorOffset(int32_t offset) { mCursorOffset = offset; }
+  int32_t GetCursorOffset() const { return mCursorOffset; }
+
+  /**
+   * @brief Counts Text requests made through MockNodeProxy, like IPC round trips.
+   */
+  void CountTextRequest() const { ++mTextRequests; }
+  int GetTextRequestCount() const { return mTextRequests; }
+
+  /**
+   * @brief Counts GetAttributes() calls; GetAttribute() lookups are not counted.
+   */
+  int GetAttributesCallCount() const { return mAttributesCalls; }
+
+  /**
+   * @brief Adds a relation of the given type targeting target.
+   */
+  void AddRelation(Accessibility::RelationType type, Accessibility::Accessible* target)
+  {
+    mRelations.emplace_back(type, std::vector<Accessibility::Accessible*>{target});
+  }
+
+  void ClearRelations() { mRelations.clear(); }
+
+  /**
+   * @brief Counts GetRelationSet() calls, i.e. relation sets read by the bridge.
+   */
+  int GetRelationSetCallCount() const { return mRelationSetCalls; }
 
   // --- Accessible interface ---
   std::string                          GetName() const override;
@@ -68,6 +106,7 @@ public:
   Accessibility::Role                  GetRole() const override;
   Accessibility::States                GetStates() override;
   Accessibility::Attributes            GetAttributes() const override;
+  bool                                 GetAttribute(Accessibility::AttributeKey key, std::string& value) const override;
   bool                                 DoGesture(const Accessibility::GestureInfo& gestureInfo) override;
   std::vector<Accessibility::Relation> GetRelationSet() override;
   Accessibility::Address               GetAddress() const override;
@@ -98,6 +137,14 @@ private:
   Accessibility::Rect<float>                  mExtents{0.0f, 0.0f, 100.0f, 50.0f};
   Accessibility::Accessible*                  mParent{nullptr};
   std::vector<std::shared_ptr<TestAccessible>> mChildren;
+  Accessibility::Attributes                   mAttributes;
+  std::vector<Accessibility::Relation>        mRelations;
+  bool                                        mScrollable{false};
+  std::string                                 mText;
+  int32_t                                     mCursorOffset{0};
+  mutable std::atomic<int>                    mTextRequests{0};
+  mutable std::atomic<int>                    mAttributesCalls{0};
+  std::atomic<int>                            mRelationSetCalls{0};
 };
 
 #endif // ACCESSIBILITY_TEST_TEST_ACCESSIBLE_H
@@ -16,15 +16,19 @@
  */
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 // INTERNAL INCLUDES
 #include <accessibility/api/accessibility.h>
 #include <accessibility/api/accessibility-bridge.h>
+#include <accessibility/api/accessibility-names.h>
 #include <accessibility/api/accessible.h>
+#include <accessibility/api/collection.h>
 #include <accessibility/internal/bridge/accessibility-common.h>
 #include <accessibility/internal/bridge/bridge-platform.h>
 #include <test/mock/mock-dbus-wrapper.h>
@@ -243,6 +247,8 @@ int main(int argc, char** argv)
       TEST_CHECK(roleVal == static_cast<uint32_t>(Accessibility::Role::PUSH_BUTTON),
                  "Button role is PUSH_BUTTON (" + std::to_string(roleVal) + ")");
     }
+    auto nameResult = client.method<DBus::ValueOrError<std::string>()>("GetRoleName").call();
+    TEST_CHECK(nameResult && std::get<0>(nameResult.getValues()) == "push button", "GetRoleName returns the role name");
   }
   {
     auto client = CreateAccessibleClient(busName, label->GetId(), conn);
@@ -537,6 +543,223 @@ int main(int argc, char** argv)
     socketClient.method<DBus::ValueOrError<void>(Accessibility::Address)>("Unembed").call(plugD);
   }
 
+  // ===== Step 16: Enum name tables =====
+  std::cout << "\n[16] Testing enum name tables..." << std::endl;
+  {
+    using namespace Accessibility;
+    TEST_CHECK(STATE_NAMES[State::HAS_TOOLTIP] == "has-tooltip" && STATE_IDENTIFIERS[State::HAS_TOOLTIP] == "HAS_TOOLTIP",
+               "State names and identifiers");
+    TEST_CHECK(ROLE_IDENTIFIERS[Role::TABLE_ROW_HEADER] == "TABLE_ROW_HEADER" && ROLE_NAMES[Role::MAX_COUNT].empty(),
+               "Role lookups are bounded");
+    State state{State::INVALID};
+    TEST_CHECK(STATE_IDENTIFIERS.Find("READ_ONLY", state) && state == State::READ_ONLY && !STATE_IDENTIFIERS.Find("NOPE", state),
+               "Names map back to enumerators");
+    TEST_CHECK(Accessible::GetInterfaceName(AtspiInterface::EVENT_OBJECT) == "org.a11y.atspi.Event.Object" &&
+                 Accessible::GetInterfaceName(AtspiInterface::MAX_COUNT).empty(),
+               "Interface names, empty for unknown values");
+    TEST_CHECK(WINDOW_EVENT_NAMES[WindowEvent::POST_RENDER] == "PostRender" &&
+                 PROPERTY_CHANGE_EVENT_NAMES[ObjectPropertyChangeEvent::PARENT] == "accessible-parent" &&
+                 TEXT_CHANGED_STATE_NAMES[TextChangedState::DELETED] == "delete",
+               "Event detail names");
+  }
+
+  // ===== Step 17: Interned attribute keys =====
+  std::cout << "\n[17] Testing attributes..." << std::endl;
+  {
+    using namespace Accessibility;
+    TEST_CHECK(AttributeKey{"automationId"} == WellKnownAttribute::AUTOMATION_ID &&
+                 AttributeKey{WellKnownAttribute::SUPPRESS_SCREEN_READER}.GetName() == "suppress-screen-reader",
+               "Well-known names intern to their fixed keys");
+    AttributeKey custom{"test-app-custom"};
+    TEST_CHECK(!AttributeKey::Find("test-app-never-interned").IsValid() && AttributeKey::Find("test-app-custom") == custom,
+               "Find() does not intern");
+
+    Attributes attrs{{"test-app-custom", "1"}, {"class", "Button"}, {"class", "Ignored"}};
+    TEST_CHECK(attrs.size() == 2u && attrs.begin()->first == WellKnownAttribute::CLASS && attrs.find("class")->second == "Button",
+               "Entries are unique and ordered by key");
+    TEST_CHECK(attrs.count("test-app-never-interned") == 0u && attrs.find(WellKnownAttribute::ITEM_COUNT) == attrs.end(),
+               "Missing names are not found");
+
+    Attributes copy = attrs;
+    TEST_CHECK(&*copy.begin() == &*attrs.begin(), "Copies share entries");
+    copy.Set(WellKnownAttribute::ITEM_COUNT, "3");
+    TEST_CHECK(&*copy.begin() != &*attrs.begin() && attrs.size() == 2u && copy.size() == 3u && copy != attrs,
+               "Modifying a copy detaches it");
+    TEST_CHECK(copy.erase(WellKnownAttribute::ITEM_COUNT) == 1u && copy == attrs, "Erase restores equality");
+    copy.Set(WellKnownAttribute::CLASS, "Label");
+    TEST_CHECK(copy.find(WellKnownAttribute::CLASS)->second == "Label" && attrs.find("class")->second == "Button",
+               "Set replaces a value in the modified copy only");
+
+    Attributes received;
+    TEST_CHECK(received.InsertByName("class", "Button") && received.InsertByName("test-app-peer-only", "1") &&
+                 !received.InsertByName("test-app-peer-only", "2"),
+               "Entries are added by name once");
+    TEST_CHECK(received.size() == 2u && received.GetUninterned().size() == 1u && received.GetUninterned()[0].second == "1" &&
+                 !AttributeKey::Find("test-app-peer-only").IsValid(),
+               "Unknown names are kept without interning them");
+
+    Attributes late;
+    late.InsertByName("class", "Button");
+    late.InsertByName("test-app-late", "1");
+    AttributeKey lateKey{"test-app-late"};
+    TEST_CHECK(late.count("test-app-late") == 1u && late.count(lateKey) == 1u && *late.GetValue("test-app-late") == "1" && late.size() == 2u,
+               "A name interned after it was received is still found");
+    late.Set(lateKey, "2");
+    TEST_CHECK(late.size() == 2u && late.GetUninterned().empty() && late.find(lateKey)->second == "2" && !late.InsertByName("test-app-late", "3"),
+               "Set moves a received entry under its new key");
+
+    button->SetAttributes({{"automationId", "ok_button"}, {"test-app-custom", "x"}});
+    auto client = CreateAccessibleClient(busName, button->GetId(), conn);
+    auto asMap  = client.method<DBus::ValueOrError<std::unordered_map<std::string, std::string>>()>("GetAttributes").call();
+    std::unordered_map<std::string, std::string> expected{{"automationId", "ok_button"}, {"test-app-custom", "x"}};
+    TEST_CHECK(asMap && std::get<0>(asMap.getValues()) == expected, "GetAttributes sends an a{ss} dictionary");
+    auto asAttributes = client.method<DBus::ValueOrError<Attributes>()>("GetAttributes").call();
+    TEST_CHECK(asAttributes && std::get<0>(asAttributes.getValues()) == button->GetAttributes(), "GetAttributes reads back as Attributes");
+
+    button->SetAttributes(late);
+    auto asPairs = client.method<DBus::ValueOrError<std::vector<std::pair<std::string, std::string>>>()>("GetAttributes").call();
+    auto sent    = asPairs ? std::get<0>(asPairs.getValues()) : std::vector<std::pair<std::string, std::string>>{};
+    TEST_CHECK(sent.size() == 2u && std::count(sent.begin(), sent.end(), std::pair<std::string, std::string>{"test-app-late", "2"}) == 1,
+               "A name interned after it was received is sent once");
+
+    // A rule read before the toolkit interns its own name still matches
+    Attributes requested;
+    requested.InsertByName("test-app-lazy", "1");
+    button->SetAttributes({{"automationId", "ok_button"}, {"test-app-custom", "x"}, {"test-app-lazy", "1"}});
+    bridge->AddTopLevelWindow(window.get());
+    auto collection = bridge->GetApplication()->GetFeature<Collection>();
+    auto ruleFor    = [&](int32_t attributesMatchType) {
+      return Collection::MatchRule{{0, 0}, 0, requested, attributesMatchType, {0, 0, 0, 0}, 0, {}, 0, false};
+    };
+    constexpr int32_t MATCH_ALL  = 1;
+    constexpr int32_t MATCH_NONE = 3;
+    auto matchAll  = collection ? collection->GetMatches(ruleFor(MATCH_ALL), static_cast<uint32_t>(SortOrder::CANONICAL), 0) : std::vector<Accessible*>{};
+    auto matchNone = collection ? collection->GetMatches(ruleFor(MATCH_NONE), static_cast<uint32_t>(SortOrder::CANONICAL), 0) : std::vector<Accessible*>{};
+    TEST_CHECK(requested.GetUninterned().size() == 1u && matchAll.size() == 1u && matchAll[0] == button.get() &&
+                 std::find(matchNone.begin(), matchNone.end(), button.get()) == matchNone.end(),
+               "Collection matches names interned after the rule was read");
+    button->SetAttributes({{"automationId", "ok_button"}, {"test-app-custom", "x"}});
+  }
+
+  // ===== Step 18: Single attribute lookups =====
+  std::cout << "\n[18] Testing single attribute lookups..." << std::endl;
+  {
+    auto client = CreateAccessibleClient(busName, button->GetId(), conn);
+    auto found  = client.method<DBus::ValueOrError<bool, std::string>(std::string)>("GetAttributeValue").call(std::string{"automationId"});
+    TEST_CHECK(found && std::get<0>(found.getValues()) && std::get<1>(found.getValues()) == "ok_button", "GetAttributeValue returns a set attribute");
+    auto missing = client.method<DBus::ValueOrError<bool, std::string>(std::string)>("GetAttributeValue").call(std::string{"class"});
+    TEST_CHECK(missing && !std::get<0>(missing.getValues()), "GetAttributeValue reports a missing attribute");
+    auto unknown = client.method<DBus::ValueOrError<bool, std::string>(std::string)>("GetAttributeValue").call(std::string{"test-app-asked-only"});
+    TEST_CHECK(unknown && !std::get<0>(unknown.getValues()) && !Accessibility::AttributeKey::Find("test-app-asked-only").IsValid(),
+               "GetAttributeValue does not intern unknown names");
+
+    Accessibility::Attributes toolkitOwned{{"automationId", "ok_button"}, {"test-app-custom", "x"}};
+    toolkitOwned.InsertByName("test-app-toolkit-only", "y");
+    button->SetAttributes(toolkitOwned);
+    auto byName = client.method<DBus::ValueOrError<bool, std::string>(std::string)>("GetAttributeValue").call(std::string{"test-app-toolkit-only"});
+    TEST_CHECK(byName && std::get<0>(byName.getValues()) && std::get<1>(byName.getValues()) == "y" &&
+                 !Accessibility::AttributeKey::Find("test-app-toolkit-only").IsValid(),
+               "GetAttributeValue finds names the toolkit has not interned");
+    button->SetAttributes({{"automationId", "ok_button"}, {"test-app-custom", "x"}});
+
+    auto calls = button->GetAttributesCallCount();
+    auto dump  = button->DumpTree(Accessibility::Accessible::DumpDetailLevel::DUMP_SHORT);
+    TEST_CHECK(dump.find("ok_button") != std::string::npos && button->GetAttributesCallCount() == calls,
+               "A short dump reads single attributes only");
+    dump = button->DumpTree(Accessibility::Accessible::DumpDetailLevel::DUMP_FULL);
+    TEST_CHECK(dump.find("test-app-custom") != std::string::npos, "A full dump lists the other attributes");
+  }
+
+  // ===== Step 19: Relation index =====
+  std::cout << "\n[19] Testing relation index..." << std::endl;
+  {
+    // Neither object is highlightable, so following FLOWS_TO only ever meets the cycle
+    button->AddRelation(Accessibility::RelationType::FLOWS_TO, label.get());
+    label->AddRelation(Accessibility::RelationType::FLOWS_TO, button.get());
+
+    auto client  = CreateAccessibleClient(busName, button->GetId(), conn);
+    auto getNext = [&client]()
+    {
+      return client.method<DBus::ValueOrError<Accessibility::Address, uint8_t>(std::string, int32_t, int32_t)>("GetNeighbor").call(std::string{}, 1, 0);
+    };
+
+    auto next = getNext();
+    TEST_CHECK(next && !std::get<0>(next.getValues()), "GetNeighbor stops at a FLOWS_TO cycle");
+
+    // Until the toolkit reports relation changes, nothing is cached
+    auto buttonReads = button->GetRelationSetCallCount();
+    next             = getNext();
+    TEST_CHECK(button->GetRelationSetCallCount() > buttonReads, "Relation sets are read live before RelationsChanged is called");
+
+    bridge->RelationsChanged(nullptr);
+    getNext();
+    buttonReads     = button->GetRelationSetCallCount();
+    auto labelReads = label->GetRelationSetCallCount();
+    next            = getNext();
+    TEST_CHECK(next && button->GetRelationSetCallCount() == buttonReads && label->GetRelationSetCallCount() == labelReads,
+               "Repeated navigation reads no relation sets");
+
+    bridge->RelationsChanged(button.get());
+    next = getNext();
+    TEST_CHECK(button->GetRelationSetCallCount() == buttonReads + 1 && label->GetRelationSetCallCount() == labelReads,
+               "RelationsChanged rereads only the changed object");
+
+    // button's cached set targets label, so replacing label drops it too
+    bridge->AddAccessible(label->GetId(), label);
+    next = getNext();
+    TEST_CHECK(button->GetRelationSetCallCount() == buttonReads + 2 && label->GetRelationSetCallCount() == labelReads + 1,
+               "Replacing a relation target drops the sets pointing at it");
+
+    // A target the bridge does not hold is never cached
+    auto stray = std::make_shared<TestAccessible>("Stray", Accessibility::Role::LABEL);
+    label->ClearRelations();
+    label->AddRelation(Accessibility::RelationType::FLOWS_TO, stray.get());
+    bridge->RelationsChanged(label.get());
+    getNext();
+    labelReads = label->GetRelationSetCallCount();
+    getNext();
+    TEST_CHECK(label->GetRelationSetCallCount() > labelReads, "Sets with unregistered targets are read every time");
+
+    bridge->RemoveAccessible(label->GetId());
+    bridge->AddAccessible(label->GetId(), label);
+    label->ClearRelations();
+    bridge->RelationsChanged(label.get());
+    button->ClearRelations();
+    bridge->RelationsChanged(button.get());
+  }
+
+  // ===== Step 20: Redundant signal suppression =====
+  std::cout << "\n[20] Testing redundant signal suppression..." << std::endl;
+  {
+    using Accessibility::ObjectPropertyChangeEvent;
+    using Accessibility::State;
+
+    auto before = bridge->GetSuppressedSignalStats();
+    bridge->EmitStateChanged(button, State::SHOWING, 1);
+    bridge->EmitStateChanged(button, State::SHOWING, 1);
+    TEST_CHECK(bridge->GetSuppressedSignalStats().stateChanged == before.stateChanged + 1, "A repeated state value is suppressed");
+
+    bridge->EmitStateChanged(button, State::SHOWING, 0);
+    bridge->EmitStateChanged(button, State::FOCUSED, 0);
+    TEST_CHECK(bridge->GetSuppressedSignalStats().stateChanged == before.stateChanged + 1, "Changed and first emitted states are sent");
+
+    bridge->Emit(button, ObjectPropertyChangeEvent::NAME);
+    bridge->Emit(button, ObjectPropertyChangeEvent::NAME);
+    TEST_CHECK(bridge->GetSuppressedSignalStats().propertyChanged == before.propertyChanged + 1, "An unchanged name is suppressed");
+
+    button->SetName("Cancel");
+    bridge->Emit(button, ObjectPropertyChangeEvent::NAME);
+    bridge->Emit(button, ObjectPropertyChangeEvent::VALUE);
+    bridge->Emit(button, ObjectPropertyChangeEvent::VALUE);
+    TEST_CHECK(bridge->GetSuppressedSignalStats().propertyChanged == before.propertyChanged + 1, "Changed names and other properties are sent");
+    button->SetName("OK");
+
+    bridge->RemoveAccessible(button->GetId());
+    bridge->AddAccessible(button->GetId(), button);
+    bridge->EmitStateChanged(button, State::SHOWING, 0);
+    TEST_CHECK(bridge->GetSuppressedSignalStats().stateChanged == before.stateChanged + 1, "Removing an object forgets its emitted states");
+  }
+
   // ===== Summary =====
   std::cout << "\n=== Results: " << gPassCount << " passed, " << gFailCount << " failed ===" << std::endl;
 
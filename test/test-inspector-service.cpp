@@ -16,18 +16,35 @@
  */
 
 // EXTERNAL INCLUDES
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
 #include <cstdlib>
+#include <deque>
+#include <functional>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
+#include <unistd.h>
 #include <vector>
 
+#include <cpp-httplib/httplib.h>
+
 // INTERNAL INCLUDES
 #include <accessibility/api/accessibility.h>
 #include <accessibility/api/accessibility-event.h>
 #include <accessibility/api/accessibility-service.h>
 #include <accessibility/internal/service/inspector-service.h>
 #include <tools/inspector/node-proxy-query-engine.h>
+#include <tools/inspector/node-store.h>
+#include <tools/inspector/persistent-id-map.h>
+#include <tools/inspector/search-index.h>
+#include <tools/inspector/snapshot-crawler.h>
+#include <tools/inspector/snapshot-file-query-engine.h>
+#include <tools/inspector/web-inspector-server.h>
 #include <test/mock/mock-app-registry.h>
 #include <test/mock/mock-gesture-provider.h>
 #include <test/mock/mock-node-proxy.h>
@@ -139,6 +156,994 @@ static void TestNodeProxyQueryEngine()
   TEST_CHECK(emptyEngine.GetRootId() == 0, "Empty engine root ID is 0");
 }
 
+// ========================================================================
+// Incremental snapshot updates
+// ========================================================================
+static Accessibility::AccessibilityEvent MakeEvent(Accessibility::AccessibilityEvent::Type type,
+                                                   const std::shared_ptr<TestAccessible>& source,
+                                                   Accessibility::EventDetail detail = {})
+{
+  Accessibility::AccessibilityEvent event;
+  event.type   = type;
+  event.source = source->GetAddress();
+  event.detail = detail;
+  return event;
+}
+
+static void TestNodeProxyQueryEngineIncremental()
+{
+  std::cout << "\n--- NodeProxyQueryEngine Incremental Update Tests ---" << std::endl;
+
+  using Type = Accessibility::AccessibilityEvent::Type;
+  using Accessibility::EventDetail;
+
+  MockAppRegistry registry;
+  auto& tree = registry.getDemoTree();
+
+  InspectorEngine::NodeProxyQueryEngine engine;
+  engine.BuildSnapshot(registry.createProxy(tree.window.get()));
+
+  // Ids are bound to addresses and survive a full rebuild
+  engine.BuildSnapshot(registry.createProxy(tree.window.get()));
+  TEST_CHECK(engine.GetRootId() == 1, "Rebuild keeps the root id");
+  TEST_CHECK(engine.GetElementInfo(6).name == "Play", "Rebuild keeps node ids");
+
+  // A new child is fetched with its subtree; existing ids stay
+  auto shuffle = std::make_shared<TestAccessible>("Shuffle", Accessibility::Role::PUSH_BUTTON);
+  tree.content->AddChild(shuffle);
+  TEST_CHECK(engine.ApplyEvent(MakeEvent(Type::CHILDREN_CHANGED, tree.content)), "ChildrenChanged is applied");
+  TEST_CHECK(engine.GetSnapshotSize() == 12, "Added child joins the snapshot");
+  TEST_CHECK(engine.GetElementInfo(12).name == "Shuffle", "Added child gets the next id");
+  TEST_CHECK(engine.GetElementInfo(12).parentId == 5, "Added child is linked to its parent");
+  TEST_CHECK(engine.GetElementInfo(5).childCount == 4, "Parent child count is updated");
+  TEST_CHECK(engine.GetElementInfo(6).name == "Play" && engine.GetElementInfo(10).name == "Previous",
+             "Existing ids are unchanged by a subtree refresh");
+
+  // A removed child disappears with its id
+  tree.content->RemoveChild(shuffle);
+  engine.ApplyEvent(MakeEvent(Type::CHILDREN_CHANGED, tree.content));
+  TEST_CHECK(engine.GetSnapshotSize() == 11, "Removed child leaves the snapshot");
+  TEST_CHECK(engine.GetElementInfo(12).name == "(not found)", "Removed child id is gone");
+  TEST_CHECK(!engine.ApplyEvent(MakeEvent(Type::STATE_CHANGED, shuffle)), "Events from removed nodes are ignored");
+
+  // Property changes patch only the source node
+  tree.playBtn->SetName("Pause");
+  tree.menuBtn->SetName("Options");
+  engine.ApplyEvent(MakeEvent(Type::PROPERTY_CHANGED, tree.playBtn, EventDetail::ACCESSIBLE_NAME));
+  TEST_CHECK(engine.GetElementInfo(6).name == "Pause", "Name change is patched");
+  TEST_CHECK(engine.GetElementInfo(3).name == "Menu", "Unrelated nodes are not refetched");
+
+  // Bounds changes patch the extents
+  tree.playBtn->SetExtents({10.0f, 20.0f, 30.0f, 40.0f});
+  engine.ApplyEvent(MakeEvent(Type::BOUNDS_CHANGED, tree.playBtn));
+  TEST_CHECK(engine.GetElementInfo(6).boundsWidth == 30.0f, "Bounds change is patched");
+
+  // Losing HIGHLIGHTABLE takes the node out of navigation
+  auto states = tree.volumeSlider->GetStates();
+  states[Accessibility::State::HIGHLIGHTABLE] = false;
+  tree.volumeSlider->SetStates(states);
+  engine.ApplyEvent(MakeEvent(Type::STATE_CHANGED, tree.volumeSlider, EventDetail::HIGHLIGHTABLE));
+  TEST_CHECK(engine.GetElementInfo(7).states.find("HIGHLIGHTABLE") == std::string::npos, "State change is patched");
+  TEST_CHECK(engine.Navigate(6, true) != 7, "Navigation skips a node that lost HIGHLIGHTABLE");
+
+  // Reparenting moves the node and keeps its id
+  tree.footer->RemoveChild(tree.nextBtn);
+  tree.header->AddChild(tree.nextBtn);
+  engine.ApplyEvent(MakeEvent(Type::PROPERTY_CHANGED, tree.nextBtn, EventDetail::ACCESSIBLE_PARENT));
+  TEST_CHECK(engine.GetElementInfo(11).parentId == 2, "Reparented node keeps its id under the new parent");
+  TEST_CHECK(engine.GetElementInfo(9).childCount == 1, "Reparented node leaves its old parent");
+  TEST_CHECK(engine.GetSnapshotSize() == 11, "Reparenting does not duplicate nodes");
+}
+
+// ========================================================================
+// SnapshotCrawler tests
+// ========================================================================
+
+/**
+ * @brief A proxy whose snapshot replies arrive only when the test dispatches them.
+ */
+class DeferredNodeProxy : public MockNodeProxy
+{
+public:
+  using Replies = std::deque<std::function<void()>>;
+
+  DeferredNodeProxy(Accessibility::Accessible* accessible, std::shared_ptr<Replies> replies)
+  : MockNodeProxy(accessible, [replies](Accessibility::Accessible* child) { return std::make_shared<DeferredNodeProxy>(child, replies); }),
+    mReplies(std::move(replies))
+  {
+  }
+
+  void fetchSnapshotFields(std::function<void(Accessibility::SnapshotFields)> callback) override
+  {
+    mReplies->push_back([this, callback] { NodeProxy::fetchSnapshotFields(callback); });
+  }
+
+private:
+  std::shared_ptr<Replies> mReplies;
+};
+
+static void TestSnapshotCrawler()
+{
+  std::cout << "\n--- SnapshotCrawler Tests ---" << std::endl;
+
+  MockAppRegistry registry;
+  auto& tree = registry.getDemoTree();
+
+  // A wide list adds many siblings below one node
+  auto list = std::make_shared<TestAccessible>("List", Accessibility::Role::LIST);
+  for(int i = 0; i < 40; ++i)
+  {
+    auto item = std::make_shared<TestAccessible>("Item " + std::to_string(i), Accessibility::Role::LIST_ITEM);
+    item->AddChild(std::make_shared<TestAccessible>("Label " + std::to_string(i), Accessibility::Role::LABEL));
+    list->AddChild(item);
+  }
+  tree.content->AddChild(list);
+
+  InspectorEngine::SnapshotCrawler crawler;
+  auto nodes = crawler.Crawl(registry.createProxy(tree.window.get()));
+  TEST_CHECK(nodes.size() == 92, "Crawl fetches every node");
+  TEST_CHECK(nodes.front().name == "Main Window" && nodes[1].name == "Header", "Crawl result starts with the root");
+
+  bool preOrder = true;
+  for(size_t i = 0; preOrder && i < nodes.size(); ++i)
+  {
+    for(auto child : nodes[i].children)
+    {
+      preOrder = preOrder && child > i && child < nodes.size();
+    }
+    preOrder = preOrder && (nodes[i].children.empty() || nodes[i].children.front() == i + 1);
+  }
+  TEST_CHECK(preOrder, "Crawl returns the tree in depth-first pre-order");
+
+  auto stats = crawler.GetStats();
+  TEST_CHECK(stats.nodes == 92 && stats.buses == 1, "Crawl stats count nodes and buses");
+
+  TEST_CHECK(crawler.Crawl(nullptr).empty(), "Crawling null yields nothing");
+
+  // Replies held back until dispatch: requests pile up to the window
+  auto   replies   = std::make_shared<DeferredNodeProxy::Replies>();
+  size_t maxQueued = 0;
+  InspectorEngine::SnapshotCrawler::Config config{8, 4, [&replies, &maxQueued] {
+    maxQueued = std::max(maxQueued, replies->size());
+    auto reply = std::move(replies->front());
+    replies->pop_front();
+    reply();
+  }};
+  InspectorEngine::SnapshotCrawler pipelined(config);
+  auto deferred = pipelined.Crawl(std::make_shared<DeferredNodeProxy>(tree.window.get(), replies));
+  bool same     = deferred.size() == nodes.size();
+  for(size_t i = 0; same && i < deferred.size(); ++i)
+  {
+    same = deferred[i].name == nodes[i].name && deferred[i].children == nodes[i].children;
+  }
+  TEST_CHECK(same, "Pipelined crawl returns the same pre-order tree");
+  TEST_CHECK(maxQueued == 4, "Requests stay outstanding up to the per-bus limit");
+
+  stats = pipelined.GetStats();
+  TEST_CHECK(stats.peakInFlight == 4, "Peak in-flight depth is reported");
+  TEST_CHECK(stats.meanInFlight > 2.0 && stats.meanInFlight <= 4.0, "Mean in-flight depth is reported");
+
+  config.maxInFlight = 1;
+  pipelined.SetConfig(config);
+  maxQueued = 0;
+  TEST_CHECK(pipelined.Crawl(std::make_shared<DeferredNodeProxy>(tree.window.get(), replies)).size() == 92 &&
+               maxQueued == 1 && pipelined.GetStats().peakInFlight == 1,
+             "A window of one fetches one node at a time");
+
+  // The engine snapshots through the crawler with the same ids as before
+  InspectorEngine::NodeProxyQueryEngine engine;
+  engine.SetCrawlerConfig({8, 4});
+  engine.BuildSnapshot(registry.createProxy(tree.window.get()));
+  TEST_CHECK(engine.GetSnapshotSize() == 92, "Engine snapshot covers the crawled tree");
+  TEST_CHECK(engine.GetElementInfo(6).name == "Play" && engine.GetElementInfo(9).name == "List",
+             "Snapshot keeps depth-first ids");
+  TEST_CHECK(engine.GetCrawlStats().nodes == 92, "Engine reports crawl stats");
+
+  tree.content->RemoveChild(list);
+}
+
+// ========================================================================
+// Web inspector concurrent readers
+// ========================================================================
+/**
+ * @brief Starts the server on a per-process port and waits until it answers.
+ *
+ * @return The port, or 0 if the server did not come up
+ */
+static int StartWebInspector(InspectorEngine::WebInspectorServer& server, InspectorEngine::InspectorQueryInterface& engine, int slot)
+{
+  const int port = 18000 + static_cast<int>(getpid() % 1000) * 8 + slot;
+  server.Start(engine, port);
+
+  httplib::Client probe("127.0.0.1", port);
+  for(int i = 0; i < 100; ++i)
+  {
+    auto res = probe.Get("/api/element/0");
+    if(res && res->status == 200) return port;
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+  return 0;
+}
+
+static void TestWebInspectorConcurrentReaders()
+{
+  std::cout << "\n--- WebInspectorServer Concurrent Reader Tests ---" << std::endl;
+
+  using Type = Accessibility::AccessibilityEvent::Type;
+
+  MockAppRegistry registry;
+  auto& tree = registry.getDemoTree();
+
+  InspectorEngine::NodeProxyQueryEngine engine;
+  engine.BuildSnapshot(registry.createProxy(tree.window.get()));
+  TEST_CHECK(engine.SupportsConcurrentReads(), "NodeProxyQueryEngine supports concurrent reads");
+
+  auto version = engine.GetSnapshotVersion();
+  tree.playBtn->SetName("Pause");
+  engine.ApplyEvent(MakeEvent(Type::PROPERTY_CHANGED, tree.playBtn, Accessibility::EventDetail::ACCESSIBLE_NAME));
+  TEST_CHECK(engine.GetSnapshotVersion() == version + 1, "Each update publishes a new snapshot version");
+
+  InspectorEngine::WebInspectorServer server;
+  const int port = StartWebInspector(server, engine, 0);
+  TEST_CHECK(port != 0, "Web inspector server accepts requests");
+  if(port == 0)
+  {
+    server.Stop();
+    return;
+  }
+  httplib::Client probe("127.0.0.1", port);
+
+  // Many browser clients poll the tree and element details while the writer keeps updating
+  constexpr int CLIENTS  = 16;
+  constexpr int REQUESTS = 25;
+
+  std::atomic<int>  succeeded{0};
+  std::atomic<int>  failed{0};
+  std::atomic<bool> writing{true};
+
+  // Other browser tabs hold every event stream the server allows open meanwhile
+  constexpr size_t  STREAMS = InspectorEngine::WebInspectorServer::MAX_EVENT_STREAMS;
+  std::atomic<int>  streaming{0};
+  std::atomic<bool> holding{true};
+  std::vector<std::thread> streams;
+  for(size_t s = 0; s < STREAMS; ++s)
+  {
+    streams.emplace_back([&] {
+      httplib::Client client("127.0.0.1", port);
+      client.set_read_timeout(std::chrono::seconds(5));
+      bool counted = false;
+      client.Get("/api/events", [&](const char*, size_t) {
+        if(!counted)
+        {
+          counted = true;
+          ++streaming;
+        }
+        return holding.load();
+      });
+    });
+  }
+  for(int i = 0; i < 250 && streaming < static_cast<int>(STREAMS); ++i)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+  TEST_CHECK(streaming == static_cast<int>(STREAMS), "Event streams up to the cap are served");
+  auto refused = probe.Get("/api/events");
+  TEST_CHECK(refused && refused->status == 503, "Event streams past the cap are refused with 503");
+
+  auto begin = std::chrono::steady_clock::now();
+  std::vector<std::thread> clients;
+  for(int c = 0; c < CLIENTS; ++c)
+  {
+    clients.emplace_back([&, c] {
+      httplib::Client client("127.0.0.1", port);
+      for(int r = 0; r < REQUESTS; ++r)
+      {
+        auto path = (r + c) % 2 ? "/api/tree" : "/api/element/" + std::to_string(1 + (r % 11));
+        auto res  = client.Get(path);
+        bool ok   = res && res->status == 200 && !res->body.empty() && res->body.front() == '{' && res->body.back() == '}';
+        ++(ok ? succeeded : failed);
+      }
+    });
+  }
+
+  std::thread writer([&] {
+    for(int i = 0; writing; ++i)
+    {
+      tree.titleLabel->SetName("Title " + std::to_string(i));
+      engine.ApplyEvent(MakeEvent(Type::PROPERTY_CHANGED, tree.titleLabel, Accessibility::EventDetail::ACCESSIBLE_NAME));
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+  });
+
+  for(auto& client : clients)
+  {
+    client.join();
+  }
+  auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  // The next diff closes the held streams
+  holding = false;
+  for(auto& stream : streams)
+  {
+    stream.join();
+  }
+  writing = false;
+  writer.join();
+
+  // The server notices a gone client within one poll interval
+  int reopened = 0;
+  for(int i = 0; i < 50 && reopened != 200; ++i)
+  {
+    probe.Get("/api/events", [&](const httplib::Response& response) {
+      reopened = response.status;
+      return true;
+    }, [](const char*, size_t) { return false; });
+    if(reopened != 200)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+  }
+  TEST_CHECK(reopened == 200, "Closed event streams free their slots");
+
+  std::cout << "  " << CLIENTS * REQUESTS << " requests from " << CLIENTS << " clients with " << STREAMS << " open event streams in "
+            << static_cast<int>(elapsed * 1000) << " ms (" << static_cast<int>(CLIENTS * REQUESTS / elapsed) << " req/s)" << std::endl;
+  TEST_CHECK(succeeded == CLIENTS * REQUESTS && failed == 0, "All concurrent requests succeed during updates");
+
+  auto res = probe.Get("/api/element/6");
+  TEST_CHECK(res && res->body.find("\"name\":\"Pause\"") != std::string::npos, "Element endpoint serves the latest snapshot");
+
+  server.Stop();
+}
+
+// ========================================================================
+// Web inspector lazy tree
+// ========================================================================
+static void TestWebInspectorLazyTree()
+{
+  std::cout << "\n--- WebInspectorServer Lazy Tree Tests ---" << std::endl;
+
+  MockAppRegistry registry;
+  auto& tree = registry.getDemoTree();
+
+  // A long list under content makes the full tree large
+  auto list = std::make_shared<TestAccessible>("List", Accessibility::Role::LIST);
+  for(int i = 0; i < 2000; ++i)
+  {
+    list->AddChild(std::make_shared<TestAccessible>("Row \"" + std::to_string(i) + "\"", Accessibility::Role::LIST_ITEM));
+  }
+  tree.content->AddChild(list);
+
+  InspectorEngine::NodeProxyQueryEngine engine;
+  engine.BuildSnapshot(registry.createProxy(tree.window.get()));
+
+  auto shallow = engine.BuildSubtree(1, 1);
+  TEST_CHECK(shallow.children.size() == 3 && shallow.children[0].children.empty(), "BuildSubtree stops at the depth limit");
+  TEST_CHECK(shallow.children[1].childCount == 4, "Nodes at the depth limit keep their child count");
+  TEST_CHECK(engine.BuildSubtree(1, -1).children[1].children[3].children.size() == 2000, "Negative depth builds the whole subtree");
+
+  InspectorEngine::WebInspectorServer server;
+  const int port = StartWebInspector(server, engine, 1);
+  TEST_CHECK(port != 0, "Web inspector server accepts requests");
+  if(port == 0)
+  {
+    server.Stop();
+    tree.content->RemoveChild(list);
+    return;
+  }
+  httplib::Client client("127.0.0.1", port);
+
+  auto res = client.Get("/api/tree?depth=2");
+  TEST_CHECK(res && res->status == 200, "/api/tree with depth succeeds");
+  TEST_CHECK(res && res->body.find("\"name\":\"Play\"") != std::string::npos, "Depth-limited tree includes the first levels");
+  TEST_CHECK(res && res->body.find("Row") == std::string::npos, "Depth-limited tree leaves deep nodes out");
+  TEST_CHECK(res && res->body.find("\"name\":\"List\",\"role\":\"LIST\",\"childCount\":2000,\"children\":[]") != std::string::npos,
+             "Unloaded nodes report their child count");
+
+  res = client.Get("/api/children/2");
+  TEST_CHECK(res && res->body.rfind("{\"id\":2,\"childCount\":2,\"children\":[{\"id\":3,", 0) == 0, "/api/children lists the children of a node");
+
+  res = client.Get("/api/tree?root=9");
+  TEST_CHECK(res && res->body.find("\"name\":\"Row \\\"1999\\\"\"") != std::string::npos, "Streamed subtree escapes names and reaches the last node");
+  TEST_CHECK(res && res->body.back() == '}', "Streamed subtree is complete");
+
+  auto full = client.Get("/api/tree");
+  TEST_CHECK(full && res && full->body.size() > res->body.size(), "Unparameterized /api/tree still returns the whole tree");
+
+  server.Stop();
+  tree.content->RemoveChild(list);
+}
+
+// ========================================================================
+// Snapshot diffs and live events
+// ========================================================================
+static void TestSnapshotDiffs()
+{
+  std::cout << "\n--- Snapshot Diff Tests ---" << std::endl;
+
+  using Type = Accessibility::AccessibilityEvent::Type;
+  using Accessibility::EventDetail;
+
+  MockAppRegistry registry;
+  auto& tree = registry.getDemoTree();
+
+  InspectorEngine::NodeProxyQueryEngine engine;
+  engine.BuildSnapshot(registry.createProxy(tree.window.get()));
+  auto start = engine.GetSnapshotVersion();
+
+  InspectorEngine::SnapshotDiff diff;
+  TEST_CHECK(engine.GetDiff(start, diff) && diff.added.empty() && diff.changed.empty() && diff.removed.empty() && !diff.reset,
+             "Diff against the current version is empty");
+  TEST_CHECK(engine.GetDiff(0, diff) && diff.reset, "Diff from version 0 asks for a reset");
+
+  // An unchanged rebuild publishes a version without changes
+  engine.BuildSnapshot(registry.createProxy(tree.window.get()));
+  TEST_CHECK(engine.GetDiff(start, diff) && diff.changed.empty() && diff.added.empty(), "Unchanged rebuild yields an empty diff");
+
+  tree.playBtn->SetName("Pause");
+  engine.ApplyEvent(MakeEvent(Type::PROPERTY_CHANGED, tree.playBtn, EventDetail::ACCESSIBLE_NAME));
+  auto shuffle = std::make_shared<TestAccessible>("Shuffle", Accessibility::Role::PUSH_BUTTON);
+  tree.content->AddChild(shuffle);
+  engine.ApplyEvent(MakeEvent(Type::CHILDREN_CHANGED, tree.content));
+
+  engine.GetDiff(start, diff);
+  TEST_CHECK(diff.toVersion == engine.GetSnapshotVersion(), "Diff reaches the current version");
+  TEST_CHECK(diff.added.size() == 1 && diff.added[0].id == 12 && diff.added[0].name == "Shuffle", "Diff lists added elements");
+  TEST_CHECK(diff.changed.size() == 2 && diff.changed[0].id == 5 && diff.changed[1].name == "Pause",
+             "Diff lists changed elements, including the parent of an added one");
+  auto afterAdd = engine.GetSnapshotVersion();
+
+  tree.content->RemoveChild(shuffle);
+  engine.ApplyEvent(MakeEvent(Type::CHILDREN_CHANGED, tree.content));
+  engine.GetDiff(afterAdd, diff);
+  TEST_CHECK(diff.removed.size() == 1 && diff.removed[0] == 12 && diff.changed.size() == 1, "Diff lists removed elements");
+  engine.GetDiff(start, diff);
+  TEST_CHECK(diff.added.empty() && diff.removed.empty(), "An element added and removed in between is not reported");
+
+  // Versions that left the change log need a reset
+  for(int i = 0; i < 300; ++i)
+  {
+    tree.titleLabel->SetName("Title " + std::to_string(i));
+    engine.ApplyEvent(MakeEvent(Type::PROPERTY_CHANGED, tree.titleLabel, EventDetail::ACCESSIBLE_NAME));
+  }
+  TEST_CHECK(engine.GetDiff(start, diff) && diff.reset, "Diff from an expired version asks for a reset");
+  TEST_CHECK(engine.GetDiff(engine.GetSnapshotVersion() - 1, diff) && diff.changed.size() == 1, "Recent versions still diff");
+
+  // Waiters wake up on focus changes
+  auto        version = engine.GetSnapshotVersion();
+  auto        begin   = std::chrono::steady_clock::now();
+  std::thread focus([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    engine.SetFocusedId(6);
+  });
+  engine.WaitForChange(version, engine.GetFocusedId(), std::chrono::seconds(5));
+  focus.join();
+  TEST_CHECK(std::chrono::steady_clock::now() - begin < std::chrono::seconds(2), "WaitForChange wakes on a focus change");
+
+  InspectorEngine::WebInspectorServer server;
+  const int port = StartWebInspector(server, engine, 2);
+  TEST_CHECK(port != 0, "Web inspector server accepts requests");
+  if(port == 0)
+  {
+    server.Stop();
+    return;
+  }
+
+  httplib::Client client("127.0.0.1", port);
+  auto res = client.Get("/api/diff?since=" + std::to_string(version - 1));
+  TEST_CHECK(res && res->body.find("\"reset\":false") != std::string::npos && res->body.find("Title 299") != std::string::npos,
+             "/api/diff returns the changes since a version");
+
+  // The event stream pushes a diff once the snapshot changes
+  std::string stream;
+  std::thread writer([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    tree.titleLabel->SetName("Live");
+    engine.ApplyEvent(MakeEvent(Type::PROPERTY_CHANGED, tree.titleLabel, EventDetail::ACCESSIBLE_NAME));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    engine.SetFocusedId(7);
+  });
+  httplib::Client events("127.0.0.1", port);
+  events.set_read_timeout(std::chrono::seconds(5));
+  events.Get("/api/events", [&](const char* data, size_t length) {
+    stream.append(data, length);
+    return stream.find("event: focus") == std::string::npos;
+  });
+  writer.join();
+  TEST_CHECK(stream.rfind("event: hello\n", 0) == 0, "Event stream starts with the current version");
+  TEST_CHECK(stream.find("event: diff\ndata: {") != std::string::npos && stream.find("\"name\":\"Live\"") != std::string::npos,
+             "Event stream pushes tree diffs");
+  TEST_CHECK(stream.find("event: focus\ndata: {\"focusedId\":7}") != std::string::npos, "Event stream pushes focus changes");
+
+  server.Stop();
+}
+
+// ========================================================================
+// Indexed search
+// ========================================================================
+static std::vector<uint32_t> SearchIds(InspectorEngine::NodeProxyQueryEngine& engine, const InspectorEngine::SearchQuery& query)
+{
+  InspectorEngine::SearchResult result;
+  engine.Search(query, result);
+  std::vector<uint32_t> ids;
+  for(auto& info : result.elements)
+  {
+    ids.push_back(info.id);
+  }
+  return ids;
+}
+
+static void TestSearchIndex()
+{
+  std::cout << "\n--- Search Index Tests ---" << std::endl;
+
+  using Query = InspectorEngine::SearchIndex::Query;
+  using Ids   = std::vector<uint32_t>;
+
+  // Large synthetic snapshot, checked against a linear scan
+  const uint32_t                                   count = 100000;
+  const char*                                      roles[] = {"PUSH_BUTTON", "LABEL", "PANEL", "LIST_ITEM", "SLIDER"};
+  const char*                                      words[] = {"Play", "Pause", "Settings", "Volume", "Album", "Artist", "Track"};
+  InspectorEngine::SearchIndex                     index;
+  std::vector<InspectorEngine::SearchIndex::Entry> entries(count + 1);
+  for(uint32_t id = 1; id <= count; ++id)
+  {
+    auto& entry        = entries[id];
+    entry.role         = roles[id % 5];
+    entry.name         = std::string(words[id % 7]) + " " + std::to_string(id);
+    entry.automationId = id % 1000 == 0 ? "row_" + std::to_string(id / 1000) : "";
+    entry.states       = (id % 3 ? 1u << 11 : 0u) | (id % 4 ? 1u << 4 : 0u);
+    index.Insert(id, entry);
+  }
+  TEST_CHECK(index.Size() == count, "Index holds every inserted element");
+
+  auto scan = [&](const Query& query) {
+    Ids ids;
+    for(uint32_t id = 1; id < entries.size(); ++id)
+    {
+      auto& entry = entries[id];
+      if(entry.role.empty()) continue;
+      if(!query.role.empty() && entry.role != query.role) continue;
+      if(!query.automationId.empty() && entry.automationId != query.automationId) continue;
+      if((entry.states & query.requiredStates) != query.requiredStates || (entry.states & query.excludedStates)) continue;
+      std::string lower = entry.name;
+      for(auto& c : lower) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+      if(lower.find(query.nameContains) == std::string::npos) continue;
+      ids.push_back(id);
+    }
+    return ids;
+  };
+
+  std::vector<Query> queries{
+    {"PUSH_BUTTON", "", "", 0, 0},
+    {"", "volume 12", "", 0, 0},
+    {"LABEL", "tist", "", 1u << 11, 1u << 4},
+    {"", "", "row_42", 0, 0},
+    {"PANEL", "se", "", 1u << 4, 0},
+    {"", "99999", "", 0, 0},
+    {"SLIDER", "nothing", "", 0, 0},
+    {"LIST_ITEM", "7", "", 0, 1u << 11},
+  };
+  bool                      matches = true;
+  std::chrono::microseconds slowest{0};
+  for(auto& query : queries)
+  {
+    size_t total = 0;
+    auto   begin = std::chrono::steady_clock::now();
+    auto   ids   = index.Find(query, count, total);
+    slowest      = std::max(slowest, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin));
+    matches      = matches && ids == scan(query) && total == ids.size();
+  }
+  TEST_CHECK(matches, "Indexed queries match a linear scan of 100k elements");
+  std::cout << "  slowest of " << queries.size() << " queries over " << count << " elements: " << slowest.count() << " us" << std::endl;
+
+  size_t total = 0;
+  auto   first = index.Find({"PUSH_BUTTON", "", "", 0, 0}, 3, total);
+  TEST_CHECK(first == (Ids{5, 10, 15}) && total == count / 5, "Limit keeps the first ids and counts every match");
+
+  // Updates replace and remove postings
+  entries[10].name = "Shuffle";
+  index.Insert(10, entries[10]);
+  index.Erase(15);
+  entries[15] = {};
+  TEST_CHECK(index.Find({"", "shuffle", "", 0, 0}, 10, total) == Ids{10}, "Re-inserted names are searchable");
+  TEST_CHECK(index.Find({"", "track 10", "", 0, 0}, count, total) == scan({"", "track 10", "", 0, 0}),
+             "Re-inserted elements lose their old names");
+  TEST_CHECK(index.Find({"PUSH_BUTTON", "", "", 0, 0}, 3, total) == (Ids{5, 10, 20}), "Erased elements are not found");
+  TEST_CHECK(index.Size() == count - 1, "Erase shrinks the index");
+}
+
+static void TestNodeStore()
+{
+  std::cout << "\n--- Node Store Tests ---" << std::endl;
+
+  using Store = InspectorEngine::NodeStore;
+  using Ids   = std::vector<uint32_t>;
+
+  // Synthetic snapshot, checked against a linear scan
+  const uint32_t     count   = 20000;
+  const char*        roles[] = {"PUSH_BUTTON", "LABEL", "PANEL", "LIST_ITEM", "SLIDER"};
+  Store              store;
+  std::vector<std::string> names(count + 1);
+  std::vector<Store::Node> nodes(count + 1);
+  for(uint32_t id = 1; id <= count; ++id)
+  {
+    names[id]    = "Item " + std::to_string(id % 100);
+    auto& node   = nodes[id];
+    node.id      = id;
+    node.role    = roles[id % 5];
+    node.name    = names[id];
+    node.states  = (id % 3 ? uint64_t{1} << 30 : 0u) | (id % 4 ? uint64_t{1} << 45 : 0u);
+    node.x       = static_cast<float>(id * 37 % 1080);
+    node.y       = static_cast<float>(id * 91 % 3840) - 960.0f;
+    node.width   = static_cast<float>(10 + id % 300);
+    node.height  = static_cast<float>(10 + id % 120);
+    store.Upsert(node);
+  }
+  TEST_CHECK(store.Size() == count, "Store holds every inserted node");
+  TEST_CHECK(store.GetStringCount() == 5 + 100 + 1, "Equal strings are interned once");
+
+  auto scan = [&](const Store::Filter& filter) {
+    Ids ids;
+    for(uint32_t id = 1; id < nodes.size(); ++id)
+    {
+      auto& node = nodes[id];
+      if(node.id == 0) continue;
+      if(!filter.role.empty() && node.role != filter.role) continue;
+      if((node.states & filter.requiredStates) != filter.requiredStates || (node.states & filter.excludedStates)) continue;
+      if(filter.intersects && !(node.x < filter.x + filter.width && node.x + node.width > filter.x &&
+                                node.y < filter.y + filter.height && node.y + node.height > filter.y))
+      {
+        continue;
+      }
+      ids.push_back(id);
+    }
+    return ids;
+  };
+
+  std::vector<Store::Filter> filters{
+    {"", 1ull << 30 | 1ull << 45, 0, true, 100.0f, 200.0f, 300.0f, 150.0f},
+    {"LABEL", 0, 1ull << 30, false, 0.0f, 0.0f, 0.0f, 0.0f},
+    {"SLIDER", 1ull << 45, 0, true, 0.0f, 0.0f, 1080.0f, 1920.0f},
+    {"", 0, 0, true, 500.0f, 500.0f, 1.0f, 1.0f},
+    {"NO_SUCH_ROLE", 0, 0, false, 0.0f, 0.0f, 0.0f, 0.0f},
+  };
+  bool matches = true;
+  for(auto& filter : filters)
+  {
+    matches = matches && store.Select(filter) == scan(filter);
+  }
+  TEST_CHECK(matches, "Column scans match a linear scan");
+
+  // Updates and removals keep rows and strings consistent
+  nodes[10].role = "SLIDER";
+  nodes[10].y    = 0.0f;
+  store.Upsert(nodes[10]);
+  for(uint32_t id = 1; id <= count; id += 2)
+  {
+    store.Erase(id);
+    nodes[id] = {};
+  }
+  store.Erase(count + 5);
+  matches = store.Size() == count / 2;
+  for(auto& filter : filters)
+  {
+    matches = matches && store.Select(filter) == scan(filter);
+  }
+  TEST_CHECK(matches, "Column scans stay correct after updates and removals");
+
+  Store::Node node;
+  TEST_CHECK(store.Get(10, node) && node.role == "SLIDER" && node.name == "Item 10" && !store.Get(11, node),
+             "Nodes read back from the columns");
+  TEST_CHECK(store.GetStringCount() == 5 + 50 + 1, "Strings are released with their last node");
+}
+
+static void TestPersistentIdMap()
+{
+  std::cout << "\n--- Persistent Id Map Tests ---" << std::endl;
+
+  using Map = InspectorEngine::PersistentIdMap<int>;
+
+  Map map;
+  TEST_CHECK(!map.Find(0) && !map.Find(UINT32_MAX) && map.Size() == 0, "Empty map finds nothing");
+
+  for(uint32_t id = 1; id <= 5000; ++id)
+  {
+    map.Set(id, std::make_shared<const int>(static_cast<int>(id)));
+  }
+  map.Set(UINT32_MAX, std::make_shared<const int>(-1));
+  bool found = map.Size() == 5001 && *map.Find(UINT32_MAX) == -1 && !map.Find(0) && !map.Find(5001);
+  for(uint32_t id = 1; found && id <= 5000; ++id)
+  {
+    found = *map.Find(id) == static_cast<int>(id);
+  }
+  TEST_CHECK(found, "Map finds every stored id, up to the largest");
+
+  // A copy shares the values and is unaffected by later changes
+  Map copy    = map;
+  auto shared = map.Find(42);
+  map.Set(42, std::make_shared<const int>(420));
+  map.Erase(43);
+  map.Erase(43);
+  TEST_CHECK(*copy.Find(42) == 42 && copy.Find(43) && copy.Size() == 5001, "Changes do not leak into copies");
+  TEST_CHECK(*map.Find(42) == 420 && !map.Find(43) && map.Size() == 5000, "Set replaces and Erase removes");
+  TEST_CHECK(copy.Find(41) == map.Find(41) && copy.Find(42) == shared, "Untouched values are shared");
+
+  std::vector<uint32_t> ids;
+  copy.ForEach([&](uint32_t id, const std::shared_ptr<const int>&) { ids.push_back(id); });
+  TEST_CHECK(ids.size() == 5001 && std::is_sorted(ids.begin(), ids.end()) && ids.back() == UINT32_MAX,
+             "ForEach visits every id in order");
+}
+
+static void TestNodeProxyQueryEngineSearch()
+{
+  std::cout << "\n--- Engine Search Tests ---" << std::endl;
+
+  using Type = Accessibility::AccessibilityEvent::Type;
+  using Ids  = std::vector<uint32_t>;
+
+  MockAppRegistry registry;
+  auto& tree = registry.getDemoTree();
+  tree.playBtn->SetAttributes({{"automationId", "play_button"}, {"class", "Button"}});
+
+  InspectorEngine::NodeProxyQueryEngine engine;
+  engine.BuildSnapshot(registry.createProxy(tree.window.get()));
+
+  InspectorEngine::SearchQuery query;
+  query.role = "push_button";
+  TEST_CHECK(SearchIds(engine, query) == (Ids{3, 6, 10, 11}), "Search by role ignores case");
+  query.nameContains = "pl";
+  TEST_CHECK(SearchIds(engine, query) == Ids{6}, "Short name filters combine with the role");
+
+  query = {};
+  query.nameContains = "PLAY";
+  TEST_CHECK(SearchIds(engine, query) == (Ids{6, 8}), "Name search matches substrings, ignoring case");
+
+  query = {};
+  query.role           = "PANEL";
+  query.excludedStates = {"FOCUSABLE"};
+  TEST_CHECK(SearchIds(engine, query) == (Ids{2, 5, 9}), "Excluded states filter");
+  query        = {};
+  query.states = {"focusable", "VISIBLE"};
+  query.role   = "SLIDER";
+  TEST_CHECK(SearchIds(engine, query) == Ids{7}, "Required states filter");
+  query.states = {"NO_SUCH_STATE"};
+  TEST_CHECK(SearchIds(engine, query).empty(), "Unknown required states match nothing");
+
+  query              = {};
+  query.automationId = "play_button";
+  TEST_CHECK(SearchIds(engine, query) == Ids{6}, "Search by automation id");
+  TEST_CHECK(engine.GetElementInfo(6).automationId == "play_button", "Element info carries the automation id");
+
+  InspectorEngine::SearchResult result;
+  query       = {};
+  query.role  = "PANEL";
+  query.limit = 2;
+  engine.Search(query, result);
+  TEST_CHECK(result.elements.size() == 2 && result.total == 3 && result.version == engine.GetSnapshotVersion(),
+             "Search reports the total and the snapshot version");
+
+  // The index follows incremental updates
+  tree.playBtn->SetName("Pause");
+  engine.ApplyEvent(MakeEvent(Type::PROPERTY_CHANGED, tree.playBtn, Accessibility::EventDetail::ACCESSIBLE_NAME));
+  query              = {};
+  query.nameContains = "play";
+  TEST_CHECK(SearchIds(engine, query) == Ids{8}, "Renamed elements leave the old name");
+  query.nameContains = "pause";
+  TEST_CHECK(SearchIds(engine, query) == Ids{6}, "Renamed elements are found by the new name");
+
+  auto shuffle = std::make_shared<TestAccessible>("Shuffle", Accessibility::Role::PUSH_BUTTON);
+  tree.content->AddChild(shuffle);
+  engine.ApplyEvent(MakeEvent(Type::CHILDREN_CHANGED, tree.content));
+  query      = {};
+  query.role = "PUSH_BUTTON";
+  TEST_CHECK(SearchIds(engine, query) == (Ids{3, 6, 10, 11, 12}), "Added elements are indexed");
+  tree.content->RemoveChild(shuffle);
+  engine.ApplyEvent(MakeEvent(Type::CHILDREN_CHANGED, tree.content));
+  TEST_CHECK(SearchIds(engine, query) == (Ids{3, 6, 10, 11}), "Removed elements leave the index");
+
+  query            = {};
+  query.intersects = true;
+  query.areaX      = 190.0f;
+  query.areaY      = 290.0f;
+  query.areaWidth  = 100.0f;
+  query.areaHeight = 100.0f;
+  TEST_CHECK(SearchIds(engine, query) == (Ids{1, 5, 6}), "Search by area finds overlapping elements");
+  query.areaX     = 0.0f;
+  query.areaY     = 745.0f;
+  query.areaWidth = 480.0f;
+  query.role      = "push_button";
+  TEST_CHECK(SearchIds(engine, query) == (Ids{10, 11}), "Area filters combine with the role");
+  query.nameContains = "next";
+  TEST_CHECK(SearchIds(engine, query) == Ids{11}, "Area filters combine with the name");
+
+  InspectorEngine::WebInspectorServer server;
+  const int port = StartWebInspector(server, engine, 3);
+  TEST_CHECK(port != 0, "Web inspector server accepts requests");
+  if(port == 0)
+  {
+    server.Stop();
+    return;
+  }
+
+  httplib::Client client("127.0.0.1", port);
+  auto res = client.Get("/api/search?role=push_button&states=FOCUSABLE,!CHECKED&limit=2");
+  TEST_CHECK(res && res->status == 200 && res->body.find("\"total\":4") != std::string::npos &&
+               res->body.find("\"results\":[{\"id\":3,") != std::string::npos &&
+               res->body.find("\"id\":10") == std::string::npos,
+             "/api/search returns the first matches and the total");
+  res = client.Get("/api/search?name=bohemian");
+  TEST_CHECK(res && res->body.find("\"name\":\"Now Playing: Bohemian Rhapsody\"") != std::string::npos,
+             "/api/search matches names");
+  res = client.Get("/api/search?role=PUSH_BUTTON&area=0,0,480,60");
+  TEST_CHECK(res && res->body.find("\"total\":1") != std::string::npos && res->body.find("\"id\":3") != std::string::npos,
+             "/api/search filters by area");
+
+  server.Stop();
+}
+
+// ========================================================================
+// Snapshot files
+// ========================================================================
+static bool SameTree(const InspectorEngine::TreeNode& a, const InspectorEngine::TreeNode& b)
+{
+  if(a.id != b.id || a.name != b.name || a.role != b.role || a.childCount != b.childCount ||
+     a.children.size() != b.children.size())
+  {
+    return false;
+  }
+  for(size_t i = 0; i < a.children.size(); ++i)
+  {
+    if(!SameTree(a.children[i], b.children[i])) return false;
+  }
+  return true;
+}
+
+static void WriteBytes(const std::string& path, const std::string& bytes)
+{
+  std::ofstream(path, std::ios::binary).write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+static void TestSnapshotFile()
+{
+  std::cout << "\n--- Snapshot File Tests ---" << std::endl;
+
+  using Type = Accessibility::AccessibilityEvent::Type;
+
+  MockAppRegistry registry;
+  auto& tree = registry.getDemoTree();
+  tree.playBtn->SetAttributes({{"automationId", "play_button"}});
+
+  InspectorEngine::NodeProxyQueryEngine live;
+  live.BuildSnapshot(registry.createProxy(tree.window.get()));
+  live.SetFocusedId(7);
+
+  const std::string path       = "/tmp/accessibility-snapshot-" + std::to_string(getpid());
+  const std::string first      = path + "-1.a11ysnap";
+  const std::string second     = path + "-2.a11ysnap";
+  const std::string corrupt    = path + "-corrupt.a11ysnap";
+  TEST_CHECK(live.SaveSnapshot(first), "Snapshot is saved to a file");
+
+  InspectorEngine::SnapshotFileQueryEngine file;
+  TEST_CHECK(file.Open(first) && file.IsOpen(), "Snapshot file opens");
+  TEST_CHECK(file.GetSnapshotSize() == live.GetSnapshotSize() && file.GetRootId() == live.GetRootId() &&
+               file.GetSnapshotVersion() == live.GetSnapshotVersion() && file.GetFocusedId() == 7,
+             "Snapshot file keeps size, root, version and focus");
+
+  auto fromFile = file.GetElementInfo(6);
+  auto fromLive = live.GetElementInfo(6);
+  TEST_CHECK(fromFile.name == fromLive.name && fromFile.role == fromLive.role && fromFile.states == fromLive.states &&
+               fromFile.automationId == "play_button" && fromFile.parentId == fromLive.parentId &&
+               fromFile.boundsWidth == fromLive.boundsWidth,
+             "Elements read from the file match the live snapshot");
+  TEST_CHECK(SameTree(file.BuildTree(file.GetRootId()), live.BuildTree(live.GetRootId())), "Trees read from the file match");
+  TEST_CHECK(file.BuildSubtree(5, 0).childCount == 3 && file.BuildSubtree(5, 0).children.empty(), "Depth-limited trees from the file");
+  TEST_CHECK(file.Navigate(3, true) == live.Navigate(3, true) && file.Navigate(3, false) == live.Navigate(3, false) &&
+               file.NavigateChild(5) == 6 && file.NavigateParent(6) == 5,
+             "Navigation over the file matches the live snapshot");
+  TEST_CHECK(file.GetElementInfo(999).name == "(not found)", "Unknown ids are reported as not found");
+
+  InspectorEngine::SearchQuery query;
+  query.role   = "PUSH_BUTTON";
+  query.states = {"FOCUSABLE"};
+  InspectorEngine::SearchResult result;
+  TEST_CHECK(file.Search(query, result) && result.total == 4 && result.elements[1].automationId == "play_button",
+             "Snapshot files are searchable");
+  query            = {};
+  query.intersects = true;
+  query.areaY      = 745.0f;
+  query.areaWidth  = 480.0f;
+  query.areaHeight = 10.0f;
+  TEST_CHECK(file.Search(query, result) && result.total == 4 && result.elements[3].id == 11,
+             "Snapshot files are searchable by area");
+
+  std::string bytes;
+  std::string mapped;
+  live.SerializeSnapshot(bytes);
+  file.SerializeSnapshot(mapped);
+  TEST_CHECK(bytes == mapped, "Serialized snapshots are reproducible");
+
+  // A later capture compares against the earlier one
+  tree.playBtn->SetName("Pause");
+  live.ApplyEvent(MakeEvent(Type::PROPERTY_CHANGED, tree.playBtn, Accessibility::EventDetail::ACCESSIBLE_NAME));
+  auto shuffle = std::make_shared<TestAccessible>("Shuffle", Accessibility::Role::PUSH_BUTTON);
+  tree.content->AddChild(shuffle);
+  live.ApplyEvent(MakeEvent(Type::CHILDREN_CHANGED, tree.content));
+  tree.footer->RemoveChild(tree.nextBtn);
+  live.ApplyEvent(MakeEvent(Type::CHILDREN_CHANGED, tree.footer));
+  live.SaveSnapshot(second);
+
+  InspectorEngine::SnapshotFileQueryEngine later;
+  TEST_CHECK(later.Open(second), "Second snapshot file opens");
+  auto diff = later.CompareTo(file);
+  TEST_CHECK(diff.added.size() == 1 && diff.added[0].name == "Shuffle", "Comparing captures lists added elements");
+  TEST_CHECK(diff.removed == std::vector<uint32_t>{11}, "Comparing captures lists removed elements");
+  TEST_CHECK(diff.changed.size() == 3 && diff.changed[0].id == 5 && diff.changed[1].name == "Pause" && diff.changed[2].id == 9,
+             "Comparing captures lists changed elements");
+  TEST_CHECK(file.CompareTo(file).changed.empty() && file.CompareTo(file).added.empty(), "A capture equals itself");
+
+  // Damaged files are rejected without reading past the mapping
+  InspectorEngine::SnapshotFileQueryEngine damaged;
+  TEST_CHECK(!damaged.Open(path + "-missing") && !damaged.GetError().empty(), "Missing files fail to open");
+  WriteBytes(corrupt, bytes.substr(0, bytes.size() / 2));
+  TEST_CHECK(!damaged.Open(corrupt) && damaged.GetError().find("truncated") != std::string::npos, "Truncated files fail to open");
+  auto wrongMagic = bytes;
+  wrongMagic[0]   = 'X';
+  WriteBytes(corrupt, wrongMagic);
+  TEST_CHECK(!damaged.Open(corrupt) && !damaged.IsOpen(), "Files with a wrong magic fail to open");
+  auto wrongVersion = bytes;
+  wrongVersion[8]   = 99;
+  WriteBytes(corrupt, wrongVersion);
+  TEST_CHECK(!damaged.Open(corrupt) && damaged.GetError().find("version") != std::string::npos, "Files of another format version fail to open");
+
+  // Every node lists the next one twice and the last links back to the root:
+  // a naive walk would expand 2^40 paths
+  std::vector<InspectorEngine::SnapshotFile::Element> linked(40);
+  for(uint32_t id = 1; id <= linked.size(); ++id)
+  {
+    auto& info    = linked[id - 1].info;
+    uint32_t next = id % linked.size() + 1;
+    info.id       = id;
+    info.name     = "Node " + std::to_string(id);
+    info.childIds = {next, next};
+  }
+  WriteBytes(corrupt, InspectorEngine::SnapshotFile::Serialize(1, 1, 0, linked, {}));
+  auto cyclic = damaged.Open(corrupt) ? damaged.BuildTree(1) : InspectorEngine::TreeNode{};
+  size_t expanded = 0;
+  for(auto* node = &cyclic; !node->children.empty(); node = &node->children[0])
+  {
+    expanded += node->children[1].children.empty() ? 1 : 0;
+  }
+  TEST_CHECK(expanded == 40 && cyclic.children[0].children.size() == 2,
+             "Linked nodes of a corrupt file are expanded once each");
+
+  // Snapshot files are served like a live tree, and live snapshots can be downloaded
+  InspectorEngine::WebInspectorServer server;
+  const int port = StartWebInspector(server, file, 4);
+  InspectorEngine::WebInspectorServer liveServer;
+  const int livePort = StartWebInspector(liveServer, live, 5);
+  TEST_CHECK(port != 0 && livePort != 0, "Web inspector servers accept requests");
+  if(port != 0 && livePort != 0)
+  {
+    httplib::Client client("127.0.0.1", port);
+    auto res = client.Get("/api/element/6");
+    TEST_CHECK(res && res->body.find("\"name\":\"Play\"") != std::string::npos, "A snapshot file is served over HTTP");
+
+    httplib::Client liveClient("127.0.0.1", livePort);
+    res = liveClient.Get("/api/snapshot");
+    std::string current;
+    live.SerializeSnapshot(current);
+    TEST_CHECK(res && res->status == 200 && res->body == current &&
+                 res->get_header_value("Content-Disposition").find(".a11ysnap") != std::string::npos,
+               "/api/snapshot downloads the live snapshot");
+  }
+  server.Stop();
+  liveServer.Stop();
+
+  std::remove(first.c_str());
+  std::remove(second.c_str());
+  std::remove(corrupt.c_str());
+}
+
 // ========================================================================
 // InspectorService lifecycle tests
 // ========================================================================
@@ -269,8 +1274,9 @@ static void TestInspectorServiceEvents()
 {
   std::cout << "\n--- InspectorService Event Tests ---" << std::endl;
 
-  auto registryPtr = std::make_unique<MockAppRegistry>();
-  auto gesturePtr  = std::make_unique<MockGestureProvider>();
+  auto  registryPtr = std::make_unique<MockAppRegistry>();
+  auto  gesturePtr  = std::make_unique<MockGestureProvider>();
+  auto& registry    = *registryPtr;
 
   Accessibility::InspectorService::Config config;
   config.port = 0;
@@ -291,6 +1297,16 @@ static void TestInspectorServiceEvents()
   service.dispatchEvent(windowEvent);
   TEST_CHECK(service.getQueryEngine().GetSnapshotSize() == 11, "WINDOW_CHANGED triggers auto-refresh");
 
+  // Events keep the snapshot current
+  auto& tree = registry.getDemoTree();
+  tree.titleLabel->SetName("Now Playing");
+  Accessibility::AccessibilityEvent nameEvent;
+  nameEvent.type   = Accessibility::AccessibilityEvent::Type::PROPERTY_CHANGED;
+  nameEvent.source = tree.titleLabel->GetAddress();
+  nameEvent.detail = Accessibility::EventDetail::ACCESSIBLE_NAME;
+  service.dispatchEvent(nameEvent);
+  TEST_CHECK(service.getQueryEngine().GetElementInfo(4).name == "Now Playing", "PROPERTY_CHANGED patches the snapshot");
+
   // Events after stop should be ignored
   service.stopInspector();
   Accessibility::AccessibilityEvent postStop;
@@ -324,6 +1340,16 @@ int main()
   std::cout << "=== InspectorService Unit Tests ===" << std::endl;
 
   TestNodeProxyQueryEngine();
+  TestNodeProxyQueryEngineIncremental();
+  TestSnapshotCrawler();
+  TestWebInspectorConcurrentReaders();
+  TestWebInspectorLazyTree();
+  TestSnapshotDiffs();
+  TestSearchIndex();
+  TestNodeStore();
+  TestPersistentIdMap();
+  TestNodeProxyQueryEngineSearch();
+  TestSnapshotFile();
   TestInspectorServiceLifecycle();
   TestInspectorServiceDestructorCleanup();
   TestInspectorServiceRefreshSnapshot();
@@ -16,10 +16,16 @@
  */
 
 // EXTERNAL INCLUDES
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <vector>
 
 // INTERNAL INCLUDES
@@ -28,16 +34,27 @@
 #include <accessibility/api/feedback-provider.h>
 #include <accessibility/api/reading-composer.h>
 #include <accessibility/api/screen-reader-service.h>
+#include <accessibility/api/task-executor.h>
 #include <accessibility/api/tts-engine.h>
+#include <accessibility/internal/service/inline-task-executor.h>
+#include <accessibility/internal/service/thread-task-executor.h>
+#include <accessibility/internal/service/screen-reader/async-tts-engine.h>
+#include <accessibility/internal/service/screen-reader/cached-tts-engine.h>
+#include <accessibility/internal/service/screen-reader/reading-prefetcher.h>
 #include <accessibility/internal/service/screen-reader/symbol-table.h>
+#include <accessibility/internal/service/screen-reader/text-mirror.h>
 #include <accessibility/internal/service/screen-reader/tts-command-queue.h>
 #include <test/mock/mock-app-registry.h>
+#include <test/mock/mock-audio-sink.h>
 #include <test/mock/mock-feedback-provider.h>
 #include <test/mock/mock-gesture-provider.h>
 #include <test/mock/mock-node-proxy.h>
 #include <test/mock/mock-screen-reader-switch.h>
 #include <test/mock/mock-settings-provider.h>
+#include <test/mock/mock-speech-synthesizer.h>
+#include <test/mock/mock-task-executor.h>
 #include <test/mock/mock-tts-engine.h>
+#include <test/mock/simulated-tts-engine.h>
 #include <test/test-accessible.h>
 
 // Stub for DirectReadingService (no-op)
@@ -88,6 +105,71 @@ static void TestSymbolTable()
   TEST_CHECK(SymbolTable::lookup(",") == "comma", "Comma symbol");
   TEST_CHECK(SymbolTable::lookup("?") == "question mark", "Question mark symbol");
   TEST_CHECK(SymbolTable::lookup("xyz").empty(), "Unknown symbol returns empty");
+  TEST_CHECK(SymbolTable::lookup("\xE2\x82\xAC") == "euro sign", "Multi-byte symbol");
+  TEST_CHECK(SymbolTable::lookup("").empty(), "Empty symbol returns empty");
+  TEST_CHECK(SymbolTable::lookup("..").empty(), "Symbol prefix match is not a lookup hit");
+
+  // Single-pass expansion
+  {
+    auto        table = SymbolTable::getDefault();
+    std::string out;
+    table->expand("user@example.com", out);
+    TEST_CHECK(out == "user at sign example dot com", "Expand separates spoken symbols");
+
+    out.clear();
+    table->expand("Price: \xE2\x82\xAC""5, caf\xC3\xA9", out);
+    TEST_CHECK(out == "Price colon euro sign 5 comma caf\xC3\xA9", "Expand handles multi-byte symbols and keeps other text");
+
+    out.clear();
+    table->expand("a b", out, true);
+    TEST_CHECK(out == "a space b", "Expand speaks whitespace when asked");
+
+    out = "Prefix:";
+    table->expand("!", out);
+    TEST_CHECK(out == "Prefix: exclamation mark", "Expand appends to the buffer");
+  }
+
+  // Longest match wins
+  {
+    auto table = SymbolTable::create({{".", "dot"}, {"...", "ellipsis"}, {"..", ""}});
+    TEST_CHECK(table && table->getSymbolCount() == 2, "Empty spoken texts are ignored");
+    std::string out;
+    table->expand("wait....", out);
+    TEST_CHECK(out == "wait ellipsis dot", "Longest symbol is matched first");
+    std::string_view spoken;
+    TEST_CHECK(table->match("..x", 0, spoken) == 1 && spoken == "dot", "Match falls back to the longest complete symbol");
+  }
+
+  // Data file round trip
+  {
+    std::string directory = "/tmp/a11y-symbols-" + std::to_string(getpid());
+    mkdir(directory.c_str(), 0700);
+    auto write = [&](const std::string& name, const std::string& data) {
+      FILE* file = fopen((directory + "/" + name).c_str(), "wb");
+      fwrite(data.data(), 1, data.size(), file);
+      fclose(file);
+    };
+    write("de.symbols", SymbolTable::serialize({{".", "Punkt"}, {"@", "At-Zeichen"}}));
+    write("xx.symbols", "ASYM broken");
+
+    auto german = SymbolTable::loadForLanguage(directory, "de_DE");
+    TEST_CHECK(german != nullptr, "Regional language falls back to the base language file");
+    TEST_CHECK(german && german->find("@") == "At-Zeichen", "Mapped table finds symbols");
+    TEST_CHECK(german && german->find(",").empty(), "Mapped table holds only its own symbols");
+    TEST_CHECK(SymbolTable::loadForLanguage(directory, "fr") == nullptr, "Missing language returns nullptr");
+    TEST_CHECK(SymbolTable::load(directory + "/xx.symbols") == nullptr, "Malformed file is rejected");
+
+    auto data = SymbolTable::serialize({{"-", "minus"}});
+    data.resize(data.size() - 1);
+    write("yy.symbols", data);
+    TEST_CHECK(SymbolTable::load(directory + "/yy.symbols") == nullptr, "Truncated file is rejected");
+
+    for(auto name : {"de.symbols", "xx.symbols", "yy.symbols"})
+    {
+      unlink((directory + "/" + name).c_str());
+    }
+    rmdir(directory.c_str());
+  }
 }
 
 // ========================================================================
@@ -323,6 +405,94 @@ static void TestReadingComposerCompose()
   }
 }
 
+static void TestReadingComposerCache()
+{
+  std::cout << "\n--- ReadingComposer Cache ---" << std::endl;
+
+  // Exact output across traits and separators
+  {
+    ReadingComposer composer;
+    ReadingMaterial rm;
+    rm.name                    = "Volume";
+    rm.role                    = Role::SLIDER;
+    rm.currentValue            = 30.0;
+    rm.description             = "Media";
+    rm.states[State::ENABLED]  = true;
+    rm.states[State::REQUIRED] = true;
+    TEST_CHECK(composer.compose(rm) == "Required, Volume, Slider, 30, Media. Swipe up or down to adjust", "Compose joins traits in order");
+
+    ReadingComposer tvComposer(ReadingComposerConfig{true, true});
+    ReadingMaterial progress;
+    progress.role                   = Role::PROGRESS_BAR;
+    progress.currentValue           = 42.7;
+    progress.states[State::ENABLED] = true;
+    TEST_CHECK(tvComposer.compose(progress) == "Progress bar, 42%", "TV progress trait");
+  }
+
+  // Repeated reading of the same node is served from the cache
+  {
+    ReadingComposer composer;
+    ReadingMaterial rm;
+    rm.name                   = "OK";
+    rm.role                   = Role::PUSH_BUTTON;
+    rm.states[State::ENABLED] = true;
+    auto first                = composer.compose(rm);
+    auto second               = composer.compose(rm);
+    TEST_CHECK(first == second, "Cached text matches");
+    auto stats = composer.getStats();
+    TEST_CHECK(stats.misses == 1, "First compose misses");
+    TEST_CHECK(stats.hits == 1, "Second compose hits");
+
+    // Any field the reading depends on invalidates the entry
+    rm.states[State::ENABLED] = false;
+    TEST_CHECK(composer.compose(rm) == "Disabled, OK, Button, Double tap to activate", "Changed state is recomposed");
+    rm.states[State::ENABLED] = true;
+    rm.description            = "Confirms";
+    TEST_CHECK(composer.compose(rm) == "OK, Button, Confirms. Double tap to activate", "Changed description is recomposed");
+    TEST_CHECK(composer.getStats().misses == 3, "Changed fields miss");
+  }
+
+  // Fields that only differ in their split between strings do not collide
+  {
+    ReadingComposer composer;
+    ReadingMaterial a;
+    a.name        = "ab";
+    a.description = "c";
+    ReadingMaterial b;
+    b.name        = "a";
+    b.description = "bc";
+    TEST_CHECK(composer.compose(a) != composer.compose(b), "Keys are length-prefixed");
+  }
+
+  // The cache holds a bounded number of readings
+  {
+    ReadingComposer composer;
+    for(int round = 0; round < 2; ++round)
+    {
+      for(int i = 0; i < 20; ++i)
+      {
+        ReadingMaterial rm;
+        rm.name = "Item " + std::to_string(i);
+        rm.role = Role::LIST_ITEM;
+        composer.compose(rm);
+      }
+    }
+    TEST_CHECK(composer.getStats().hits == 0, "Cycling more nodes than entries never hits");
+  }
+
+  // composeInto reuses the caller's buffer
+  {
+    ReadingComposer composer;
+    ReadingMaterial rm;
+    rm.name                   = "Settings";
+    rm.role                   = Role::LIST_ITEM;
+    rm.states[State::ENABLED] = true;
+    std::string buffer        = "stale text that is longer than the reading";
+    composer.composeInto(rm, buffer);
+    TEST_CHECK(buffer == composer.compose(rm), "composeInto replaces buffer contents");
+  }
+}
+
 // ========================================================================
 // TtsCommandQueue Tests
 // ========================================================================
@@ -476,6 +646,575 @@ static void TestTtsCommandQueue()
     }
     TEST_CHECK(engine.getSpokenTexts().size() >= 2, "Chunked text: subsequent chunks spoken");
   }
+
+  // Lookahead: asynchronous engines receive the next command while the current one plays
+  {
+    MockTtsEngine engine;
+    engine.setLookahead(1);
+    TtsCommandQueue queue(engine);
+    queue.enqueue("One");
+    queue.enqueue("Two");
+    queue.enqueue("Three");
+    TEST_CHECK(engine.getSpokenTexts().size() == 2, "Lookahead: one command submitted ahead");
+    TEST_CHECK(queue.pendingCount() == 1, "Lookahead: the rest stays queued");
+    engine.fireUtteranceCompleted(1);
+    TEST_CHECK(engine.getSpokenTexts().size() == 3 && engine.getSpokenTexts()[2] == "Three", "Lookahead: refilled on completion");
+    engine.fireUtteranceCompleted(1);
+    TEST_CHECK(engine.getSpokenTexts().size() == 3, "Lookahead: stale completion ignored");
+    engine.fireUtteranceCompleted(3);
+    queue.enqueue("Four");
+    queue.enqueue("Five");
+    TEST_CHECK(engine.getSpokenTexts().size() == 5, "Lookahead: completing a later command retires earlier ones");
+
+    queue.purgeDiscardable();
+    TEST_CHECK(engine.getStopCount() == 1, "Lookahead: purge stops submitted commands");
+    queue.enqueue("Six");
+    queue.enqueue("Seven");
+    TEST_CHECK(engine.getSpokenTexts().size() == 7, "Lookahead: nothing in flight after purge");
+  }
+
+  // Lookahead: purging keeps an important command submitted behind a discardable one
+  {
+    MockTtsEngine engine;
+    engine.setLookahead(1);
+    TtsCommandQueue queue(engine, TtsCommandQueue::Config{10});
+    queue.enqueue("Reading", true);
+    queue.enqueue("alpha beta gamma", false);
+    TEST_CHECK(engine.getSpokenTexts().size() == 2 && engine.getSpokenTexts()[1] == "alpha beta", "Purge lookahead: important chunk submitted");
+
+    queue.purge(TtsCommandQueue::Priority::HINT);
+    TEST_CHECK(engine.getStopCount() == 0, "Purge lookahead: purging an idle lane stops nothing");
+
+    queue.purgeDiscardable();
+    auto& spoken = engine.getSpokenTexts();
+    TEST_CHECK(engine.getStopCount() == 1, "Purge lookahead: discardable command stopped");
+    TEST_CHECK(spoken.size() == 4 && spoken[2] == "alpha beta" && spoken[3] == "gamma",
+               "Purge lookahead: important command resubmitted from its chunk");
+
+    queue.purge(TtsCommandQueue::Priority::NORMAL);
+    TEST_CHECK(engine.getStopCount() == 1 && spoken.size() == 4, "Purge lookahead: other lanes keep speaking");
+    engine.fireUtteranceCompleted(4);
+    TEST_CHECK(spoken.size() == 4 && queue.pendingCount() == 0, "Purge lookahead: important text spoken once to the end");
+  }
+
+  // Priority lanes: important speech first, hints last
+  {
+    MockTtsEngine engine;
+    TtsCommandQueue queue(engine);
+    queue.enqueue("Playing");
+    queue.enqueue("Double tap to activate", TtsCommandQueue::Priority::HINT);
+    queue.enqueue("Item", TtsCommandQueue::Priority::NORMAL);
+    queue.enqueue("Battery low", TtsCommandQueue::Priority::IMPORTANT);
+    engine.fireUtteranceCompleted(1);
+    engine.fireUtteranceCompleted(2);
+    engine.fireUtteranceCompleted(3);
+    auto& spoken = engine.getSpokenTexts();
+    TEST_CHECK(spoken.size() == 4 && spoken[1] == "Battery low" && spoken[2] == "Item" && spoken[3] == "Double tap to activate",
+               "Lanes: important, then normal, then hint");
+    TEST_CHECK(!engine.getSpeakOptions()[1].discardable && engine.getSpeakOptions()[3].discardable,
+               "Lanes: only important speech is non-discardable");
+  }
+
+  // Purging one lane leaves the others
+  {
+    MockTtsEngine engine;
+    TtsCommandQueue queue(engine);
+    queue.enqueue("Playing");
+    queue.enqueue("Hint one", TtsCommandQueue::Priority::HINT);
+    queue.enqueue("Hint two", TtsCommandQueue::Priority::HINT);
+    queue.enqueue("Alert", TtsCommandQueue::Priority::IMPORTANT);
+    queue.purge(TtsCommandQueue::Priority::HINT);
+    TEST_CHECK(engine.getStopCount() == 0, "Lane purge: speech from other lanes keeps playing");
+    TEST_CHECK(queue.pendingCount() == 1, "Lane purge: other lanes kept");
+    queue.purge(TtsCommandQueue::Priority::NORMAL);
+    TEST_CHECK(engine.getStopCount() == 1 && engine.getSpokenTexts().back() == "Alert",
+               "Lane purge: playing speech from the lane stopped, next lane spoken");
+  }
+
+  // Long text is split one chunk per submission
+  {
+    MockTtsEngine engine;
+    TtsCommandQueue queue(engine, TtsCommandQueue::Config{10});
+    queue.enqueue("aaaa bbbbb ccccc ddddd");
+    TEST_CHECK(engine.getSpokenTexts().size() == 1 && engine.getSpokenTexts()[0] == "aaaa bbbbb", "Lazy chunks: first chunk only");
+    TEST_CHECK(queue.pendingCount() == 1, "Lazy chunks: remainder pending as one text");
+    engine.fireUtteranceCompleted(1);
+    engine.fireUtteranceCompleted(2);
+    TEST_CHECK(engine.getSpokenTexts().size() == 3 && engine.getSpokenTexts()[2] == "ddddd", "Lazy chunks: rest follows in order");
+    TEST_CHECK(queue.pendingCount() == 0, "Lazy chunks: text done after last chunk");
+
+    size_t offset = 0;
+    auto   range  = TtsCommandQueue::nextChunk("hello world", offset, 8);
+    TEST_CHECK(range.begin == 0 && range.end == 5 && offset == 6, "nextChunk: breaks at last space, skips it");
+    range = TtsCommandQueue::nextChunk("hello world", offset, 8);
+    TEST_CHECK(range.begin == 6 && range.end == 11 && offset == 11, "nextChunk: remainder");
+    range = TtsCommandQueue::nextChunk("hello world", offset, 8);
+    TEST_CHECK(range.begin == range.end, "nextChunk: empty at end");
+  }
+}
+
+// ========================================================================
+// SimulatedTtsEngine Tests
+// ========================================================================
+static void TestSimulatedTtsEngine()
+{
+  std::cout << "\n--- SimulatedTtsEngine ---" << std::endl;
+
+  using std::chrono::milliseconds;
+  using Time = SimulatedTtsEngine::Time;
+
+  SimulatedTtsEngine::Config config;
+  config.synthesisLatency    = milliseconds(100);
+  config.charactersPerSecond = 10.0;
+
+  // Synthesis latency, then playback for length / rate; rendering is pipelined
+  {
+    SimulatedTtsEngine engine(config);
+    std::vector<Accessibility::CommandId> completed;
+    engine.onUtteranceCompleted([&completed](Accessibility::CommandId id) { completed.push_back(id); });
+
+    auto first  = engine.speak("0123456789", {});
+    auto second = engine.speak("01234", {});
+    engine.advanceTo(Time(milliseconds(99)));
+    TEST_CHECK(engine.findRecord(first)->startedAt < Time(0), "Simulated: not started before synthesis latency");
+    engine.advanceTo(Time(milliseconds(100)));
+    TEST_CHECK(engine.findRecord(first)->startedAt == Time(milliseconds(100)), "Simulated: starts once rendered");
+    TEST_CHECK(engine.getQueueDepth() == 2, "Simulated: both utterances pending");
+    engine.runUntilIdle();
+    TEST_CHECK(engine.findRecord(first)->finishedAt == Time(milliseconds(1100)), "Simulated: plays length / rate");
+    TEST_CHECK(engine.findRecord(second)->startedAt == Time(milliseconds(1100)), "Simulated: rendered ahead, no gap");
+    TEST_CHECK(completed.size() == 2 && completed[1] == second && engine.now() == Time(milliseconds(1600)),
+               "Simulated: completions fire in order at their times");
+  }
+
+  // Pause freezes playback; purge drops discardable utterances
+  {
+    SimulatedTtsEngine engine(config);
+    auto playing = engine.speak("0123456789", {});
+    Accessibility::SpeakOptions important;
+    important.discardable = false;
+    auto kept = engine.speak("01234", important);
+    engine.speak("later", {});
+
+    engine.advanceTo(Time(milliseconds(600)));
+    engine.pause();
+    engine.advanceTo(Time(milliseconds(5000)));
+    TEST_CHECK(!engine.findRecord(playing)->completed, "Simulated: pause holds playback");
+    engine.resume();
+    engine.advanceTo(Time(milliseconds(5499)));
+    TEST_CHECK(!engine.findRecord(playing)->completed, "Simulated: resume plays the remainder");
+    engine.advanceTo(Time(milliseconds(5500)));
+    TEST_CHECK(engine.findRecord(playing)->completed, "Simulated: completes after the remainder");
+
+    engine.purge(true);
+    TEST_CHECK(engine.getQueueDepth() == 1, "Simulated: purge keeps non-discardable speech");
+    engine.runUntilIdle();
+    TEST_CHECK(engine.findRecord(kept)->completed && !engine.findRecord(3)->completed, "Simulated: purged speech never completes");
+  }
+
+  // Jitter is reproducible from the seed
+  {
+    config.jitter = milliseconds(40);
+    SimulatedTtsEngine a(config);
+    SimulatedTtsEngine b(config);
+    for(int i = 0; i < 8; ++i)
+    {
+      a.speak("x", {});
+      b.speak("x", {});
+    }
+    a.runUntilIdle();
+    b.runUntilIdle();
+    bool same = true;
+    for(auto& record : a.getRecords())
+    {
+      same = same && b.findRecord(record.id)->startedAt == record.startedAt;
+    }
+    TEST_CHECK(same, "Simulated: same seed, same timeline");
+
+    bool inRange = true, varied = false;
+    for(uint64_t seed = 1; seed <= 8; ++seed)
+    {
+      config.seed = seed;
+      SimulatedTtsEngine engine(config);
+      auto id = engine.speak("x", {});
+      engine.runUntilIdle();
+      auto startedAt = engine.findRecord(id)->startedAt;
+      inRange        = inRange && startedAt >= Time(milliseconds(60)) && startedAt <= Time(milliseconds(140));
+      varied         = varied || startedAt != Time(milliseconds(100));
+    }
+    TEST_CHECK(inRange && varied, "Simulated: jitter varies latency within bounds");
+  }
+}
+
+// ========================================================================
+// AsyncTtsEngine Tests
+// ========================================================================
+namespace
+{
+/**
+ * @brief Synthesizer that renders one block per word and holds after the first block until released.
+ */
+class GatedSynthesizer : public Accessibility::SpeechSynthesizer
+{
+public:
+  std::string getVoiceKey() const override { return "gated"; }
+
+  bool synthesize(const std::string& text, Accessibility::PcmBuffer& pcm) override
+  {
+    pcm.sampleRate = 1000;
+    pcm.samples.assign(text.begin(), text.end());
+    return true;
+  }
+
+  bool synthesizeStream(const std::string& text, const std::function<bool(std::shared_ptr<const Accessibility::PcmBuffer>)>& onBlock) override
+  {
+    bool first = true;
+    std::size_t begin = 0;
+    while(begin < text.size())
+    {
+      auto end   = std::min(text.find(' ', begin), text.size());
+      auto block = std::make_shared<Accessibility::PcmBuffer>();
+      synthesize(text.substr(begin, end - begin), *block);
+      if(!onBlock(std::move(block)))
+      {
+        return false;
+      }
+      if(first)
+      {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mHolding = true;
+        mChanged.notify_all();
+        mChanged.wait(lock, [this]() { return mReleased; });
+        first = false;
+      }
+      begin = end + 1;
+    }
+    return true;
+  }
+
+  void waitHolding()
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mChanged.wait(lock, [this]() { return mHolding; });
+  }
+
+  void release()
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mReleased = true;
+    mChanged.notify_all();
+  }
+
+private:
+  std::mutex              mMutex;
+  std::condition_variable mChanged;
+  bool                    mHolding{false};
+  bool                    mReleased{false};
+};
+
+/**
+ * @brief Synthesizer that holds on one phrase until released.
+ */
+class HeldPhraseSynthesizer : public Accessibility::SpeechSynthesizer
+{
+public:
+  explicit HeldPhraseSynthesizer(std::string heldPhrase)
+  : mHeldPhrase(std::move(heldPhrase))
+  {
+  }
+
+  std::string getVoiceKey() const override { return "held"; }
+
+  bool synthesize(const std::string& text, Accessibility::PcmBuffer& pcm) override
+  {
+    if(text == mHeldPhrase)
+    {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mHolding = true;
+      mChanged.notify_all();
+      mChanged.wait(lock, [this]() { return mReleased; });
+    }
+    pcm.sampleRate = 1000;
+    pcm.samples.assign(text.begin(), text.end());
+    return true;
+  }
+
+  void waitHolding()
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mChanged.wait(lock, [this]() { return mHolding; });
+  }
+
+  void release()
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mReleased = true;
+    mChanged.notify_all();
+  }
+
+private:
+  std::string             mHeldPhrase;
+  std::mutex              mMutex;
+  std::condition_variable mChanged;
+  bool                    mHolding{false};
+  bool                    mReleased{false};
+};
+
+} // namespace
+
+static void TestAsyncTtsEngine()
+{
+  std::cout << "\n--- AsyncTtsEngine ---" << std::endl;
+
+  using Accessibility::AsyncTtsEngine;
+
+  // Rendering runs ahead of playback; utterances are closed in order
+  {
+    auto synthesizer    = std::make_unique<MockSpeechSynthesizer>();
+    auto sink           = std::make_unique<MockAudioSink>();
+    auto synthesizerPtr = synthesizer.get();
+    auto sinkPtr        = sink.get();
+    AsyncTtsEngine engine(std::move(synthesizer), std::move(sink));
+
+    auto first  = engine.speak("Hello", {});
+    auto second = engine.speak("World", {});
+    TEST_CHECK(first != second, "speak returns distinct ids without waiting");
+    TEST_CHECK(engine.getLookahead() == 1, "AsyncTtsEngine accepts one utterance ahead");
+    engine.waitIdle();
+
+    TEST_CHECK(synthesizerPtr->getSynthesizedTexts().size() == 2, "Both utterances rendered before playback completes");
+    auto& segments = sinkPtr->getSegments();
+    TEST_CHECK(segments.size() == 4, "Each utterance: audio block plus closing segment");
+    if(segments.size() == 4)
+    {
+      TEST_CHECK(segments[0].id == first && segments[0].pcm && !segments[0].last, "First utterance audio");
+      TEST_CHECK(segments[1].id == first && !segments[1].pcm && segments[1].last, "First utterance closed");
+      TEST_CHECK(segments[2].id == second && segments[3].id == second && segments[3].last, "Second utterance follows");
+    }
+
+    Accessibility::CommandId completed = 0;
+    engine.onUtteranceCompleted([&completed](Accessibility::CommandId id) { completed = id; });
+    sinkPtr->fireUtteranceCompleted(first);
+    TEST_CHECK(completed == first, "Completion comes from the sink");
+
+    engine.pause();
+    TEST_CHECK(engine.isPaused(), "pause holds playback in the sink");
+    engine.resume();
+    TEST_CHECK(!engine.isPaused(), "resume releases playback");
+
+    synthesizerPtr->setFail(true);
+    sinkPtr->reset();
+    engine.speak("Broken", {});
+    engine.waitIdle();
+    TEST_CHECK(sinkPtr->getSegments().size() == 1 && sinkPtr->getSegments()[0].last, "Failed synthesis still closes the utterance");
+  }
+
+  // Stop cancels the utterance being rendered and everything queued
+  {
+    auto synthesizer    = std::make_unique<GatedSynthesizer>();
+    auto sink           = std::make_unique<MockAudioSink>();
+    auto synthesizerPtr = synthesizer.get();
+    auto sinkPtr        = sink.get();
+    AsyncTtsEngine engine(std::move(synthesizer), std::move(sink));
+
+    engine.speak("one two", {});
+    engine.speak("three", {});
+    synthesizerPtr->waitHolding();
+    engine.stop();
+    synthesizerPtr->release();
+    engine.waitIdle();
+
+    TEST_CHECK(sinkPtr->getStopCount() == 1, "stop stops the sink");
+    TEST_CHECK(sinkPtr->getSegments().size() == 1, "No block reaches the sink after stop");
+  }
+
+  // Purge keeps non-discardable utterances
+  {
+    auto synthesizer    = std::make_unique<GatedSynthesizer>();
+    auto sink           = std::make_unique<MockAudioSink>();
+    auto synthesizerPtr = synthesizer.get();
+    auto sinkPtr        = sink.get();
+    AsyncTtsEngine engine(std::move(synthesizer), std::move(sink));
+
+    Accessibility::SpeakOptions important;
+    important.discardable = false;
+    auto kept = engine.speak("alert now", important);
+    engine.speak("hint", {});
+    synthesizerPtr->waitHolding();
+    engine.purge(true);
+    synthesizerPtr->release();
+    engine.waitIdle();
+
+    auto& segments = sinkPtr->getSegments();
+    TEST_CHECK(sinkPtr->getPurgeCount() == 1 && sinkPtr->getLastPurgeOnlyDiscardable(), "purge forwarded to the sink");
+    TEST_CHECK(segments.size() == 3 && segments.back().id == kept && segments.back().last,
+               "Non-discardable utterance rendered to the end, discardable one dropped");
+  }
+}
+
+// ========================================================================
+// CachedTtsEngine Tests
+// ========================================================================
+static void TestCachedTtsEngine()
+{
+  std::cout << "\n--- CachedTtsEngine ---" << std::endl;
+
+  using Accessibility::CachedTtsEngine;
+
+  // Phrase splitting
+  {
+    auto phrases = CachedTtsEngine::SplitPhrases("OK, Button, double tap to activate.");
+    TEST_CHECK(phrases.size() == 3, "SplitPhrases: three phrases");
+    TEST_CHECK(phrases.size() == 3 && phrases[0] == "OK" && phrases[1] == "Button" && phrases[2] == "double tap to activate",
+               "SplitPhrases: trimmed, punctuation dropped");
+    auto numbers = CachedTtsEngine::SplitPhrases("1,000 items in v1.2");
+    TEST_CHECK(numbers.size() == 1, "SplitPhrases: punctuation inside numbers does not split");
+    TEST_CHECK(CachedTtsEngine::SplitPhrases(" , . ").empty(), "SplitPhrases: punctuation-only text yields nothing");
+  }
+
+  // Hits, misses, ordering and silence gaps
+  {
+    auto synthesizer    = std::make_unique<MockSpeechSynthesizer>();
+    auto sink           = std::make_unique<MockAudioSink>();
+    auto synthesizerPtr = synthesizer.get();
+    auto sinkPtr        = sink.get();
+    CachedTtsEngine::Config config;
+    config.phraseGapMs = 10;
+    CachedTtsEngine engine(std::move(synthesizer), std::move(sink), config);
+
+    auto id = engine.speak("OK, Button", {});
+    engine.waitIdle();
+    TEST_CHECK(synthesizerPtr->getSynthesizedTexts().size() == 2, "First utterance: every phrase synthesized");
+    auto& segments = sinkPtr->getSegments();
+    TEST_CHECK(segments.size() == 4, "First utterance: phrase, gap, phrase, end");
+    if(segments.size() == 4)
+    {
+      TEST_CHECK(segments[0].id == id && segments[0].pcm && segments[0].pcm->samples.size() == 2, "Segment 0 is 'OK'");
+      TEST_CHECK(segments[1].pcm && segments[1].pcm->samples.size() == 10 && segments[1].pcm->samples[0] == 0,
+                 "Segment 1 is 10 ms of silence");
+      TEST_CHECK(segments[2].pcm && segments[2].pcm->samples.size() == 6, "Segment 2 is 'Button'");
+      TEST_CHECK(!segments[3].pcm && segments[3].last && !segments[2].last, "Only the closing segment is last");
+    }
+
+    synthesizerPtr->reset();
+    sinkPtr->reset();
+    engine.speak("Cancel, Button", {});
+    engine.waitIdle();
+    TEST_CHECK(synthesizerPtr->getSynthesizedTexts().size() == 1 && synthesizerPtr->getSynthesizedTexts()[0] == "Cancel",
+               "Second utterance: only the new phrase synthesized");
+    auto stats = engine.getCacheStats();
+    TEST_CHECK(stats.hits == 1 && stats.misses == 3, "Cache stats count hits and misses");
+    TEST_CHECK(stats.entries == 3 && stats.bytes == (2 + 6 + 6) * sizeof(int16_t), "Cache stats count entries and bytes");
+    TEST_CHECK(stats.getHitRate() == 0.25, "Hit rate is hits / lookups");
+
+    synthesizerPtr->reset();
+    synthesizerPtr->setVoiceKey("other");
+    engine.speak("Button", {});
+    engine.waitIdle();
+    TEST_CHECK(synthesizerPtr->getSynthesizedTexts().size() == 1, "Voice change misses the cache");
+
+    engine.clearCache();
+    TEST_CHECK(engine.getCacheStats().entries == 0, "clearCache drops every phrase");
+  }
+
+  // LRU eviction by size
+  {
+    auto synthesizer    = std::make_unique<MockSpeechSynthesizer>();
+    auto synthesizerPtr = synthesizer.get();
+    CachedTtsEngine::Config config;
+    config.cacheBytes  = 8 * sizeof(int16_t);
+    config.phraseGapMs = 0;
+    CachedTtsEngine engine(std::move(synthesizer), std::make_unique<MockAudioSink>(), config);
+
+    engine.speak("aaaa, bbbb", {});
+    engine.speak("aaaa", {});           // a becomes most recently used
+    engine.speak("cccc", {});           // evicts b
+    engine.waitIdle();
+    synthesizerPtr->reset();
+    engine.speak("aaaa, bbbb", {});
+    engine.waitIdle();
+    TEST_CHECK(synthesizerPtr->getSynthesizedTexts().size() == 1 && synthesizerPtr->getSynthesizedTexts()[0] == "bbbb",
+               "LRU: least recently used phrase evicted");
+    TEST_CHECK(engine.getCacheStats().evictions >= 1, "LRU: evictions counted");
+    TEST_CHECK(engine.getCacheStats().bytes <= config.cacheBytes, "LRU: size stays within capacity");
+
+    synthesizerPtr->reset();
+    engine.speak("this phrase is larger than the cache", {});
+    engine.speak("this phrase is larger than the cache", {});
+    engine.waitIdle();
+    TEST_CHECK(synthesizerPtr->getSynthesizedTexts().size() == 2, "Oversized phrase is not cached");
+  }
+
+  // Playback control is forwarded to the sink
+  {
+    auto synthesizer    = std::make_unique<MockSpeechSynthesizer>();
+    auto sink           = std::make_unique<MockAudioSink>();
+    auto synthesizerPtr = synthesizer.get();
+    auto sinkPtr        = sink.get();
+    CachedTtsEngine engine(std::move(synthesizer), std::move(sink));
+
+    Accessibility::SpeakOptions options;
+    options.interrupt   = true;
+    options.discardable = false;
+    engine.speak("Alert", options);
+    engine.waitIdle();
+    TEST_CHECK(sinkPtr->getStopCount() == 1, "Interrupt stops the sink");
+    TEST_CHECK(!sinkPtr->getSegments().empty() && !sinkPtr->getSegments()[0].discardable, "Discardable flag forwarded");
+
+    engine.purge(true);
+    TEST_CHECK(sinkPtr->getPurgeCount() == 1 && sinkPtr->getLastPurgeOnlyDiscardable(), "purge forwarded");
+    engine.pause();
+    TEST_CHECK(engine.isPaused(), "pause forwarded");
+    engine.resume();
+    TEST_CHECK(!engine.isPaused(), "resume forwarded");
+
+    Accessibility::CommandId completed = 0;
+    engine.onUtteranceCompleted([&completed](Accessibility::CommandId id) { completed = id; });
+    sinkPtr->fireUtteranceCompleted(7);
+    TEST_CHECK(completed == 7, "Completion callback forwarded");
+
+    sinkPtr->reset();
+    synthesizerPtr->setFail(true);
+    engine.speak("Unrenderable", {});
+    engine.waitIdle();
+    TEST_CHECK(sinkPtr->getSegments().size() == 1 && sinkPtr->getSegments()[0].last, "Failed synthesis still closes the utterance");
+  }
+
+  // No silence is spliced in unless configured
+  {
+    auto sink    = std::make_unique<MockAudioSink>();
+    auto sinkPtr = sink.get();
+    CachedTtsEngine engine(std::make_unique<MockSpeechSynthesizer>(), std::move(sink));
+    engine.speak("OK, Button", {});
+    engine.waitIdle();
+    TEST_CHECK(sinkPtr->getSegments().size() == 3, "Default config: phrase, phrase, end");
+  }
+
+  // Misses are synthesized on the worker, outside the lock; stop cuts the utterance short
+  {
+    auto synthesizer    = std::make_unique<HeldPhraseSynthesizer>("slow");
+    auto sink           = std::make_unique<MockAudioSink>();
+    auto synthesizerPtr = synthesizer.get();
+    auto sinkPtr        = sink.get();
+    CachedTtsEngine engine(std::move(synthesizer), std::move(sink));
+
+    auto first = engine.speak("quick, slow, never", {});
+    TEST_CHECK(engine.getLookahead() == 1, "CachedTtsEngine accepts one utterance ahead");
+    synthesizerPtr->waitHolding();
+    TEST_CHECK(engine.getCacheStats().entries == 1, "speak() returns and the cache stays readable while a phrase is synthesized");
+    engine.stop();
+    synthesizerPtr->release();
+    engine.waitIdle();
+
+    auto& segments = sinkPtr->getSegments();
+    TEST_CHECK(segments.size() == 1 && segments[0].id == first && !segments[0].last,
+               "Stopped utterance ends after the phrase being synthesized, unclosed");
+    TEST_CHECK(engine.getCacheStats().entries == 2, "Phrase synthesized during the stop is still cached");
+
+    engine.speak("slow, never", {});
+    engine.waitIdle();
+    TEST_CHECK(segments.size() == 4 && segments.back().last, "Next utterance renders in full");
+  }
 }
 
 // ========================================================================
@@ -491,7 +1230,8 @@ struct ServiceMocks
   MockGestureProvider*   gesture{nullptr};
 };
 
-static std::unique_ptr<ScreenReaderService> CreateScreenReaderService(ServiceMocks& mocks)
+static std::unique_ptr<ScreenReaderService> CreateScreenReaderService(ServiceMocks& mocks,
+                                                                      std::unique_ptr<TaskExecutor> executor = nullptr)
 {
   auto registry = std::make_unique<MockAppRegistry>();
   auto gesture  = std::make_unique<MockGestureProvider>();
@@ -520,7 +1260,8 @@ static std::unique_ptr<ScreenReaderService> CreateScreenReaderService(ServiceMoc
     std::move(feedback),
     std::move(settings),
     std::move(srSwitch),
-    std::move(directReading));
+    std::move(directReading),
+    std::move(executor));
 }
 
 // ========================================================================
@@ -816,6 +1557,30 @@ static void TestScreenReaderServiceEvents()
     TEST_CHECK(!mocks.tts->getSpokenTexts().empty(), "PropertyChanged: re-read current");
   }
 
+  // PROPERTY_CHANGED from another object -> rejected by routing table, no IPC/read
+  {
+    ServiceMocks mocks;
+    auto service = CreateScreenReaderService(mocks);
+    service->startScreenReader();
+
+    GestureInfo fwd;
+    fwd.type = Gesture::ONE_FINGER_FLICK_RIGHT;
+    mocks.gesture->fireGesture(fwd);
+    mocks.tts->reset();
+
+    AccessibilityEvent other;
+    other.type   = AccessibilityEvent::Type::PROPERTY_CHANGED;
+    other.source = mocks.registry->getDemoTree().nextBtn->GetAddress();
+    service->dispatchEvent(other);
+    TEST_CHECK(mocks.tts->getSpokenTexts().empty(), "PropertyChanged: other source ignored");
+
+    AccessibilityEvent own;
+    own.type   = AccessibilityEvent::Type::PROPERTY_CHANGED;
+    own.source = mocks.registry->getDemoTree().menuBtn->GetAddress();
+    service->dispatchEvent(own);
+    TEST_CHECK(!mocks.tts->getSpokenTexts().empty(), "PropertyChanged: current node source re-read");
+  }
+
   // WINDOW_CHANGED -> sound
   {
     ServiceMocks mocks;
@@ -1133,6 +1898,309 @@ static void TestSettingsAndSwitch()
   }
 }
 
+// ========================================================================
+// Gesture Cancellation Tests (latest gesture wins)
+// ========================================================================
+static void TestScreenReaderServiceCancellation()
+{
+  std::cout << "\n--- ScreenReaderService Cancellation Tests ---" << std::endl;
+
+  // CancellationSource: a new token supersedes older ones
+  {
+    CancellationSource source;
+    CancellationToken  idle;
+    auto               first  = source.next();
+    auto               second = source.next();
+    TEST_CHECK(!idle.isCancelled(), "Default token is never cancelled");
+    TEST_CHECK(first.isCancelled(), "Older token cancelled by next()");
+    TEST_CHECK(!second.isCancelled(), "Latest token is live");
+    source.cancel();
+    TEST_CHECK(second.isCancelled(), "cancel() cancels the latest token");
+  }
+
+  // Burst of flicks: every node is highlighted in turn, only the last is read
+  {
+    ServiceMocks mocks;
+    auto executor = std::make_unique<MockTaskExecutor>();
+    auto pending  = executor.get();
+    auto service  = CreateScreenReaderService(mocks, std::move(executor));
+    service->startScreenReader();
+
+    GestureInfo fwd;
+    fwd.type = Gesture::ONE_FINGER_FLICK_RIGHT;
+    for(int i = 0; i < 3; ++i)
+    {
+      mocks.gesture->fireGesture(fwd);
+    }
+    TEST_CHECK(pending->getPendingCount() == 3, "Burst: gestures queued on executor");
+    TEST_CHECK(mocks.tts->getSpokenTexts().empty(), "Burst: nothing read on gesture thread");
+
+    pending->runAll();
+
+    auto current = service->getCurrentNode();
+    TEST_CHECK(current && current->getName() == "Play", "Burst: navigation moved three steps");
+    TEST_CHECK(mocks.tts->getSpokenTexts().size() == 1, "Burst: only one node read");
+    TEST_CHECK(!mocks.tts->getSpokenTexts().empty() &&
+               mocks.tts->getSpokenTexts().back().find("Play") != std::string::npos,
+               "Burst: last node read");
+    TEST_CHECK(mocks.feedback->getPlayedSounds().size() == 1, "Burst: one highlight sound");
+  }
+
+  // Highlighted event arriving while a navigation is queued is not read
+  {
+    ServiceMocks mocks;
+    auto executor = std::make_unique<MockTaskExecutor>();
+    auto pending  = executor.get();
+    auto service  = CreateScreenReaderService(mocks, std::move(executor));
+    service->startScreenReader();
+
+    GestureInfo fwd;
+    fwd.type = Gesture::ONE_FINGER_FLICK_RIGHT;
+    mocks.gesture->fireGesture(fwd);
+    pending->runAll();
+    mocks.tts->reset();
+
+    AccessibilityEvent event;
+    event.type    = AccessibilityEvent::Type::STATE_CHANGED;
+    event.detail  = "highlighted";
+    event.detail1 = 1;
+    event.source  = service->getCurrentNode()->getAddress();
+    service->dispatchEvent(event);
+    mocks.gesture->fireGesture(fwd);
+    pending->runAll();
+
+    TEST_CHECK(mocks.tts->getSpokenTexts().size() == 1, "Stale highlight event skipped");
+  }
+
+  // Settings come from the cached snapshot, kept current by the provider
+  {
+    ServiceMocks mocks;
+    auto service = CreateScreenReaderService(mocks);
+    service->startScreenReader();
+
+    int fetches = mocks.settings->getGetSettingsCount();
+    GestureInfo fwd;
+    fwd.type = Gesture::ONE_FINGER_FLICK_RIGHT;
+    mocks.gesture->fireGesture(fwd);
+    mocks.gesture->fireGesture(fwd);
+    TEST_CHECK(mocks.settings->getGetSettingsCount() == fetches, "Gestures do not query settings");
+
+    ScreenReaderSettings noSound;
+    noSound.soundFeedback = false;
+    mocks.settings->setSettings(noSound);
+    mocks.feedback->reset();
+    mocks.gesture->fireGesture(fwd);
+    TEST_CHECK(mocks.feedback->getPlayedSounds().empty(), "Settings change reaches snapshot");
+  }
+
+  // Worker thread executor: flicks run off the gesture thread, stop drains them
+  {
+    ServiceMocks mocks;
+    auto executor = std::make_unique<ThreadTaskExecutor>();
+    auto worker   = executor.get();
+    auto service  = CreateScreenReaderService(mocks, std::move(executor));
+    service->startScreenReader();
+
+    GestureInfo fwd;
+    fwd.type = Gesture::ONE_FINGER_FLICK_RIGHT;
+    for(int i = 0; i < 5; ++i)
+    {
+      mocks.gesture->fireGesture(fwd);
+    }
+    worker->waitIdle();
+
+    auto current = service->getCurrentNode();
+    TEST_CHECK(current && current->getName() == "Now Playing: Bohemian Rhapsody", "Worker: all flicks navigated");
+    TEST_CHECK(!mocks.tts->getSpokenTexts().empty(), "Worker: latest node read");
+
+    mocks.gesture->fireGesture(fwd);
+    service->stopScreenReader();
+    TEST_CHECK(!service->isScreenReaderRunning(), "Worker: stop waits for in-flight work");
+  }
+
+  // ThreadTaskExecutor runs tasks in order
+  {
+    ThreadTaskExecutor executor;
+    std::vector<int>   order;
+    for(int i = 0; i < 100; ++i)
+    {
+      executor.post([&order, i]() { order.push_back(i); });
+    }
+    executor.waitIdle();
+
+    bool inOrder = order.size() == 100;
+    for(size_t i = 0; inOrder && i < order.size(); ++i)
+    {
+      inOrder = order[i] == static_cast<int>(i);
+    }
+    TEST_CHECK(inOrder, "ThreadTaskExecutor: FIFO order");
+  }
+
+  // InlineTaskExecutor runs a task posted by a task after it returns
+  {
+    InlineTaskExecutor executor;
+    std::vector<int>   order;
+    executor.post([&]()
+    {
+      executor.post([&order]() { order.push_back(2); });
+      order.push_back(1);
+    });
+    TEST_CHECK(order == std::vector<int>({1, 2}), "InlineTaskExecutor: nested post runs after the task");
+  }
+}
+
+// ========================================================================
+// Reading Prefetch Tests
+// ========================================================================
+static void TestScreenReaderServicePrefetch()
+{
+  std::cout << "\n--- Reading Prefetch Tests ---" << std::endl;
+
+  Address origin{"bus", "1"};
+  Address next{"bus", "2"};
+
+  // Store then take from the same origin is a hit
+  {
+    ReadingPrefetcher prefetcher;
+    prefetcher.store(prefetcher.beginFetch(), origin, true, {nullptr, next, "Next"});
+    TEST_CHECK(prefetcher.getPredictedAddress(true) == next, "Prefetcher: predicted address");
+
+    ReadingPrefetcher::Prediction prediction;
+    TEST_CHECK(prefetcher.take(origin, true, prediction), "Prefetcher: hit");
+    TEST_CHECK(prediction.text == "Next", "Prefetcher: cached text");
+    TEST_CHECK(!prefetcher.getPredictedAddress(true), "Prefetcher: take clears cache");
+    TEST_CHECK(prefetcher.getHitCount() == 1 && prefetcher.getMissCount() == 0, "Prefetcher: hit counted");
+  }
+
+  // Wrong origin or direction is a miss
+  {
+    ReadingPrefetcher prefetcher;
+    prefetcher.store(prefetcher.beginFetch(), origin, true, {nullptr, next, "Next"});
+
+    ReadingPrefetcher::Prediction prediction;
+    TEST_CHECK(!prefetcher.take(origin, false, prediction), "Prefetcher: other direction misses");
+    TEST_CHECK(!prefetcher.take(next, true, prediction), "Prefetcher: other origin misses");
+    TEST_CHECK(prefetcher.getMissCount() == 2, "Prefetcher: misses counted");
+  }
+
+  // Invalidation drops the entry and discards fetches in flight
+  {
+    ReadingPrefetcher prefetcher;
+    prefetcher.store(prefetcher.beginFetch(), origin, true, {nullptr, next, "Next"});
+    auto epoch = prefetcher.beginFetch();
+    prefetcher.invalidate(next);
+    TEST_CHECK(!prefetcher.getPredictedAddress(true), "Prefetcher: invalidate drops entry");
+
+    prefetcher.store(epoch, origin, false, {nullptr, next, "Stale"});
+    TEST_CHECK(!prefetcher.getPredictedAddress(false), "Prefetcher: stale fetch not stored");
+  }
+
+  // A flick onto the predicted node speaks the prefetched text
+  {
+    ServiceMocks mocks;
+    auto service = CreateScreenReaderService(mocks);
+    service->startScreenReader();
+
+    GestureInfo fwd;
+    fwd.type = Gesture::ONE_FINGER_FLICK_RIGHT;
+    mocks.gesture->fireGesture(fwd);
+
+    // Renamed without an event: the prediction still holds the old text
+    auto& tree = mocks.registry->getDemoTree();
+    tree.titleLabel->SetName("Renamed Title");
+    mocks.gesture->fireGesture(fwd);
+
+    auto current = service->getCurrentNode();
+    TEST_CHECK(current && current->getName() == "Renamed Title", "Prefetch hit: navigated to predicted node");
+    TEST_CHECK(!mocks.tts->getSpokenTexts().empty() &&
+               mocks.tts->getSpokenTexts().back().find("My Tizen App") != std::string::npos,
+               "Prefetch hit: cached text spoken");
+
+    GestureInfo bwd;
+    bwd.type = Gesture::ONE_FINGER_FLICK_LEFT;
+    mocks.gesture->fireGesture(bwd);
+    current = service->getCurrentNode();
+    TEST_CHECK(current && current->getName() == "Menu", "Prefetch hit: backward prediction");
+  }
+
+  // A predicted node that cannot be highlighted any more is not spoken
+  {
+    ServiceMocks mocks;
+    auto service = CreateScreenReaderService(mocks);
+    service->startScreenReader();
+
+    GestureInfo fwd;
+    fwd.type = Gesture::ONE_FINGER_FLICK_RIGHT;
+    mocks.gesture->fireGesture(fwd);
+
+    auto& tree   = mocks.registry->getDemoTree();
+    auto  states = tree.titleLabel->GetStates();
+    states[Accessibility::State::DEFUNCT] = true;
+    tree.titleLabel->SetStates(states);
+    tree.titleLabel->SetName("Gone Title");
+    mocks.tts->reset();
+    mocks.gesture->fireGesture(fwd);
+
+    bool stale = false;
+    for(auto& text : mocks.tts->getSpokenTexts())
+    {
+      stale = stale || text.find("My Tizen App") != std::string::npos;
+    }
+    TEST_CHECK(!stale, "Prefetch hit on a defunct node: prediction not spoken");
+  }
+
+  // An event from the predicted node invalidates its cached reading
+  {
+    ServiceMocks mocks;
+    auto service = CreateScreenReaderService(mocks);
+    service->startScreenReader();
+
+    GestureInfo fwd;
+    fwd.type = Gesture::ONE_FINGER_FLICK_RIGHT;
+    mocks.gesture->fireGesture(fwd);
+
+    auto& tree = mocks.registry->getDemoTree();
+    tree.titleLabel->SetName("Renamed Title");
+
+    AccessibilityEvent event;
+    event.type   = AccessibilityEvent::Type::PROPERTY_CHANGED;
+    event.detail = EventDetail::ACCESSIBLE_NAME;
+    event.source = mocks.registry->createProxy(tree.titleLabel.get())->getAddress();
+    mocks.tts->reset();
+    service->dispatchEvent(event);
+    TEST_CHECK(mocks.tts->getSpokenTexts().empty(), "Predicted node event: current not re-read");
+
+    mocks.gesture->fireGesture(fwd);
+    TEST_CHECK(!mocks.tts->getSpokenTexts().empty() &&
+               mocks.tts->getSpokenTexts().back().find("Renamed Title") != std::string::npos,
+               "Predicted node event: fresh text spoken");
+  }
+
+  // A structural change elsewhere drops the predictions
+  {
+    ServiceMocks mocks;
+    auto service = CreateScreenReaderService(mocks);
+    service->startScreenReader();
+
+    GestureInfo fwd;
+    fwd.type = Gesture::ONE_FINGER_FLICK_RIGHT;
+    mocks.gesture->fireGesture(fwd);
+
+    auto& tree = mocks.registry->getDemoTree();
+    tree.header->RemoveChild(tree.titleLabel);
+
+    AccessibilityEvent event;
+    event.type   = AccessibilityEvent::Type::CHILDREN_CHANGED;
+    event.source = mocks.registry->createProxy(tree.header.get())->getAddress();
+    service->dispatchEvent(event);
+
+    mocks.gesture->fireGesture(fwd);
+    auto current = service->getCurrentNode();
+    TEST_CHECK(current && current->getName() == "Play", "Children change of another node: prediction dropped");
+    tree.header->AddChild(tree.titleLabel);
+  }
+}
+
 // ========================================================================
 // ReadNode Tests (via ScreenReaderService)
 // ========================================================================
@@ -1173,6 +2241,151 @@ static void TestReadNode()
   }
 }
 
+// ========================================================================
+// TextMirror Tests
+// ========================================================================
+static AccessibilityEvent MakeTextEvent(const Address& source, EventDetail detail, int position, int length, std::string text)
+{
+  AccessibilityEvent event;
+  event.type    = AccessibilityEvent::Type::TEXT_CHANGED;
+  event.source  = source;
+  event.detail  = detail;
+  event.detail1 = position;
+  event.detail2 = length;
+  event.text    = std::move(text);
+  return event;
+}
+
+static void TestTextMirror()
+{
+  std::cout << "\n--- TextMirror Tests ---" << std::endl;
+
+  auto accessible = std::make_shared<TestAccessible>("Entry", Role::ENTRY);
+  auto proxy      = std::make_shared<MockNodeProxy>(accessible.get(), [](Accessible*) { return nullptr; });
+  auto address    = accessible->GetAddress();
+
+  // Boundaries
+  {
+    accessible->SetText("Don't stop. Caf\xC3\xA9 au lait costs 3.50!\nNext line");
+    accessible->SetCursorOffset(2);
+    TextMirror mirror;
+    TEST_CHECK(mirror.load(proxy) && mirror.isValid(), "Mirror loads");
+    TEST_CHECK(mirror.getCharacterCount() == 46 && mirror.getCaretOffset() == 2, "Mirror counts characters and caret");
+    TEST_CHECK(mirror.getTextAtOffset(0, TextBoundary::CHARACTER).content == "D", "Character at offset");
+    TEST_CHECK(mirror.getTextAtOffset(15, TextBoundary::CHARACTER).content == "\xC3\xA9", "Multi-byte character");
+    TEST_CHECK(mirror.getTextAtOffset(2, TextBoundary::WORD).content == "Don't", "Word keeps inner apostrophe");
+    auto word = mirror.getTextAtOffset(13, TextBoundary::WORD);
+    TEST_CHECK(word.content == "Caf\xC3\xA9" && word.startOffset == 12 && word.endOffset == 16, "Word offsets are in characters");
+    TEST_CHECK(mirror.getTextAtOffset(10, TextBoundary::WORD).content == ".", "Punctuation is its own word");
+    TEST_CHECK(mirror.getTextAtOffset(3, TextBoundary::SENTENCE).content == "Don't stop. ", "Sentence includes trailing space");
+    TEST_CHECK(mirror.getTextAtOffset(30, TextBoundary::SENTENCE).content == "Caf\xC3\xA9 au lait costs 3.50!\n", "Decimal point does not end a sentence");
+    TEST_CHECK(mirror.getTextAtOffset(40, TextBoundary::LINE).content == "Next line", "Last line");
+    TEST_CHECK(mirror.getTextAtOffset(5, TextBoundary::LINE).endOffset == 37, "Line ends after the new line");
+    TEST_CHECK(mirror.getTextAtOffset(46, TextBoundary::CHARACTER).content.empty(), "Offset at the end is empty");
+  }
+
+  // Combining marks and joined emoji stay with their base character
+  {
+    accessible->SetText("e\xCC\x81\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBBx");
+    TextMirror mirror;
+    mirror.load(proxy);
+    TEST_CHECK(mirror.getTextAtOffset(1, TextBoundary::CHARACTER).content == "e\xCC\x81", "Combining mark joins its base");
+    auto emoji = mirror.getTextAtOffset(3, TextBoundary::CHARACTER);
+    TEST_CHECK(emoji.startOffset == 2 && emoji.endOffset == 5, "ZWJ sequence is one character");
+  }
+
+  // Deltas keep the copy current without fetching again
+  {
+    accessible->SetText("helo");
+    accessible->SetCursorOffset(3);
+    TextMirror mirror;
+    mirror.load(proxy);
+    auto requests = accessible->GetTextRequestCount();
+
+    std::string changed;
+    TEST_CHECK(mirror.applyEvent(MakeTextEvent(address, EventDetail::TEXT_INSERT, 3, 1, "l"), &changed), "Insert applied");
+    TEST_CHECK(changed == "l" && mirror.getText(0, -1) == "hello" && mirror.getCaretOffset() == 4, "Insert updates text and caret");
+    TEST_CHECK(mirror.applyEvent(MakeTextEvent(address, EventDetail::TEXT_DELETE, 0, 1, ""), &changed), "Delete applied");
+    TEST_CHECK(changed == "h" && mirror.getText(0, -1) == "ello", "Delete reports removed text");
+
+    AccessibilityEvent caret;
+    caret.type    = AccessibilityEvent::Type::TEXT_CARET_MOVED;
+    caret.source  = address;
+    caret.detail1 = 1;
+    TEST_CHECK(mirror.applyEvent(caret) && mirror.getCaretOffset() == 1, "Caret move applied");
+    TEST_CHECK(accessible->GetTextRequestCount() == requests, "Deltas cost no requests");
+
+    TEST_CHECK(!mirror.applyEvent(MakeTextEvent(Address{"other", "1"}, EventDetail::TEXT_INSERT, 0, 1, "x")) && mirror.isValid(),
+               "Other node's events are ignored");
+    TEST_CHECK(!mirror.applyEvent(MakeTextEvent(address, EventDetail::TEXT_DELETE, 0, 1, "z")) && !mirror.isValid(),
+               "Mismatching removal invalidates");
+    mirror.load(proxy);
+    TEST_CHECK(!mirror.applyEvent(MakeTextEvent(address, EventDetail::TEXT_INSERT, 0, 2, "")) && !mirror.isValid(),
+               "Insertion without text invalidates");
+  }
+}
+
+static void TestScreenReaderTextEcho()
+{
+  std::cout << "\n--- ScreenReaderService Text Echo Tests ---" << std::endl;
+
+  ServiceMocks mocks;
+  auto service = CreateScreenReaderService(mocks);
+  service->startScreenReader();
+
+  GestureInfo fwd;
+  fwd.type = Gesture::ONE_FINGER_FLICK_RIGHT;
+  mocks.gesture->fireGesture(fwd);
+  auto current    = std::dynamic_pointer_cast<MockNodeProxy>(service->getCurrentNode());
+  auto accessible = current ? dynamic_cast<TestAccessible*>(current->getAccessible()) : nullptr;
+  TEST_CHECK(accessible != nullptr, "Text echo: current node");
+  if(!accessible) return;
+
+  auto address = accessible->GetAddress();
+  accessible->SetText("ab");
+  accessible->SetCursorOffset(2);
+  mocks.tts->reset();
+
+  // First edit fetches the text once
+  accessible->SetText("abc");
+  service->dispatchEvent(MakeTextEvent(address, EventDetail::TEXT_INSERT, 2, 1, "c"));
+  TEST_CHECK(!mocks.tts->getSpokenTexts().empty() && mocks.tts->getSpokenTexts().back() == "c", "Typed character echoed");
+  auto requests = accessible->GetTextRequestCount();
+
+  // The caret move caused by typing is not read again
+  AccessibilityEvent caret;
+  caret.type    = AccessibilityEvent::Type::TEXT_CARET_MOVED;
+  caret.source  = address;
+  caret.detail1 = 3;
+  service->dispatchEvent(caret);
+  TEST_CHECK(mocks.tts->getSpokenTexts().size() == 1, "Caret move after typing is silent");
+
+  // Typing a space speaks its name
+  service->dispatchEvent(MakeTextEvent(address, EventDetail::TEXT_INSERT, 3, 1, " "));
+  TEST_CHECK(mocks.tts->getSpokenTexts().back() == "space", "Typed space spoken by name");
+
+  // Moving the caret reads the character under it
+  caret.detail1 = 1;
+  service->dispatchEvent(caret);
+  TEST_CHECK(mocks.tts->getSpokenTexts().back() == "b", "Caret move reads character");
+
+  // Deleting reads the removed character from the local copy
+  service->dispatchEvent(MakeTextEvent(address, EventDetail::TEXT_DELETE, 0, 1, ""));
+  TEST_CHECK(mocks.tts->getSpokenTexts().back() == "a", "Deleted character echoed");
+  TEST_CHECK(accessible->GetTextRequestCount() == requests, "Echo after the first edit costs no IPC");
+
+  // Edits made while another node was current are not in the copy
+  GestureInfo bwd;
+  bwd.type = Gesture::ONE_FINGER_FLICK_LEFT;
+  mocks.gesture->fireGesture(fwd);
+  accessible->SetText("xyz");
+  accessible->SetCursorOffset(1);
+  mocks.gesture->fireGesture(bwd);
+  caret.detail1 = 1;
+  service->dispatchEvent(caret);
+  TEST_CHECK(mocks.tts->getSpokenTexts().back() == "y", "Returning to a node fetches its text again");
+}
+
 // ========================================================================
 // Main
 // ========================================================================
@@ -1185,14 +2398,22 @@ int main()
   TestReadingComposerStateTraits();
   TestReadingComposerDescriptionTraits();
   TestReadingComposerCompose();
+  TestReadingComposerCache();
   TestTtsCommandQueue();
+  TestSimulatedTtsEngine();
+  TestAsyncTtsEngine();
+  TestCachedTtsEngine();
   TestScreenReaderServiceLifecycle();
   TestScreenReaderServiceGestures();
   TestScreenReaderServiceEvents();
   TestScreenReaderServiceKeyEvents();
+  TestScreenReaderServiceCancellation();
+  TestScreenReaderServicePrefetch();
   TestTvScreenReaderService();
   TestSettingsAndSwitch();
   TestReadNode();
+  TestTextMirror();
+  TestScreenReaderTextEcho();
 
   std::cout << "\n=== Results: " << gPassCount << " passed, " << gFailCount << " failed ===" << std::endl;
 
@@ -27,9 +27,12 @@
 #include <accessibility/api/accessibility-event.h>
 #include <accessibility/api/accessibility-service.h>
 #include <accessibility/api/node-proxy.h>
+#include <accessibility/internal/service/neighbor-resolver.h>
+#include <accessibility/internal/service/window-mirror.h>
 #include <test/mock/mock-app-registry.h>
 #include <test/mock/mock-gesture-provider.h>
 #include <test/mock/mock-node-proxy.h>
+#include <test/mock/mock-task-executor.h>
 #include <test/test-accessible.h>
 
 // Test framework
@@ -67,6 +70,9 @@ public:
   std::vector<std::shared_ptr<Accessibility::NodeProxy>> windowChanges;
   std::vector<Accessibility::GestureInfo> receivedGestures;
 
+  using AccessibilityService::subscribeEvents;
+  using AccessibilityService::getRejectedEventCount;
+
 protected:
   void onAccessibilityEvent(const Accessibility::AccessibilityEvent& event) override
   {
@@ -310,6 +316,97 @@ static void TestServiceEventRouting()
   service.stop();
 }
 
+// ========================================================================
+// Event subscription (routing table) tests
+// ========================================================================
+static void TestServiceEventSubscriptions()
+{
+  std::cout << "\n--- Service Event Subscription Tests ---" << std::endl;
+
+  using Accessibility::AccessibilityEvent;
+  using Accessibility::EventDetail;
+  using Accessibility::EventTarget;
+  using Accessibility::EventTypeBit;
+
+  // EventDetail interning
+  {
+    EventDetail highlighted = "highlighted";
+    TEST_CHECK(highlighted.id() == EventDetail::HIGHLIGHTED, "EventDetail: well-known text is interned");
+    TEST_CHECK(highlighted == "highlighted", "EventDetail: compares equal to its text");
+    TEST_CHECK(EventDetail(EventDetail::ACCESSIBLE_NAME).view() == "accessible-name", "EventDetail: atom maps back to text");
+
+    EventDetail title = std::string("Settings Window");
+    TEST_CHECK(title.id() == EventDetail::CUSTOM, "EventDetail: unknown text is CUSTOM");
+    TEST_CHECK(title.str() == "Settings Window", "EventDetail: CUSTOM keeps its text");
+    TEST_CHECK(title != EventDetail("Other Window"), "EventDetail: CUSTOM compares by text");
+    TEST_CHECK(EventDetail().empty() && EventDetail("").empty(), "EventDetail: empty text is NONE");
+  }
+
+  auto registryPtr  = std::make_unique<MockAppRegistry>();
+  auto* registryRaw = registryPtr.get();
+  auto gesturePtr   = std::make_unique<MockGestureProvider>();
+
+  TestService service(std::move(registryPtr), std::move(gesturePtr));
+  service.start();
+
+  auto& tree = registryRaw->getDemoTree();
+  auto makeEvent = [](AccessibilityEvent::Type type, const Accessibility::Address& source)
+  {
+    AccessibilityEvent e;
+    e.type   = type;
+    e.source = source;
+    return e;
+  };
+
+  // Default: everything is delivered
+  service.dispatchEvent(makeEvent(AccessibilityEvent::Type::PROPERTY_CHANGED, tree.playBtn->GetAddress()));
+  TEST_CHECK(service.receivedEvents.size() == 1, "Default subscription delivers all sources");
+
+  // Narrow to the current node only
+  service.subscribeEvents(EventTarget::ANY_SOURCE, 0);
+  service.subscribeEvents(EventTarget::CURRENT_NODE, EventTypeBit(AccessibilityEvent::Type::PROPERTY_CHANGED));
+  service.subscribeEvents(EventTarget::ACTIVE_WINDOW, EventTypeBit(AccessibilityEvent::Type::STATE_CHANGED));
+
+  auto first = service.navigateNext();
+  TEST_CHECK(first != nullptr, "navigateNext gives a current node");
+
+  service.receivedEvents.clear();
+  service.dispatchEvent(makeEvent(AccessibilityEvent::Type::PROPERTY_CHANGED, first->getAddress()));
+  TEST_CHECK(service.receivedEvents.size() == 1, "Current node event delivered");
+
+  service.dispatchEvent(makeEvent(AccessibilityEvent::Type::PROPERTY_CHANGED, tree.nextBtn->GetAddress()));
+  TEST_CHECK(service.receivedEvents.size() == 1, "Unrelated node event rejected");
+  TEST_CHECK(service.getRejectedEventCount() == 1, "Rejected event counted");
+
+  service.dispatchEvent(makeEvent(AccessibilityEvent::Type::STATE_CHANGED, first->getAddress()));
+  TEST_CHECK(service.receivedEvents.size() == 1, "Unsubscribed type from current node rejected");
+
+  service.dispatchEvent(makeEvent(AccessibilityEvent::Type::STATE_CHANGED, tree.window->GetAddress()));
+  TEST_CHECK(service.receivedEvents.size() == 2, "Active window event delivered");
+
+  service.dispatchEvent(makeEvent(AccessibilityEvent::Type::BOUNDS_CHANGED, Accessibility::Address{}));
+  TEST_CHECK(service.receivedEvents.size() == 3, "Event without source delivered");
+
+  service.dispatchEvent(makeEvent(AccessibilityEvent::Type::WINDOW_CHANGED, tree.nextBtn->GetAddress()));
+  TEST_CHECK(service.receivedEvents.size() == 4, "WINDOW_CHANGED always delivered");
+
+  // Route follows navigation
+  auto second = service.navigateNext();
+  service.receivedEvents.clear();
+  service.dispatchEvent(makeEvent(AccessibilityEvent::Type::PROPERTY_CHANGED, first->getAddress()));
+  TEST_CHECK(service.receivedEvents.empty(), "Previous node no longer routed after navigation");
+  service.dispatchEvent(makeEvent(AccessibilityEvent::Type::PROPERTY_CHANGED, second->getAddress()));
+  TEST_CHECK(service.receivedEvents.size() == 1, "New current node routed after navigation");
+
+  // Parent subscription resolves the parent of the current node
+  service.subscribeEvents(EventTarget::CURRENT_PARENT, EventTypeBit(AccessibilityEvent::Type::PROPERTY_CHANGED));
+  service.receivedEvents.clear();
+  service.dispatchEvent(makeEvent(AccessibilityEvent::Type::PROPERTY_CHANGED, tree.header->GetAddress()));
+  TEST_CHECK(service.receivedEvents.size() == 1, "Parent of current node routed");
+
+  service.stop();
+}
+
 // ========================================================================
 // Gesture handling tests
 // ========================================================================
@@ -373,14 +470,10 @@ static void TestServiceHighlight()
   auto& tree = registryRaw->getDemoTree();
   auto playProxy = registryRaw->createProxy(tree.playBtn.get());
 
-  // highlightNode should succeed (mock returns false but sets currentNode)
-  service.highlightNode(playProxy);
+  TEST_CHECK(service.highlightNode(playProxy), "highlightNode succeeds");
 
   auto current = service.getCurrentNode();
-  // Note: MockNodeProxy::grabHighlight() returns false (TestAccessible default)
-  // but the service only sets currentNode if grabHighlight returns true.
-  // So current may be null. This tests the code path regardless.
-  TEST_CHECK(true, "highlightNode does not crash");
+  TEST_CHECK(current && current->getName() == "Play", "highlightNode moves the current node");
 
   // null node should return false
   bool result = service.highlightNode(nullptr);
@@ -389,6 +482,415 @@ static void TestServiceHighlight()
   service.stop();
 }
 
+// ========================================================================
+// Window mirror tests
+// ========================================================================
+static std::shared_ptr<MockNodeProxy> MakeProxy(Accessibility::Accessible* accessible)
+{
+  return std::make_shared<MockNodeProxy>(accessible, [](Accessibility::Accessible* a) { return MakeProxy(a); });
+}
+
+static std::shared_ptr<TestAccessible> MakeMirrorNode(const std::string& name, Accessibility::Rect<float> extents, bool highlightable = true)
+{
+  Accessibility::States states;
+  states[Accessibility::State::VISIBLE]       = true;
+  states[Accessibility::State::SHOWING]       = true;
+  states[Accessibility::State::HIGHLIGHTABLE] = highlightable;
+
+  auto node = std::make_shared<TestAccessible>(name, Accessibility::Role::PUSH_BUTTON);
+  node->SetStates(states);
+  node->SetExtents(extents);
+  return node;
+}
+
+static std::vector<std::string> WalkMirror(Accessibility::WindowMirror& mirror, bool forward)
+{
+  std::vector<std::string> names;
+  Accessibility::Address   start;
+  for(int i = 0; i < 20; ++i)
+  {
+    std::shared_ptr<Accessibility::NodeProxy> neighbor;
+    if(!mirror.findNeighbor(start, forward, Accessibility::NeighborSearchMode::RECURSE_FROM_ROOT, neighbor) || !neighbor)
+    {
+      break;
+    }
+    names.push_back(neighbor->getName());
+    start = neighbor->getAddress();
+  }
+  return names;
+}
+
+static void TestWindowMirror()
+{
+  std::cout << "\n--- Window Mirror Tests ---" << std::endl;
+
+  using Accessibility::AccessibilityEvent;
+  using Names = std::vector<std::string>;
+
+  // Same order as GetNeighbor on the demo tree, without wrap-around
+  {
+    MockAppRegistry registry;
+    auto&           tree = registry.getDemoTree();
+
+    Accessibility::WindowMirror mirror;
+    TEST_CHECK(!mirror.isLoaded(), "Mirror not loaded initially");
+    TEST_CHECK(mirror.load(registry.getActiveWindow()), "Mirror loads demo window");
+    TEST_CHECK(mirror.getNodeCount() == 11, "Mirror holds all 11 demo nodes");
+    TEST_CHECK(mirror.getWindowAddress() == tree.window->GetAddress(), "Mirror records window address");
+
+    Names expected{"Menu", "My Tizen App", "Play", "Volume", "Now Playing: Bohemian Rhapsody", "Previous", "Next"};
+    TEST_CHECK(WalkMirror(mirror, true) == expected, "Mirror walks demo tree forward");
+    TEST_CHECK(WalkMirror(mirror, false) == Names(expected.rbegin(), expected.rend()), "Mirror walks demo tree backward");
+
+    // Highlightable starts only differ from the mock where it wraps around
+    auto mismatches = mirror.verify(registry.getActiveWindow());
+    int  wraps      = 0;
+    bool onlyWraps  = true;
+    for(auto& mismatch : mismatches)
+    {
+      bool isWrap = (mismatch.start == tree.nextBtn->GetAddress() && mismatch.forward) ||
+                    (mismatch.start == tree.menuBtn->GetAddress() && !mismatch.forward);
+      bool isContainer = mismatch.start == tree.window->GetAddress() || mismatch.start == tree.header->GetAddress() ||
+                         mismatch.start == tree.content->GetAddress() || mismatch.start == tree.footer->GetAddress();
+      wraps += isWrap ? 1 : 0;
+      onlyWraps = onlyWraps && (isWrap || isContainer);
+    }
+    TEST_CHECK(wraps == 2 && onlyWraps, "verify() reports only the mock's wrap-around for highlightable nodes");
+
+    // A state change is patched in place
+    AccessibilityEvent event;
+    event.type    = AccessibilityEvent::Type::STATE_CHANGED;
+    event.source  = tree.volumeSlider->GetAddress();
+    event.detail  = "highlightable";
+    event.detail1 = 0;
+    TEST_CHECK(mirror.applyEvent(event), "applyEvent patches state change");
+    TEST_CHECK(!mirror.isStale(), "State change does not mark mirror stale");
+    TEST_CHECK(WalkMirror(mirror, true).size() == 6, "Node made non-highlightable is skipped");
+
+    // Reparenting dirties the old parent's subtree only
+    event.type   = AccessibilityEvent::Type::PROPERTY_CHANGED;
+    event.detail = "accessible-parent";
+    TEST_CHECK(mirror.applyEvent(event) && mirror.needsRefresh() && !mirror.isStale(), "Parent change dirties a subtree, not the mirror");
+    std::shared_ptr<Accessibility::NodeProxy> neighbor;
+    TEST_CHECK(!mirror.findNeighbor({}, true, Accessibility::NeighborSearchMode::RECURSE_FROM_ROOT, neighbor),
+               "Mirror with a dirty subtree declines to answer");
+    auto dirty = mirror.getDirtySubtrees();
+    TEST_CHECK(dirty.size() == 1u && dirty[0]->getAddress() == tree.content->GetAddress(), "Old parent is the dirty subtree");
+
+    // Refetching a subtree leaves the rest of the copy alone
+    auto headerCalls  = tree.menuBtn->GetAttributesCallCount();
+    auto contentCalls = tree.playBtn->GetAttributesCallCount();
+    auto refetch      = [&]()
+    {
+      for(auto& root : mirror.getDirtySubtrees())
+      {
+        Accessibility::WindowMirror subtree;
+        subtree.loadSubtree(root, tree.window->GetAddress().GetBus());
+        mirror.replaceSubtree(std::move(subtree));
+      }
+    };
+    refetch();
+    TEST_CHECK(!mirror.needsRefresh() && mirror.getNodeCount() == 11, "Refetched subtree is spliced in");
+    TEST_CHECK(tree.menuBtn->GetAttributesCallCount() == headerCalls && tree.playBtn->GetAttributesCallCount() > contentCalls,
+               "Only the dirty subtree is fetched again");
+    TEST_CHECK(WalkMirror(mirror, true) == expected, "Refetch picks up the toolkit's current states");
+
+    auto added = std::make_shared<TestAccessible>("Added", Accessibility::Role::PUSH_BUTTON);
+    added->SetStates(tree.prevBtn->GetStates());
+    added->SetExtents({200.0f, 750.0f, 80.0f, 40.0f});
+    tree.footer->AddChild(added);
+    event.source = tree.footer->GetAddress();
+    event.type   = AccessibilityEvent::Type::CHILDREN_CHANGED;
+    event.detail = "";
+    TEST_CHECK(mirror.applyEvent(event) && !mirror.isStale(), "Children change dirties the source's subtree");
+    refetch();
+    Names withAdded{"Menu", "My Tizen App", "Play", "Volume", "Now Playing: Bohemian Rhapsody", "Previous", "Added", "Next"};
+    TEST_CHECK(mirror.getNodeCount() == 12 && WalkMirror(mirror, true) == withAdded, "New child is mirrored after refetch");
+
+    // Nested dirty subtrees are fetched once, from the outermost root
+    event.source = tree.content->GetAddress();
+    mirror.applyEvent(event);
+    event.source = tree.window->GetAddress();
+    event.type   = AccessibilityEvent::Type::SCROLL_FINISHED;
+    mirror.applyEvent(event);
+    dirty = mirror.getDirtySubtrees();
+    TEST_CHECK(dirty.size() == 1u && dirty[0]->getAddress() == tree.window->GetAddress(), "Only the outermost dirty root is refetched");
+    for(int i = 0; i < 4; ++i)
+    {
+      mirror.applyEvent(event);
+      refetch();
+    }
+    TEST_CHECK(mirror.getNodeCount() == 12 && WalkMirror(mirror, true) == withAdded, "Repeated refetches keep the copy intact");
+    tree.footer->RemoveChild(added);
+    event.source = tree.footer->GetAddress();
+    event.type   = AccessibilityEvent::Type::CHILDREN_CHANGED;
+    mirror.applyEvent(event);
+    refetch();
+    TEST_CHECK(mirror.getNodeCount() == 11 && WalkMirror(mirror, true) == expected, "Removed child leaves the copy");
+
+    // Objects outside the window cannot change the copy
+    event.source = Accessibility::Address{"other.app", "1"};
+    event.type   = AccessibilityEvent::Type::WINDOW_CHANGED;
+    event.detail = "";
+    TEST_CHECK(!mirror.applyEvent(event) && !mirror.isStale(), "Window event from another application is ignored");
+    event.type    = AccessibilityEvent::Type::STATE_CHANGED;
+    event.detail  = "showing";
+    event.detail1 = 1;
+    TEST_CHECK(!mirror.applyEvent(event) && !mirror.isStale(), "State change of an unknown object is ignored");
+    event.source = tree.window->GetAddress();
+    event.type   = AccessibilityEvent::Type::WINDOW_CHANGED;
+    event.detail = "";
+    TEST_CHECK(mirror.applyEvent(event) && mirror.isStale(), "Window change marks the whole mirror stale");
+    TEST_CHECK(mirror.load(registry.getActiveWindow()) && !mirror.needsRefresh(), "Reload clears stale flag");
+  }
+
+  // Children are ordered top-left to bottom-right, not in child order
+  {
+    auto window = MakeMirrorNode("Window", {0.0f, 0.0f, 480.0f, 800.0f}, false);
+    auto c      = MakeMirrorNode("C", {0.0f, 400.0f, 100.0f, 50.0f});
+    window->AddChild(c);
+    window->AddChild(MakeMirrorNode("B", {200.0f, 10.0f, 100.0f, 50.0f}));
+    window->AddChild(MakeMirrorNode("A", {0.0f, 10.0f, 100.0f, 50.0f}));
+    window->AddChild(MakeMirrorNode("Empty", {0.0f, 500.0f, 0.0f, 0.0f}));
+    window->AddChild(MakeMirrorNode("Plain", {0.0f, 600.0f, 100.0f, 50.0f}, false));
+
+    Accessibility::WindowMirror mirror;
+    mirror.load(MakeProxy(window.get()));
+    TEST_CHECK(WalkMirror(mirror, true) == (Names{"A", "B", "C"}), "Mirror sorts lines, skips zero-size and non-highlightable");
+
+    // Bounds changes mark the node for the owner to refetch
+    c->SetExtents({0.0f, 0.0f, 100.0f, 50.0f});
+    AccessibilityEvent event;
+    event.type   = AccessibilityEvent::Type::BOUNDS_CHANGED;
+    event.source = c->GetAddress();
+    mirror.applyEvent(event);
+    std::shared_ptr<Accessibility::NodeProxy> neighbor;
+    TEST_CHECK(mirror.needsRefresh() && !mirror.findNeighbor({}, true, Accessibility::NeighborSearchMode::RECURSE_FROM_ROOT, neighbor),
+               "Bounds change: mirror declines until the node is refetched");
+    auto dirty = mirror.getDirtyNodes();
+    TEST_CHECK(dirty.size() == 1 && dirty[0]->getAddress() == c->GetAddress(), "Bounds change dirties only its source");
+    TEST_CHECK(mirror.refreshNode(Accessibility::WindowMirror::fetchNode(dirty[0])) && !mirror.needsRefresh(), "Refetched node is clean");
+    TEST_CHECK(WalkMirror(mirror, true) == (Names{"C", "A", "B"}), "Bounds change of one node is refetched alone");
+  }
+
+  // Collection containers order by collection_index
+  {
+    auto window = MakeMirrorNode("Window", {0.0f, 0.0f, 480.0f, 800.0f}, false);
+    window->SetAttributes({{"collection_container", "true"}});
+    auto first  = MakeMirrorNode("First", {0.0f, 300.0f, 100.0f, 50.0f});
+    auto second = MakeMirrorNode("Second", {0.0f, 0.0f, 100.0f, 50.0f});
+    auto loose  = MakeMirrorNode("Loose", {0.0f, 100.0f, 100.0f, 50.0f});
+    first->SetAttributes({{"collection_index", "0"}});
+    second->SetAttributes({{"collection_index", "1"}});
+    window->AddChild(loose);
+    window->AddChild(second);
+    window->AddChild(first);
+
+    Accessibility::WindowMirror mirror;
+    mirror.load(MakeProxy(window.get()));
+    TEST_CHECK(WalkMirror(mirror, true) == (Names{"First", "Second", "Loose"}), "Mirror sorts collection by index");
+  }
+
+  // FLOWS_TO jumps over the spatial order
+  {
+    auto window = MakeMirrorNode("Window", {0.0f, 0.0f, 480.0f, 800.0f}, false);
+    auto a      = MakeMirrorNode("A", {0.0f, 0.0f, 100.0f, 50.0f});
+    auto b      = MakeMirrorNode("B", {0.0f, 100.0f, 100.0f, 50.0f});
+    auto c      = MakeMirrorNode("C", {0.0f, 200.0f, 100.0f, 50.0f});
+    a->AddRelation(Accessibility::RelationType::FLOWS_TO, c.get());
+    window->AddChild(a);
+    window->AddChild(b);
+    window->AddChild(c);
+
+    Accessibility::WindowMirror mirror;
+    mirror.load(MakeProxy(window.get()));
+    TEST_CHECK(WalkMirror(mirror, true) == (Names{"A", "C"}), "Mirror follows FLOWS_TO");
+  }
+
+  // Children of a scrollable are clipped to its extents when entered from outside
+  {
+    auto window   = MakeMirrorNode("Window", {0.0f, 0.0f, 480.0f, 800.0f}, false);
+    auto scroller = MakeMirrorNode("Scroller", {0.0f, 0.0f, 480.0f, 200.0f}, false);
+    scroller->SetScrollable(true);
+    scroller->AddChild(MakeMirrorNode("Item 1", {0.0f, 0.0f, 480.0f, 80.0f}));
+    scroller->AddChild(MakeMirrorNode("Item 2", {0.0f, 100.0f, 480.0f, 80.0f}));
+    scroller->AddChild(MakeMirrorNode("Item 3", {0.0f, 300.0f, 480.0f, 80.0f}));
+    window->AddChild(scroller);
+
+    Accessibility::WindowMirror mirror;
+    mirror.load(MakeProxy(window.get()));
+    TEST_CHECK(WalkMirror(mirror, false) == (Names{"Item 2", "Item 1"}), "Mirror does not enter items scrolled out of view");
+    TEST_CHECK(WalkMirror(mirror, true) == (Names{"Item 1", "Item 2", "Item 3"}), "Mirror continues past the view from inside the scrollable");
+  }
+}
+
+static void TestServiceMirroredNavigation()
+{
+  std::cout << "\n--- Service Mirrored Navigation Tests ---" << std::endl;
+
+  auto  registryPtr = std::make_unique<MockAppRegistry>();
+  auto& tree        = registryPtr->getDemoTree();
+  auto  gesturePtr  = std::make_unique<MockGestureProvider>();
+
+  auto loader = std::make_shared<MockTaskExecutor>();
+
+  TestService service(std::move(registryPtr), std::move(gesturePtr));
+  TEST_CHECK(!service.isMirroredNavigationEnabled(), "Mirrored navigation disabled by default");
+  service.setMirroredNavigation(true, loader);
+  TEST_CHECK(service.isMirroredNavigationEnabled(), "Mirrored navigation enabled");
+  service.start();
+
+  // The first gesture asks the bridge and leaves the load to the loader
+  auto first = service.navigateNext();
+  TEST_CHECK(first && first->getName() == "Menu" && loader->getPendingCount() == 1 && tree.playBtn->GetAttributesCallCount() == 0,
+             "Mirror is not loaded on the gesture path");
+  loader->runAll();
+
+  std::vector<std::string> sequence{first ? first->getName() : ""};
+  for(auto node = service.navigateNext(); node; node = service.navigateNext())
+  {
+    sequence.push_back(node->getName());
+    if(sequence.size() > 10)
+    {
+      break;
+    }
+  }
+  TEST_CHECK(sequence.size() == 7, "Mirrored navigation walks 7 nodes and stops at the end");
+  TEST_CHECK(service.getCurrentNode() && service.getCurrentNode()->getName() == "Next", "Current node stays on last node");
+
+  // Structural events queue one refetch of the source's subtree; the bridge answers meanwhile
+  Accessibility::AccessibilityEvent event;
+  event.type   = Accessibility::AccessibilityEvent::Type::CHILDREN_CHANGED;
+  event.source = tree.footer->GetAddress();
+  service.dispatchEvent(event);
+  service.dispatchEvent(event);
+  auto menuCalls   = tree.menuBtn->GetAttributesCallCount();
+  auto footerCalls = tree.prevBtn->GetAttributesCallCount();
+  auto wrapped     = service.navigateNext();
+  TEST_CHECK(loader->getPendingCount() == 1 && wrapped && wrapped->getName() == "Menu",
+             "Dirty mirror falls back to the bridge, which wraps around");
+  TEST_CHECK(tree.prevBtn->GetAttributesCallCount() == footerCalls, "Nothing is refetched on the gesture path");
+  loader->runAll();
+  TEST_CHECK(tree.menuBtn->GetAttributesCallCount() == menuCalls && tree.prevBtn->GetAttributesCallCount() > footerCalls,
+             "Loader refetches only the changed subtree");
+  service.navigateTo(MakeProxy(tree.nextBtn.get()));
+
+  // Events reach the mirror through dispatchEvent
+  event.type    = Accessibility::AccessibilityEvent::Type::STATE_CHANGED;
+  event.source  = tree.prevBtn->GetAddress();
+  event.detail  = "highlightable";
+  event.detail1 = 0;
+  service.dispatchEvent(event);
+  TEST_CHECK(loader->getPendingCount() == 0, "State changes need no refetch");
+
+  // Bounds and role changes are refetched by the loader, not on dispatch
+  event.type   = Accessibility::AccessibilityEvent::Type::BOUNDS_CHANGED;
+  event.source = tree.playBtn->GetAddress();
+  event.detail = "";
+  service.dispatchEvent(event);
+  TEST_CHECK(loader->getPendingCount() == 1, "Bounds change queues a refetch");
+  loader->runAll();
+
+  auto prev = service.navigatePrev();
+  TEST_CHECK(prev && prev->getName() == "Now Playing: Bohemian Rhapsody", "Mirrored navigation skips node made non-highlightable");
+
+  TEST_CHECK(service.verifyMirroredNavigation() > 0, "verifyMirroredNavigation reports the mock's wrap-around");
+
+  service.setMirroredNavigation(false);
+  auto next = service.navigateNext();
+  TEST_CHECK(next && next->getName() == "Previous", "Disabled mirror falls back to GetNeighbor");
+
+  service.stop();
+}
+
+// ========================================================================
+// Cross-process neighbor resolution tests
+// ========================================================================
+class AddressedNodeProxy : public MockNodeProxy
+{
+public:
+  explicit AddressedNodeProxy(Accessibility::Address address)
+  : MockNodeProxy(nullptr, nullptr),
+    mAddress(std::move(address))
+  {
+  }
+
+  Accessibility::Address getAddress() override
+  {
+    return mAddress;
+  }
+
+private:
+  Accessibility::Address mAddress;
+};
+
+static void TestNeighborResolver()
+{
+  std::cout << "\n--- Neighbor Resolver Tests ---" << std::endl;
+
+  using Accessibility::NeighborHop;
+  using Accessibility::NeighborSearchMode;
+
+  // Host process "host" embeds process "emb" through plug H:
+  //   A, H [ S(root) > E1, E2 ], B
+  auto a  = std::make_shared<AddressedNodeProxy>(Accessibility::Address{"host", "a"});
+  auto h  = std::make_shared<AddressedNodeProxy>(Accessibility::Address{"host", "h"});
+  auto b  = std::make_shared<AddressedNodeProxy>(Accessibility::Address{"host", "b"});
+  auto s  = std::make_shared<AddressedNodeProxy>(Accessibility::Address{"emb", "root"});
+  auto e1 = std::make_shared<AddressedNodeProxy>(Accessibility::Address{"emb", "e1"});
+  auto e2 = std::make_shared<AddressedNodeProxy>(Accessibility::Address{"emb", "e2"});
+
+  std::vector<std::string> calls;
+  auto                     hop = [&](const std::shared_ptr<Accessibility::NodeProxy>& start, NeighborSearchMode mode) -> NeighborHop
+  {
+    auto path = start->getAddress().GetPath();
+    calls.push_back(path + (mode == NeighborSearchMode::CONTINUE_AFTER_FAILED_RECURSION ? "+continue" : ""));
+    if(path == "a") return {s, true};
+    if(path == "root") return {e1, false};
+    if(path == "e1") return {e2, false};
+    if(path == "e2") return {h, true};
+    if(path == "h" && mode == NeighborSearchMode::CONTINUE_AFTER_FAILED_RECURSION) return {b, false};
+    return {};
+  };
+
+  Accessibility::NeighborResolver resolver;
+
+  auto next = resolver.resolve(a, hop);
+  TEST_CHECK(next == e1, "Recurse flag descends into embedded content");
+  TEST_CHECK(calls == (std::vector<std::string>{"a", "root"}), "Descending costs one extra hop");
+
+  calls.clear();
+  next = resolver.resolve(e2, hop);
+  TEST_CHECK(next == b, "Exhausted embedded content continues after the plug");
+  TEST_CHECK(calls == (std::vector<std::string>{"e2", "h+continue"}), "Plug is continued with CONTINUE_AFTER_FAILED_RECURSION");
+
+  auto stats = resolver.getStats();
+  TEST_CHECK(stats.lookups == 2, "Lookups counted");
+  TEST_CHECK(stats.hops == 4 && stats.crossBusHops == 2, "Hops and cross-bus hops counted");
+  TEST_CHECK(stats.maxHopLatency <= stats.totalLatency, "Per-hop latency accumulated");
+
+  // A cycle of recurse flags is cut off
+  calls.clear();
+  auto loop = [&](const std::shared_ptr<Accessibility::NodeProxy>& start, NeighborSearchMode) -> NeighborHop
+  {
+    calls.push_back(start->getAddress().GetPath());
+    return {start == s ? std::static_pointer_cast<Accessibility::NodeProxy>(h) : s, true};
+  };
+  TEST_CHECK(resolver.resolve(a, loop) == nullptr, "Cyclic embedding returns nullptr");
+  TEST_CHECK(calls.size() == Accessibility::NeighborResolver::MAX_HOPS, "Cyclic embedding stops at MAX_HOPS");
+
+  // The service routes navigation through the resolver
+  TestService service(std::make_unique<MockAppRegistry>(), std::make_unique<MockGestureProvider>());
+  service.start();
+  auto peeked = service.findNeighbor(nullptr, true);
+  TEST_CHECK(peeked && peeked->getName() == "Menu", "findNeighbor peeks the first node");
+  TEST_CHECK(service.getCurrentNode() == nullptr, "findNeighbor does not move");
+  service.navigateNext();
+  auto serviceStats = service.getNeighborHopStats();
+  TEST_CHECK(serviceStats.lookups == 2 && serviceStats.crossBusHops == 0, "Service counts neighbor lookups");
+  service.stop();
+}
+
 // ========================================================================
 // App registration callback tests
 // ========================================================================
@@ -435,8 +937,12 @@ int main()
   TestServiceLifecycle();
   TestServiceNavigation();
   TestServiceEventRouting();
+  TestServiceEventSubscriptions();
   TestServiceGestureHandling();
   TestServiceHighlight();
+  TestWindowMirror();
+  TestServiceMirroredNavigation();
+  TestNeighborResolver();
   TestAppRegistrationCallbacks();
 
   std::cout << "\n=== Results: " << gPassCount << " passed, " << gFailCount << " failed ===" << std::endl;
@@ -101,6 +101,11 @@ public:
    */
   TreeNode BuildTree(uint32_t rootId) override;
 
+  /**
+   * @brief Builds a tree structure at most maxDepth levels below the given root ID.
+   */
+  TreeNode BuildSubtree(uint32_t rootId, int maxDepth) override;
+
   /**
    * @brief Navigates to the next or previous highlightable element.
    * @param[in] currentId The current element ID
@@ -19,7 +19,10 @@
  */
 
 // EXTERNAL INCLUDES
+#include <chrono>
 #include <cstdint>
+#include <string>
+#include <thread>
 
 // INTERNAL INCLUDES
 #include <tools/inspector/inspector-types.h>
@@ -63,6 +66,17 @@ public:
    */
   virtual TreeNode BuildTree(uint32_t rootId) = 0;
 
+  /**
+   * @brief Builds a tree structure at most maxDepth levels below the given root ID.
+   *
+   * Nodes at the depth limit keep their childCount but have no children,
+   * so a client can fetch them on demand.
+   *
+   * @param[in] rootId The root element ID
+   * @param[in] maxDepth Levels of children to include; negative for no limit
+   */
+  virtual TreeNode BuildSubtree(uint32_t rootId, int maxDepth) = 0;
+
   /**
    * @brief Navigates to the next or previous highlightable element.
    *
@@ -87,6 +101,72 @@ public:
    * @return The parent element ID, or currentId if no parent
    */
   virtual uint32_t NavigateParent(uint32_t currentId) = 0;
+
+  /**
+   * @brief Checks whether the read methods may be called concurrently.
+   *
+   * Engines returning false are serialized by their callers.
+   */
+  virtual bool SupportsConcurrentReads() const
+  {
+    return false;
+  }
+
+  /**
+   * @brief Returns a number that changes whenever the tree changes.
+   *
+   * Engines that do not track changes return 0.
+   */
+  virtual uint64_t GetSnapshotVersion() const
+  {
+    return 0;
+  }
+
+  /**
+   * @brief Computes the elements that changed since the given snapshot version.
+   *
+   * @param[in] sinceVersion A version previously returned by GetSnapshotVersion()
+   * @param[out] diff The changes up to the current version
+   * @return false if the engine does not track changes
+   */
+  virtual bool GetDiff(uint64_t /*sinceVersion*/, SnapshotDiff& /*diff*/)
+  {
+    return false;
+  }
+
+  /**
+   * @brief Finds the elements matching a query.
+   *
+   * @param[in] query The filters
+   * @param[out] result The matches
+   * @return false if the engine does not support searching
+   */
+  virtual bool Search(const SearchQuery& /*query*/, SearchResult& /*result*/)
+  {
+    return false;
+  }
+
+  /**
+   * @brief Serializes the current snapshot in the SnapshotFile format.
+   *
+   * @param[out] bytes The file contents
+   * @return false if the engine cannot serialize snapshots
+   */
+  virtual bool SerializeSnapshot(std::string& /*bytes*/)
+  {
+    return false;
+  }
+
+  /**
+   * @brief Blocks until the snapshot version or the focused ID differs from
+   * the given ones, or the timeout expires.
+   *
+   * Engines that cannot signal changes simply sleep, so callers poll.
+   */
+  virtual void WaitForChange(uint64_t /*version*/, uint32_t /*focusedId*/, std::chrono::milliseconds timeout)
+  {
+    std::this_thread::sleep_for(timeout);
+  }
 };
 
 } // namespace InspectorEngine
@@ -19,11 +19,15 @@
 #include <csignal>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
+#include <string>
 #include <thread>
 
 // INTERNAL INCLUDES
 #include <accessibility/internal/service/inspector-service.h>
+#include <tools/inspector/snapshot-file-query-engine.h>
+#include <tools/inspector/web-inspector-server.h>
 #include <test/mock/mock-app-registry.h>
 #include <test/mock/mock-gesture-provider.h>
 
@@ -35,23 +39,71 @@ void SignalHandler(int)
 {
   gRunning = 0;
 }
+
+void WaitForSignal()
+{
+  std::signal(SIGINT, SignalHandler);
+  std::signal(SIGTERM, SignalHandler);
+  while(gRunning)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+}
+
+/**
+ * @brief Serves a snapshot file captured earlier, without any application.
+ */
+int ServeSnapshotFile(const std::string& path, int port)
+{
+  InspectorEngine::SnapshotFileQueryEngine engine;
+  if(!engine.Open(path))
+  {
+    fprintf(stderr, "Failed to load snapshot: %s\n", engine.GetError().c_str());
+    return 1;
+  }
+  printf("Loaded %zu elements (snapshot version %llu) from %s\n", engine.GetSnapshotSize(),
+         static_cast<unsigned long long>(engine.GetSnapshotVersion()), path.c_str());
+
+  InspectorEngine::WebInspectorServer server;
+  server.Start(engine, port);
+  printf("Web inspector: http://localhost:%d\n", port);
+  printf("Press Ctrl+C to stop.\n\n");
+
+  WaitForSignal();
+  server.Stop();
+  return 0;
+}
 } // anonymous namespace
 
 int main(int argc, char** argv)
 {
-  int port = 8080;
-  if(argc > 1)
+  // Usage: [port] [--save FILE | --load FILE]
+  int         port = 8080;
+  std::string savePath;
+  std::string loadPath;
+  for(int i = 1; i < argc; ++i)
   {
-    port = std::atoi(argv[1]);
+    if((std::strcmp(argv[i], "--save") == 0 || std::strcmp(argv[i], "--load") == 0) && i + 1 < argc)
+    {
+      (argv[i][2] == 's' ? savePath : loadPath) = argv[i + 1];
+      ++i;
+      continue;
+    }
+    port = std::atoi(argv[i]);
     if(port <= 0 || port > 65535)
     {
-      fprintf(stderr, "Invalid port: %s\n", argv[1]);
+      fprintf(stderr, "Invalid port: %s\n", argv[i]);
       return 1;
     }
   }
 
   printf("=== InspectorService Web Inspector ===\n\n");
 
+  if(!loadPath.empty())
+  {
+    return ServeSnapshotFile(loadPath, port);
+  }
+
   auto registry = std::make_unique<MockAppRegistry>();
   auto gesture  = std::make_unique<MockGestureProvider>();
 
@@ -61,15 +113,22 @@ int main(int argc, char** argv)
   Accessibility::InspectorService service(std::move(registry), std::move(gesture), config);
   service.startInspector();
 
+  if(!savePath.empty())
+  {
+    if(!service.getQueryEngine().SaveSnapshot(savePath))
+    {
+      fprintf(stderr, "Failed to save snapshot to %s\n", savePath.c_str());
+    }
+    else
+    {
+      printf("Saved snapshot to %s\n", savePath.c_str());
+    }
+  }
+
   printf("Web inspector: http://localhost:%d\n", port);
   printf("Press Ctrl+C to stop.\n\n");
 
-  std::signal(SIGINT, SignalHandler);
-  std::signal(SIGTERM, SignalHandler);
-  while(gRunning)
-  {
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
-  }
+  WaitForSignal();
 
   printf("\nShutting down...\n");
   service.stopInspector();
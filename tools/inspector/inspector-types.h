@@ -19,6 +19,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -42,6 +43,7 @@ struct ElementInfo
   int         childCount;
   std::vector<uint32_t> childIds;
   uint32_t    parentId;
+  std::string automationId;
 };
 
 /**
@@ -56,6 +58,51 @@ struct TreeNode
   std::vector<TreeNode> children;
 };
 
+/**
+ * @brief Elements that changed between two snapshot versions.
+ *
+ * A changed element's childIds tell the client which children to add or
+ * drop; added elements are listed as well so it needs no further request.
+ */
+struct SnapshotDiff
+{
+  uint64_t                 fromVersion{0};
+  uint64_t                 toVersion{0};
+  bool                     reset{false}; ///< fromVersion is too old; reload the whole tree
+  uint32_t                 rootId{0};
+  std::vector<ElementInfo> added;
+  std::vector<ElementInfo> changed;
+  std::vector<uint32_t>    removed;
+};
+
+/**
+ * @brief An element search; every non-empty filter must match.
+ */
+struct SearchQuery
+{
+  std::string              role;           ///< Role name, e.g. "PUSH_BUTTON"
+  std::string              nameContains;   ///< Substring of the name, ignoring ASCII case
+  std::string              automationId;
+  std::vector<std::string> states;         ///< State names the element must have
+  std::vector<std::string> excludedStates; ///< State names the element must not have
+  bool                     intersects{false}; ///< Keep only elements overlapping the area below
+  float                    areaX{0.0f};
+  float                    areaY{0.0f};
+  float                    areaWidth{0.0f};
+  float                    areaHeight{0.0f};
+  size_t                   limit{100};
+};
+
+/**
+ * @brief The first matches of a search, in element id order.
+ */
+struct SearchResult
+{
+  uint64_t                 version{0}; ///< Snapshot version the search ran against
+  size_t                   total{0};   ///< Matches, including those past the limit
+  std::vector<ElementInfo> elements;
+};
+
 } // namespace InspectorEngine
 
 #endif // ACCESSIBILITY_TOOLS_INSPECTOR_TYPES_H
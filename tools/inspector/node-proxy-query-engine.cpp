@@ -23,149 +23,362 @@
 
 // INTERNAL INCLUDES
 #include <accessibility/api/accessibility.h>
+#include <accessibility/api/accessibility-names.h>
 #include <accessibility/api/node-proxy.h>
+#include <tools/inspector/snapshot-file.h>
 
 namespace InspectorEngine
 {
-NodeProxyQueryEngine::NodeProxyQueryEngine() = default;
+NodeProxyQueryEngine::NodeProxyQueryEngine()
+: mPublished(std::make_shared<const PublishedSnapshot>())
+{
+}
+
 NodeProxyQueryEngine::~NodeProxyQueryEngine() = default;
 
 std::string NodeProxyQueryEngine::RoleToString(Accessibility::Role role)
 {
-  static const char* names[] = {
-    "INVALID", "ACCELERATOR_LABEL", "ALERT", "ANIMATION", "ARROW", "CALENDAR",
-    "CANVAS", "CHECK_BOX", "CHECK_MENU_ITEM", "COLOR_CHOOSER", "COLUMN_HEADER",
-    "COMBO_BOX", "DATE_EDITOR", "DESKTOP_ICON", "DESKTOP_FRAME", "DIAL", "DIALOG",
-    "DIRECTORY_PANE", "DRAWING_AREA", "FILE_CHOOSER", "FILLER", "FOCUS_TRAVERSABLE",
-    "FONT_CHOOSER", "FRAME", "GLASS_PANE", "HTML_CONTAINER", "ICON", "IMAGE",
-    "INTERNAL_FRAME", "LABEL", "LAYERED_PANE", "LIST", "LIST_ITEM", "MENU",
-    "MENU_BAR", "MENU_ITEM", "OPTION_PANE", "PAGE_TAB", "PAGE_TAB_LIST", "PANEL",
-    "PASSWORD_TEXT", "POPUP_MENU", "PROGRESS_BAR", "PUSH_BUTTON", "RADIO_BUTTON",
-    "RADIO_MENU_ITEM", "ROOT_PANE", "ROW_HEADER", "SCROLL_BAR", "SCROLL_PANE",
-    "SEPARATOR", "SLIDER", "SPIN_BUTTON", "SPLIT_PANE", "STATUS_BAR", "TABLE",
-    "TABLE_CELL", "TABLE_COLUMN_HEADER", "TABLE_ROW_HEADER", "TEAROFF_MENU_ITEM",
-    "TERMINAL", "TEXT", "TOGGLE_BUTTON", "TOOL_BAR", "TOOL_TIP", "TREE", "TREE_TABLE",
-    "UNKNOWN", "VIEWPORT", "WINDOW", "EXTENDED", "HEADER", "FOOTER", "PARAGRAPH",
-    "RULER", "APPLICATION", "AUTOCOMPLETE", "EDITBAR", "EMBEDDED", "ENTRY", "CHART",
-    "CAPTION", "DOCUMENT_FRAME", "HEADING", "PAGE", "SECTION", "REDUNDANT_OBJECT",
-    "FORM", "LINK", "INPUT_METHOD_WINDOW", "TABLE_ROW", "TREE_ITEM", "DOCUMENT_SPREADSHEET",
-    "DOCUMENT_PRESENTATION", "DOCUMENT_TEXT", "DOCUMENT_WEB", "DOCUMENT_EMAIL",
-    "COMMENT", "LIST_BOX", "GROUPING", "IMAGE_MAP", "NOTIFICATION", "INFO_BAR",
-    "LEVEL_BAR", "TITLE_BAR", "BLOCK_QUOTE", "AUDIO", "VIDEO", "DEFINITION",
-    "ARTICLE", "LANDMARK", "LOG", "MARQUEE", "MATH", "RATING", "TIMER", "STATIC",
-    "MATH_FRACTION", "MATH_ROOT", "SUBSCRIPT", "SUPERSCRIPT"
-  };
-  auto idx = static_cast<size_t>(role);
-  if(idx < sizeof(names) / sizeof(names[0]))
+  auto name = Accessibility::ROLE_IDENTIFIERS[role];
+  if(!name.empty())
   {
-    return names[idx];
+    return std::string{name};
   }
-  return "ROLE_" + std::to_string(idx);
+  return "ROLE_" + std::to_string(static_cast<size_t>(role));
 }
 
 std::string NodeProxyQueryEngine::StatesToString(Accessibility::States states)
 {
-  static const std::pair<Accessibility::State, const char*> stateNames[] = {
-    {Accessibility::State::ENABLED, "ENABLED"},
-    {Accessibility::State::VISIBLE, "VISIBLE"},
-    {Accessibility::State::SHOWING, "SHOWING"},
-    {Accessibility::State::SENSITIVE, "SENSITIVE"},
-    {Accessibility::State::FOCUSABLE, "FOCUSABLE"},
-    {Accessibility::State::FOCUSED, "FOCUSED"},
-    {Accessibility::State::ACTIVE, "ACTIVE"},
-    {Accessibility::State::CHECKED, "CHECKED"},
-    {Accessibility::State::SELECTED, "SELECTED"},
-    {Accessibility::State::EXPANDED, "EXPANDED"},
-    {Accessibility::State::PRESSED, "PRESSED"},
-    {Accessibility::State::HIGHLIGHTABLE, "HIGHLIGHTABLE"},
-    {Accessibility::State::HIGHLIGHTED, "HIGHLIGHTED"},
-    {Accessibility::State::EDITABLE, "EDITABLE"},
-    {Accessibility::State::READ_ONLY, "READ_ONLY"},
+  static constexpr Accessibility::State shownStates[] = {
+    Accessibility::State::ENABLED, Accessibility::State::VISIBLE, Accessibility::State::SHOWING,
+    Accessibility::State::SENSITIVE, Accessibility::State::FOCUSABLE, Accessibility::State::FOCUSED,
+    Accessibility::State::ACTIVE, Accessibility::State::CHECKED, Accessibility::State::SELECTED,
+    Accessibility::State::EXPANDED, Accessibility::State::PRESSED, Accessibility::State::HIGHLIGHTABLE,
+    Accessibility::State::HIGHLIGHTED, Accessibility::State::EDITABLE, Accessibility::State::READ_ONLY,
   };
 
   std::string result;
-  for(auto& [state, name] : stateNames)
+  for(auto state : shownStates)
   {
     if(states[state])
     {
       if(!result.empty()) result += ", ";
-      result += name;
+      result += Accessibility::STATE_IDENTIFIERS[state];
     }
   }
   return result.empty() ? "(none)" : result;
 }
 
-void NodeProxyQueryEngine::TraverseTree(std::shared_ptr<Accessibility::NodeProxy> node, uint32_t parentId, uint32_t& nextId)
+void NodeProxyQueryEngine::FetchTree(const std::shared_ptr<Accessibility::NodeProxy>& root, std::vector<FetchedNode>& fetched)
 {
-  if(!node) return;
+  auto crawled = mCrawler.Crawl(root);
+  fetched.reserve(crawled.size());
+  for(auto& node : crawled)
+  {
+    CachedElement elem{};
+    elem.proxy        = std::move(node.proxy);
+    elem.address      = std::move(node.address);
+    elem.name         = std::move(node.name);
+    elem.role         = RoleToString(node.role);
+    elem.description  = std::move(node.description);
+    elem.automationId = std::move(node.automationId);
+    elem.states       = node.states;
+    elem.boundsX      = static_cast<float>(node.extents.x);
+    elem.boundsY      = static_cast<float>(node.extents.y);
+    elem.boundsWidth  = static_cast<float>(node.extents.width);
+    elem.boundsHeight = static_cast<float>(node.extents.height);
+    fetched.push_back({std::move(elem), std::move(node.children)});
+  }
+}
 
-  uint32_t id = nextId++;
+void NodeProxyQueryEngine::SetCrawlerConfig(const SnapshotCrawler::Config& config)
+{
+  mCrawler.SetConfig(config);
+}
 
-  CachedElement elem;
-  elem.id          = id;
-  elem.name        = node->getName();
-  elem.role        = RoleToString(node->getRole());
-  elem.description = node->getDescription();
-  elem.states      = StatesToString(node->getStates());
-  elem.parentId    = parentId;
+CrawlStats NodeProxyQueryEngine::GetCrawlStats() const
+{
+  return mCrawler.GetStats();
+}
 
-  auto extents      = node->getExtents(Accessibility::CoordinateType::SCREEN);
-  elem.boundsX      = static_cast<float>(extents.x);
-  elem.boundsY      = static_cast<float>(extents.y);
-  elem.boundsWidth  = static_cast<float>(extents.width);
-  elem.boundsHeight = static_cast<float>(extents.height);
+void NodeProxyQueryEngine::CollectSubtree(uint32_t id, std::vector<uint32_t>& ids) const
+{
+  auto it = mSnapshot.find(id);
+  if(it == mSnapshot.end()) return;
 
-  auto children    = node->getChildren();
-  elem.childCount  = static_cast<int>(children.size());
+  ids.push_back(id);
+  for(auto childId : it->second.childIds)
+  {
+    CollectSubtree(childId, ids);
+  }
+}
 
-  // Reserve child IDs
-  std::vector<uint32_t> childIds;
-  uint32_t childStartId = nextId;
-  for(size_t i = 0; i < children.size(); ++i)
+uint32_t NodeProxyQueryEngine::MergeTree(uint32_t replacedId, uint32_t parentId, std::vector<FetchedNode>& fetched)
+{
+  // Known addresses keep their ids
+  std::vector<uint32_t> ids(fetched.size());
+  std::vector<uint32_t> parents(fetched.size(), parentId);
+  for(size_t i = 0; i < fetched.size(); ++i)
   {
-    childIds.push_back(childStartId + static_cast<uint32_t>(i));
+    auto it = mIdByAddress.find(fetched[i].element.address);
+    ids[i]  = it != mIdByAddress.end() ? it->second : mNextId++;
+  }
+  for(size_t i = 0; i < fetched.size(); ++i)
+  {
+    for(auto child : fetched[i].children)
+    {
+      parents[child] = ids[i];
+    }
+  }
+
+  // Everything previously below the replaced node, or below a node that
+  // moved in from elsewhere, is dropped unless it was fetched again
+  std::vector<uint32_t> dropped;
+  if(replacedId != 0)
+  {
+    CollectSubtree(replacedId, dropped);
+  }
+  for(size_t i = 0; i < fetched.size(); ++i)
+  {
+    auto old = mSnapshot.find(ids[i]);
+    if(old == mSnapshot.end() || old->second.parentId == parents[i]) continue;
+
+    auto oldParent = mSnapshot.find(old->second.parentId);
+    if(oldParent != mSnapshot.end())
+    {
+      auto& siblings = oldParent->second.childIds;
+      siblings.erase(std::remove(siblings.begin(), siblings.end(), ids[i]), siblings.end());
+      oldParent->second.childCount = static_cast<int>(siblings.size());
+      MarkDirty(oldParent->first);
+    }
+    CollectSubtree(ids[i], dropped);
   }
-  // Adjust: we don't know subtree sizes yet, so we traverse sequentially
-  childIds.clear();
 
-  mSnapshot[id] = std::move(elem);
+  for(size_t i = 0; i < fetched.size(); ++i)
+  {
+    auto& elem    = fetched[i].element;
+    elem.id       = ids[i];
+    elem.parentId = parents[i];
+    elem.childIds.clear();
+    for(auto child : fetched[i].children)
+    {
+      elem.childIds.push_back(ids[child]);
+    }
+    elem.childCount         = static_cast<int>(elem.childIds.size());
+    mIdByAddress[elem.address] = ids[i];
+    mSnapshot[ids[i]]       = std::move(elem);
+    MarkDirty(ids[i]);
+  }
 
-  for(auto& child : children)
+  std::sort(ids.begin(), ids.end());
+  for(auto id : dropped)
   {
-    uint32_t childId = nextId;
-    mSnapshot[id].childIds.push_back(childId);
-    TraverseTree(child, id, nextId);
+    if(std::binary_search(ids.begin(), ids.end(), id)) continue;
+
+    auto it = mSnapshot.find(id);
+    if(it == mSnapshot.end()) continue;
+    auto address = mIdByAddress.find(it->second.address);
+    if(address != mIdByAddress.end() && address->second == id)
+    {
+      mIdByAddress.erase(address);
+    }
+    mSnapshot.erase(it);
+    MarkDirty(id);
   }
-  mSnapshot[id].childCount = static_cast<int>(mSnapshot[id].childIds.size());
+
+  return fetched.empty() ? 0 : fetched.front().element.id;
 }
 
-void NodeProxyQueryEngine::BuildSnapshot(std::shared_ptr<Accessibility::NodeProxy> root)
+void NodeProxyQueryEngine::RemoveSubtree(uint32_t id)
 {
-  std::lock_guard<std::mutex> lock(mMutex);
+  auto it = mSnapshot.find(id);
+  if(it == mSnapshot.end()) return;
 
-  mSnapshot.clear();
-  mHighlightableOrder.clear();
-  if(!root) return;
+  auto parent = mSnapshot.find(it->second.parentId);
+  if(parent != mSnapshot.end())
+  {
+    auto& siblings = parent->second.childIds;
+    siblings.erase(std::remove(siblings.begin(), siblings.end(), id), siblings.end());
+    parent->second.childCount = static_cast<int>(siblings.size());
+    MarkDirty(parent->first);
+  }
 
-  uint32_t nextId = 1;
-  mRootId = nextId;
-  TraverseTree(root, 0, nextId);
+  std::vector<uint32_t> ids;
+  CollectSubtree(id, ids);
+  for(auto removed : ids)
+  {
+    mIdByAddress.erase(mSnapshot[removed].address);
+    mSnapshot.erase(removed);
+    MarkDirty(removed);
+  }
+}
 
+void NodeProxyQueryEngine::UpdateDerivedState()
+{
+  mHighlightableOrder.clear();
   BuildHighlightableOrder(mRootId);
+  mOrderDirty = true;
 
+  if(mFocusedId != 0 && mSnapshot.find(mFocusedId) == mSnapshot.end())
+  {
+    mFocusedId = 0;
+  }
   if(mFocusedId == 0 && !mHighlightableOrder.empty())
   {
     mFocusedId = mHighlightableOrder.front();
   }
 }
 
+void NodeProxyQueryEngine::BuildSnapshot(std::shared_ptr<Accessibility::NodeProxy> root)
+{
+  std::vector<FetchedNode> fetched;
+  FetchTree(root, fetched);
+
+  std::lock_guard<std::mutex> lock(mMutex);
+
+  mSnapshot.clear();
+  mRootId = MergeTree(0, 0, fetched);
+
+  // Forget the ids of nodes that are gone
+  for(auto it = mIdByAddress.begin(); it != mIdByAddress.end();)
+  {
+    it = mSnapshot.count(it->second) ? std::next(it) : mIdByAddress.erase(it);
+  }
+
+  UpdateDerivedState();
+  Publish(true);
+}
+
+bool NodeProxyQueryEngine::RefreshSubtree(uint32_t id)
+{
+  std::shared_ptr<Accessibility::NodeProxy> proxy;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mSnapshot.find(id);
+    if(it == mSnapshot.end()) return false;
+    proxy = it->second.proxy;
+  }
+
+  std::vector<FetchedNode> fetched;
+  FetchTree(proxy, fetched);
+
+  std::lock_guard<std::mutex> lock(mMutex);
+  auto it = mSnapshot.find(id);
+  if(it == mSnapshot.end()) return false;
+
+  MergeTree(id, it->second.parentId, fetched);
+  UpdateDerivedState();
+  Publish(false);
+  return true;
+}
+
+bool NodeProxyQueryEngine::ApplyEvent(const Accessibility::AccessibilityEvent& event)
+{
+  using Type = Accessibility::AccessibilityEvent::Type;
+
+  uint32_t                                  id = 0;
+  std::shared_ptr<Accessibility::NodeProxy> proxy;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = event.source ? mIdByAddress.find(event.source) : mIdByAddress.end();
+    if(it == mIdByAddress.end()) return false;
+    id    = it->second;
+    proxy = mSnapshot[id].proxy;
+  }
+
+  // Fetches one field, then patches it in unless the node was removed meanwhile
+  auto patch = [this, id](auto&& apply) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mSnapshot.find(id);
+    if(it == mSnapshot.end()) return false;
+    apply(it->second);
+    MarkDirty(id);
+    Publish(false);
+    return true;
+  };
+
+  switch(event.type)
+  {
+    case Type::CHILDREN_CHANGED:
+    {
+      return RefreshSubtree(id);
+    }
+    case Type::STATE_CHANGED:
+    {
+      auto states = proxy->getStates();
+      return patch([&](CachedElement& elem) {
+        bool highlightable = elem.states[Accessibility::State::HIGHLIGHTABLE];
+        elem.states        = states;
+        if(highlightable != states[Accessibility::State::HIGHLIGHTABLE])
+        {
+          UpdateDerivedState();
+        }
+      });
+    }
+    case Type::BOUNDS_CHANGED:
+    {
+      auto extents = proxy->getExtents(Accessibility::CoordinateType::SCREEN);
+      return patch([&](CachedElement& elem) {
+        elem.boundsX      = static_cast<float>(extents.x);
+        elem.boundsY      = static_cast<float>(extents.y);
+        elem.boundsWidth  = static_cast<float>(extents.width);
+        elem.boundsHeight = static_cast<float>(extents.height);
+      });
+    }
+    case Type::PROPERTY_CHANGED:
+    {
+      switch(event.detail.id())
+      {
+        case Accessibility::EventDetail::ACCESSIBLE_NAME:
+        {
+          auto name = proxy->getName();
+          return patch([&](CachedElement& elem) { elem.name = std::move(name); });
+        }
+        case Accessibility::EventDetail::ACCESSIBLE_DESCRIPTION:
+        {
+          auto description = proxy->getDescription();
+          return patch([&](CachedElement& elem) { elem.description = std::move(description); });
+        }
+        case Accessibility::EventDetail::ACCESSIBLE_ROLE:
+        {
+          auto role = RoleToString(proxy->getRole());
+          return patch([&](CachedElement& elem) { elem.role = std::move(role); });
+        }
+        case Accessibility::EventDetail::ACCESSIBLE_PARENT:
+        {
+          // Moving the node out of its old parent is part of the merge
+          auto     parent   = proxy->getParent();
+          uint32_t parentId = 0;
+          {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto it = parent ? mIdByAddress.find(parent->getAddress()) : mIdByAddress.end();
+            if(it == mIdByAddress.end())
+            {
+              // Moved out of the snapshot
+              RemoveSubtree(id);
+              UpdateDerivedState();
+              Publish(false);
+              return true;
+            }
+            parentId = it->second;
+          }
+          return RefreshSubtree(parentId);
+        }
+        default:
+          return false;
+      }
+    }
+    default:
+      return false;
+  }
+}
+
 void NodeProxyQueryEngine::BuildHighlightableOrder(uint32_t nodeId)
 {
   auto it = mSnapshot.find(nodeId);
   if(it == mSnapshot.end()) return;
 
   auto& elem = it->second;
-  if(elem.states.find("HIGHLIGHTABLE") != std::string::npos)
+  if(elem.states[Accessibility::State::HIGHLIGHTABLE])
   {
     mHighlightableOrder.push_back(nodeId);
   }
@@ -176,24 +389,182 @@ void NodeProxyQueryEngine::BuildHighlightableOrder(uint32_t nodeId)
   }
 }
 
+std::shared_ptr<const NodeProxyQueryEngine::PublishedSnapshot> NodeProxyQueryEngine::LoadSnapshot() const
+{
+  return std::atomic_load(&mPublished);
+}
+
+void NodeProxyQueryEngine::MarkDirty(uint32_t id)
+{
+  mDirty.push_back(id);
+}
+
+bool NodeProxyQueryEngine::SameContent(const CachedElement& a, const CachedElement& b)
+{
+  return a.name == b.name && a.role == b.role && a.description == b.description &&
+         a.automationId == b.automationId && a.states == b.states &&
+         a.boundsX == b.boundsX && a.boundsY == b.boundsY && a.boundsWidth == b.boundsWidth &&
+         a.boundsHeight == b.boundsHeight && a.childIds == b.childIds && a.parentId == b.parentId;
+}
+
+ElementInfo NodeProxyQueryEngine::ToElementInfo(const CachedElement& elem)
+{
+  ElementInfo info;
+  info.id           = elem.id;
+  info.name         = elem.name;
+  info.role         = elem.role;
+  info.description  = elem.description;
+  info.states       = StatesToString(elem.states);
+  info.boundsX      = elem.boundsX;
+  info.boundsY      = elem.boundsY;
+  info.boundsWidth  = elem.boundsWidth;
+  info.boundsHeight = elem.boundsHeight;
+  info.childCount   = elem.childCount;
+  info.childIds     = elem.childIds;
+  info.parentId     = elem.parentId;
+  info.automationId = elem.automationId;
+  return info;
+}
+
+SearchIndex::Entry NodeProxyQueryEngine::ToSearchEntry(const CachedElement& elem)
+{
+  return {elem.role, elem.name, elem.automationId, elem.states.GetRawData64()};
+}
+
+NodeStore::Node NodeProxyQueryEngine::ToStoreNode(uint32_t id, const CachedElement& elem)
+{
+  NodeStore::Node node;
+  node.id          = id;
+  node.parentId    = elem.parentId;
+  node.role        = elem.role;
+  node.name        = elem.name;
+  node.description = elem.description;
+  node.states      = elem.states.GetRawData64();
+  node.x           = elem.boundsX;
+  node.y           = elem.boundsY;
+  node.width       = elem.boundsWidth;
+  node.height      = elem.boundsHeight;
+  return node;
+}
+
+void NodeProxyQueryEngine::Publish(bool rebuild)
+{
+  auto previous = LoadSnapshot();
+  auto next     = std::make_shared<PublishedSnapshot>();
+  next->version = previous->version + 1;
+  next->rootId  = mRootId;
+
+  ChangeSet changes{next->version, {}};
+
+  // Elements whose content did not change keep the previous snapshot's copy
+  auto update = [&](uint32_t id, const CachedElement& elem) {
+    auto old = previous->elements.Find(id);
+    if(old && SameContent(*old, elem))
+    {
+      next->elements.Set(id, std::move(old));
+      return;
+    }
+    next->elements.Set(id, std::make_shared<const CachedElement>(elem));
+    changes.ids.emplace_back(id, old != nullptr);
+  };
+
+  if(rebuild)
+  {
+    for(auto& [id, elem] : mSnapshot)
+    {
+      update(id, elem);
+    }
+    previous->elements.ForEach([&](uint32_t id, const ElementPtr&) {
+      if(mSnapshot.find(id) == mSnapshot.end())
+      {
+        changes.ids.emplace_back(id, true);
+      }
+    });
+  }
+  else
+  {
+    // Shares every trie node; the updates below copy only the paths they touch
+    next->elements = previous->elements;
+    std::sort(mDirty.begin(), mDirty.end());
+    mDirty.erase(std::unique(mDirty.begin(), mDirty.end()), mDirty.end());
+    for(auto id : mDirty)
+    {
+      auto it = mSnapshot.find(id);
+      if(it != mSnapshot.end())
+      {
+        update(id, it->second);
+      }
+      else if(next->elements.Erase(id))
+      {
+        changes.ids.emplace_back(id, true);
+      }
+    }
+  }
+  mDirty.clear();
+
+  next->highlightableOrder = previous->highlightableOrder;
+  if(mOrderDirty || !next->highlightableOrder)
+  {
+    next->highlightableOrder = std::make_shared<const std::vector<uint32_t>>(mHighlightableOrder);
+    mOrderDirty              = false;
+  }
+
+  // The index changes together with the snapshot, so a search always
+  // reports elements of the version it ran against
+  std::unique_lock<std::shared_mutex> searchLock(mSearchMutex);
+  for(auto& [id, existed] : changes.ids)
+  {
+    if(auto elem = next->elements.Find(id))
+    {
+      mSearchIndex.Insert(id, ToSearchEntry(*elem));
+      mNodeStore.Upsert(ToStoreNode(id, *elem));
+    }
+    else
+    {
+      mSearchIndex.Erase(id);
+      mNodeStore.Erase(id);
+    }
+  }
+
+  // The change set is logged before the snapshot is visible, so a reader
+  // that sees a version can always find how it was reached
+  {
+    std::lock_guard<std::mutex> lock(mChangeLogMutex);
+    mChangeLog.push_back(std::move(changes));
+    if(mChangeLog.size() > MAX_CHANGE_LOG)
+    {
+      mChangeLog.pop_front();
+    }
+  }
+
+  std::atomic_store(&mPublished, std::shared_ptr<const PublishedSnapshot>(std::move(next)));
+  searchLock.unlock();
+  NotifyChange();
+}
+
+void NodeProxyQueryEngine::NotifyChange()
+{
+  // Taking the lock orders the change before the waiters' predicate check
+  {
+    std::lock_guard<std::mutex> lock(mNotifyMutex);
+  }
+  mNotifyCondition.notify_all();
+}
+
 uint32_t NodeProxyQueryEngine::GetRootId() const
 {
-  std::lock_guard<std::mutex> lock(mMutex);
-  return mRootId;
+  return LoadSnapshot()->rootId;
 }
 
 uint32_t NodeProxyQueryEngine::GetFocusedId() const
 {
-  std::lock_guard<std::mutex> lock(mMutex);
-  return mFocusedId;
+  return mFocusedId.load();
 }
 
 void NodeProxyQueryEngine::SetFocusedId(uint32_t id)
 {
-  {
-    std::lock_guard<std::mutex> lock(mMutex);
-    mFocusedId = id;
-  }
+  mFocusedId.store(id);
+  NotifyChange();
   if(mFocusChangedCallback)
   {
     mFocusChangedCallback(id);
@@ -207,10 +578,10 @@ void NodeProxyQueryEngine::SetFocusChangedCallback(std::function<void(uint32_t)>
 
 ElementInfo NodeProxyQueryEngine::GetElementInfo(uint32_t id)
 {
-  std::lock_guard<std::mutex> lock(mMutex);
+  auto snapshot = LoadSnapshot();
 
-  auto it = mSnapshot.find(id);
-  if(it == mSnapshot.end())
+  auto elem = snapshot->elements.Find(id);
+  if(!elem)
   {
     ElementInfo info{};
     info.id    = id;
@@ -220,32 +591,48 @@ ElementInfo NodeProxyQueryEngine::GetElementInfo(uint32_t id)
     return info;
   }
 
-  auto& elem = it->second;
-  ElementInfo info;
-  info.id           = elem.id;
-  info.name         = elem.name;
-  info.role         = elem.role;
-  info.description  = elem.description;
-  info.states       = elem.states;
-  info.boundsX      = elem.boundsX;
-  info.boundsY      = elem.boundsY;
-  info.boundsWidth  = elem.boundsWidth;
-  info.boundsHeight = elem.boundsHeight;
-  info.childCount   = elem.childCount;
-  info.childIds     = elem.childIds;
-  info.parentId     = elem.parentId;
-  return info;
+  return ToElementInfo(*elem);
+}
+
+void NodeProxyQueryEngine::BuildTreeNode(const PublishedSnapshot& snapshot, const CachedElement& elem, int maxDepth, TreeNode& node)
+{
+  node.id         = elem.id;
+  node.name       = elem.name;
+  node.role       = elem.role;
+  node.childCount = elem.childCount;
+
+  if(maxDepth == 0)
+  {
+    return;
+  }
+
+  node.children.reserve(elem.childIds.size());
+  for(auto childId : elem.childIds)
+  {
+    TreeNode child;
+    child.id = childId;
+    if(auto childElem = snapshot.elements.Find(childId))
+    {
+      BuildTreeNode(snapshot, *childElem, maxDepth - 1, child);
+    }
+    node.children.push_back(std::move(child));
+  }
 }
 
 TreeNode NodeProxyQueryEngine::BuildTree(uint32_t rootId)
 {
-  std::lock_guard<std::mutex> lock(mMutex);
+  return BuildSubtree(rootId, -1);
+}
+
+TreeNode NodeProxyQueryEngine::BuildSubtree(uint32_t rootId, int maxDepth)
+{
+  auto snapshot = LoadSnapshot();
 
   TreeNode node;
   node.id = rootId;
 
-  auto it = mSnapshot.find(rootId);
-  if(it == mSnapshot.end())
+  auto elem = snapshot->elements.Find(rootId);
+  if(!elem)
   {
     node.name       = "(not found)";
     node.role       = "UNKNOWN";
@@ -253,79 +640,37 @@ TreeNode NodeProxyQueryEngine::BuildTree(uint32_t rootId)
     return node;
   }
 
-  auto& elem       = it->second;
-  node.name        = elem.name;
-  node.role        = elem.role;
-  node.childCount  = elem.childCount;
-
-  for(auto childId : elem.childIds)
-  {
-    // Temporarily release lock for recursive call — but since
-    // snapshot is only modified in BuildSnapshot, this is safe
-    // as long as BuildSnapshot is not called concurrently.
-    // For simplicity, use non-locking internal helper.
-    TreeNode childNode;
-    childNode.id = childId;
-    auto childIt = mSnapshot.find(childId);
-    if(childIt != mSnapshot.end())
-    {
-      childNode.name       = childIt->second.name;
-      childNode.role       = childIt->second.role;
-      childNode.childCount = childIt->second.childCount;
-      // Build children recursively (inline to avoid deadlock)
-      std::function<void(TreeNode&)> buildChildren = [&](TreeNode& parent)
-      {
-        auto parentIt = mSnapshot.find(parent.id);
-        if(parentIt == mSnapshot.end()) return;
-        for(auto cid : parentIt->second.childIds)
-        {
-          TreeNode cn;
-          cn.id = cid;
-          auto cit = mSnapshot.find(cid);
-          if(cit != mSnapshot.end())
-          {
-            cn.name       = cit->second.name;
-            cn.role       = cit->second.role;
-            cn.childCount = cit->second.childCount;
-            buildChildren(cn);
-          }
-          parent.children.push_back(std::move(cn));
-        }
-      };
-      buildChildren(childNode);
-    }
-    node.children.push_back(std::move(childNode));
-  }
-
+  BuildTreeNode(*snapshot, *elem, maxDepth, node);
   return node;
 }
 
 uint32_t NodeProxyQueryEngine::Navigate(uint32_t currentId, bool forward)
 {
-  std::lock_guard<std::mutex> lock(mMutex);
+  auto  snapshot = LoadSnapshot();
+  auto& order    = *snapshot->highlightableOrder;
 
-  if(mHighlightableOrder.empty()) return currentId;
+  if(order.empty()) return currentId;
 
-  auto it = std::find(mHighlightableOrder.begin(), mHighlightableOrder.end(), currentId);
+  auto it = std::find(order.begin(), order.end(), currentId);
 
-  if(it == mHighlightableOrder.end())
+  if(it == order.end())
   {
-    return mHighlightableOrder.front();
+    return order.front();
   }
 
   if(forward)
   {
     ++it;
-    if(it == mHighlightableOrder.end())
+    if(it == order.end())
     {
-      it = mHighlightableOrder.begin();
+      it = order.begin();
     }
   }
   else
   {
-    if(it == mHighlightableOrder.begin())
+    if(it == order.begin())
     {
-      it = mHighlightableOrder.end();
+      it = order.end();
     }
     --it;
   }
@@ -335,32 +680,153 @@ uint32_t NodeProxyQueryEngine::Navigate(uint32_t currentId, bool forward)
 
 uint32_t NodeProxyQueryEngine::NavigateChild(uint32_t currentId)
 {
-  std::lock_guard<std::mutex> lock(mMutex);
+  auto snapshot = LoadSnapshot();
 
-  auto it = mSnapshot.find(currentId);
-  if(it == mSnapshot.end() || it->second.childIds.empty())
+  auto elem = snapshot->elements.Find(currentId);
+  if(!elem || elem->childIds.empty())
   {
     return currentId;
   }
-  return it->second.childIds.front();
+  return elem->childIds.front();
 }
 
 uint32_t NodeProxyQueryEngine::NavigateParent(uint32_t currentId)
 {
-  std::lock_guard<std::mutex> lock(mMutex);
+  auto snapshot = LoadSnapshot();
 
-  auto it = mSnapshot.find(currentId);
-  if(it == mSnapshot.end() || it->second.parentId == 0)
+  auto elem = snapshot->elements.Find(currentId);
+  if(!elem || elem->parentId == 0)
   {
     return currentId;
   }
-  return it->second.parentId;
+  return elem->parentId;
+}
+
+bool NodeProxyQueryEngine::SupportsConcurrentReads() const
+{
+  return true;
+}
+
+uint64_t NodeProxyQueryEngine::GetSnapshotVersion() const
+{
+  return LoadSnapshot()->version;
+}
+
+bool NodeProxyQueryEngine::GetDiff(uint64_t sinceVersion, SnapshotDiff& diff)
+{
+  auto snapshot    = LoadSnapshot();
+  diff             = {};
+  diff.fromVersion = sinceVersion;
+  diff.toVersion   = snapshot->version;
+  diff.rootId      = snapshot->rootId;
+  if(sinceVersion == snapshot->version)
+  {
+    return true;
+  }
+
+  // Whether each touched element existed at sinceVersion: its first change says
+  std::unordered_map<uint32_t, bool> existed;
+  {
+    std::lock_guard<std::mutex> lock(mChangeLogMutex);
+    if(sinceVersion == 0 || sinceVersion > snapshot->version || mChangeLog.empty() ||
+       mChangeLog.front().version > sinceVersion + 1)
+    {
+      diff.reset = true;
+      return true;
+    }
+    for(auto& changes : mChangeLog)
+    {
+      if(changes.version <= sinceVersion || changes.version > snapshot->version) continue;
+      for(auto& [id, before] : changes.ids)
+      {
+        existed.emplace(id, before);
+      }
+    }
+  }
+
+  for(auto& [id, before] : existed)
+  {
+    if(auto elem = snapshot->elements.Find(id))
+    {
+      (before ? diff.changed : diff.added).push_back(ToElementInfo(*elem));
+    }
+    else if(before)
+    {
+      diff.removed.push_back(id);
+    }
+  }
+
+  auto byId = [](const ElementInfo& a, const ElementInfo& b) { return a.id < b.id; };
+  std::sort(diff.added.begin(), diff.added.end(), byId);
+  std::sort(diff.changed.begin(), diff.changed.end(), byId);
+  std::sort(diff.removed.begin(), diff.removed.end());
+  return true;
+}
+
+void NodeProxyQueryEngine::WaitForChange(uint64_t version, uint32_t focusedId, std::chrono::milliseconds timeout)
+{
+  std::unique_lock<std::mutex> lock(mNotifyMutex);
+  mNotifyCondition.wait_for(lock, timeout, [&] {
+    return LoadSnapshot()->version != version || mFocusedId.load() != focusedId;
+  });
+}
+
+bool NodeProxyQueryEngine::Search(const SearchQuery& query, SearchResult& result)
+{
+  SearchIndex::Query filters;
+  bool               satisfiable = SearchIndex::MakeQuery(query, filters);
+
+  std::vector<uint32_t>                    ids;
+  std::shared_ptr<const PublishedSnapshot> snapshot;
+  result = {};
+  {
+    std::shared_lock<std::shared_mutex> lock(mSearchMutex);
+    snapshot = LoadSnapshot();
+    if(query.intersects)
+    {
+      ids = SearchArea(mNodeStore, mSearchIndex, query, result.total);
+    }
+    else if(satisfiable)
+    {
+      ids = mSearchIndex.Find(filters, query.limit, result.total);
+    }
+  }
+
+  result.version = snapshot->version;
+  result.elements.reserve(ids.size());
+  for(auto id : ids)
+  {
+    if(auto elem = snapshot->elements.Find(id))
+    {
+      result.elements.push_back(ToElementInfo(*elem));
+    }
+  }
+  return true;
+}
+
+bool NodeProxyQueryEngine::SerializeSnapshot(std::string& bytes)
+{
+  auto snapshot = LoadSnapshot();
+
+  std::vector<SnapshotFile::Element> elements;
+  elements.reserve(snapshot->elements.Size());
+  snapshot->elements.ForEach([&](uint32_t, const ElementPtr& elem) {
+    elements.push_back({ToElementInfo(*elem), elem->states.GetRawData64()});
+  });
+  bytes = SnapshotFile::Serialize(snapshot->version, snapshot->rootId, mFocusedId.load(), std::move(elements),
+                                  snapshot->highlightableOrder ? *snapshot->highlightableOrder : std::vector<uint32_t>{});
+  return true;
+}
+
+bool NodeProxyQueryEngine::SaveSnapshot(const std::string& path)
+{
+  std::string bytes;
+  return SerializeSnapshot(bytes) && SnapshotFile::WriteFile(path, bytes);
 }
 
 size_t NodeProxyQueryEngine::GetSnapshotSize() const
 {
-  std::lock_guard<std::mutex> lock(mMutex);
-  return mSnapshot.size();
+  return LoadSnapshot()->elements.Size();
 }
 
 } // namespace InspectorEngine
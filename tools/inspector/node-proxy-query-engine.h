@@ -19,18 +19,29 @@
  */
 
 // EXTERNAL INCLUDES
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 // INTERNAL INCLUDES
 #include <accessibility/api/accessibility.h>
+#include <accessibility/api/accessibility-event.h>
+#include <accessibility/internal/service/event-route-table.h>
 #include <tools/inspector/inspector-query-interface.h>
 #include <tools/inspector/inspector-types.h>
+#include <tools/inspector/node-store.h>
+#include <tools/inspector/persistent-id-map.h>
+#include <tools/inspector/search-index.h>
+#include <tools/inspector/snapshot-crawler.h>
 
 namespace Accessibility
 {
@@ -48,7 +59,24 @@ namespace InspectorEngine
  *
  * Usage:
  * 1. Call BuildSnapshot(root) from the main thread to capture the tree.
- * 2. Call GetElementInfo/BuildTree from any thread (reads immutable snapshot).
+ * 2. Call ApplyEvent() from the main thread to keep the snapshot current.
+ * 3. Call GetElementInfo/BuildTree from any thread.
+ *
+ * Element ids are bound to node addresses and stay stable across updates
+ * and full rebuilds, for as long as the node remains in the snapshot.
+ * IPC runs without holding the snapshot lock; only the merge of fetched
+ * nodes is done under it.
+ *
+ * Every update publishes a new immutable, versioned snapshot. Readers pick
+ * up the current one with an atomic load and never take the writer lock,
+ * so a long BuildTree does not block other readers or the writer. Elements
+ * live in a persistent trie: an update copies only the paths to the
+ * elements it changed and shares the rest with the previous snapshot.
+ *
+ * A SearchIndex over roles, states, names and automation ids, and a
+ * columnar NodeStore for searches by area, are updated with the elements
+ * each publish changed. Searches share a reader lock that the writer holds
+ * only while it applies those changes.
  */
 class NodeProxyQueryEngine : public InspectorQueryInterface
 {
@@ -66,6 +94,31 @@ public:
    */
   void BuildSnapshot(std::shared_ptr<Accessibility::NodeProxy> root);
 
+  /**
+   * @brief Updates the snapshot from an accessibility event.
+   *
+   * CHILDREN_CHANGED re-fetches the subtree of the source, and a parent
+   * change the subtree of the new parent. Name, description, role, state
+   * and bounds changes re-fetch that one field. Events from nodes outside
+   * the snapshot are ignored.
+   *
+   * Must be called from the main thread.
+   *
+   * @param[in] event The event
+   * @return true if the snapshot changed
+   */
+  bool ApplyEvent(const Accessibility::AccessibilityEvent& event);
+
+  /**
+   * @brief Sets how many nodes snapshots and subtree refreshes fetch concurrently.
+   */
+  void SetCrawlerConfig(const SnapshotCrawler::Config& config);
+
+  /**
+   * @brief Returns the throughput of the last snapshot or subtree refresh.
+   */
+  CrawlStats GetCrawlStats() const;
+
   /**
    * @brief Returns the root element ID.
    */
@@ -96,6 +149,11 @@ public:
    */
   TreeNode BuildTree(uint32_t rootId) override;
 
+  /**
+   * @brief Builds a tree structure at most maxDepth levels below the given root ID.
+   */
+  TreeNode BuildSubtree(uint32_t rootId, int maxDepth) override;
+
   /**
    * @brief Navigates to the next or previous highlightable element.
    */
@@ -111,6 +169,37 @@ public:
    */
   uint32_t NavigateParent(uint32_t currentId) override;
 
+  bool SupportsConcurrentReads() const override;
+
+  uint64_t GetSnapshotVersion() const override;
+
+  /**
+   * @brief Computes the elements that changed since the given snapshot version.
+   *
+   * The last MAX_CHANGE_LOG versions are kept; older versions yield a reset.
+   */
+  bool GetDiff(uint64_t sinceVersion, SnapshotDiff& diff) override;
+
+  void WaitForChange(uint64_t version, uint32_t focusedId, std::chrono::milliseconds timeout) override;
+
+  /**
+   * @brief Finds elements by role, name substring, states and automation id.
+   *
+   * Role and state names are matched ignoring case. A required state that
+   * does not exist matches nothing; an unknown excluded state is ignored.
+   */
+  bool Search(const SearchQuery& query, SearchResult& result) override;
+
+  bool SerializeSnapshot(std::string& bytes) override;
+
+  /**
+   * @brief Writes the current snapshot to a file that SnapshotFileQueryEngine can open.
+   *
+   * @param[in] path The file to write; an existing file is replaced
+   * @return true on success
+   */
+  bool SaveSnapshot(const std::string& path);
+
   /**
    * @brief Returns the number of elements in the snapshot.
    */
@@ -119,31 +208,98 @@ public:
 private:
   struct CachedElement
   {
-    uint32_t    id;
-    std::string name;
-    std::string role;
-    std::string description;
-    std::string states;
-    float       boundsX{0.0f};
-    float       boundsY{0.0f};
-    float       boundsWidth{0.0f};
-    float       boundsHeight{0.0f};
-    int         childCount{0};
-    std::vector<uint32_t> childIds;
-    uint32_t    parentId{0};
+    uint32_t                                  id;
+    std::shared_ptr<Accessibility::NodeProxy> proxy;
+    Accessibility::Address                    address;
+    std::string                               name;
+    std::string                               role;
+    std::string                               description;
+    std::string                               automationId;
+    Accessibility::States                     states;
+    float                                     boundsX{0.0f};
+    float                                     boundsY{0.0f};
+    float                                     boundsWidth{0.0f};
+    float                                     boundsHeight{0.0f};
+    int                                       childCount{0};
+    std::vector<uint32_t>                     childIds;
+    uint32_t                                  parentId{0};
   };
 
-  void TraverseTree(std::shared_ptr<Accessibility::NodeProxy> node, uint32_t parentId, uint32_t& nextId);
+  /**
+   * @brief A node fetched over IPC, not yet merged into the snapshot.
+   */
+  struct FetchedNode
+  {
+    CachedElement       element;
+    std::vector<size_t> children; ///< Indices into the fetched list
+  };
+
+  using ElementPtr = std::shared_ptr<const CachedElement>;
+
+  /**
+   * @brief What readers see; replaced as a whole, never modified.
+   */
+  struct PublishedSnapshot
+  {
+    uint64_t                                     version{0};
+    uint32_t                                     rootId{0};
+    PersistentIdMap<CachedElement>               elements; ///< Shares unchanged nodes with the previous version
+    std::shared_ptr<const std::vector<uint32_t>> highlightableOrder;
+  };
+
+  /**
+   * @brief Elements touched by one published version.
+   */
+  struct ChangeSet
+  {
+    uint64_t                                version;
+    std::vector<std::pair<uint32_t, bool>> ids; ///< Element id, whether it existed before
+  };
+
+  static constexpr size_t MAX_CHANGE_LOG = 256;
+
+  static bool SameContent(const CachedElement& a, const CachedElement& b);
+  static ElementInfo ToElementInfo(const CachedElement& elem);
+  static SearchIndex::Entry ToSearchEntry(const CachedElement& elem);
+  static NodeStore::Node ToStoreNode(uint32_t id, const CachedElement& elem);
+  void NotifyChange();
+
+  std::shared_ptr<const PublishedSnapshot> LoadSnapshot() const;
+  void Publish(bool rebuild);
+  void MarkDirty(uint32_t id);
+  static void BuildTreeNode(const PublishedSnapshot& snapshot, const CachedElement& elem, int maxDepth, TreeNode& node);
+
+  void FetchTree(const std::shared_ptr<Accessibility::NodeProxy>& root, std::vector<FetchedNode>& fetched);
+  uint32_t MergeTree(uint32_t replacedId, uint32_t parentId, std::vector<FetchedNode>& fetched);
+  bool RefreshSubtree(uint32_t id);
+  void RemoveSubtree(uint32_t id);
+  void CollectSubtree(uint32_t id, std::vector<uint32_t>& ids) const;
+  void UpdateDerivedState();
   void BuildHighlightableOrder(uint32_t nodeId);
   static std::string RoleToString(Accessibility::Role role);
   static std::string StatesToString(Accessibility::States states);
 
-  mutable std::mutex                              mMutex;
+  using IdMap = std::unordered_map<Accessibility::Address, uint32_t, Accessibility::AddressPathHash>;
+
+  SnapshotCrawler                                 mCrawler;
+  mutable std::mutex                              mMutex; ///< Serializes writers
   std::unordered_map<uint32_t, CachedElement>     mSnapshot;
+  IdMap                                           mIdByAddress;
   std::vector<uint32_t>                           mHighlightableOrder;
+  std::vector<uint32_t>                           mDirty; ///< Changed since the last Publish()
+  bool                                            mOrderDirty{false};
+  std::shared_ptr<const PublishedSnapshot>        mPublished;
+  std::deque<ChangeSet>                           mChangeLog;
+  SearchIndex                                     mSearchIndex;
+  NodeStore                                       mNodeStore;
+  mutable std::shared_mutex                       mSearchMutex; ///< Guards mSearchIndex and mNodeStore
+  mutable std::mutex                              mChangeLogMutex;
+  std::mutex                                      mNotifyMutex;
+  std::condition_variable                         mNotifyCondition;
   std::function<void(uint32_t)>                   mFocusChangedCallback;
   uint32_t                                        mRootId{0};
-  uint32_t                                        mFocusedId{0};
+  std::atomic<uint32_t>                           mFocusedId{0};
+  uint32_t                                        mNextId{1};
 };
 
 } // namespace InspectorEngine
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <tools/inspector/node-store.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <iterator>
+
+namespace InspectorEngine
+{
+uint32_t StringPool::Intern(std::string_view text)
+{
+  auto it = mIndex.find(text);
+  if(it != mIndex.end())
+  {
+    ++mReferences[it->second];
+    return it->second;
+  }
+
+  uint32_t index;
+  if(!mFree.empty())
+  {
+    index = mFree.back();
+    mFree.pop_back();
+    mStrings[index]    = std::string(text);
+    mReferences[index] = 1;
+  }
+  else
+  {
+    index = static_cast<uint32_t>(mStrings.size());
+    mStrings.emplace_back(text);
+    mReferences.push_back(1);
+  }
+  mIndex.emplace(mStrings[index], index);
+  return index;
+}
+
+void StringPool::Release(uint32_t index)
+{
+  if(index >= mReferences.size() || mReferences[index] == 0) return;
+
+  if(--mReferences[index] == 0)
+  {
+    mIndex.erase(mStrings[index]);
+    mStrings[index].clear();
+    mStrings[index].shrink_to_fit();
+    mFree.push_back(index);
+  }
+}
+
+uint32_t StringPool::Find(std::string_view text) const
+{
+  auto it = mIndex.find(text);
+  return it != mIndex.end() ? it->second : NONE;
+}
+
+std::string_view StringPool::Get(uint32_t index) const
+{
+  return index < mStrings.size() ? std::string_view(mStrings[index]) : std::string_view();
+}
+
+size_t StringPool::Size() const
+{
+  return mIndex.size();
+}
+
+void StringPool::Clear()
+{
+  mIndex.clear();
+  mStrings.clear();
+  mReferences.clear();
+  mFree.clear();
+}
+
+void NodeStore::Upsert(const Node& node)
+{
+  if(node.id >= mRowById.size())
+  {
+    mRowById.resize(node.id + 1, NO_ROW);
+  }
+
+  // Interning first keeps strings shared with the old values alive
+  auto role        = mStrings.Intern(node.role);
+  auto name        = mStrings.Intern(node.name);
+  auto description = mStrings.Intern(node.description);
+
+  auto row = mRowById[node.id];
+  if(row == NO_ROW)
+  {
+    row                = static_cast<uint32_t>(mIds.size());
+    mRowById[node.id]  = row;
+    mIds.push_back(node.id);
+    mParentIds.push_back(0);
+    mRoles.push_back(StringPool::NONE);
+    mNames.push_back(StringPool::NONE);
+    mDescriptions.push_back(StringPool::NONE);
+    mStates.push_back(0);
+    mX.push_back(0.0f);
+    mY.push_back(0.0f);
+    mWidths.push_back(0.0f);
+    mHeights.push_back(0.0f);
+  }
+  else
+  {
+    ReleaseStrings(row);
+  }
+
+  mParentIds[row]    = node.parentId;
+  mRoles[row]        = role;
+  mNames[row]        = name;
+  mDescriptions[row] = description;
+  mStates[row]       = node.states;
+  mX[row]            = node.x;
+  mY[row]            = node.y;
+  mWidths[row]       = node.width;
+  mHeights[row]      = node.height;
+}
+
+void NodeStore::ReleaseStrings(uint32_t row)
+{
+  mStrings.Release(mRoles[row]);
+  mStrings.Release(mNames[row]);
+  mStrings.Release(mDescriptions[row]);
+}
+
+void NodeStore::Erase(uint32_t id)
+{
+  if(id >= mRowById.size() || mRowById[id] == NO_ROW) return;
+
+  auto row  = mRowById[id];
+  auto last = static_cast<uint32_t>(mIds.size() - 1);
+  ReleaseStrings(row);
+
+  auto move = [row, last](auto& column) {
+    column[row] = column[last];
+    column.pop_back();
+  };
+  mRowById[mIds[last]] = row;
+  mRowById[id]         = NO_ROW;
+  move(mIds);
+  move(mParentIds);
+  move(mRoles);
+  move(mNames);
+  move(mDescriptions);
+  move(mStates);
+  move(mX);
+  move(mY);
+  move(mWidths);
+  move(mHeights);
+}
+
+void NodeStore::Clear()
+{
+  mRowById.clear();
+  mIds.clear();
+  mParentIds.clear();
+  mRoles.clear();
+  mNames.clear();
+  mDescriptions.clear();
+  mStates.clear();
+  mX.clear();
+  mY.clear();
+  mWidths.clear();
+  mHeights.clear();
+  mStrings.Clear();
+}
+
+size_t NodeStore::Size() const
+{
+  return mIds.size();
+}
+
+bool NodeStore::Contains(uint32_t id) const
+{
+  return id < mRowById.size() && mRowById[id] != NO_ROW;
+}
+
+bool NodeStore::Get(uint32_t id, Node& node) const
+{
+  if(!Contains(id)) return false;
+
+  auto row         = mRowById[id];
+  node.id          = id;
+  node.parentId    = mParentIds[row];
+  node.role        = mStrings.Get(mRoles[row]);
+  node.name        = mStrings.Get(mNames[row]);
+  node.description = mStrings.Get(mDescriptions[row]);
+  node.states      = mStates[row];
+  node.x           = mX[row];
+  node.y           = mY[row];
+  node.width       = mWidths[row];
+  node.height      = mHeights[row];
+  return true;
+}
+
+std::vector<uint32_t> NodeStore::Select(const Filter& filter) const
+{
+  const size_t rows = mIds.size();
+  std::vector<uint8_t> pass(rows, 1);
+
+  // One pass per filtered column; each loop is a plain element-wise AND
+  if(!filter.role.empty())
+  {
+    auto role = mStrings.Find(filter.role);
+    for(size_t row = 0; row < rows; ++row)
+    {
+      pass[row] &= mRoles[row] == role;
+    }
+  }
+  if(filter.requiredStates != 0 || filter.excludedStates != 0)
+  {
+    auto required = filter.requiredStates;
+    auto excluded = filter.excludedStates;
+    for(size_t row = 0; row < rows; ++row)
+    {
+      pass[row] &= ((mStates[row] & required) == required) & ((mStates[row] & excluded) == 0);
+    }
+  }
+  if(filter.intersects)
+  {
+    auto right  = filter.x + filter.width;
+    auto bottom = filter.y + filter.height;
+    for(size_t row = 0; row < rows; ++row)
+    {
+      pass[row] &= (mX[row] < right) & (mX[row] + mWidths[row] > filter.x) & (mY[row] < bottom) &
+                   (mY[row] + mHeights[row] > filter.y);
+    }
+  }
+
+  // Branch-free compaction: every row is written, only passing rows advance
+  std::vector<uint32_t> ids(rows + 1);
+  size_t                count = 0;
+  for(size_t row = 0; row < rows; ++row)
+  {
+    ids[count] = mIds[row];
+    count += pass[row];
+  }
+  ids.resize(count);
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+size_t NodeStore::GetStringCount() const
+{
+  return mStrings.Size();
+}
+
+std::vector<uint32_t> SearchArea(const NodeStore& store, const SearchIndex& index, const SearchQuery& query, size_t& total)
+{
+  total = 0;
+  SearchIndex::Query filters;
+  if(!SearchIndex::MakeQuery(query, filters)) return {};
+
+  NodeStore::Filter filter;
+  filter.role           = filters.role;
+  filter.requiredStates = filters.requiredStates;
+  filter.excludedStates = filters.excludedStates;
+  filter.intersects     = true;
+  filter.x              = query.areaX;
+  filter.y              = query.areaY;
+  filter.width          = query.areaWidth;
+  filter.height         = query.areaHeight;
+  auto ids              = store.Select(filter);
+
+  if(!filters.nameContains.empty() || !filters.automationId.empty())
+  {
+    SearchIndex::Query text;
+    text.nameContains = filters.nameContains;
+    text.automationId = filters.automationId;
+
+    size_t                matches;
+    auto                  named = index.Find(text, SIZE_MAX, matches);
+    std::vector<uint32_t> both;
+    std::set_intersection(ids.begin(), ids.end(), named.begin(), named.end(), std::back_inserter(both));
+    ids.swap(both);
+  }
+
+  total = ids.size();
+  if(ids.size() > query.limit)
+  {
+    ids.resize(query.limit);
+  }
+  return ids;
+}
+
+} // namespace InspectorEngine
@@ -0,0 +1,192 @@
+#ifndef ACCESSIBILITY_TOOLS_INSPECTOR_NODE_STORE_H
+#define ACCESSIBILITY_TOOLS_INSPECTOR_NODE_STORE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <tools/inspector/inspector-types.h>
+#include <tools/inspector/search-index.h>
+
+namespace InspectorEngine
+{
+/**
+ * @brief Reference-counted interned strings.
+ *
+ * Equal strings share one index. An index is reused once every reference
+ * to its string has been released.
+ */
+class StringPool
+{
+public:
+  static constexpr uint32_t NONE = UINT32_MAX;
+
+  /**
+   * @brief Adds a reference to text, interning it if needed.
+   */
+  uint32_t Intern(std::string_view text);
+
+  /**
+   * @brief Drops a reference taken by Intern().
+   */
+  void Release(uint32_t index);
+
+  /**
+   * @brief Returns the index of text, or NONE if it is not interned.
+   */
+  uint32_t Find(std::string_view text) const;
+
+  std::string_view Get(uint32_t index) const;
+
+  /**
+   * @brief Returns the number of distinct strings held.
+   */
+  size_t Size() const;
+
+  void Clear();
+
+private:
+  std::deque<std::string>                        mStrings; ///< Stable addresses as it grows
+  std::vector<uint32_t>                          mReferences;
+  std::vector<uint32_t>                          mFree;
+  std::unordered_map<std::string_view, uint32_t> mIndex; ///< Views into mStrings
+};
+
+/**
+ * @brief Columnar store of snapshot nodes.
+ *
+ * Each field is a separate column with one row per node: role and strings
+ * as interned indices, states as a 64-bit mask and extents as four float
+ * columns. Filters scan only the columns they need, row by row without
+ * branches, so the compiler can vectorize them and a scan over 100k nodes
+ * touches a few megabytes instead of every node's heap allocations.
+ *
+ * Rows are unordered; removing a node moves the last row into its place.
+ * The store is not synchronized.
+ */
+class NodeStore
+{
+public:
+  /**
+   * @brief The fields of one node.
+   */
+  struct Node
+  {
+    uint32_t         id{0};
+    uint32_t         parentId{0};
+    std::string_view role;
+    std::string_view name;
+    std::string_view description;
+    uint64_t         states{0}; ///< One bit per Accessibility::State
+    float            x{0.0f};
+    float            y{0.0f};
+    float            width{0.0f};
+    float            height{0.0f};
+  };
+
+  /**
+   * @brief A conjunction of column filters; empty fields match everything.
+   */
+  struct Filter
+  {
+    std::string role;
+    uint64_t    requiredStates{0};
+    uint64_t    excludedStates{0};
+    bool        intersects{false}; ///< Keep only nodes overlapping the area below
+    float       x{0.0f};
+    float       y{0.0f};
+    float       width{0.0f};
+    float       height{0.0f};
+  };
+
+  /**
+   * @brief Adds a node, or replaces the node with the same id.
+   */
+  void Upsert(const Node& node);
+
+  /**
+   * @brief Removes a node; unknown ids are ignored.
+   */
+  void Erase(uint32_t id);
+
+  void Clear();
+
+  size_t Size() const;
+
+  bool Contains(uint32_t id) const;
+
+  /**
+   * @brief Reads a node back; the views stay valid until the node changes.
+   */
+  bool Get(uint32_t id, Node& node) const;
+
+  /**
+   * @brief Returns the ids of the nodes matching every filter, in ascending order.
+   */
+  std::vector<uint32_t> Select(const Filter& filter) const;
+
+  /**
+   * @brief Returns the number of distinct interned strings.
+   */
+  size_t GetStringCount() const;
+
+private:
+  static constexpr uint32_t NO_ROW = UINT32_MAX;
+
+  void ReleaseStrings(uint32_t row);
+
+  std::vector<uint32_t> mRowById; ///< Indexed by id; NO_ROW if absent
+  std::vector<uint32_t> mIds;
+  std::vector<uint32_t> mParentIds;
+  std::vector<uint32_t> mRoles;
+  std::vector<uint32_t> mNames;
+  std::vector<uint32_t> mDescriptions;
+  std::vector<uint64_t> mStates;
+  std::vector<float>    mX;
+  std::vector<float>    mY;
+  std::vector<float>    mWidths;
+  std::vector<float>    mHeights;
+  StringPool            mStrings;
+};
+
+/**
+ * @brief Runs a search that has an area.
+ *
+ * Role, states and area are scanned in the store; name and automation id
+ * filters, if any, come from the index and are intersected with the scan.
+ * Both must describe the same elements.
+ *
+ * @param[in] store The node columns
+ * @param[in] index The search index
+ * @param[in] query The search, with intersects set
+ * @param[out] total The number of matches, including those past the limit
+ * @return The matching ids in ascending order, at most query.limit of them
+ */
+std::vector<uint32_t> SearchArea(const NodeStore& store, const SearchIndex& index, const SearchQuery& query, size_t& total);
+
+} // namespace InspectorEngine
+
+#endif // ACCESSIBILITY_TOOLS_INSPECTOR_NODE_STORE_H
@@ -0,0 +1,207 @@
+#ifndef ACCESSIBILITY_TOOLS_INSPECTOR_PERSISTENT_ID_MAP_H
+#define ACCESSIBILITY_TOOLS_INSPECTOR_PERSISTENT_ID_MAP_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace InspectorEngine
+{
+/**
+ * @brief Immutable-node map from dense ids to shared values.
+ *
+ * A 32-way radix trie over the id bits. Copying the map shares every node;
+ * Set() and Erase() copy only the nodes on the path to the id, so a change
+ * costs O(log32 id) regardless of how many entries the map holds. Ids are
+ * expected to be allocated from a counter, which keeps the trie shallow.
+ *
+ * Readers of one copy may run concurrently with a writer of another.
+ */
+template<typename T>
+class PersistentIdMap
+{
+public:
+  using ValuePtr = std::shared_ptr<const T>;
+
+  /**
+   * @brief Returns the value stored for id, or nullptr.
+   */
+  ValuePtr Find(uint32_t id) const
+  {
+    if(!mRoot || (static_cast<uint64_t>(id) >> (mShift + BITS)) != 0)
+    {
+      return nullptr;
+    }
+
+    const Node* node = mRoot.get();
+    for(auto shift = mShift; shift > 0; shift -= BITS)
+    {
+      node = static_cast<const Node*>(node->slots[(id >> shift) & MASK].get());
+      if(!node)
+      {
+        return nullptr;
+      }
+    }
+    return std::static_pointer_cast<const T>(node->slots[id & MASK]);
+  }
+
+  /**
+   * @brief Stores value for id, replacing any previous value.
+   *
+   * @param[in] id The id
+   * @param[in] value The value; must not be null
+   */
+  void Set(uint32_t id, ValuePtr value)
+  {
+    while((static_cast<uint64_t>(id) >> (mShift + BITS)) != 0)
+    {
+      auto root = std::make_shared<Node>();
+      root->slots[0] = std::move(mRoot);
+      mRoot          = std::move(root);
+      mShift += BITS;
+    }
+
+    bool added = false;
+    mRoot      = SetIn(mRoot, mShift, id, std::move(value), added);
+    mSize += added ? 1 : 0;
+  }
+
+  /**
+   * @brief Removes the value stored for id.
+   *
+   * @return true if there was one
+   */
+  bool Erase(uint32_t id)
+  {
+    if(!Find(id))
+    {
+      return false;
+    }
+    mRoot = EraseIn(mRoot, mShift, id);
+    --mSize;
+    return true;
+  }
+
+  /**
+   * @brief Calls fn(id, value) for every entry, in increasing id order.
+   */
+  template<typename Fn>
+  void ForEach(Fn&& fn) const
+  {
+    if(mRoot)
+    {
+      ForEachIn(*mRoot, mShift, 0, fn);
+    }
+  }
+
+  size_t Size() const
+  {
+    return mSize;
+  }
+
+private:
+  static constexpr unsigned BITS  = 5;
+  static constexpr unsigned WIDTH = 1u << BITS;
+  static constexpr uint32_t MASK  = WIDTH - 1;
+
+  /**
+   * @brief Inner nodes hold child Nodes, leaves hold values.
+   */
+  struct Node
+  {
+    std::array<std::shared_ptr<const void>, WIDTH> slots;
+  };
+
+  using NodePtr = std::shared_ptr<const Node>;
+
+  static NodePtr SetIn(const NodePtr& node, unsigned shift, uint32_t id, ValuePtr value, bool& added)
+  {
+    auto copy  = node ? std::make_shared<Node>(*node) : std::make_shared<Node>();
+    auto index = (id >> shift) & MASK;
+    if(shift == 0)
+    {
+      added              = !copy->slots[index];
+      copy->slots[index] = std::move(value);
+    }
+    else
+    {
+      auto child         = std::static_pointer_cast<const Node>(copy->slots[index]);
+      copy->slots[index] = SetIn(child, shift - BITS, id, std::move(value), added);
+    }
+    return copy;
+  }
+
+  static NodePtr EraseIn(const NodePtr& node, unsigned shift, uint32_t id)
+  {
+    auto copy  = std::make_shared<Node>(*node);
+    auto index = (id >> shift) & MASK;
+    if(shift == 0)
+    {
+      copy->slots[index].reset();
+    }
+    else
+    {
+      copy->slots[index] = EraseIn(std::static_pointer_cast<const Node>(copy->slots[index]), shift - BITS, id);
+    }
+
+    for(auto& slot : copy->slots)
+    {
+      if(slot)
+      {
+        return copy;
+      }
+    }
+    return nullptr;
+  }
+
+  template<typename Fn>
+  static void ForEachIn(const Node& node, unsigned shift, uint32_t prefix, Fn& fn)
+  {
+    for(uint32_t index = 0; index < WIDTH; ++index)
+    {
+      auto& slot = node.slots[index];
+      if(!slot)
+      {
+        continue;
+      }
+
+      uint32_t id = prefix | (index << shift);
+      if(shift == 0)
+      {
+        fn(id, std::static_pointer_cast<const T>(slot));
+      }
+      else
+      {
+        ForEachIn(*static_cast<const Node*>(slot.get()), shift - BITS, id, fn);
+      }
+    }
+  }
+
+  NodePtr  mRoot;
+  unsigned mShift{0}; ///< Bit offset of the root's index; 0 when the root is a leaf
+  size_t   mSize{0};
+};
+
+} // namespace InspectorEngine
+
+#endif // ACCESSIBILITY_TOOLS_INSPECTOR_PERSISTENT_ID_MAP_H
@@ -24,6 +24,7 @@
 
 // INTERNAL INCLUDES
 #include <accessibility/api/accessibility.h>
+#include <accessibility/api/accessibility-names.h>
 #include <accessibility/api/accessibility-bridge.h>
 #include <accessibility/internal/bridge/accessibility-common.h>
 #include <accessibility/internal/bridge/bridge-platform.h>
@@ -48,35 +49,12 @@ DBus::DBusClient AccessibilityQueryEngine::CreateClient(uint32_t id, const std::
 
 std::string AccessibilityQueryEngine::RoleToString(Accessibility::Role role)
 {
-  static const char* names[] = {
-    "INVALID", "ACCELERATOR_LABEL", "ALERT", "ANIMATION", "ARROW", "CALENDAR",
-    "CANVAS", "CHECK_BOX", "CHECK_MENU_ITEM", "COLOR_CHOOSER", "COLUMN_HEADER",
-    "COMBO_BOX", "DATE_EDITOR", "DESKTOP_ICON", "DESKTOP_FRAME", "DIAL", "DIALOG",
-    "DIRECTORY_PANE", "DRAWING_AREA", "FILE_CHOOSER", "FILLER", "FOCUS_TRAVERSABLE",
-    "FONT_CHOOSER", "FRAME", "GLASS_PANE", "HTML_CONTAINER", "ICON", "IMAGE",
-    "INTERNAL_FRAME", "LABEL", "LAYERED_PANE", "LIST", "LIST_ITEM", "MENU",
-    "MENU_BAR", "MENU_ITEM", "OPTION_PANE", "PAGE_TAB", "PAGE_TAB_LIST", "PANEL",
-    "PASSWORD_TEXT", "POPUP_MENU", "PROGRESS_BAR", "PUSH_BUTTON", "RADIO_BUTTON",
-    "RADIO_MENU_ITEM", "ROOT_PANE", "ROW_HEADER", "SCROLL_BAR", "SCROLL_PANE",
-    "SEPARATOR", "SLIDER", "SPIN_BUTTON", "SPLIT_PANE", "STATUS_BAR", "TABLE",
-    "TABLE_CELL", "TABLE_COLUMN_HEADER", "TABLE_ROW_HEADER", "TEAROFF_MENU_ITEM",
-    "TERMINAL", "TEXT", "TOGGLE_BUTTON", "TOOL_BAR", "TOOL_TIP", "TREE", "TREE_TABLE",
-    "UNKNOWN", "VIEWPORT", "WINDOW", "EXTENDED", "HEADER", "FOOTER", "PARAGRAPH",
-    "RULER", "APPLICATION", "AUTOCOMPLETE", "EDITBAR", "EMBEDDED", "ENTRY", "CHART",
-    "CAPTION", "DOCUMENT_FRAME", "HEADING", "PAGE", "SECTION", "REDUNDANT_OBJECT",
-    "FORM", "LINK", "INPUT_METHOD_WINDOW", "TABLE_ROW", "TREE_ITEM", "DOCUMENT_SPREADSHEET",
-    "DOCUMENT_PRESENTATION", "DOCUMENT_TEXT", "DOCUMENT_WEB", "DOCUMENT_EMAIL",
-    "COMMENT", "LIST_BOX", "GROUPING", "IMAGE_MAP", "NOTIFICATION", "INFO_BAR",
-    "LEVEL_BAR", "TITLE_BAR", "BLOCK_QUOTE", "AUDIO", "VIDEO", "DEFINITION",
-    "ARTICLE", "LANDMARK", "LOG", "MARQUEE", "MATH", "RATING", "TIMER", "STATIC",
-    "MATH_FRACTION", "MATH_ROOT", "SUBSCRIPT", "SUPERSCRIPT"
-  };
-  auto idx = static_cast<size_t>(role);
-  if(idx < sizeof(names) / sizeof(names[0]))
+  auto name = Accessibility::ROLE_IDENTIFIERS[role];
+  if(!name.empty())
   {
-    return names[idx];
+    return std::string{name};
   }
-  return "ROLE_" + std::to_string(idx);
+  return "ROLE_" + std::to_string(static_cast<size_t>(role));
 }
 
 AccessibilityQueryEngine::DemoTree AccessibilityQueryEngine::BuildDemoTree()
@@ -353,29 +331,19 @@ ElementInfo AccessibilityQueryEngine::GetElementInfo(uint32_t id)
   {
     auto stateData = std::get<0>(stateResult.getValues());
     Accessibility::States states{stateData};
-    static const std::pair<Accessibility::State, const char*> stateNames[] = {
-      {Accessibility::State::ENABLED, "ENABLED"},
-      {Accessibility::State::VISIBLE, "VISIBLE"},
-      {Accessibility::State::SHOWING, "SHOWING"},
-      {Accessibility::State::SENSITIVE, "SENSITIVE"},
-      {Accessibility::State::FOCUSABLE, "FOCUSABLE"},
-      {Accessibility::State::FOCUSED, "FOCUSED"},
-      {Accessibility::State::ACTIVE, "ACTIVE"},
-      {Accessibility::State::CHECKED, "CHECKED"},
-      {Accessibility::State::SELECTED, "SELECTED"},
-      {Accessibility::State::EXPANDED, "EXPANDED"},
-      {Accessibility::State::PRESSED, "PRESSED"},
-      {Accessibility::State::HIGHLIGHTABLE, "HIGHLIGHTABLE"},
-      {Accessibility::State::HIGHLIGHTED, "HIGHLIGHTED"},
-      {Accessibility::State::EDITABLE, "EDITABLE"},
-      {Accessibility::State::READ_ONLY, "READ_ONLY"},
+    static constexpr Accessibility::State shownStates[] = {
+      Accessibility::State::ENABLED, Accessibility::State::VISIBLE, Accessibility::State::SHOWING,
+      Accessibility::State::SENSITIVE, Accessibility::State::FOCUSABLE, Accessibility::State::FOCUSED,
+      Accessibility::State::ACTIVE, Accessibility::State::CHECKED, Accessibility::State::SELECTED,
+      Accessibility::State::EXPANDED, Accessibility::State::PRESSED, Accessibility::State::HIGHLIGHTABLE,
+      Accessibility::State::HIGHLIGHTED, Accessibility::State::EDITABLE, Accessibility::State::READ_ONLY,
     };
-    for(auto& [state, name] : stateNames)
+    for(auto state : shownStates)
     {
       if(states[state])
       {
         if(!info.states.empty()) info.states += ", ";
-        info.states += name;
+        info.states += Accessibility::STATE_IDENTIFIERS[state];
       }
     }
   }
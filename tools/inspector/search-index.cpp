@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <tools/inspector/search-index.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/accessibility-names.h>
+
+namespace InspectorEngine
+{
+namespace
+{
+std::string ToUpperAscii(std::string text)
+{
+  for(auto& c : text)
+  {
+    if(c >= 'a' && c <= 'z')
+    {
+      c = static_cast<char>(c - 'a' + 'A');
+    }
+  }
+  return text;
+}
+
+/**
+ * @brief Converts state names to a mask; returns false if a name is unknown.
+ */
+bool StateMaskFromNames(const std::vector<std::string>& names, uint64_t& mask)
+{
+  bool known = true;
+  for(auto& name : names)
+  {
+    Accessibility::State state;
+    if(!Accessibility::STATE_IDENTIFIERS.Find(ToUpperAscii(name), state))
+    {
+      known = false;
+      continue;
+    }
+    mask |= uint64_t{1} << static_cast<uint32_t>(state);
+  }
+  return known;
+}
+
+std::string ToLowerAscii(const std::string& text)
+{
+  std::string lower(text);
+  for(auto& c : lower)
+  {
+    if(c >= 'A' && c <= 'Z')
+    {
+      c = static_cast<char>(c - 'A' + 'a');
+    }
+  }
+  return lower;
+}
+
+} // namespace
+
+bool SearchIndex::MakeQuery(const SearchQuery& search, Query& query)
+{
+  query.role         = ToUpperAscii(search.role);
+  query.nameContains = search.nameContains;
+  query.automationId = search.automationId;
+  bool satisfiable   = StateMaskFromNames(search.states, query.requiredStates);
+  StateMaskFromNames(search.excludedStates, query.excludedStates);
+  return satisfiable;
+}
+
+std::vector<uint32_t> SearchIndex::Grams(const std::string& text, bool forQuery)
+{
+  auto byte = [&text](size_t i) { return static_cast<uint32_t>(static_cast<uint8_t>(text[i])); };
+
+  std::vector<uint32_t> grams;
+  if(!forQuery || text.size() >= 3)
+  {
+    for(size_t i = 0; i + 2 < text.size(); ++i)
+    {
+      grams.push_back(byte(i) << 16 | byte(i + 1) << 8 | byte(i + 2));
+    }
+  }
+  if(!forQuery || text.size() == 2)
+  {
+    for(size_t i = 0; i + 1 < text.size(); ++i)
+    {
+      grams.push_back(BIGRAM | byte(i) << 8 | byte(i + 1));
+    }
+  }
+  std::sort(grams.begin(), grams.end());
+  grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+  return grams;
+}
+
+void SearchIndex::AddPosting(std::vector<uint32_t>& postings, uint32_t id)
+{
+  // New elements get the highest ids, so this is nearly always an append
+  if(postings.empty() || postings.back() < id)
+  {
+    postings.push_back(id);
+    return;
+  }
+  auto it = std::lower_bound(postings.begin(), postings.end(), id);
+  if(it == postings.end() || *it != id)
+  {
+    postings.insert(it, id);
+  }
+}
+
+void SearchIndex::RemovePosting(std::vector<uint32_t>& postings, uint32_t id)
+{
+  auto it = std::lower_bound(postings.begin(), postings.end(), id);
+  if(it != postings.end() && *it == id)
+  {
+    postings.erase(it);
+  }
+}
+
+void SearchIndex::SetBit(Bitmap& bitmap, uint32_t id, bool value)
+{
+  size_t word = id / 64;
+  if(word >= bitmap.size())
+  {
+    if(!value) return;
+    bitmap.resize(word + 1, 0);
+  }
+  auto mask = uint64_t{1} << (id % 64);
+  bitmap[word] = value ? bitmap[word] | mask : bitmap[word] & ~mask;
+}
+
+bool SearchIndex::TestBit(const Bitmap& bitmap, uint32_t id)
+{
+  size_t word = id / 64;
+  return word < bitmap.size() && (bitmap[word] >> (id % 64)) & 1;
+}
+
+void SearchIndex::Insert(uint32_t id, Entry entry)
+{
+  Erase(id);
+  if(id >= mSlots.size())
+  {
+    mSlots.resize(id + 1);
+  }
+
+  auto& slot        = mSlots[id];
+  slot.live         = true;
+  slot.role         = std::move(entry.role);
+  slot.lowerName    = ToLowerAscii(entry.name);
+  slot.automationId = std::move(entry.automationId);
+  slot.states       = entry.states;
+
+  SetBit(mLive, id, true);
+  SetBit(mRoles[slot.role], id, true);
+  for(size_t bit = 0; bit < mStates.size(); ++bit)
+  {
+    if(slot.states >> bit & 1)
+    {
+      SetBit(mStates[bit], id, true);
+    }
+  }
+  for(auto gram : Grams(slot.lowerName, false))
+  {
+    AddPosting(mGrams[gram], id);
+  }
+  if(!slot.automationId.empty())
+  {
+    AddPosting(mAutomationIds[slot.automationId], id);
+  }
+  ++mSize;
+}
+
+void SearchIndex::Erase(uint32_t id)
+{
+  if(id >= mSlots.size() || !mSlots[id].live) return;
+
+  auto& slot = mSlots[id];
+  SetBit(mLive, id, false);
+  auto role = mRoles.find(slot.role);
+  if(role != mRoles.end())
+  {
+    SetBit(role->second, id, false);
+  }
+  for(size_t bit = 0; bit < mStates.size(); ++bit)
+  {
+    if(slot.states >> bit & 1)
+    {
+      SetBit(mStates[bit], id, false);
+    }
+  }
+  for(auto gram : Grams(slot.lowerName, false))
+  {
+    auto it = mGrams.find(gram);
+    if(it == mGrams.end()) continue;
+    RemovePosting(it->second, id);
+    if(it->second.empty())
+    {
+      mGrams.erase(it);
+    }
+  }
+  auto automationId = mAutomationIds.find(slot.automationId);
+  if(automationId != mAutomationIds.end())
+  {
+    RemovePosting(automationId->second, id);
+    if(automationId->second.empty())
+    {
+      mAutomationIds.erase(automationId);
+    }
+  }
+
+  slot = Slot{};
+  --mSize;
+}
+
+void SearchIndex::Clear()
+{
+  mSlots.clear();
+  mLive.clear();
+  mRoles.clear();
+  for(auto& column : mStates)
+  {
+    column.clear();
+  }
+  mGrams.clear();
+  mAutomationIds.clear();
+  mSize = 0;
+}
+
+size_t SearchIndex::Size() const
+{
+  return mSize;
+}
+
+std::vector<uint32_t> SearchIndex::Find(const Query& query, size_t limit, size_t& total) const
+{
+  total = 0;
+  std::vector<uint32_t> result;
+
+  // Role and state filters narrow a bitmap of live ids
+  Bitmap candidates = mLive;
+  auto   intersect  = [&candidates](const Bitmap* column, bool negate) {
+    for(size_t word = 0; word < candidates.size(); ++word)
+    {
+      uint64_t bits = column && word < column->size() ? (*column)[word] : 0;
+      candidates[word] &= negate ? ~bits : bits;
+    }
+  };
+  if(!query.role.empty())
+  {
+    auto it = mRoles.find(query.role);
+    intersect(it != mRoles.end() ? &it->second : nullptr, false);
+  }
+  for(size_t bit = 0; bit < mStates.size(); ++bit)
+  {
+    if(query.requiredStates >> bit & 1)
+    {
+      intersect(&mStates[bit], false);
+    }
+    if(query.excludedStates >> bit & 1)
+    {
+      intersect(&mStates[bit], true);
+    }
+  }
+
+  // Automation id and name n-grams give posting lists to intersect
+  std::vector<const std::vector<uint32_t>*> lists;
+  if(!query.automationId.empty())
+  {
+    auto it = mAutomationIds.find(query.automationId);
+    if(it == mAutomationIds.end()) return result;
+    lists.push_back(&it->second);
+  }
+  auto needle = ToLowerAscii(query.nameContains);
+  for(auto gram : Grams(needle, true))
+  {
+    auto it = mGrams.find(gram);
+    if(it == mGrams.end()) return result;
+    lists.push_back(&it->second);
+  }
+
+  // A needle of two or three bytes is a single n-gram; longer ones are
+  // only narrowed by their n-grams and the name itself is checked last
+  bool verify = needle.size() == 1 || needle.size() > 3;
+  auto accept = [&](uint32_t id) {
+    if(verify && mSlots[id].lowerName.find(needle) == std::string::npos) return;
+    if(result.size() < limit)
+    {
+      result.push_back(id);
+    }
+    ++total;
+  };
+
+  if(lists.empty())
+  {
+    for(size_t word = 0; word < candidates.size(); ++word)
+    {
+      for(auto bits = candidates[word]; bits != 0; bits &= bits - 1)
+      {
+        accept(static_cast<uint32_t>(word * 64 + __builtin_ctzll(bits)));
+      }
+    }
+    return result;
+  }
+
+  // Walk the shortest list; the others are probed with cursors that only move forward
+  std::sort(lists.begin(), lists.end(), [](auto* a, auto* b) { return a->size() < b->size(); });
+  std::vector<std::vector<uint32_t>::const_iterator> cursors;
+  for(auto* list : lists)
+  {
+    cursors.push_back(list->begin());
+  }
+  for(auto id : *lists.front())
+  {
+    if(!TestBit(candidates, id)) continue;
+
+    bool inAll = true;
+    for(size_t i = 1; inAll && i < lists.size(); ++i)
+    {
+      cursors[i] = std::lower_bound(cursors[i], lists[i]->end(), id);
+      inAll      = cursors[i] != lists[i]->end() && *cursors[i] == id;
+    }
+    if(inAll)
+    {
+      accept(id);
+    }
+  }
+  return result;
+}
+
+} // namespace InspectorEngine
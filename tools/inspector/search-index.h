@@ -0,0 +1,143 @@
+#ifndef ACCESSIBILITY_TOOLS_INSPECTOR_SEARCH_INDEX_H
+#define ACCESSIBILITY_TOOLS_INSPECTOR_SEARCH_INDEX_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <tools/inspector/inspector-types.h>
+
+namespace InspectorEngine
+{
+/**
+ * @brief Secondary indexes over snapshot elements, keyed by element id.
+ *
+ * Roles and states are kept as bitmap columns with one bit per id, so
+ * filters combine with word-wise AND. Names are indexed by their byte
+ * bigrams and trigrams; a substring query intersects the posting lists of
+ * the needle's n-grams and only checks the names that survive. Automation
+ * ids map to posting lists directly.
+ *
+ * Name matching ignores ASCII case. The index is not synchronized.
+ */
+class SearchIndex
+{
+public:
+  /**
+   * @brief The indexed fields of one element.
+   */
+  struct Entry
+  {
+    std::string role;
+    std::string name;
+    std::string automationId;
+    uint64_t    states{0}; ///< One bit per Accessibility::State
+  };
+
+  /**
+   * @brief A conjunction of filters; empty fields match everything.
+   */
+  struct Query
+  {
+    std::string role;
+    std::string nameContains;
+    std::string automationId;
+    uint64_t    requiredStates{0};
+    uint64_t    excludedStates{0};
+  };
+
+  /**
+   * @brief Converts a SearchQuery into filters.
+   *
+   * Role and state names are matched ignoring case. An unknown excluded
+   * state is ignored.
+   *
+   * @return false if a required state does not exist, so nothing can match
+   */
+  static bool MakeQuery(const SearchQuery& search, Query& query);
+
+  /**
+   * @brief Adds an element, replacing any previous entry with the same id.
+   */
+  void Insert(uint32_t id, Entry entry);
+
+  /**
+   * @brief Removes an element; unknown ids are ignored.
+   */
+  void Erase(uint32_t id);
+
+  void Clear();
+
+  /**
+   * @brief Returns the number of indexed elements.
+   */
+  size_t Size() const;
+
+  /**
+   * @brief Finds the elements matching every filter of query.
+   *
+   * @param[in] query The filters
+   * @param[in] limit Most ids to return
+   * @param[out] total The number of matches, including those past limit
+   * @return The matching ids in ascending order, at most limit of them
+   */
+  std::vector<uint32_t> Find(const Query& query, size_t limit, size_t& total) const;
+
+private:
+  using Bitmap = std::vector<uint64_t>;
+
+  struct Slot
+  {
+    bool        live{false};
+    std::string role;
+    std::string lowerName;
+    std::string automationId;
+    uint64_t    states{0};
+  };
+
+  static constexpr uint32_t BIGRAM = 1u << 24; ///< Tags bigram keys apart from trigram keys
+
+  /**
+   * @brief Returns the distinct n-gram keys of text; a query needs only the
+   * trigrams, or the bigram of a two-byte needle.
+   */
+  static std::vector<uint32_t> Grams(const std::string& text, bool forQuery);
+  static void AddPosting(std::vector<uint32_t>& postings, uint32_t id);
+  static void RemovePosting(std::vector<uint32_t>& postings, uint32_t id);
+  static void SetBit(Bitmap& bitmap, uint32_t id, bool value);
+  static bool TestBit(const Bitmap& bitmap, uint32_t id);
+
+  std::vector<Slot>                                      mSlots; ///< Indexed by id
+  Bitmap                                                 mLive;
+  std::unordered_map<std::string, Bitmap>                mRoles;
+  std::array<Bitmap, 64>                                 mStates;
+  std::unordered_map<uint32_t, std::vector<uint32_t>>    mGrams;
+  std::unordered_map<std::string, std::vector<uint32_t>> mAutomationIds;
+  size_t                                                 mSize{0};
+};
+
+} // namespace InspectorEngine
+
+#endif // ACCESSIBILITY_TOOLS_INSPECTOR_SEARCH_INDEX_H
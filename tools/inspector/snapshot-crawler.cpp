@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <tools/inspector/snapshot-crawler.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <utility>
+
+namespace InspectorEngine
+{
+namespace
+{
+struct PendingNode
+{
+  std::shared_ptr<Accessibility::NodeProxy> proxy;
+  Accessibility::Address                    address;
+  size_t                                    index;
+};
+
+struct BusQueue
+{
+  std::deque<PendingNode> pending;
+  size_t                  inFlight{0};
+};
+
+struct Reply
+{
+  size_t                        index;
+  std::string                   bus;
+  Accessibility::SnapshotFields fields;
+};
+
+/**
+ * @brief Replies handed from the proxies' callbacks to the crawling thread.
+ */
+struct ReplyQueue
+{
+  std::mutex              mutex;
+  std::condition_variable arrived;
+  std::deque<Reply>       replies;
+};
+
+using BusMap = std::map<std::string, BusQueue>;
+
+/**
+ * @brief Picks the next bus with queued work and spare capacity, round-robin.
+ */
+BusMap::iterator PickBus(BusMap& buses, const std::string& lastBus, size_t maxInFlightPerBus)
+{
+  auto start = buses.upper_bound(lastBus);
+  for(size_t i = 0; i < buses.size(); ++i, ++start)
+  {
+    if(start == buses.end())
+    {
+      start = buses.begin();
+    }
+    if(!start->second.pending.empty() && start->second.inFlight < maxInFlightPerBus)
+    {
+      return start;
+    }
+  }
+  return buses.end();
+}
+
+/**
+ * @brief Reorders nodes from fetch order into depth-first pre-order.
+ */
+std::vector<CrawledNode> ToPreOrder(std::vector<CrawledNode>& nodes)
+{
+  std::vector<size_t> order;
+  std::vector<size_t> position(nodes.size());
+  std::vector<size_t> stack{0};
+  order.reserve(nodes.size());
+  while(!stack.empty())
+  {
+    auto index = stack.back();
+    stack.pop_back();
+    position[index] = order.size();
+    order.push_back(index);
+    auto& children = nodes[index].children;
+    stack.insert(stack.end(), children.rbegin(), children.rend());
+  }
+
+  std::vector<CrawledNode> result;
+  result.reserve(order.size());
+  for(auto index : order)
+  {
+    result.push_back(std::move(nodes[index]));
+    for(auto& child : result.back().children)
+    {
+      child = position[child];
+    }
+  }
+  return result;
+}
+
+} // namespace
+
+SnapshotCrawler::SnapshotCrawler() = default;
+
+SnapshotCrawler::SnapshotCrawler(const Config& config)
+: mConfig(config)
+{
+}
+
+std::vector<CrawledNode> SnapshotCrawler::Crawl(const std::shared_ptr<Accessibility::NodeProxy>& root)
+{
+  if(!root)
+  {
+    return {};
+  }
+
+  auto config      = GetConfig();
+  auto maxInFlight = std::max<size_t>(config.maxInFlight, 1);
+  auto perBus      = std::max<size_t>(config.maxInFlightPerBus, 1);
+  auto begin       = std::chrono::steady_clock::now();
+
+  std::vector<CrawledNode> nodes(1);
+  BusMap                   buses;
+  std::string              lastBus;
+  size_t                   queued{1};
+  size_t                   inFlight{0};
+  size_t                   peakInFlight{0};
+  size_t                   sent{0};
+  size_t                   inFlightSum{0};
+
+  auto rootAddress = root->getAddress();
+  buses[rootAddress.GetBus()].pending.push_back({root, std::move(rootAddress), 0});
+
+  // Callbacks may run on another thread, or before fetchSnapshotFields() returns
+  auto queue = std::make_shared<ReplyQueue>();
+  while(queued > 0 || inFlight > 0)
+  {
+    while(inFlight < maxInFlight)
+    {
+      auto bus = PickBus(buses, lastBus, perBus);
+      if(bus == buses.end())
+      {
+        break;
+      }
+
+      auto item = std::move(bus->second.pending.front());
+      bus->second.pending.pop_front();
+      ++bus->second.inFlight;
+      lastBus = bus->first;
+      --queued;
+      ++inFlight;
+      ++sent;
+      inFlightSum += inFlight;
+      peakInFlight = std::max(peakInFlight, inFlight);
+
+      nodes[item.index].proxy   = item.proxy;
+      nodes[item.index].address = std::move(item.address);
+      item.proxy->fetchSnapshotFields([queue, index = item.index, busName = bus->first](Accessibility::SnapshotFields fields) {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->replies.push_back({index, busName, std::move(fields)});
+        queue->arrived.notify_one();
+      });
+    }
+
+    std::deque<Reply> replies;
+    {
+      std::unique_lock<std::mutex> lock(queue->mutex);
+      if(!config.dispatch)
+      {
+        queue->arrived.wait(lock, [&queue] { return !queue->replies.empty(); });
+      }
+      replies.swap(queue->replies);
+    }
+    if(replies.empty())
+    {
+      config.dispatch();
+      continue;
+    }
+
+    for(auto& reply : replies)
+    {
+      --buses[reply.bus].inFlight;
+      --inFlight;
+
+      auto& node        = nodes[reply.index];
+      node.name         = std::move(reply.fields.name);
+      node.role         = reply.fields.role;
+      node.description  = std::move(reply.fields.description);
+      node.automationId = std::move(reply.fields.automationId);
+      node.states       = reply.fields.states;
+      node.extents      = reply.fields.extents;
+
+      for(auto& child : reply.fields.children)
+      {
+        if(!child)
+        {
+          continue;
+        }
+        auto index    = nodes.size();
+        auto address  = child->getAddress();
+        auto childBus = address.GetBus();
+        nodes.emplace_back();
+        nodes[reply.index].children.push_back(index);
+        buses[childBus].pending.push_back({std::move(child), std::move(address), index});
+        ++queued;
+      }
+    }
+  }
+
+  CrawlStats stats;
+  stats.nodes        = nodes.size();
+  stats.buses        = buses.size();
+  stats.peakInFlight = peakInFlight;
+  stats.meanInFlight = sent ? static_cast<double>(inFlightSum) / sent : 0.0;
+  stats.elapsed      = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+
+  std::lock_guard<std::mutex> lock(mMutex);
+  mStats = stats;
+  return ToPreOrder(nodes);
+}
+
+void SnapshotCrawler::SetConfig(const Config& config)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mConfig = config;
+}
+
+SnapshotCrawler::Config SnapshotCrawler::GetConfig() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mConfig;
+}
+
+CrawlStats SnapshotCrawler::GetStats() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mStats;
+}
+
+} // namespace InspectorEngine
@@ -0,0 +1,138 @@
+#ifndef ACCESSIBILITY_TOOLS_INSPECTOR_SNAPSHOT_CRAWLER_H
+#define ACCESSIBILITY_TOOLS_INSPECTOR_SNAPSHOT_CRAWLER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/accessibility.h>
+#include <accessibility/api/node-proxy.h>
+
+namespace InspectorEngine
+{
+/**
+ * @brief A node as fetched by SnapshotCrawler.
+ */
+struct CrawledNode
+{
+  std::shared_ptr<Accessibility::NodeProxy> proxy;
+  Accessibility::Address                    address;
+  std::string                               name;
+  Accessibility::Role                       role{Accessibility::Role::UNKNOWN};
+  std::string                               description;
+  std::string                               automationId;
+  Accessibility::States                     states;
+  Accessibility::Rect<int>                  extents;
+  std::vector<size_t>                       children; ///< Indices into the crawl result
+};
+
+/**
+ * @brief Throughput of the last crawl.
+ */
+struct CrawlStats
+{
+  size_t                    nodes{0};
+  size_t                    buses{0};          ///< Distinct application buses visited
+  size_t                    peakInFlight{0};   ///< Most node fetches outstanding at once
+  double                    meanInFlight{0.0}; ///< Outstanding fetches, averaged over requests sent
+  std::chrono::microseconds elapsed{0};
+
+  double NodesPerSecond() const
+  {
+    return elapsed.count() > 0 ? nodes * 1e6 / elapsed.count() : 0.0;
+  }
+};
+
+/**
+ * @brief Fetches an accessibility subtree with several requests outstanding.
+ *
+ * Each node is fetched with NodeProxy::fetchSnapshotFields(), which remote
+ * proxies send without waiting for the reply, so up to Config::maxInFlight
+ * nodes are pending on the one IPC connection at a time. Nodes are fetched
+ * breadth-first: a node's children are queued as soon as its reply arrives.
+ *
+ * Work is queued per application bus and each bus gets at most
+ * Config::maxInFlightPerBus pending requests, so several applications are
+ * crawled at once without any one of them being flooded.
+ */
+class SnapshotCrawler
+{
+public:
+  struct Config
+  {
+    size_t maxInFlight{8};       ///< Node fetches outstanding at once; 1 fetches one node at a time
+    size_t maxInFlightPerBus{4}; ///< Node fetches outstanding at once on one application bus
+
+    /**
+     * @brief Runs one iteration of the loop that delivers the proxies' replies.
+     *
+     * Crawl() calls it while requests are outstanding and none has been
+     * answered. Set it when replies are dispatched by the crawling thread
+     * itself, e.g. g_main_context_iteration() on the default GLib context;
+     * otherwise Crawl() waits for a reply delivered on another thread.
+     */
+    std::function<void()> dispatch;
+  };
+
+  SnapshotCrawler();
+  explicit SnapshotCrawler(const Config& config);
+
+  /**
+   * @brief Fetches name, role, description, automation id, states, screen
+   * extents and children of every node below root.
+   *
+   * Blocks until every reply has arrived.
+   *
+   * @param[in] root The subtree root
+   * @return The nodes in depth-first pre-order, root first; empty if root is null
+   */
+  std::vector<CrawledNode> Crawl(const std::shared_ptr<Accessibility::NodeProxy>& root);
+
+  /**
+   * @brief Sets the request window used by later crawls.
+   */
+  void SetConfig(const Config& config);
+
+  /**
+   * @brief Returns the request window.
+   */
+  Config GetConfig() const;
+
+  /**
+   * @brief Returns the statistics of the last completed crawl.
+   */
+  CrawlStats GetStats() const;
+
+private:
+  mutable std::mutex mMutex;
+  Config             mConfig;
+  CrawlStats         mStats;
+};
+
+} // namespace InspectorEngine
+
+#endif // ACCESSIBILITY_TOOLS_INSPECTOR_SNAPSHOT_CRAWLER_H
@@ -0,0 +1,449 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <tools/inspector/snapshot-file-query-engine.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace InspectorEngine
+{
+namespace
+{
+/**
+ * @brief Checks that count items of T at offset lie within a file of size bytes.
+ */
+template<typename T>
+bool SectionFits(uint64_t offset, uint64_t count, size_t size)
+{
+  return offset % alignof(T) == 0 && offset <= size && count <= (size - offset) / sizeof(T);
+}
+
+} // namespace
+
+SnapshotFileQueryEngine::SnapshotFileQueryEngine() = default;
+
+SnapshotFileQueryEngine::~SnapshotFileQueryEngine()
+{
+  Close();
+}
+
+bool SnapshotFileQueryEngine::Fail(const std::string& error)
+{
+  Close();
+  mError = error;
+  return false;
+}
+
+bool SnapshotFileQueryEngine::Open(const std::string& path)
+{
+  Close();
+  mError.clear();
+
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if(fd < 0)
+  {
+    return Fail("cannot open " + path + ": " + std::strerror(errno));
+  }
+  struct stat info;
+  if(::fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(SnapshotFile::Header)))
+  {
+    ::close(fd);
+    return Fail(path + " is not a snapshot file");
+  }
+
+  auto size = static_cast<size_t>(info.st_size);
+  auto data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if(data == MAP_FAILED)
+  {
+    return Fail("cannot map " + path + ": " + std::strerror(errno));
+  }
+  mData = static_cast<const char*>(data);
+  mSize = size;
+
+  // Only the header is checked up front; records are validated as they are read
+  auto header = reinterpret_cast<const SnapshotFile::Header*>(mData);
+  if(std::memcmp(header->magic, SnapshotFile::MAGIC, sizeof(SnapshotFile::MAGIC)) != 0)
+  {
+    return Fail(path + " is not a snapshot file");
+  }
+  if(header->byteOrder != SnapshotFile::ENDIAN_MARK)
+  {
+    return Fail(path + " was written on a machine with a different byte order");
+  }
+  if(header->formatVersion != SnapshotFile::FORMAT_VERSION)
+  {
+    return Fail(path + " has unsupported format version " + std::to_string(header->formatVersion));
+  }
+  if(!SectionFits<SnapshotFile::NodeRecord>(header->nodesOffset, header->nodeCount, mSize) ||
+     !SectionFits<uint32_t>(header->childrenOffset, header->childCount, mSize) ||
+     !SectionFits<uint32_t>(header->highlightableOffset, header->highlightableCount, mSize) ||
+     !SectionFits<char>(header->stringsOffset, header->stringsSize, mSize))
+  {
+    return Fail(path + " is truncated or corrupt");
+  }
+
+  mHeader        = header;
+  mNodes         = reinterpret_cast<const SnapshotFile::NodeRecord*>(mData + header->nodesOffset);
+  mChildren      = reinterpret_cast<const uint32_t*>(mData + header->childrenOffset);
+  mHighlightable = reinterpret_cast<const uint32_t*>(mData + header->highlightableOffset);
+  mStrings       = mData + header->stringsOffset;
+  mFocusedId     = header->focusedId;
+  return true;
+}
+
+void SnapshotFileQueryEngine::Close()
+{
+  if(mData)
+  {
+    ::munmap(const_cast<char*>(mData), mSize);
+  }
+  mData          = nullptr;
+  mSize          = 0;
+  mHeader        = nullptr;
+  mNodes         = nullptr;
+  mChildren      = nullptr;
+  mHighlightable = nullptr;
+  mStrings       = nullptr;
+  mFocusedId     = 0;
+
+  std::lock_guard<std::mutex> lock(mSearchMutex);
+  mSearchIndex.reset();
+  mNodeStore.reset();
+}
+
+bool SnapshotFileQueryEngine::IsOpen() const
+{
+  return mHeader != nullptr;
+}
+
+const std::string& SnapshotFileQueryEngine::GetError() const
+{
+  return mError;
+}
+
+size_t SnapshotFileQueryEngine::GetSnapshotSize() const
+{
+  return mHeader ? mHeader->nodeCount : 0;
+}
+
+const SnapshotFile::NodeRecord* SnapshotFileQueryEngine::FindNode(uint32_t id) const
+{
+  if(!mHeader) return nullptr;
+
+  auto end = mNodes + mHeader->nodeCount;
+  auto it  = std::lower_bound(mNodes, end, id, [](const SnapshotFile::NodeRecord& node, uint32_t key) { return node.id < key; });
+  return it != end && it->id == id ? it : nullptr;
+}
+
+std::string_view SnapshotFileQueryEngine::GetString(const SnapshotFile::StringRef& ref) const
+{
+  if(ref.offset > mHeader->stringsSize || ref.length > mHeader->stringsSize - ref.offset)
+  {
+    return {};
+  }
+  return {mStrings + ref.offset, ref.length};
+}
+
+const uint32_t* SnapshotFileQueryEngine::GetChildren(const SnapshotFile::NodeRecord& node) const
+{
+  if(node.firstChild > mHeader->childCount || node.childCount > mHeader->childCount - node.firstChild)
+  {
+    return nullptr;
+  }
+  return mChildren + node.firstChild;
+}
+
+ElementInfo SnapshotFileQueryEngine::ToElementInfo(const SnapshotFile::NodeRecord& node) const
+{
+  ElementInfo info;
+  info.id           = node.id;
+  info.name         = std::string(GetString(node.name));
+  info.role         = std::string(GetString(node.role));
+  info.description  = std::string(GetString(node.description));
+  info.states       = std::string(GetString(node.statesText));
+  info.boundsX      = node.boundsX;
+  info.boundsY      = node.boundsY;
+  info.boundsWidth  = node.boundsWidth;
+  info.boundsHeight = node.boundsHeight;
+  if(auto children = GetChildren(node))
+  {
+    info.childIds.assign(children, children + node.childCount);
+  }
+  info.childCount   = static_cast<int>(info.childIds.size());
+  info.parentId     = node.parentId;
+  info.automationId = std::string(GetString(node.automationId));
+  return info;
+}
+
+uint32_t SnapshotFileQueryEngine::GetRootId() const
+{
+  return mHeader ? mHeader->rootId : 0;
+}
+
+uint32_t SnapshotFileQueryEngine::GetFocusedId() const
+{
+  return mFocusedId.load();
+}
+
+void SnapshotFileQueryEngine::SetFocusedId(uint32_t id)
+{
+  mFocusedId.store(id);
+}
+
+ElementInfo SnapshotFileQueryEngine::GetElementInfo(uint32_t id)
+{
+  auto node = FindNode(id);
+  if(!node)
+  {
+    ElementInfo info{};
+    info.id     = id;
+    info.name   = "(not found)";
+    info.role   = "UNKNOWN";
+    info.states = "(none)";
+    return info;
+  }
+  return ToElementInfo(*node);
+}
+
+void SnapshotFileQueryEngine::BuildTreeNode(const SnapshotFile::NodeRecord& root, int maxDepth, TreeNode& tree) const
+{
+  struct Pending
+  {
+    const SnapshotFile::NodeRecord* node;
+    TreeNode*                       tree;
+    int                             depth; ///< Levels still to expand; negative for all
+  };
+
+  // A corrupt file may link nodes into a cycle or share a child between
+  // parents; each record is expanded at most once, later links stay stubs
+  std::vector<bool> visited(mHeader->nodeCount);
+
+  std::vector<Pending> stack{{&root, &tree, maxDepth}};
+  while(!stack.empty())
+  {
+    auto [node, target, depth] = stack.back();
+    stack.pop_back();
+    if(visited[node - mNodes])
+    {
+      continue;
+    }
+    visited[node - mNodes] = true;
+
+    auto children      = GetChildren(*node);
+    target->id         = node->id;
+    target->name       = std::string(GetString(node->name));
+    target->role       = std::string(GetString(node->role));
+    target->childCount = children ? static_cast<int>(node->childCount) : 0;
+
+    if(depth == 0 || !children)
+    {
+      continue;
+    }
+
+    // Sized once, so the pointers pushed below stay valid
+    target->children.resize(node->childCount);
+    for(uint32_t i = node->childCount; i-- > 0;)
+    {
+      auto& child      = target->children[i];
+      child.id         = children[i];
+      child.childCount = 0;
+
+      if(auto childNode = FindNode(children[i]))
+      {
+        stack.push_back({childNode, &child, depth - 1});
+      }
+    }
+  }
+}
+
+TreeNode SnapshotFileQueryEngine::BuildTree(uint32_t rootId)
+{
+  return BuildSubtree(rootId, -1);
+}
+
+TreeNode SnapshotFileQueryEngine::BuildSubtree(uint32_t rootId, int maxDepth)
+{
+  TreeNode tree;
+  tree.id = rootId;
+
+  auto node = FindNode(rootId);
+  if(!node)
+  {
+    tree.name       = "(not found)";
+    tree.role       = "UNKNOWN";
+    tree.childCount = 0;
+    return tree;
+  }
+
+  BuildTreeNode(*node, maxDepth, tree);
+  return tree;
+}
+
+uint32_t SnapshotFileQueryEngine::Navigate(uint32_t currentId, bool forward)
+{
+  if(!mHeader || mHeader->highlightableCount == 0) return currentId;
+
+  auto begin = mHighlightable;
+  auto end   = mHighlightable + mHeader->highlightableCount;
+  auto it    = std::find(begin, end, currentId);
+  if(it == end)
+  {
+    return *begin;
+  }
+
+  if(forward)
+  {
+    return ++it == end ? *begin : *it;
+  }
+  return it == begin ? *(end - 1) : *(it - 1);
+}
+
+uint32_t SnapshotFileQueryEngine::NavigateChild(uint32_t currentId)
+{
+  auto node     = FindNode(currentId);
+  auto children = node ? GetChildren(*node) : nullptr;
+  return children && node->childCount > 0 ? children[0] : currentId;
+}
+
+uint32_t SnapshotFileQueryEngine::NavigateParent(uint32_t currentId)
+{
+  auto node = FindNode(currentId);
+  return node && node->parentId != 0 ? node->parentId : currentId;
+}
+
+bool SnapshotFileQueryEngine::SupportsConcurrentReads() const
+{
+  return true;
+}
+
+uint64_t SnapshotFileQueryEngine::GetSnapshotVersion() const
+{
+  return mHeader ? mHeader->snapshotVersion : 0;
+}
+
+bool SnapshotFileQueryEngine::Search(const SearchQuery& query, SearchResult& result)
+{
+  result         = {};
+  result.version = GetSnapshotVersion();
+
+  SearchIndex::Query filters;
+  bool               satisfiable = SearchIndex::MakeQuery(query, filters);
+
+  std::vector<uint32_t> ids;
+  {
+    std::lock_guard<std::mutex> lock(mSearchMutex);
+    if(!mSearchIndex)
+    {
+      mSearchIndex = std::make_unique<SearchIndex>();
+      mNodeStore   = std::make_unique<NodeStore>();
+      for(uint32_t i = 0; mHeader && i < mHeader->nodeCount; ++i)
+      {
+        auto& node = mNodes[i];
+        mSearchIndex->Insert(node.id, {std::string(GetString(node.role)), std::string(GetString(node.name)),
+                                       std::string(GetString(node.automationId)), node.states});
+
+        NodeStore::Node columns;
+        columns.id          = node.id;
+        columns.parentId    = node.parentId;
+        columns.role        = GetString(node.role);
+        columns.name        = GetString(node.name);
+        columns.description = GetString(node.description);
+        columns.states      = node.states;
+        columns.x           = node.boundsX;
+        columns.y           = node.boundsY;
+        columns.width       = node.boundsWidth;
+        columns.height      = node.boundsHeight;
+        mNodeStore->Upsert(columns);
+      }
+    }
+    if(query.intersects)
+    {
+      ids = SearchArea(*mNodeStore, *mSearchIndex, query, result.total);
+    }
+    else if(satisfiable)
+    {
+      ids = mSearchIndex->Find(filters, query.limit, result.total);
+    }
+  }
+
+  result.elements.reserve(ids.size());
+  for(auto id : ids)
+  {
+    result.elements.push_back(GetElementInfo(id));
+  }
+  return true;
+}
+
+bool SnapshotFileQueryEngine::SerializeSnapshot(std::string& bytes)
+{
+  if(!mHeader) return false;
+
+  bytes.assign(mData, mSize);
+  return true;
+}
+
+SnapshotDiff SnapshotFileQueryEngine::CompareTo(const SnapshotFileQueryEngine& before) const
+{
+  SnapshotDiff diff;
+  diff.fromVersion = before.GetSnapshotVersion();
+  diff.toVersion   = GetSnapshotVersion();
+  diff.rootId      = GetRootId();
+
+  auto same = [](const ElementInfo& a, const ElementInfo& b) {
+    return a.name == b.name && a.role == b.role && a.description == b.description && a.states == b.states &&
+           a.automationId == b.automationId && a.boundsX == b.boundsX && a.boundsY == b.boundsY &&
+           a.boundsWidth == b.boundsWidth && a.boundsHeight == b.boundsHeight && a.childIds == b.childIds &&
+           a.parentId == b.parentId;
+  };
+
+  // Both record arrays are sorted by id, so one merge pass finds every difference
+  size_t i = 0, j = 0;
+  size_t count       = GetSnapshotSize();
+  size_t beforeCount = before.GetSnapshotSize();
+  while(i < count || j < beforeCount)
+  {
+    if(j == beforeCount || (i < count && mNodes[i].id < before.mNodes[j].id))
+    {
+      diff.added.push_back(ToElementInfo(mNodes[i++]));
+    }
+    else if(i == count || before.mNodes[j].id < mNodes[i].id)
+    {
+      diff.removed.push_back(before.mNodes[j++].id);
+    }
+    else
+    {
+      auto info = ToElementInfo(mNodes[i++]);
+      if(!same(info, before.ToElementInfo(before.mNodes[j++])))
+      {
+        diff.changed.push_back(std::move(info));
+      }
+    }
+  }
+  return diff;
+}
+
+} // namespace InspectorEngine
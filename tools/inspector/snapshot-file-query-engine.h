@@ -0,0 +1,139 @@
+#ifndef ACCESSIBILITY_TOOLS_INSPECTOR_SNAPSHOT_FILE_QUERY_ENGINE_H
+#define ACCESSIBILITY_TOOLS_INSPECTOR_SNAPSHOT_FILE_QUERY_ENGINE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+// INTERNAL INCLUDES
+#include <tools/inspector/inspector-query-interface.h>
+#include <tools/inspector/inspector-types.h>
+#include <tools/inspector/node-store.h>
+#include <tools/inspector/search-index.h>
+#include <tools/inspector/snapshot-file.h>
+
+namespace InspectorEngine
+{
+/**
+ * @brief Engine that serves a snapshot file captured earlier.
+ *
+ * The file is mapped read-only and queried in place: elements are found by
+ * binary search over the id-sorted node records, and nothing is parsed or
+ * copied on load. This lets a capture from a device be browsed, searched
+ * and compared with another capture without the application running.
+ *
+ * Usage:
+ * 1. Call Open(path) to map a file written by NodeProxyQueryEngine::SaveSnapshot().
+ * 2. Call GetElementInfo/BuildTree/Search from any thread.
+ *
+ * Focus moves only within this engine. The search index and node columns
+ * are built on the first Search().
+ */
+class SnapshotFileQueryEngine : public InspectorQueryInterface
+{
+public:
+  SnapshotFileQueryEngine();
+  ~SnapshotFileQueryEngine();
+
+  SnapshotFileQueryEngine(const SnapshotFileQueryEngine&)            = delete;
+  SnapshotFileQueryEngine& operator=(const SnapshotFileQueryEngine&) = delete;
+
+  /**
+   * @brief Maps a snapshot file, replacing the one currently open.
+   *
+   * Must not be called while other threads query the engine.
+   *
+   * @param[in] path The file to map
+   * @return true on success; GetError() explains a failure
+   */
+  bool Open(const std::string& path);
+
+  /**
+   * @brief Unmaps the current file.
+   */
+  void Close();
+
+  bool IsOpen() const;
+
+  /**
+   * @brief Describes why the last Open() failed.
+   */
+  const std::string& GetError() const;
+
+  /**
+   * @brief Returns the number of elements in the snapshot.
+   */
+  size_t GetSnapshotSize() const;
+
+  /**
+   * @brief Compares this snapshot with an earlier capture of the same session.
+   *
+   * Element ids are stable within a session, so elements are matched by id.
+   */
+  SnapshotDiff CompareTo(const SnapshotFileQueryEngine& before) const;
+
+  uint32_t GetRootId() const override;
+  uint32_t GetFocusedId() const override;
+  void SetFocusedId(uint32_t id) override;
+  ElementInfo GetElementInfo(uint32_t id) override;
+  TreeNode BuildTree(uint32_t rootId) override;
+  TreeNode BuildSubtree(uint32_t rootId, int maxDepth) override;
+  uint32_t Navigate(uint32_t currentId, bool forward) override;
+  uint32_t NavigateChild(uint32_t currentId) override;
+  uint32_t NavigateParent(uint32_t currentId) override;
+  bool SupportsConcurrentReads() const override;
+  uint64_t GetSnapshotVersion() const override;
+  bool Search(const SearchQuery& query, SearchResult& result) override;
+
+  /**
+   * @brief Returns the mapped file as is.
+   */
+  bool SerializeSnapshot(std::string& bytes) override;
+
+private:
+  const SnapshotFile::NodeRecord* FindNode(uint32_t id) const;
+  std::string_view GetString(const SnapshotFile::StringRef& ref) const;
+  const uint32_t* GetChildren(const SnapshotFile::NodeRecord& node) const;
+  ElementInfo ToElementInfo(const SnapshotFile::NodeRecord& node) const;
+  void BuildTreeNode(const SnapshotFile::NodeRecord& root, int maxDepth, TreeNode& tree) const;
+  bool Fail(const std::string& error);
+
+  const char*                     mData{nullptr};
+  size_t                          mSize{0};
+  const SnapshotFile::Header*     mHeader{nullptr};
+  const SnapshotFile::NodeRecord* mNodes{nullptr};
+  const uint32_t*                 mChildren{nullptr};
+  const uint32_t*                 mHighlightable{nullptr};
+  const char*                     mStrings{nullptr};
+  std::string                     mError;
+  std::atomic<uint32_t>           mFocusedId{0};
+  std::mutex                      mSearchMutex;
+  std::unique_ptr<SearchIndex>    mSearchIndex;
+  std::unique_ptr<NodeStore>      mNodeStore;
+};
+
+} // namespace InspectorEngine
+
+#endif // ACCESSIBILITY_TOOLS_INSPECTOR_SNAPSHOT_FILE_QUERY_ENGINE_H
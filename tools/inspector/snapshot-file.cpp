@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <tools/inspector/snapshot-file.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+
+namespace InspectorEngine
+{
+namespace SnapshotFile
+{
+namespace
+{
+/**
+ * @brief Deduplicating string table.
+ */
+class StringTable
+{
+public:
+  StringRef Add(const std::string& text)
+  {
+    auto it = mOffsets.find(text);
+    if(it == mOffsets.end())
+    {
+      it = mOffsets.emplace(text, static_cast<uint32_t>(mData.size())).first;
+      mData += text;
+    }
+    return {it->second, static_cast<uint32_t>(text.size())};
+  }
+
+  const std::string& Data() const
+  {
+    return mData;
+  }
+
+private:
+  std::string                               mData;
+  std::unordered_map<std::string, uint32_t> mOffsets;
+};
+
+size_t Align(size_t offset)
+{
+  return (offset + 7) & ~size_t{7};
+}
+
+template<typename T>
+void Append(std::string& bytes, const std::vector<T>& items)
+{
+  bytes.resize(Align(bytes.size()), '\0');
+  bytes.append(reinterpret_cast<const char*>(items.data()), items.size() * sizeof(T));
+}
+
+} // namespace
+
+std::string Serialize(uint64_t                     snapshotVersion,
+                      uint32_t                     rootId,
+                      uint32_t                     focusedId,
+                      std::vector<Element>         elements,
+                      const std::vector<uint32_t>& highlightableOrder)
+{
+  std::sort(elements.begin(), elements.end(), [](const Element& a, const Element& b) { return a.info.id < b.info.id; });
+
+  StringTable             strings;
+  std::vector<NodeRecord> nodes;
+  std::vector<uint32_t>   children;
+  nodes.reserve(elements.size());
+  for(auto& element : elements)
+  {
+    auto&      info = element.info;
+    NodeRecord node{};
+    node.id           = info.id;
+    node.parentId     = info.parentId;
+    node.name         = strings.Add(info.name);
+    node.role         = strings.Add(info.role);
+    node.description  = strings.Add(info.description);
+    node.automationId = strings.Add(info.automationId);
+    node.statesText   = strings.Add(info.states);
+    node.states       = element.states;
+    node.boundsX      = info.boundsX;
+    node.boundsY      = info.boundsY;
+    node.boundsWidth  = info.boundsWidth;
+    node.boundsHeight = info.boundsHeight;
+    node.firstChild   = static_cast<uint32_t>(children.size());
+    node.childCount   = static_cast<uint32_t>(info.childIds.size());
+    children.insert(children.end(), info.childIds.begin(), info.childIds.end());
+    nodes.push_back(node);
+  }
+
+  Header header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.formatVersion      = FORMAT_VERSION;
+  header.byteOrder          = ENDIAN_MARK;
+  header.snapshotVersion    = snapshotVersion;
+  header.rootId             = rootId;
+  header.focusedId          = focusedId;
+  header.nodeCount          = static_cast<uint32_t>(nodes.size());
+  header.childCount         = static_cast<uint32_t>(children.size());
+  header.highlightableCount = static_cast<uint32_t>(highlightableOrder.size());
+
+  std::string bytes(sizeof(Header), '\0');
+  header.nodesOffset = Align(bytes.size());
+  Append(bytes, nodes);
+  header.childrenOffset = Align(bytes.size());
+  Append(bytes, children);
+  header.highlightableOffset = Align(bytes.size());
+  Append(bytes, highlightableOrder);
+  header.stringsOffset = Align(bytes.size());
+  header.stringsSize   = strings.Data().size();
+  bytes.resize(header.stringsOffset, '\0');
+  bytes += strings.Data();
+
+  std::memcpy(&bytes[0], &header, sizeof(header));
+  return bytes;
+}
+
+bool WriteFile(const std::string& path, const std::string& bytes)
+{
+  // Readers may have the old file mapped; write a new file and rename it over
+  auto  temporary = path + ".tmp";
+  FILE* file      = std::fopen(temporary.c_str(), "wb");
+  if(!file)
+  {
+    return false;
+  }
+  bool written = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+  written      = std::fclose(file) == 0 && written;
+  if(!written || std::rename(temporary.c_str(), path.c_str()) != 0)
+  {
+    std::remove(temporary.c_str());
+    return false;
+  }
+  return true;
+}
+
+} // namespace SnapshotFile
+
+} // namespace InspectorEngine
@@ -0,0 +1,132 @@
+#ifndef ACCESSIBILITY_TOOLS_INSPECTOR_SNAPSHOT_FILE_H
+#define ACCESSIBILITY_TOOLS_INSPECTOR_SNAPSHOT_FILE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <tools/inspector/inspector-types.h>
+
+namespace InspectorEngine
+{
+/**
+ * @brief Binary snapshot file layout.
+ *
+ * A file is a Header followed by four 8-byte aligned sections: node records
+ * sorted by id, the child id array the records point into, the
+ * highlightable navigation order, and a string table of deduplicated UTF-8
+ * strings. Every field has a fixed size and the byte order of the writer,
+ * recorded in Header::byteOrder, so a mapped file is read in place.
+ */
+namespace SnapshotFile
+{
+constexpr char     MAGIC[8]       = {'A', '1', '1', 'Y', 'S', 'N', 'A', 'P'};
+constexpr uint32_t FORMAT_VERSION = 1;
+constexpr uint32_t ENDIAN_MARK    = 0x01020304; ///< Reads back differently on a foreign byte order
+
+struct Header
+{
+  char     magic[8];
+  uint32_t formatVersion;
+  uint32_t byteOrder;
+  uint64_t snapshotVersion;
+  uint32_t rootId;
+  uint32_t focusedId;
+  uint32_t nodeCount;
+  uint32_t childCount;
+  uint32_t highlightableCount;
+  uint32_t reserved;
+  uint64_t nodesOffset;
+  uint64_t childrenOffset;
+  uint64_t highlightableOffset;
+  uint64_t stringsOffset;
+  uint64_t stringsSize;
+};
+
+/**
+ * @brief A string in the string table.
+ */
+struct StringRef
+{
+  uint32_t offset;
+  uint32_t length;
+};
+
+struct NodeRecord
+{
+  uint32_t  id;
+  uint32_t  parentId;
+  StringRef name;
+  StringRef role;
+  StringRef description;
+  StringRef automationId;
+  StringRef statesText; ///< ElementInfo::states
+  uint64_t  states;     ///< One bit per Accessibility::State
+  float     boundsX;
+  float     boundsY;
+  float     boundsWidth;
+  float     boundsHeight;
+  uint32_t  firstChild; ///< Index into the child id array
+  uint32_t  childCount;
+};
+
+static_assert(sizeof(Header) == 88, "Header layout must not change within a format version");
+static_assert(sizeof(NodeRecord) == 80, "NodeRecord layout must not change within a format version");
+
+/**
+ * @brief An element to serialize.
+ */
+struct Element
+{
+  ElementInfo info;
+  uint64_t    states{0};
+};
+
+/**
+ * @brief Serializes a snapshot.
+ *
+ * @param[in] snapshotVersion The version of the snapshot
+ * @param[in] rootId The root element id
+ * @param[in] focusedId The focused element id
+ * @param[in] elements The elements, in any order
+ * @param[in] highlightableOrder Highlightable element ids in navigation order
+ * @return The file contents
+ */
+std::string Serialize(uint64_t                     snapshotVersion,
+                      uint32_t                     rootId,
+                      uint32_t                     focusedId,
+                      std::vector<Element>         elements,
+                      const std::vector<uint32_t>& highlightableOrder);
+
+/**
+ * @brief Writes bytes to path, replacing the file atomically.
+ *
+ * @return true on success
+ */
+bool WriteFile(const std::string& path, const std::string& bytes);
+
+} // namespace SnapshotFile
+
+} // namespace InspectorEngine
+
+#endif // ACCESSIBILITY_TOOLS_INSPECTOR_SNAPSHOT_FILE_H
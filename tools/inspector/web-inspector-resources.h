@@ -108,6 +108,35 @@ inline const char* HTML = R"HTMLPAGE(<!DOCTYPE html>
     margin-left: 4px;
   }
 
+  .search {
+    margin-left: auto;
+    display: flex;
+    align-items: center;
+    gap: 8px;
+  }
+
+  .search input {
+    background: var(--bg-overlay);
+    color: var(--text-main);
+    border: 1px solid var(--border);
+    border-radius: var(--radius);
+    padding: 6px 10px;
+    font-family: inherit;
+    font-size: 12px;
+    width: 280px;
+  }
+
+  .search input:focus {
+    outline: none;
+    border-color: var(--accent);
+  }
+
+  .search .search-status {
+    font-size: 11px;
+    color: var(--text-dim);
+    white-space: nowrap;
+  }
+
   .main-content {
     display: grid;
     grid-template-columns: 1fr 1fr;
@@ -300,6 +329,10 @@ inline const char* HTML = R"HTMLPAGE(<!DOCTYPE html>
       <button onclick="navigate('parent')">Parent <span class="kbd">Backspace</span></button>
       <button onclick="loadTree()">Refresh <span class="kbd">R</span></button>
     </div>
+    <div class="search">
+      <input id="search-input" type="search" placeholder="Search: text role:LABEL state:FOCUSABLE,!CHECKED id:... area:X,Y,W,H" title="Press Enter for the next match, / to focus">
+      <span class="search-status" id="search-status"></span>
+    </div>
   </header>
   <div class="main-content">
     <div class="panel tree-panel">
@@ -318,14 +351,26 @@ inline const char* HTML = R"HTMLPAGE(<!DOCTYPE html>
 
 <script>
 const API = {
-  async getTree() {
-    const r = await fetch('/api/tree');
+  async getTree(depth) {
+    const r = await fetch('/api/tree?depth=' + depth);
+    return r.json();
+  },
+  async getChildren(id) {
+    const r = await fetch('/api/children/' + id);
     return r.json();
   },
   async getElement(id) {
     const r = await fetch('/api/element/' + id);
     return r.json();
   },
+  async search(params) {
+    const r = await fetch('/api/search?' + new URLSearchParams(params));
+    return r.json();
+  },
+  async getDiff(since) {
+    const r = await fetch('/api/diff?since=' + since);
+    return r.json();
+  },
   async navigate(direction) {
     const r = await fetch('/api/navigate', {
       method: 'POST',
@@ -337,16 +382,22 @@ const API = {
 };
 
 let currentFocusedId = 0;
+let snapshotVersion = 0;
+let events = null;
+
+// Levels loaded up front; deeper nodes are fetched when expanded
+const INITIAL_DEPTH = 3;
 
 function renderTree(node, container) {
   const item = document.createElement('div');
   item.className = 'tree-item' + (node.id === currentFocusedId ? ' focused' : '');
   item.dataset.id = node.id;
 
-  const hasChildren = node.children && node.children.length > 0;
+  const hasChildren = node.childCount > 0;
+  const loaded = node.children && node.children.length > 0;
 
   const toggle = document.createElement('span');
-  toggle.className = 'tree-toggle' + (hasChildren ? '' : ' leaf');
+  toggle.className = 'tree-toggle' + (hasChildren ? (loaded ? '' : ' collapsed') : ' leaf');
   toggle.textContent = '\u25BC';
 
   const role = document.createElement('span');
@@ -361,28 +412,68 @@ function renderTree(node, container) {
   item.appendChild(role);
   item.appendChild(name);
 
+  const childContainer = document.createElement('div');
+  childContainer.className = 'tree-children' + (loaded ? '' : ' collapsed');
+  if (loaded) {
+    node.children.forEach(function(child) {
+      renderTree(child, childContainer);
+    });
+  }
+
   item.addEventListener('click', function(e) {
     if (e.target === toggle && hasChildren) {
       e.stopPropagation();
-      const childContainer = item.nextElementSibling;
-      if (childContainer && childContainer.classList.contains('tree-children')) {
-        childContainer.classList.toggle('collapsed');
-        toggle.classList.toggle('collapsed');
-      }
+      toggleChildren(item);
       return;
     }
     selectElement(node.id);
   });
 
   container.appendChild(item);
-
   if (hasChildren) {
-    const childContainer = document.createElement('div');
-    childContainer.className = 'tree-children';
-    node.children.forEach(function(child) {
+    container.appendChild(childContainer);
+  }
+}
+
+async function expandChildren(item) {
+  const childContainer = item.nextElementSibling;
+  if (!childContainer || !childContainer.classList.contains('tree-children')) return;
+  if (!childContainer.dataset.loaded && childContainer.children.length === 0) {
+    childContainer.dataset.loaded = '1';
+    const data = await API.getChildren(parseInt(item.dataset.id));
+    data.children.forEach(function(child) {
       renderTree(child, childContainer);
     });
-    container.appendChild(childContainer);
+  }
+  childContainer.classList.remove('collapsed');
+  item.querySelector('.tree-toggle').classList.remove('collapsed');
+}
+
+async function toggleChildren(item) {
+  const childContainer = item.nextElementSibling;
+  if (childContainer && !childContainer.classList.contains('collapsed')) {
+    childContainer.classList.add('collapsed');
+    item.querySelector('.tree-toggle').classList.add('collapsed');
+  } else {
+    await expandChildren(item);
+  }
+}
+
+function findTreeItem(id) {
+  return document.querySelector('.tree-item[data-id="' + id + '"]');
+}
+
+// Loads and expands the ancestors of an element that is not rendered yet
+async function revealElement(id) {
+  const path = [];
+  let current = id;
+  while (current && !findTreeItem(current)) {
+    path.push(current);
+    current = (await API.getElement(current)).parentId;
+  }
+  if (!current) return;
+  for (let i = path.length; i > 0; --i) {
+    await expandChildren(findTreeItem(i === path.length ? current : path[i]));
   }
 }
 
@@ -398,6 +489,9 @@ function renderDetail(info) {
   if (info.description) {
     addRow(identSec, 'Description', info.description);
   }
+  if (info.automationId) {
+    addRow(identSec, 'Automation ID', info.automationId);
+  }
   root.appendChild(identSec);
 
   // States section
@@ -486,6 +580,7 @@ async function navigate(direction) {
   const result = await API.navigate(direction);
   if (result.focusedId) {
     currentFocusedId = result.focusedId;
+    await revealElement(currentFocusedId);
     // Update tree highlight
     document.querySelectorAll('.tree-item').forEach(function(el) {
       el.classList.toggle('focused', parseInt(el.dataset.id) === currentFocusedId);
@@ -500,16 +595,165 @@ async function navigate(direction) {
   }
 }
 
+// Splits "text role:X state:A,!B id:Y area:X,Y,W,H" into /api/search parameters
+function parseSearch(text) {
+  const params = {};
+  const words = [];
+  text.trim().split(/\s+/).forEach(function(token) {
+    const m = token.match(/^(role|state|states|id|area):(.*)$/);
+    if (!m) {
+      if (token) words.push(token);
+    } else if (m[1] === 'role') {
+      params.role = m[2];
+    } else if (m[1] === 'id') {
+      params.automationId = m[2];
+    } else if (m[1] === 'area') {
+      params.area = m[2];
+    } else {
+      params.states = params.states ? params.states + ',' + m[2] : m[2];
+    }
+  });
+  if (words.length) params.name = words.join(' ');
+  return params;
+}
+
+let searchQuery = '';
+let searchResults = [];
+let searchIndex = -1;
+
+async function runSearch() {
+  const text = document.getElementById('search-input').value;
+  const status = document.getElementById('search-status');
+  if (!text.trim()) {
+    status.textContent = '';
+    return;
+  }
+  if (text !== searchQuery) {
+    const result = await API.search(parseSearch(text));
+    searchQuery = text;
+    searchResults = result.results || [];
+    searchIndex = -1;
+    status.dataset.total = result.total || 0;
+  }
+  if (!searchResults.length) {
+    status.textContent = 'No matches';
+    return;
+  }
+  searchIndex = (searchIndex + 1) % searchResults.length;
+  const id = searchResults[searchIndex].id;
+  status.textContent = (searchIndex + 1) + ' of ' + status.dataset.total;
+  await revealElement(id);
+  await selectElement(id);
+  const item = findTreeItem(id);
+  if (item) item.scrollIntoView({block: 'nearest', behavior: 'smooth'});
+}
+
+function setFocusHighlight(id) {
+  currentFocusedId = id;
+  document.querySelectorAll('.tree-item').forEach(function(el) {
+    el.classList.toggle('focused', parseInt(el.dataset.id) === id);
+  });
+}
+
+function removeTreeItem(id) {
+  const item = findTreeItem(id);
+  if (!item) return;
+  const childContainer = item.nextElementSibling;
+  if (childContainer && childContainer.classList.contains('tree-children')) {
+    childContainer.remove();
+  }
+  item.remove();
+}
+
+// Re-renders the children of a node whose child list changed, if they are loaded
+async function reloadChildren(info) {
+  const item = findTreeItem(info.id);
+  if (!item) return;
+  const childContainer = item.nextElementSibling;
+  const hasContainer = childContainer && childContainer.classList.contains('tree-children');
+  const wasOpen = hasContainer && !childContainer.classList.contains('collapsed');
+  const wasLoaded = hasContainer && childContainer.children.length > 0;
+  if (hasContainer) childContainer.remove();
+
+  const container = document.createElement('div');
+  container.className = 'tree-children collapsed';
+  item.after(container);
+  const toggle = item.querySelector('.tree-toggle');
+  toggle.className = 'tree-toggle' + (info.childCount > 0 ? ' collapsed' : ' leaf');
+  if (info.childCount > 0 && (wasOpen || wasLoaded)) {
+    await expandChildren(item);
+    if (!wasOpen) {
+      container.classList.add('collapsed');
+      toggle.classList.add('collapsed');
+    }
+  }
+}
+
+async function applyDiff(diff) {
+  if (diff.reset) {
+    loadTree();
+    return;
+  }
+  snapshotVersion = diff.to;
+  diff.removed.forEach(removeTreeItem);
+  for (const info of diff.changed) {
+    const item = findTreeItem(info.id);
+    if (!item) continue;
+    item.querySelector('.tree-role').textContent = '[' + info.role + ']';
+    item.querySelector('.tree-name').textContent = '"' + info.name + '"';
+    const rendered = [];
+    const childContainer = item.nextElementSibling;
+    if (childContainer && childContainer.classList.contains('tree-children')) {
+      for (const child of childContainer.children) {
+        if (child.classList.contains('tree-item')) rendered.push(parseInt(child.dataset.id));
+      }
+    }
+    const childrenLoaded = rendered.length > 0 || info.childCount === 0;
+    if (childrenLoaded && rendered.join(',') !== info.childIds.join(',')) {
+      await reloadChildren(info);
+    } else if (!childrenLoaded) {
+      item.querySelector('.tree-toggle').className = 'tree-toggle' + (info.childCount > 0 ? ' collapsed' : ' leaf');
+    }
+    if (info.id === currentFocusedId) renderDetail(info);
+  }
+  setFocusHighlight(currentFocusedId);
+}
+
+// Live updates; on reconnect the stream resumes from the last applied version
+function connectEvents() {
+  if (!window.EventSource) return;
+  if (events) events.close();
+  events = new EventSource('/api/events?since=' + snapshotVersion);
+  events.addEventListener('diff', function(e) {
+    applyDiff(JSON.parse(e.data));
+  });
+  events.addEventListener('focus', async function(e) {
+    const id = JSON.parse(e.data).focusedId;
+    await revealElement(id);
+    setFocusHighlight(id);
+    renderDetail(await API.getElement(id));
+  });
+  events.onerror = function() {
+    events.close();
+    setTimeout(async function() {
+      applyDiff(await API.getDiff(snapshotVersion));
+      connectEvents();
+    }, 1000);
+  };
+}
+
 async function loadTree() {
   const treeRoot = document.getElementById('tree-root');
   treeRoot.innerHTML = '<div class="loading">Loading tree...</div>';
   try {
-    const data = await API.getTree();
+    const data = await API.getTree(INITIAL_DEPTH);
     currentFocusedId = data.focusedId;
+    snapshotVersion = data.version;
     treeRoot.innerHTML = '';
     renderTree(data.tree, treeRoot);
     // Load details for focused element
     if (currentFocusedId) {
+      await revealElement(currentFocusedId);
       const info = await API.getElement(currentFocusedId);
       renderDetail(info);
     }
@@ -519,10 +763,25 @@ async function loadTree() {
 }
 
 // Keyboard shortcuts
+document.getElementById('search-input').addEventListener('keydown', function(e) {
+  if (e.key === 'Enter') {
+    e.preventDefault();
+    runSearch();
+  } else if (e.key === 'Escape') {
+    e.target.blur();
+  }
+});
+
 document.addEventListener('keydown', function(e) {
   // Skip if user is typing in an input
   if (e.target.tagName === 'INPUT' || e.target.tagName === 'TEXTAREA') return;
 
+  if (e.key === '/') {
+    e.preventDefault();
+    document.getElementById('search-input').focus();
+    return;
+  }
+
   if (e.key === 'Tab') {
     e.preventDefault();
     navigate(e.shiftKey ? 'prev' : 'next');
@@ -541,7 +800,7 @@ document.addEventListener('keydown', function(e) {
 });
 
 // Initialize
-loadTree();
+loadTree().then(connectEvents);
 </script>
 </body>
 </html>
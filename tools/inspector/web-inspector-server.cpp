@@ -22,95 +22,343 @@
 #include <tools/inspector/web-inspector-resources.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <thread>
+#include <type_traits>
 
+// Browsers open several connections each; the default backlog of 5 drops
+// connection attempts (retried only after a second) with a few clients open
+#ifndef CPPHTTPLIB_LISTEN_BACKLOG
+#define CPPHTTPLIB_LISTEN_BACKLOG 64
+#endif
 #include <cpp-httplib/httplib.h>
 
 namespace
 {
 /**
- * @brief Escapes a string for safe embedding in JSON.
+ * @brief Appends JSON to a buffer, optionally handing it to a sink in chunks.
+ *
+ * Without a sink the whole document accumulates in the buffer. With one,
+ * the buffer is flushed whenever it grows past CHUNK_SIZE, so serializing
+ * a large tree needs only one chunk of memory.
  */
-std::string JsonEscape(const std::string& s)
+class JsonWriter
 {
-  std::string out;
-  out.reserve(s.size() + 8);
-  for(char c : s)
+public:
+  using Sink = std::function<bool(const char* data, size_t length)>;
+
+  static constexpr size_t CHUNK_SIZE = 16 * 1024;
+
+  JsonWriter() = default;
+
+  explicit JsonWriter(Sink sink)
+  : mSink(std::move(sink))
+  {
+    mBuffer.reserve(CHUNK_SIZE * 2);
+  }
+
+  JsonWriter& Raw(std::string_view text)
+  {
+    mBuffer.append(text);
+    return MaybeFlush();
+  }
+
+  JsonWriter& Key(std::string_view key)
+  {
+    if(mNeedComma) mBuffer += ',';
+    mBuffer += '"';
+    mBuffer.append(key);
+    mBuffer += "\":";
+    mNeedComma = false;
+    return *this;
+  }
+
+  JsonWriter& String(std::string_view value)
   {
-    switch(c)
+    Separate();
+    mBuffer += '"';
+    for(char c : value)
     {
-      case '"':  out += "\\\""; break;
-      case '\\': out += "\\\\"; break;
-      case '\n': out += "\\n";  break;
-      case '\r': out += "\\r";  break;
-      case '\t': out += "\\t";  break;
-      default:
-        if(static_cast<unsigned char>(c) < 0x20)
-        {
-          char buf[8];
-          snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned char>(c));
-          out += buf;
-        }
-        else
-        {
-          out += c;
-        }
-        break;
+      switch(c)
+      {
+        case '"':  mBuffer += "\\\""; break;
+        case '\\': mBuffer += "\\\\"; break;
+        case '\n': mBuffer += "\\n";  break;
+        case '\r': mBuffer += "\\r";  break;
+        case '\t': mBuffer += "\\t";  break;
+        default:
+          if(static_cast<unsigned char>(c) < 0x20)
+          {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned char>(c));
+            mBuffer += buf;
+          }
+          else
+          {
+            mBuffer += c;
+          }
+          break;
+      }
+    }
+    mBuffer += '"';
+    mNeedComma = true;
+    return MaybeFlush();
+  }
+
+  template<typename T>
+  JsonWriter& Number(T value)
+  {
+    Separate();
+    if constexpr(std::is_floating_point_v<T>)
+    {
+      char buf[32];
+      snprintf(buf, sizeof(buf), "%f", static_cast<double>(value));
+      mBuffer += buf;
+    }
+    else
+    {
+      mBuffer += std::to_string(value);
+    }
+    mNeedComma = true;
+    return MaybeFlush();
+  }
+
+  JsonWriter& Bool(bool value)
+  {
+    Separate();
+    mBuffer += value ? "true" : "false";
+    mNeedComma = true;
+    return *this;
+  }
+
+  JsonWriter& BeginObject() { return Open('{'); }
+  JsonWriter& EndObject() { return Close('}'); }
+  JsonWriter& BeginArray() { return Open('['); }
+  JsonWriter& EndArray() { return Close(']'); }
+
+  /**
+   * @brief Hands the rest of the buffer to the sink.
+   *
+   * @return false if the sink rejected data (the client went away)
+   */
+  bool Flush()
+  {
+    if(mSink && !mBuffer.empty())
+    {
+      mOk = mOk && mSink(mBuffer.data(), mBuffer.size());
+      mBuffer.clear();
+    }
+    return mOk;
+  }
+
+  std::string Take()
+  {
+    return std::move(mBuffer);
+  }
+
+private:
+  void Separate()
+  {
+    if(mNeedComma) mBuffer += ',';
+  }
+
+  JsonWriter& Open(char bracket)
+  {
+    Separate();
+    mBuffer += bracket;
+    mNeedComma = false;
+    return *this;
+  }
+
+  JsonWriter& Close(char bracket)
+  {
+    mBuffer += bracket;
+    mNeedComma = true;
+    return MaybeFlush();
+  }
+
+  JsonWriter& MaybeFlush()
+  {
+    if(mSink && mBuffer.size() >= CHUNK_SIZE)
+    {
+      Flush();
     }
+    return *this;
+  }
+
+  Sink        mSink;
+  std::string mBuffer;
+  bool        mNeedComma{false};
+  bool        mOk{true};
+};
+
+/**
+ * @brief Writes an ElementInfo as a JSON object.
+ */
+void WriteElementInfo(JsonWriter& json, const InspectorEngine::ElementInfo& info)
+{
+  json.BeginObject();
+  json.Key("id").Number(info.id);
+  json.Key("name").String(info.name);
+  json.Key("role").String(info.role);
+  json.Key("description").String(info.description);
+  json.Key("states").String(info.states);
+  json.Key("boundsX").Number(info.boundsX);
+  json.Key("boundsY").Number(info.boundsY);
+  json.Key("boundsWidth").Number(info.boundsWidth);
+  json.Key("boundsHeight").Number(info.boundsHeight);
+  json.Key("childCount").Number(info.childCount);
+  json.Key("childIds").BeginArray();
+  for(auto childId : info.childIds)
+  {
+    json.Number(childId);
   }
-  return out;
+  json.EndArray();
+  json.Key("parentId").Number(info.parentId);
+  json.Key("automationId").String(info.automationId);
+  json.EndObject();
 }
 
 /**
- * @brief Serializes an ElementInfo to a JSON string.
+ * @brief Writes a TreeNode and its loaded children as a JSON object.
  */
+void WriteTreeNode(JsonWriter& json, const InspectorEngine::TreeNode& node)
+{
+  json.BeginObject();
+  json.Key("id").Number(node.id);
+  json.Key("name").String(node.name);
+  json.Key("role").String(node.role);
+  json.Key("childCount").Number(node.childCount);
+  json.Key("children").BeginArray();
+  for(auto& child : node.children)
+  {
+    WriteTreeNode(json, child);
+  }
+  json.EndArray();
+  json.EndObject();
+}
+
 std::string ElementInfoToJson(const InspectorEngine::ElementInfo& info)
 {
-  std::string json = "{";
-  json += "\"id\":" + std::to_string(info.id);
-  json += ",\"name\":\"" + JsonEscape(info.name) + "\"";
-  json += ",\"role\":\"" + JsonEscape(info.role) + "\"";
-  json += ",\"description\":\"" + JsonEscape(info.description) + "\"";
-  json += ",\"states\":\"" + JsonEscape(info.states) + "\"";
-  json += ",\"boundsX\":" + std::to_string(info.boundsX);
-  json += ",\"boundsY\":" + std::to_string(info.boundsY);
-  json += ",\"boundsWidth\":" + std::to_string(info.boundsWidth);
-  json += ",\"boundsHeight\":" + std::to_string(info.boundsHeight);
-  json += ",\"childCount\":" + std::to_string(info.childCount);
-  json += ",\"childIds\":[";
-  for(size_t i = 0; i < info.childIds.size(); ++i)
-  {
-    if(i > 0) json += ",";
-    json += std::to_string(info.childIds[i]);
-  }
-  json += "]";
-  json += ",\"parentId\":" + std::to_string(info.parentId);
-  json += "}";
-  return json;
+  JsonWriter json;
+  WriteElementInfo(json, info);
+  return json.Take();
+}
+
+std::string TreeNodeToJson(const InspectorEngine::TreeNode& node)
+{
+  JsonWriter json;
+  WriteTreeNode(json, node);
+  return json.Take();
 }
 
 /**
- * @brief Serializes a TreeNode to a JSON string (recursive).
+ * @brief Writes a SnapshotDiff as a JSON object.
  */
-std::string TreeNodeToJson(const InspectorEngine::TreeNode& node)
+void WriteDiff(JsonWriter& json, const InspectorEngine::SnapshotDiff& diff)
+{
+  json.BeginObject();
+  json.Key("from").Number(diff.fromVersion);
+  json.Key("to").Number(diff.toVersion);
+  json.Key("reset").Bool(diff.reset);
+  json.Key("rootId").Number(diff.rootId);
+  json.Key("added").BeginArray();
+  for(auto& info : diff.added)
+  {
+    WriteElementInfo(json, info);
+  }
+  json.EndArray();
+  json.Key("changed").BeginArray();
+  for(auto& info : diff.changed)
+  {
+    WriteElementInfo(json, info);
+  }
+  json.EndArray();
+  json.Key("removed").BeginArray();
+  for(auto id : diff.removed)
+  {
+    json.Number(id);
+  }
+  json.EndArray();
+  json.EndObject();
+}
+
+/**
+ * @brief Reads an integer query parameter, or returns fallback if it is absent or malformed.
+ */
+long GetIntParam(const httplib::Request& req, const char* name, long fallback)
+{
+  if(!req.has_param(name)) return fallback;
+
+  auto  value = req.get_param_value(name);
+  char* end   = nullptr;
+  long  n     = std::strtol(value.c_str(), &end, 10);
+  return (end && *end == '\0' && !value.empty()) ? n : fallback;
+}
+
+/**
+ * @brief Parses the /api/search parameters.
+ *
+ * states is a comma-separated list of state names; a name prefixed with
+ * '!' must not be set.
+ */
+InspectorEngine::SearchQuery GetSearchQuery(const httplib::Request& req)
 {
-  std::string json = "{";
-  json += "\"id\":" + std::to_string(node.id);
-  json += ",\"name\":\"" + JsonEscape(node.name) + "\"";
-  json += ",\"role\":\"" + JsonEscape(node.role) + "\"";
-  json += ",\"childCount\":" + std::to_string(node.childCount);
-  json += ",\"children\":[";
-  for(size_t i = 0; i < node.children.size(); ++i)
+  InspectorEngine::SearchQuery query;
+  query.role         = req.get_param_value("role");
+  query.nameContains = req.get_param_value("name");
+  query.automationId = req.get_param_value("automationId");
+  query.limit        = static_cast<size_t>(std::clamp(GetIntParam(req, "limit", 100), 0L, 10000L));
+
+  auto             param  = req.get_param_value("states");
+  std::string_view states = param;
+  while(!states.empty())
+  {
+    auto comma = states.find(',');
+    auto state = states.substr(0, comma);
+    states     = comma == std::string_view::npos ? std::string_view{} : states.substr(comma + 1);
+    if(state.empty()) continue;
+    if(state.front() == '!')
+    {
+      query.excludedStates.emplace_back(state.substr(1));
+    }
+    else
+    {
+      query.states.emplace_back(state);
+    }
+  }
+
+  auto area = req.get_param_value("area");
+  if(!area.empty())
   {
-    if(i > 0) json += ",";
-    json += TreeNodeToJson(node.children[i]);
+    query.intersects = std::sscanf(area.c_str(), "%f,%f,%f,%f", &query.areaX, &query.areaY, &query.areaWidth, &query.areaHeight) == 4;
   }
-  json += "]";
-  json += "}";
-  return json;
+  return query;
+}
+
+/**
+ * @brief Streams a document written by write as a chunked response.
+ */
+void SetStreamedJson(httplib::Response& res, std::function<void(JsonWriter&)> write)
+{
+  res.set_chunked_content_provider("application/json", [write = std::move(write)](size_t, httplib::DataSink& sink) {
+    JsonWriter json([&sink](const char* data, size_t length) { return sink.write(data, length); });
+    write(json);
+    if(json.Flush())
+    {
+      sink.done();
+    }
+    return true;
+  });
 }
 
 } // anonymous namespace
@@ -119,10 +367,65 @@ namespace InspectorEngine
 {
 struct WebInspectorServer::Impl
 {
-  httplib::Server server;
-  std::thread     thread;
-  std::mutex      engineMutex;
-  bool            running{false};
+  /**
+   * @brief Locks the engine for a read, unless it supports concurrent reads.
+   */
+  std::unique_lock<std::mutex> LockForRead(const InspectorQueryInterface& engine)
+  {
+    return engine.SupportsConcurrentReads() ? std::unique_lock<std::mutex>() : std::unique_lock<std::mutex>(engineMutex);
+  }
+
+  /**
+   * @brief Returns the /api/tree body for the current snapshot, serializing it once per version.
+   */
+  std::shared_ptr<const std::string> GetTreeJson(InspectorQueryInterface& engine)
+  {
+    auto version = engine.GetSnapshotVersion();
+    if(version != 0)
+    {
+      std::lock_guard<std::mutex> lock(treeCacheMutex);
+      if(treeCache && treeCacheVersion == version)
+      {
+        return treeCache;
+      }
+    }
+
+    std::shared_ptr<const std::string> json;
+    {
+      auto lock = LockForRead(engine);
+      json      = std::make_shared<const std::string>(TreeNodeToJson(engine.BuildTree(engine.GetRootId())));
+    }
+
+    if(version != 0)
+    {
+      std::lock_guard<std::mutex> lock(treeCacheMutex);
+      treeCache        = json;
+      treeCacheVersion = version;
+    }
+    return json;
+  }
+
+  // Each open event stream holds one worker thread; the ones beyond
+  // MAX_EVENT_STREAMS stay free for REST requests
+  static constexpr size_t WORKER_THREADS = 32;
+  static_assert(WORKER_THREADS > MAX_EVENT_STREAMS, "event streams must not exhaust the pool");
+
+  // Longest wait between checks for a stopped server or a gone client
+  static constexpr std::chrono::milliseconds EVENT_POLL_INTERVAL{250};
+
+  // Comment line sent on an idle event stream so proxies keep it open
+  static constexpr std::chrono::seconds EVENT_KEEPALIVE_INTERVAL{15};
+
+  httplib::Server                    server;
+  std::thread                        thread;
+  std::mutex                         engineMutex;   ///< Serializes engines without concurrent reads
+  std::mutex                         navigateMutex; ///< Serializes focus changes
+  std::mutex                         treeCacheMutex;
+  std::shared_ptr<const std::string> treeCache;
+  uint64_t                           treeCacheVersion{0};
+  bool                               running{false};
+  std::atomic<bool>                  stopping{false};
+  std::atomic<size_t>                eventStreams{0}; ///< Open /api/events streams
 };
 
 WebInspectorServer::WebInspectorServer()
@@ -139,34 +442,262 @@ void WebInspectorServer::Start(InspectorQueryInterface& engine, int port)
 {
   if(mImpl->running) return;
 
-  auto& engineMutex = mImpl->engineMutex;
+  auto& impl = *mImpl;
 
   // Serve the embedded HTML page
   mImpl->server.Get("/", [](const httplib::Request&, httplib::Response& res) {
     res.set_content(WebInspectorResources::HTML, "text/html");
   });
 
-  // GET /api/tree — returns the full tree and current focused ID
-  mImpl->server.Get("/api/tree", [&engine, &engineMutex](const httplib::Request&, httplib::Response& res) {
-    std::lock_guard<std::mutex> lock(engineMutex);
-    auto tree = engine.BuildTree(engine.GetRootId());
-    std::string json = "{";
-    json += "\"focusedId\":" + std::to_string(engine.GetFocusedId());
-    json += ",\"tree\":" + TreeNodeToJson(tree);
-    json += "}";
-    res.set_content(json, "application/json");
+  // GET /api/tree[?root=<id>&depth=<n>] — returns the tree and current focused ID.
+  // Without parameters the whole tree is returned; with them, the subtree
+  // of root down to depth levels, with deeper nodes left for /api/children.
+  mImpl->server.Get("/api/tree", [&engine, &impl](const httplib::Request& req, httplib::Response& res) {
+    if(!req.has_param("root") && !req.has_param("depth"))
+    {
+      auto        tree = impl.GetTreeJson(engine);
+      std::string json;
+      json.reserve(tree->size() + 32);
+      json += "{";
+      {
+        auto lock = impl.LockForRead(engine);
+        json += "\"focusedId\":" + std::to_string(engine.GetFocusedId());
+      }
+      json += ",\"tree\":" + *tree;
+      json += "}";
+      res.set_content(json, "application/json");
+      return;
+    }
+
+    InspectorEngine::TreeNode tree;
+    uint32_t                  focusedId;
+    uint64_t                  version;
+    {
+      auto lock = impl.LockForRead(engine);
+      auto root = static_cast<uint32_t>(GetIntParam(req, "root", engine.GetRootId()));
+      version   = engine.GetSnapshotVersion();
+      tree      = engine.BuildSubtree(root, static_cast<int>(GetIntParam(req, "depth", -1)));
+      focusedId = engine.GetFocusedId();
+    }
+    SetStreamedJson(res, [tree = std::move(tree), focusedId, version](JsonWriter& json) {
+      json.BeginObject();
+      json.Key("focusedId").Number(focusedId);
+      json.Key("version").Number(version);
+      json.Key("tree");
+      WriteTreeNode(json, tree);
+      json.EndObject();
+    });
+  });
+
+  // GET /api/children/:id[?depth=<n>] — returns the children of an element,
+  // each with depth - 1 levels of its own children (default depth 1)
+  mImpl->server.Get(R"(/api/children/(\d+))", [&engine, &impl](const httplib::Request& req, httplib::Response& res) {
+    uint32_t id    = static_cast<uint32_t>(std::stoul(req.matches[1]));
+    long     depth = GetIntParam(req, "depth", 1);
+
+    InspectorEngine::TreeNode node;
+    {
+      auto lock = impl.LockForRead(engine);
+      node      = engine.BuildSubtree(id, depth < 1 ? 1 : static_cast<int>(depth));
+    }
+    SetStreamedJson(res, [node = std::move(node)](JsonWriter& json) {
+      json.BeginObject();
+      json.Key("id").Number(node.id);
+      json.Key("childCount").Number(node.childCount);
+      json.Key("children").BeginArray();
+      for(auto& child : node.children)
+      {
+        WriteTreeNode(json, child);
+      }
+      json.EndArray();
+      json.EndObject();
+    });
   });
 
   // GET /api/element/:id — returns element details
-  mImpl->server.Get(R"(/api/element/(\d+))", [&engine, &engineMutex](const httplib::Request& req, httplib::Response& res) {
-    uint32_t id = static_cast<uint32_t>(std::stoul(req.matches[1]));
-    std::lock_guard<std::mutex> lock(engineMutex);
-    auto info = engine.GetElementInfo(id);
+  mImpl->server.Get(R"(/api/element/(\d+))", [&engine, &impl](const httplib::Request& req, httplib::Response& res) {
+    uint32_t id   = static_cast<uint32_t>(std::stoul(req.matches[1]));
+    auto     lock = impl.LockForRead(engine);
+    auto     info = engine.GetElementInfo(id);
     res.set_content(ElementInfoToJson(info), "application/json");
   });
 
+  // GET /api/search?role=&name=&automationId=&states=&limit= — returns the
+  // elements matching every given filter, in id order
+  mImpl->server.Get("/api/search", [&engine, &impl](const httplib::Request& req, httplib::Response& res) {
+    auto query = GetSearchQuery(req);
+    auto begin = std::chrono::steady_clock::now();
+
+    InspectorEngine::SearchResult result;
+    bool                          supported;
+    {
+      auto lock = impl.LockForRead(engine);
+      supported = engine.Search(query, result);
+    }
+    if(!supported)
+    {
+      res.status = 501;
+      res.set_content("{\"error\":\"search is not supported by this engine\"}", "application/json");
+      return;
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+    SetStreamedJson(res, [result = std::move(result), elapsed](JsonWriter& json) {
+      json.BeginObject();
+      json.Key("version").Number(result.version);
+      json.Key("total").Number(result.total);
+      json.Key("elapsedUs").Number(elapsed.count());
+      json.Key("results").BeginArray();
+      for(auto& info : result.elements)
+      {
+        WriteElementInfo(json, info);
+      }
+      json.EndArray();
+      json.EndObject();
+    });
+  });
+
+  // GET /api/snapshot — downloads the current snapshot as a binary file
+  // that SnapshotFileQueryEngine can serve later
+  mImpl->server.Get("/api/snapshot", [&engine, &impl](const httplib::Request&, httplib::Response& res) {
+    std::string bytes;
+    uint64_t    version;
+    bool        supported;
+    {
+      auto lock = impl.LockForRead(engine);
+      supported = engine.SerializeSnapshot(bytes);
+      version   = engine.GetSnapshotVersion();
+    }
+    if(!supported)
+    {
+      res.status = 501;
+      res.set_content("{\"error\":\"snapshots are not supported by this engine\"}", "application/json");
+      return;
+    }
+    res.set_header("Content-Disposition", "attachment; filename=\"snapshot-" + std::to_string(version) + ".a11ysnap\"");
+    res.set_content(std::move(bytes), "application/octet-stream");
+  });
+
+  // GET /api/diff?since=<version> — returns the elements added, changed and
+  // removed since version, so a reconnecting client can catch up
+  mImpl->server.Get("/api/diff", [&engine, &impl](const httplib::Request& req, httplib::Response& res) {
+    InspectorEngine::SnapshotDiff diff;
+    {
+      auto lock = impl.LockForRead(engine);
+      if(!engine.GetDiff(static_cast<uint64_t>(GetIntParam(req, "since", 0)), diff))
+      {
+        diff.reset     = true;
+        diff.toVersion = engine.GetSnapshotVersion();
+        diff.rootId    = engine.GetRootId();
+      }
+    }
+    SetStreamedJson(res, [diff = std::move(diff)](JsonWriter& json) { WriteDiff(json, diff); });
+  });
+
+  // GET /api/events[?since=<version>] — Server-Sent Events stream with a
+  // "focus" event for every focus change and a "diff" event for every new
+  // snapshot version. Without since, diffs start from the current version.
+  // Past MAX_EVENT_STREAMS open streams the request is refused with 503.
+  mImpl->server.Get("/api/events", [&engine, &impl](const httplib::Request& req, httplib::Response& res) {
+    if(++impl.eventStreams > MAX_EVENT_STREAMS)
+    {
+      --impl.eventStreams;
+      res.status = 503;
+      res.set_header("Retry-After", "1");
+      res.set_content("{\"error\":\"too many event streams\"}", "application/json");
+      return;
+    }
+
+    struct StreamState
+    {
+      uint64_t                              version;
+      uint32_t                              focusedId;
+      bool                                  started{false};
+      std::chrono::steady_clock::time_point lastSent{std::chrono::steady_clock::now()};
+    };
+
+    auto state = std::make_shared<StreamState>();
+    {
+      auto lock        = impl.LockForRead(engine);
+      state->version   = static_cast<uint64_t>(GetIntParam(req, "since", static_cast<long>(engine.GetSnapshotVersion())));
+      state->focusedId = engine.GetFocusedId();
+    }
+
+    res.set_header("Cache-Control", "no-cache");
+    res.set_chunked_content_provider("text/event-stream", [&engine, &impl, state](size_t, httplib::DataSink& sink) {
+      auto send = [&](std::string_view event, const std::function<void(JsonWriter&)>& write) {
+        JsonWriter json;
+        json.Raw("event: ").Raw(event).Raw("\ndata: ");
+        write(json);
+        json.Raw("\n\n");
+        auto text       = json.Take();
+        state->lastSent = std::chrono::steady_clock::now();
+        return sink.write(text.data(), text.size());
+      };
+
+      if(!state->started)
+      {
+        // Tells the client which version the stream starts from
+        state->started = true;
+        if(!send("hello", [&](JsonWriter& json) {
+             json.BeginObject().Key("version").Number(state->version).Key("focusedId").Number(state->focusedId).EndObject();
+           }))
+        {
+          return false;
+        }
+      }
+
+      engine.WaitForChange(state->version, state->focusedId, Impl::EVENT_POLL_INTERVAL);
+      if(impl.stopping || !sink.is_writable())
+      {
+        sink.done();
+        return true;
+      }
+
+      InspectorEngine::SnapshotDiff diff;
+      uint32_t                      focusedId;
+      bool                          hasDiff = false;
+      {
+        auto lock = impl.LockForRead(engine);
+        focusedId = engine.GetFocusedId();
+        if(engine.GetSnapshotVersion() != state->version)
+        {
+          hasDiff = engine.GetDiff(state->version, diff);
+          if(!hasDiff)
+          {
+            diff.reset     = true;
+            diff.toVersion = engine.GetSnapshotVersion();
+            diff.rootId    = engine.GetRootId();
+            hasDiff        = true;
+          }
+        }
+      }
+
+      if(hasDiff)
+      {
+        state->version = diff.toVersion;
+        if(!send("diff", [&](JsonWriter& json) { WriteDiff(json, diff); })) return false;
+      }
+      if(focusedId != state->focusedId)
+      {
+        state->focusedId = focusedId;
+        if(!send("focus", [&](JsonWriter& json) { json.BeginObject().Key("focusedId").Number(focusedId).EndObject(); }))
+        {
+          return false;
+        }
+      }
+      if(std::chrono::steady_clock::now() - state->lastSent >= Impl::EVENT_KEEPALIVE_INTERVAL)
+      {
+        state->lastSent = std::chrono::steady_clock::now();
+        return sink.write(": keepalive\n\n", 13);
+      }
+      return true;
+    },
+    [&impl](bool) { --impl.eventStreams; });
+  });
+
   // POST /api/navigate — navigates in the given direction
-  mImpl->server.Post("/api/navigate", [&engine, &engineMutex](const httplib::Request& req, httplib::Response& res) {
+  mImpl->server.Post("/api/navigate", [&engine, &impl](const httplib::Request& req, httplib::Response& res) {
     // Parse direction from request body
     std::string direction;
     auto pos = req.body.find("\"direction\"");
@@ -184,7 +715,8 @@ void WebInspectorServer::Start(InspectorQueryInterface& engine, int port)
       }
     }
 
-    std::lock_guard<std::mutex> lock(engineMutex);
+    std::lock_guard<std::mutex> navigateLock(impl.navigateMutex);
+    auto                        lock = impl.LockForRead(engine);
 
     uint32_t currentId = engine.GetFocusedId();
     uint32_t newId     = currentId;
@@ -209,15 +741,20 @@ void WebInspectorServer::Start(InspectorQueryInterface& engine, int port)
     engine.SetFocusedId(newId);
     auto info = engine.GetElementInfo(newId);
 
-    std::string json = "{";
-    json += "\"focusedId\":" + std::to_string(newId);
-    json += ",\"changed\":" + std::string(newId != currentId ? "true" : "false");
-    json += ",\"element\":" + ElementInfoToJson(info);
-    json += "}";
-    res.set_content(json, "application/json");
+    JsonWriter json;
+    json.BeginObject();
+    json.Key("focusedId").Number(newId);
+    json.Key("changed").Bool(newId != currentId);
+    json.Key("element");
+    WriteElementInfo(json, info);
+    json.EndObject();
+    res.set_content(json.Take(), "application/json");
   });
 
-  mImpl->running = true;
+  mImpl->server.new_task_queue = [] { return new httplib::ThreadPool(Impl::WORKER_THREADS); };
+
+  mImpl->stopping = false;
+  mImpl->running  = true;
   mImpl->thread = std::thread([this, port]() {
     mImpl->server.listen("0.0.0.0", port);
   });
@@ -231,6 +768,7 @@ void WebInspectorServer::Start(DirectQueryEngine& engine, int port)
 void WebInspectorServer::Stop()
 {
   if(!mImpl->running) return;
+  mImpl->stopping = true;
   mImpl->server.stop();
   if(mImpl->thread.joinable())
   {
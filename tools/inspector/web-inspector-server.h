@@ -19,6 +19,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <cstddef>
 #include <memory>
 
 namespace InspectorEngine
@@ -32,10 +33,24 @@ class InspectorQueryInterface;
  * Uses PIMPL pattern to avoid leaking httplib.h into the header.
  * The server runs on a background thread and serves read-only access
  * to the DirectQueryEngine's snapshot.
+ *
+ * Requests are handled on a pool of threads. Engines that support
+ * concurrent reads (see InspectorQueryInterface::SupportsConcurrentReads)
+ * are read without a lock; others are serialized. The /api/tree body is
+ * serialized once per snapshot version and shared by all clients.
+ *
+ * Each open /api/events stream occupies a pool thread, so at most
+ * MAX_EVENT_STREAMS are served at once; further ones get 503 and the
+ * frontend falls back to polling /api/diff until a stream frees up.
  */
 class WebInspectorServer
 {
 public:
+  /**
+   * @brief Upper bound on concurrently open event streams.
+   */
+  static constexpr size_t MAX_EVENT_STREAMS = 24;
+
   WebInspectorServer();
   ~WebInspectorServer();
 
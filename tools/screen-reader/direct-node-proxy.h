@@ -94,6 +94,11 @@ public:
     return mAccessible ? mAccessible->GetAttributes() : Accessibility::Attributes{};
   }
 
+  bool getAttribute(Accessibility::AttributeKey key, std::string& value) override
+  {
+    return mAccessible && mAccessible->GetAttribute(key, value);
+  }
+
   std::vector<std::string> getInterfaces() override
   {
     return mAccessible ? mAccessible->GetInterfacesAsStrings() : std::vector<std::string>{};
@@ -232,10 +237,15 @@ public:
       info.name     = mAccessible->GetName();
       info.roleName = mAccessible->GetRoleName();
       info.states   = mAccessible->GetStates();
+      info.attributes = mAccessible->GetAttributes();
       auto ext      = mAccessible->GetExtents(Accessibility::CoordinateType::SCREEN);
       info.screenExtents = Accessibility::Rect<int>{
         static_cast<int>(ext.x), static_cast<int>(ext.y),
         static_cast<int>(ext.width), static_cast<int>(ext.height)};
+      auto windowExt = mAccessible->GetExtents(Accessibility::CoordinateType::WINDOW);
+      info.windowExtents = Accessibility::Rect<int>{
+        static_cast<int>(windowExt.x), static_cast<int>(windowExt.y),
+        static_cast<int>(windowExt.width), static_cast<int>(windowExt.height)};
     }
     return info;
   }
@@ -285,6 +295,11 @@ public:
     return mAccessible ? mAccessible->DoGesture(gesture) : false;
   }
 
+  bool isScrollable() override
+  {
+    return mAccessible ? mAccessible->IsScrollable() : false;
+  }
+
   // --- Action interface ---
 
   int32_t getActionCount() override
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdio>
+#include <espeak-ng/speak_lib.h>
+#include <functional>
+#include <memory>
+
+// INTERNAL INCLUDES
+#include <tools/screen-reader/espeak-synthesizer.h>
+
+namespace
+{
+/**
+ * @brief Destination of the samples of one espeak_Synth call.
+ */
+struct SynthTarget
+{
+  uint32_t                                                                 sampleRate{0};
+  Accessibility::PcmBuffer*                                                pcm{nullptr};     ///< synthesize(): append here
+  const std::function<bool(std::shared_ptr<const Accessibility::PcmBuffer>)>* onBlock{nullptr}; ///< synthesizeStream(): deliver here
+  bool                                                                     cancelled{false};
+};
+
+int OnSynthesized(short* wav, int numSamples, espeak_EVENT* events)
+{
+  // Every event of a call carries the user data passed to espeak_Synth
+  auto* target = static_cast<SynthTarget*>(events->user_data);
+  if(!target || !wav || numSamples <= 0)
+  {
+    return 0;
+  }
+
+  if(target->pcm)
+  {
+    target->pcm->samples.insert(target->pcm->samples.end(), wav, wav + numSamples);
+    return 0;
+  }
+
+  auto block        = std::make_shared<Accessibility::PcmBuffer>();
+  block->sampleRate = target->sampleRate;
+  block->samples.assign(wav, wav + numSamples);
+  if(!(*target->onBlock)(std::move(block)))
+  {
+    target->cancelled = true;
+    return 1; // Abort synthesis
+  }
+  return 0;
+}
+
+bool Synthesize(const std::string& text, SynthTarget& target)
+{
+  auto result = espeak_Synth(text.c_str(),
+                             text.size() + 1,
+                             0, // position
+                             POS_CHARACTER,
+                             0, // end position (0 = no end)
+                             espeakCHARS_UTF8,
+                             nullptr,
+                             &target);
+  return result == EE_OK;
+}
+
+} // namespace
+
+EspeakSynthesizer::EspeakSynthesizer()
+{
+  int result = espeak_Initialize(AUDIO_OUTPUT_SYNCHRONOUS, 0, nullptr, 0);
+  if(result == EE_INTERNAL_ERROR)
+  {
+    fprintf(stderr, "EspeakSynthesizer: espeak_Initialize failed\n");
+  }
+  else
+  {
+    mInitialized = true;
+    mSampleRate  = result;
+    espeak_SetSynthCallback(OnSynthesized);
+    espeak_SetParameter(espeakRATE, mRate, 0);
+  }
+}
+
+EspeakSynthesizer::~EspeakSynthesizer()
+{
+  if(mInitialized)
+  {
+    espeak_Terminate();
+  }
+}
+
+bool EspeakSynthesizer::setVoice(const std::string& name)
+{
+  if(!mInitialized || espeak_SetVoiceByName(name.c_str()) != EE_OK)
+  {
+    return false;
+  }
+  mVoice = name;
+  return true;
+}
+
+bool EspeakSynthesizer::setRate(int wordsPerMinute)
+{
+  if(!mInitialized || espeak_SetParameter(espeakRATE, wordsPerMinute, 0) != EE_OK)
+  {
+    return false;
+  }
+  mRate = wordsPerMinute;
+  return true;
+}
+
+std::string EspeakSynthesizer::getVoiceKey() const
+{
+  return mVoice + "@" + std::to_string(mRate);
+}
+
+bool EspeakSynthesizer::synthesize(const std::string& text, Accessibility::PcmBuffer& pcm)
+{
+  if(!mInitialized)
+  {
+    return false;
+  }
+
+  pcm.sampleRate = static_cast<uint32_t>(mSampleRate);
+  pcm.samples.clear();
+
+  SynthTarget target;
+  target.pcm = &pcm;
+  return Synthesize(text, target);
+}
+
+bool EspeakSynthesizer::synthesizeStream(const std::string& text, const std::function<bool(std::shared_ptr<const Accessibility::PcmBuffer>)>& onBlock)
+{
+  if(!mInitialized)
+  {
+    return false;
+  }
+
+  SynthTarget target;
+  target.sampleRate = static_cast<uint32_t>(mSampleRate);
+  target.onBlock    = &onBlock;
+  return Synthesize(text, target) && !target.cancelled;
+}
@@ -0,0 +1,64 @@
+#ifndef ACCESSIBILITY_TOOLS_SCREEN_READER_ESPEAK_SYNTHESIZER_H
+#define ACCESSIBILITY_TOOLS_SCREEN_READER_ESPEAK_SYNTHESIZER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <functional>
+#include <memory>
+#include <string>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/speech-synthesizer.h>
+
+/**
+ * @brief SpeechSynthesizer implementation using espeak-ng in retrieval mode.
+ *
+ * Initializes espeak-ng with AUDIO_OUTPUT_SYNCHRONOUS, so samples are
+ * delivered through the synth callback and espeak_Synth returns once the
+ * text is rendered. synthesizeStream() passes on each callback buffer as a
+ * block. espeak-ng keeps global state: create one instance per process.
+ */
+class EspeakSynthesizer : public Accessibility::SpeechSynthesizer
+{
+public:
+  EspeakSynthesizer();
+  ~EspeakSynthesizer() override;
+
+  /**
+   * @brief Selects an espeak-ng voice by name (e.g. "en-us").
+   */
+  bool setVoice(const std::string& name);
+
+  /**
+   * @brief Sets the speaking rate in words per minute.
+   */
+  bool setRate(int wordsPerMinute);
+
+  std::string getVoiceKey() const override;
+  bool        synthesize(const std::string& text, Accessibility::PcmBuffer& pcm) override;
+  bool        synthesizeStream(const std::string& text, const std::function<bool(std::shared_ptr<const Accessibility::PcmBuffer>)>& onBlock) override;
+
+private:
+  bool        mInitialized{false};
+  int         mSampleRate{0};
+  std::string mVoice{"default"};
+  int         mRate{175};
+};
+
+#endif // ACCESSIBILITY_TOOLS_SCREEN_READER_ESPEAK_SYNTHESIZER_H
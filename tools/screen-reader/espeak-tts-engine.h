@@ -18,40 +18,21 @@
  *
  */
 
-// EXTERNAL INCLUDES
-#include <functional>
-#include <string>
-
 // INTERNAL INCLUDES
-#include <accessibility/api/tts-engine.h>
+#include <accessibility/internal/service/screen-reader/async-tts-engine.h>
 
 /**
  * @brief TtsEngine implementation using espeak-ng.
  *
- * Uses AUDIO_OUTPUT_PLAYBACK mode for async audio output.
- * pause/resume are not supported by espeak-ng and return false.
+ * Text is rendered on a worker thread by EspeakSynthesizer and played by
+ * PcaudioAudioSink, so started/completed callbacks follow the actual audio
+ * and the next utterance is rendered while the current one plays.
+ * pause/resume hold playback in the sink.
  */
-class EspeakTtsEngine : public Accessibility::TtsEngine
+class EspeakTtsEngine : public Accessibility::AsyncTtsEngine
 {
 public:
   EspeakTtsEngine();
-  ~EspeakTtsEngine() override;
-
-  Accessibility::CommandId speak(const std::string& text, const Accessibility::SpeakOptions& options) override;
-  void stop() override;
-  bool pause() override;
-  bool resume() override;
-  bool isPaused() const override;
-  void purge(bool onlyDiscardable) override;
-  void onUtteranceStarted(std::function<void(Accessibility::CommandId)> callback) override;
-  void onUtteranceCompleted(std::function<void(Accessibility::CommandId)> callback) override;
-
-private:
-  Accessibility::CommandId                      mNextId{1};
-  Accessibility::CommandId                      mCurrentId{0};
-  bool                                          mInitialized{false};
-  std::function<void(Accessibility::CommandId)> mStartedCallback;
-  std::function<void(Accessibility::CommandId)> mCompletedCallback;
 };
 
 #endif // ACCESSIBILITY_TOOLS_SCREEN_READER_ESPEAK_TTS_ENGINE_H
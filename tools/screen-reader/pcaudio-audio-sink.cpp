@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdio>
+#include <pcaudiolib/audio.h>
+
+// INTERNAL INCLUDES
+#include <tools/screen-reader/pcaudio-audio-sink.h>
+
+PcaudioAudioSink::PcaudioAudioSink()
+: mAudio(create_audio_device_object(nullptr, "accessibility-screen-reader", "Screen reader speech"))
+{
+  if(!mAudio)
+  {
+    fprintf(stderr, "PcaudioAudioSink: no audio device\n");
+  }
+  mWorker = std::thread([this]() { run(); });
+}
+
+PcaudioAudioSink::~PcaudioAudioSink()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mQuit  = true;
+    mAbort = true;
+  }
+  mWakeUp.notify_all();
+  mWorker.join();
+
+  if(mAudio)
+  {
+    if(mOpenRate)
+    {
+      audio_object_close(mAudio);
+    }
+    audio_object_destroy(mAudio);
+  }
+}
+
+void PcaudioAudioSink::enqueue(Accessibility::CommandId id, std::shared_ptr<const Accessibility::PcmBuffer> segment, bool discardable, bool last)
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if(id <= mDropUpTo || (discardable && id <= mDropDiscardableUpTo))
+    {
+      return;
+    }
+    mQueue.push_back({id, std::move(segment), discardable, last});
+  }
+  mWakeUp.notify_all();
+}
+
+void PcaudioAudioSink::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    for(auto& segment : mQueue)
+    {
+      mDropUpTo = std::max(mDropUpTo, segment.id);
+    }
+    mDropUpTo = std::max(mDropUpTo, mPlayingId);
+    mQueue.clear();
+    mAbort = mPlayingId != 0;
+  }
+  mWakeUp.notify_all();
+}
+
+void PcaudioAudioSink::purge(bool onlyDiscardable)
+{
+  if(!onlyDiscardable)
+  {
+    stop();
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    for(auto& segment : mQueue)
+    {
+      if(segment.discardable)
+      {
+        mDropDiscardableUpTo = std::max(mDropDiscardableUpTo, segment.id);
+      }
+    }
+    mQueue.erase(std::remove_if(mQueue.begin(), mQueue.end(), [](const Segment& segment) { return segment.discardable; }), mQueue.end());
+    if(mPlayingId != 0 && mPlayingDiscardable)
+    {
+      mDropDiscardableUpTo = std::max(mDropDiscardableUpTo, mPlayingId);
+      mAbort               = true;
+    }
+  }
+  mWakeUp.notify_all();
+}
+
+bool PcaudioAudioSink::pause()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mPaused = true;
+  return true;
+}
+
+bool PcaudioAudioSink::resume()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mPaused = false;
+  }
+  mWakeUp.notify_all();
+  return true;
+}
+
+bool PcaudioAudioSink::isPaused() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mPaused;
+}
+
+void PcaudioAudioSink::onUtteranceStarted(std::function<void(Accessibility::CommandId)> callback)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mStartedCallback = std::move(callback);
+}
+
+void PcaudioAudioSink::onUtteranceCompleted(std::function<void(Accessibility::CommandId)> callback)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mCompletedCallback = std::move(callback);
+}
+
+bool PcaudioAudioSink::open(uint32_t sampleRate)
+{
+  if(!mAudio)
+  {
+    return false;
+  }
+  if(mOpenRate == sampleRate)
+  {
+    return true;
+  }
+  if(mOpenRate)
+  {
+    audio_object_close(mAudio);
+    mOpenRate = 0;
+  }
+
+  int error = audio_object_open(mAudio, AUDIO_OBJECT_FORMAT_S16LE, sampleRate, 1);
+  if(error != 0)
+  {
+    fprintf(stderr, "PcaudioAudioSink: %s\n", audio_object_strerror(mAudio, error));
+    return false;
+  }
+  mOpenRate = sampleRate;
+  return true;
+}
+
+bool PcaudioAudioSink::play(const Accessibility::PcmBuffer& pcm)
+{
+  if(!open(pcm.sampleRate))
+  {
+    return true;
+  }
+
+  const std::size_t chunk = std::max<std::size_t>(pcm.sampleRate / 50, 1);
+  for(std::size_t offset = 0; offset < pcm.samples.size(); offset += chunk)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mWakeUp.wait(lock, [this]() { return !mPaused || mAbort; });
+      if(mAbort)
+      {
+        return false;
+      }
+    }
+
+    auto count = std::min(chunk, pcm.samples.size() - offset);
+    audio_object_write(mAudio, pcm.samples.data() + offset, count * sizeof(int16_t));
+  }
+  return true;
+}
+
+void PcaudioAudioSink::run()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  while(true)
+  {
+    mWakeUp.wait(lock, [this]() { return mQuit || (!mPaused && !mQueue.empty()); });
+    if(mQuit)
+    {
+      break;
+    }
+
+    auto segment = std::move(mQueue.front());
+    mQueue.pop_front();
+    bool starting       = segment.id != mPlayingId;
+    mPlayingId          = segment.id;
+    mPlayingDiscardable = segment.discardable;
+    mAbort              = false;
+    auto started        = mStartedCallback;
+    auto completed      = mCompletedCallback;
+    lock.unlock();
+
+    if(starting && started)
+    {
+      started(segment.id);
+    }
+
+    bool finished = !segment.pcm || play(*segment.pcm);
+    if(!finished && mAudio && mOpenRate)
+    {
+      audio_object_flush(mAudio);
+    }
+    if(finished && segment.last)
+    {
+      // Draining stalls the device, so only wait for playout when nothing
+      // follows; back to back, completion is reported once the last sample
+      // is written and the next utterance plays without a gap
+      lock.lock();
+      bool idle = mQueue.empty();
+      lock.unlock();
+      if(idle && mAudio && mOpenRate)
+      {
+        audio_object_drain(mAudio);
+      }
+      if(completed)
+      {
+        completed(segment.id);
+      }
+    }
+
+    lock.lock();
+    if(!finished || segment.last)
+    {
+      mPlayingId = 0;
+    }
+  }
+}
@@ -0,0 +1,88 @@
+#ifndef ACCESSIBILITY_TOOLS_SCREEN_READER_PCAUDIO_AUDIO_SINK_H
+#define ACCESSIBILITY_TOOLS_SCREEN_READER_PCAUDIO_AUDIO_SINK_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// INTERNAL INCLUDES
+#include <accessibility/api/audio-sink.h>
+
+struct audio_object;
+
+/**
+ * @brief AudioSink implementation using pcaudiolib, the audio layer of espeak-ng.
+ *
+ * Segments are written from a worker thread in 20 ms chunks, so stop,
+ * purge and pause take effect within one chunk. An utterance is reported
+ * complete after the device drains only when no other segment is queued;
+ * otherwise it is reported as soon as its last chunk is written.
+ */
+class PcaudioAudioSink : public Accessibility::AudioSink
+{
+public:
+  PcaudioAudioSink();
+  ~PcaudioAudioSink() override;
+
+  void enqueue(Accessibility::CommandId id, std::shared_ptr<const Accessibility::PcmBuffer> segment, bool discardable, bool last) override;
+  void stop() override;
+  void purge(bool onlyDiscardable) override;
+  bool pause() override;
+  bool resume() override;
+  bool isPaused() const override;
+  void onUtteranceStarted(std::function<void(Accessibility::CommandId)> callback) override;
+  void onUtteranceCompleted(std::function<void(Accessibility::CommandId)> callback) override;
+
+private:
+  struct Segment
+  {
+    Accessibility::CommandId                         id;
+    std::shared_ptr<const Accessibility::PcmBuffer> pcm;
+    bool                                             discardable;
+    bool                                             last;
+  };
+
+  void run();
+  bool open(uint32_t sampleRate);
+  bool play(const Accessibility::PcmBuffer& pcm);
+
+  audio_object*                                 mAudio{nullptr};
+  uint32_t                                      mOpenRate{0};
+  std::deque<Segment>                           mQueue;
+  Accessibility::CommandId                      mPlayingId{0};
+  bool                                          mPlayingDiscardable{false};
+  Accessibility::CommandId                      mDropUpTo{0};            ///< Late segments of stopped utterances
+  Accessibility::CommandId                      mDropDiscardableUpTo{0}; ///< Late segments of purged discardable utterances
+  bool                                          mAbort{false};
+  bool                                          mPaused{false};
+  bool                                          mQuit{false};
+  std::function<void(Accessibility::CommandId)> mStartedCallback;
+  std::function<void(Accessibility::CommandId)> mCompletedCallback;
+  mutable std::mutex                            mMutex;
+  std::condition_variable                       mWakeUp;
+  std::thread                                   mWorker;
+};
+
+#endif // ACCESSIBILITY_TOOLS_SCREEN_READER_PCAUDIO_AUDIO_SINK_H
@@ -34,10 +34,10 @@
 #include <tools/screen-reader/direct-app-registry.h>
 #ifdef __APPLE__
 #include <tools/screen-reader/mac-tts-engine.h>
-using PlatformTtsEngine = MacTtsEngine;
 #else
-#include <tools/screen-reader/espeak-tts-engine.h>
-using PlatformTtsEngine = EspeakTtsEngine;
+#include <accessibility/internal/service/screen-reader/cached-tts-engine.h>
+#include <tools/screen-reader/espeak-synthesizer.h>
+#include <tools/screen-reader/pcaudio-audio-sink.h>
 #endif
 
 using namespace Dali;
@@ -45,6 +45,19 @@ using namespace Dali::Toolkit;
 
 namespace
 {
+/**
+ * @brief Creates the TTS engine; on Linux, espeak-ng phrases are cached as PCM.
+ */
+std::unique_ptr<::Accessibility::TtsEngine> CreatePlatformTtsEngine()
+{
+#ifdef __APPLE__
+  return std::make_unique<MacTtsEngine>();
+#else
+  return std::make_unique<::Accessibility::CachedTtsEngine>(std::make_unique<EspeakSynthesizer>(),
+                                                            std::make_unique<PcaudioAudioSink>());
+#endif
+}
+
 /**
  * @brief GestureProvider that allows keyboard events to inject gestures.
  *
@@ -218,7 +231,7 @@ public:
 
     auto registry   = std::make_unique<DirectAppRegistry>(rootAccessible);
     auto gesture    = std::make_unique<KeyboardGestureProvider>();
-    auto tts        = std::make_unique<PlatformTtsEngine>();
+    auto tts        = CreatePlatformTtsEngine();
     auto feedback   = std::make_unique<::Accessibility::StubFeedbackProvider>();
     auto settings   = std::make_unique<::Accessibility::StubSettingsProvider>();
     auto srSwitch   = std::make_unique<::Accessibility::StubScreenReaderSwitch>();
@@ -226,6 +239,9 @@ public:
 
     mGestureProvider = gesture.get();
 
+    // DirectNodeProxy calls into DALi controls, which must stay on the DALi
+    // thread; keyboard gestures arrive there too, so the default inline
+    // executor is the right one here
     mService = std::make_unique<::Accessibility::ScreenReaderService>(
       std::move(registry),
       std::move(gesture),